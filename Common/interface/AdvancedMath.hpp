@@ -515,6 +515,46 @@ inline BoxVisibility GetBoxVisibility(const ViewFrustum&  ViewFrustum,
     return (NumPlanesInside == TotalPlanes) ? BoxVisibility::FullyVisible : BoxVisibility::Intersecting;
 }
 
+/// Tests if the whole view frustum is outside one of the bounding box planes.
+
+/// This test helps to cull boxes that intersect the frustum planes, but are
+/// not visible (see GetBoxVisibility()).
+inline bool IsViewFrustumOutsideBoundBox(const ViewFrustumExt& ViewFrustumExt,
+                                         const BoundBox&       Box)
+{
+    // Test all frustum corners against every bound box plane
+    for (int iBoundBoxPlane = 0; iBoundBoxPlane < 6; ++iBoundBoxPlane)
+    {
+        // struct BoundBox
+        // {
+        //     float3 Min;
+        //     float3 Max;
+        // };
+        float CurrPlaneCoord = reinterpret_cast<const float*>(&Box)[iBoundBoxPlane];
+        // Bound box normal is one of the axis, so we just need to pick the right coordinate
+        int iCoordOrder = iBoundBoxPlane % 3; // 0, 1, 2, 0, 1, 2
+        // Since plane normal is directed along one of the axis, we only need to select
+        // if it is pointing in the positive (max planes) or negative (min planes) direction
+        float fSign              = (iBoundBoxPlane >= 3) ? +1.f : -1.f;
+        bool  bAllCornersOutside = true;
+        for (int iCorner = 0; iCorner < 8; iCorner++)
+        {
+            // Pick the frustum corner coordinate
+            float CurrCornerCoord = ViewFrustumExt.FrustumCorners[iCorner][iCoordOrder];
+            // Dot product is simply the coordinate difference multiplied by the sign
+            if (fSign * (CurrPlaneCoord - CurrCornerCoord) > 0)
+            {
+                bAllCornersOutside = false;
+                break;
+            }
+        }
+        if (bAllCornersOutside)
+            return true;
+    }
+
+    return false;
+}
+
 inline BoxVisibility GetBoxVisibility(const ViewFrustumExt& ViewFrustumExt,
                                       const BoundBox&       Box,
                                       FRUSTUM_PLANE_FLAGS   PlaneFlags = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM)
@@ -539,35 +579,8 @@ inline BoxVisibility GetBoxVisibility(const ViewFrustumExt& ViewFrustumExt,
         //               ' .   |
         //                   ' .
 
-        // Test all frustum corners against every bound box plane
-        for (int iBoundBoxPlane = 0; iBoundBoxPlane < 6; ++iBoundBoxPlane)
-        {
-            // struct BoundBox
-            // {
-            //     float3 Min;
-            //     float3 Max;
-            // };
-            float CurrPlaneCoord = reinterpret_cast<const float*>(&Box)[iBoundBoxPlane];
-            // Bound box normal is one of the axis, so we just need to pick the right coordinate
-            int iCoordOrder = iBoundBoxPlane % 3; // 0, 1, 2, 0, 1, 2
-            // Since plane normal is directed along one of the axis, we only need to select
-            // if it is pointing in the positive (max planes) or negative (min planes) direction
-            float fSign              = (iBoundBoxPlane >= 3) ? +1.f : -1.f;
-            bool  bAllCornersOutside = true;
-            for (int iCorner = 0; iCorner < 8; iCorner++)
-            {
-                // Pick the frustum corner coordinate
-                float CurrCornerCoord = ViewFrustumExt.FrustumCorners[iCorner][iCoordOrder];
-                // Dot product is simply the coordinate difference multiplied by the sign
-                if (fSign * (CurrPlaneCoord - CurrCornerCoord) > 0)
-                {
-                    bAllCornersOutside = false;
-                    break;
-                }
-            }
-            if (bAllCornersOutside)
-                return BoxVisibility::Invisible;
-        }
+        if (IsViewFrustumOutsideBoundBox(ViewFrustumExt, Box))
+            return BoxVisibility::Invisible;
     }
 
     return BoxVisibility::Intersecting;
@@ -629,6 +642,111 @@ inline BoxVisibility GetBoxVisibility(const ViewFrustumExt&      ViewFrustumExt,
     return BoxVisibility::Intersecting;
 }
 
+/// Structure-of-arrays storage of axis-aligned bounding boxes.
+
+/// Every box coordinate is stored in a separate array, which allows
+/// testing multiple boxes at once with SIMD instructions (see GetBoxVisibilityBatch()).
+struct BoundBoxArraySoA
+{
+    std::vector<float> MinX;
+    std::vector<float> MinY;
+    std::vector<float> MinZ;
+    std::vector<float> MaxX;
+    std::vector<float> MaxY;
+    std::vector<float> MaxZ;
+
+    size_t GetSize() const
+    {
+        return MinX.size();
+    }
+
+    void Reserve(size_t Size)
+    {
+        for (std::vector<float>* pArray : {&MinX, &MinY, &MinZ, &MaxX, &MaxY, &MaxZ})
+            pArray->reserve(Size);
+    }
+
+    void Resize(size_t Size)
+    {
+        for (std::vector<float>* pArray : {&MinX, &MinY, &MinZ, &MaxX, &MaxY, &MaxZ})
+            pArray->resize(Size);
+    }
+
+    void Clear()
+    {
+        for (std::vector<float>* pArray : {&MinX, &MinY, &MinZ, &MaxX, &MaxY, &MaxZ})
+            pArray->clear();
+    }
+
+    void Add(const BoundBox& Box)
+    {
+        MinX.push_back(Box.Min.x);
+        MinY.push_back(Box.Min.y);
+        MinZ.push_back(Box.Min.z);
+        MaxX.push_back(Box.Max.x);
+        MaxY.push_back(Box.Max.y);
+        MaxZ.push_back(Box.Max.z);
+    }
+
+    void Set(size_t Idx, const BoundBox& Box)
+    {
+        VERIFY_EXPR(Idx < GetSize());
+        MinX[Idx] = Box.Min.x;
+        MinY[Idx] = Box.Min.y;
+        MinZ[Idx] = Box.Min.z;
+        MaxX[Idx] = Box.Max.x;
+        MaxY[Idx] = Box.Max.y;
+        MaxZ[Idx] = Box.Max.z;
+    }
+
+    BoundBox Get(size_t Idx) const
+    {
+        VERIFY_EXPR(Idx < GetSize());
+        return BoundBox{
+            float3{MinX[Idx], MinY[Idx], MinZ[Idx]},
+            float3{MaxX[Idx], MaxY[Idx], MaxZ[Idx]},
+        };
+    }
+};
+
+struct IThreadPool;
+
+/// Tests the visibility of multiple axis-aligned bounding boxes.
+
+/// \param[in]  Frustum           - View frustum.
+/// \param[in]  Boxes             - Bounding boxes to test.
+/// \param[out] pVisibleMask      - Array of (Boxes.GetSize() + 31) / 32 elements that receives
+///                                 the visibility mask: bit (i % 32) of element i / 32 is set
+///                                 if box i is not BoxVisibility::Invisible.
+/// \param[out] pFullyVisibleMask - Optional array of the same size that receives the mask of
+///                                 boxes that are BoxVisibility::FullyVisible.
+/// \param[in]  PlaneFlags        - Frustum planes to test the boxes against.
+/// \param[in]  pThreadPool       - Optional thread pool. If not null, large arrays are split
+///                                 into chunks that are processed by the pool threads and the
+///                                 calling thread. The function returns when all boxes are processed.
+///
+/// \return     The number of visible boxes.
+///
+/// The results are identical to calling GetBoxVisibility() for every box. The function
+/// tests 8 boxes at a time if the CPU supports AVX2, and 4 boxes with SSE2 or NEON.
+Uint32 GetBoxVisibilityBatch(const ViewFrustum&      Frustum,
+                             const BoundBoxArraySoA& Boxes,
+                             Uint32*                 pVisibleMask,
+                             Uint32*                 pFullyVisibleMask = nullptr,
+                             FRUSTUM_PLANE_FLAGS     PlaneFlags        = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                             IThreadPool*            pThreadPool       = nullptr);
+
+/// Tests the visibility of multiple axis-aligned bounding boxes using the extended view frustum.
+
+/// Boxes that intersect the frustum planes are additionally tested with IsViewFrustumOutsideBoundBox()
+/// when all frustum planes are enabled. See the overload above for the description of parameters.
+Uint32 GetBoxVisibilityBatch(const ViewFrustumExt&   FrustumExt,
+                             const BoundBoxArraySoA& Boxes,
+                             Uint32*                 pVisibleMask,
+                             Uint32*                 pFullyVisibleMask = nullptr,
+                             FRUSTUM_PLANE_FLAGS     PlaneFlags        = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                             IThreadPool*            pThreadPool       = nullptr);
+
 inline float GetPointToBoxDistanceSqr(const BoundBox& BB, const float3& Pos)
 {
     VERIFY_EXPR(BB.Max.x >= BB.Min.x &&
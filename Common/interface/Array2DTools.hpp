@@ -1,5 +1,5 @@
 /*
- *  Copyright 2019-2022 Diligent Graphics LLC
+ *  Copyright 2019-2025 Diligent Graphics LLC
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -34,14 +34,53 @@
 namespace Diligent
 {
 
+/// SIMD implementation used by the 2D array processing functions
+enum ARRAY2D_SIMD_IMPL : Uint8
+{
+    /// Select the best implementation supported by the CPU at run time.
+    ARRAY2D_SIMD_IMPL_AUTO = 0,
+
+    /// Scalar implementation.
+    ARRAY2D_SIMD_IMPL_SCALAR,
+
+    /// SSE2 implementation.
+    ARRAY2D_SIMD_IMPL_SSE2,
+
+    /// AVX2 implementation.
+    ARRAY2D_SIMD_IMPL_AVX2,
+
+    /// NEON implementation.
+    ARRAY2D_SIMD_IMPL_NEON,
+
+    ARRAY2D_SIMD_IMPL_COUNT
+};
+
+/// Checks if the given SIMD implementation can be used on the current CPU.
+bool IsArray2DSIMDImplSupported(ARRAY2D_SIMD_IMPL Impl);
+
+/// Sets the SIMD implementation used by all 2D array processing functions.
+
+/// \param[in] Impl - SIMD implementation to use. ARRAY2D_SIMD_IMPL_AUTO selects
+///                   the best implementation supported by the CPU.
+///
+/// \return true if the implementation is supported and was selected, and false otherwise.
+///
+/// By default, the best implementation is selected automatically. This function
+/// is mostly intended for testing and benchmarking.
+bool SetArray2DSIMDImpl(ARRAY2D_SIMD_IMPL Impl);
+
+/// Returns the SIMD implementation currently used by the 2D array processing functions.
+ARRAY2D_SIMD_IMPL GetArray2DSIMDImpl();
+
+
 /// Computes the minimum and the maximum value in a 2D floating-point array
 
-/// \param[in]  pData		   - A pointer to the array data.
+/// \param[in]  pData          - A pointer to the array data.
 /// \param[in]  StrideInFloats - Row stride in 32-bit floats.
-/// \param[in]  Width		   - 2D array width.
-/// \param[in]  Height		   - 2D array height.
-/// \param[out] MinValue	   - Minimum value.
-/// \param[out] MaxValue	   - Maximum value.
+/// \param[in]  Width          - 2D array width.
+/// \param[in]  Height         - 2D array height.
+/// \param[out] MinValue       - Minimum value.
+/// \param[out] MaxValue       - Maximum value.
 void GetArray2DMinMaxValue(const float* pData,
                            size_t       StrideInFloats,
                            Uint32       Width,
@@ -49,4 +88,138 @@ void GetArray2DMinMaxValue(const float* pData,
                            float&       MinValue,
                            float&       MaxValue);
 
+
+/// Computes the sum of all elements of a 2D floating-point array
+
+/// \param[in]  pData          - A pointer to the array data.
+/// \param[in]  StrideInFloats - Row stride in 32-bit floats.
+/// \param[in]  Width          - 2D array width.
+/// \param[in]  Height         - 2D array height.
+///
+/// \return     The sum of all elements.
+///
+/// \note  The values are accumulated in double precision. Since SIMD implementations
+///        add the values in a different order, the results may slightly differ
+///        between implementations.
+double GetArray2DSum(const float* pData,
+                     size_t       StrideInFloats,
+                     Uint32       Width,
+                     Uint32       Height);
+
+
+/// Computes the mean value of a 2D floating-point array
+
+/// See GetArray2DSum() for the description of parameters.
+inline double GetArray2DMean(const float* pData,
+                             size_t       StrideInFloats,
+                             Uint32       Width,
+                             Uint32       Height)
+{
+    return (Width != 0 && Height != 0) ?
+        GetArray2DSum(pData, StrideInFloats, Width, Height) / (static_cast<double>(Width) * static_cast<double>(Height)) :
+        0.0;
+}
+
+
+/// Computes the histogram of a 2D floating-point array
+
+/// \param[in]  pData          - A pointer to the array data.
+/// \param[in]  StrideInFloats - Row stride in 32-bit floats.
+/// \param[in]  Width          - 2D array width.
+/// \param[in]  Height         - 2D array height.
+/// \param[in]  MinValue       - The value that corresponds to the start of the first bin.
+/// \param[in]  MaxValue       - The value that corresponds to the end of the last bin.
+/// \param[in]  NumBins        - The number of bins. Must not exceed 2^24.
+/// \param[out] pBins          - A pointer to the array of NumBins counters.
+///                              The counters are not reset before accumulating the histogram.
+///
+/// A value v is placed into the bin `(v - MinValue) * NumBins / (MaxValue - MinValue)`.
+/// Values outside of [MinValue, MaxValue] range are placed into the first or the last bin.
+/// NaNs are placed into the first bin.
+/// All implementations produce identical results.
+void ComputeArray2DHistogram(const float* pData,
+                             size_t       StrideInFloats,
+                             Uint32       Width,
+                             Uint32       Height,
+                             float        MinValue,
+                             float        MaxValue,
+                             Uint32       NumBins,
+                             Uint32*      pBins);
+
+
+/// Converts a 2D floating-point array to 8-bit unsigned normalized values
+
+/// \param[in]  pSrc              - A pointer to the source data.
+/// \param[in]  SrcStrideInFloats - Source row stride in 32-bit floats.
+/// \param[in]  Width             - 2D array width.
+/// \param[in]  Height            - 2D array height.
+/// \param[in]  Scale             - Scale to apply to the source values.
+/// \param[in]  Bias              - Bias to apply to the scaled source values.
+/// \param[out] pDst              - A pointer to the destination data.
+/// \param[in]  DstStride         - Destination row stride in elements.
+///
+/// Each value is converted as `round(saturate(Src * Scale + Bias) * 255)`.
+/// For instance, to map the [Min, Max] range to [0, 255], use
+/// `Scale = 1 / (Max - Min)` and `Bias = -Min / (Max - Min)`.
+void ConvertArray2DFloatToUnorm8(const float* pSrc,
+                                 size_t       SrcStrideInFloats,
+                                 Uint32       Width,
+                                 Uint32       Height,
+                                 float        Scale,
+                                 float        Bias,
+                                 Uint8*       pDst,
+                                 size_t       DstStride);
+
+
+/// Converts a 2D floating-point array to 16-bit unsigned normalized values
+
+/// This function is similar to ConvertArray2DFloatToUnorm8(), but
+/// each value is converted as `round(saturate(Src * Scale + Bias) * 65535)`.
+void ConvertArray2DFloatToUnorm16(const float* pSrc,
+                                  size_t       SrcStrideInFloats,
+                                  Uint32       Width,
+                                  Uint32       Height,
+                                  float        Scale,
+                                  float        Bias,
+                                  Uint16*      pDst,
+                                  size_t       DstStride);
+
+
+/// Converts a 2D array of 16-bit half-precision floats to 32-bit floats
+
+/// \param[in]  pSrc              - A pointer to the source data.
+/// \param[in]  SrcStride         - Source row stride in elements.
+/// \param[in]  Width             - 2D array width.
+/// \param[in]  Height            - 2D array height.
+/// \param[out] pDst              - A pointer to the destination data.
+/// \param[in]  DstStrideInFloats - Destination row stride in 32-bit floats.
+///
+/// The conversion is exact for all values, including denormals and infinities.
+void ConvertArray2DHalfToFloat(const Uint16* pSrc,
+                               size_t        SrcStride,
+                               Uint32        Width,
+                               Uint32        Height,
+                               float*        pDst,
+                               size_t        DstStrideInFloats);
+
+
+/// Downsamples a 2D floating-point array by a factor of two using a bilinear (2x2 box) filter
+
+/// \param[in]  pSrc              - A pointer to the source data.
+/// \param[in]  SrcStrideInFloats - Source row stride in 32-bit floats.
+/// \param[in]  SrcWidth          - Source array width.
+/// \param[in]  SrcHeight         - Source array height.
+/// \param[out] pDst              - A pointer to the destination data.
+/// \param[in]  DstStrideInFloats - Destination row stride in 32-bit floats.
+///
+/// The destination array size is `max(SrcWidth / 2, 1)` x `max(SrcHeight / 2, 1)`.
+/// If the source dimension is 1, the source row or column is repeated.
+/// All implementations produce identical results.
+void DownsampleArray2D(const float* pSrc,
+                       size_t       SrcStrideInFloats,
+                       Uint32       SrcWidth,
+                       Uint32       SrcHeight,
+                       float*       pDst,
+                       size_t       DstStrideInFloats);
+
 } // namespace Diligent
@@ -0,0 +1,264 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// SIMD implementations of the most frequently used BasicMath operations.
+///
+/// The functions operate on the regular BasicMath types (float4x4, float4, float3, QuaternionF)
+/// and produce the same results as the corresponding scalar operations up to the sign of zero
+/// and possible floating-point contraction performed by the compiler in the scalar code.
+/// SSE2 is used on x86/x64, NEON on ARM, and scalar code on other platforms. Batched functions
+/// additionally use AVX2 when it is supported by the CPU.
+
+#include "../../Platforms/interface/Intrinsics.hpp"
+
+#include "BasicMath.hpp"
+
+namespace Diligent
+{
+
+#if DILIGENT_SSE2_ENABLED
+
+namespace BasicMathSIMDInternal
+{
+
+inline __m128 MulRow(__m128 Row, const __m128 M[4])
+{
+    // Note: the order of operations must be the same as in the scalar code
+    __m128 Res = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(Row, Row, _MM_SHUFFLE(0, 0, 0, 0)), M[0]),
+                            _mm_mul_ps(_mm_shuffle_ps(Row, Row, _MM_SHUFFLE(1, 1, 1, 1)), M[1]));
+    Res        = _mm_add_ps(Res, _mm_mul_ps(_mm_shuffle_ps(Row, Row, _MM_SHUFFLE(2, 2, 2, 2)), M[2]));
+    return _mm_add_ps(Res, _mm_mul_ps(_mm_shuffle_ps(Row, Row, _MM_SHUFFLE(3, 3, 3, 3)), M[3]));
+}
+
+} // namespace BasicMathSIMDInternal
+
+#elif DILIGENT_NEON_ENABLED
+
+namespace BasicMathSIMDInternal
+{
+
+inline float32x4_t MulRow(float32x4_t Row, const float32x4_t M[4])
+{
+    // Note: vmlaq_f32 is not used to keep the order of operations the same as in the scalar code
+    float32x4_t Res = vaddq_f32(vmulq_n_f32(M[0], vgetq_lane_f32(Row, 0)), vmulq_n_f32(M[1], vgetq_lane_f32(Row, 1)));
+    Res             = vaddq_f32(Res, vmulq_n_f32(M[2], vgetq_lane_f32(Row, 2)));
+    return vaddq_f32(Res, vmulq_n_f32(M[3], vgetq_lane_f32(Row, 3)));
+}
+
+} // namespace BasicMathSIMDInternal
+
+#endif
+
+
+/// Computes the product of two matrices m1 * m2. Equivalent to float4x4::Mul(m1, m2).
+inline float4x4 MatrixMultiplySIMD(const float4x4& m1, const float4x4& m2)
+{
+#if DILIGENT_SSE2_ENABLED
+    const __m128 M2[4] = {
+        _mm_loadu_ps(m2.m[0]),
+        _mm_loadu_ps(m2.m[1]),
+        _mm_loadu_ps(m2.m[2]),
+        _mm_loadu_ps(m2.m[3]),
+    };
+
+    float4x4 Res;
+    for (int i = 0; i < 4; ++i)
+        _mm_storeu_ps(Res.m[i], BasicMathSIMDInternal::MulRow(_mm_loadu_ps(m1.m[i]), M2));
+    return Res;
+#elif DILIGENT_NEON_ENABLED
+    const float32x4_t M2[4] = {
+        vld1q_f32(m2.m[0]),
+        vld1q_f32(m2.m[1]),
+        vld1q_f32(m2.m[2]),
+        vld1q_f32(m2.m[3]),
+    };
+
+    float4x4 Res;
+    for (int i = 0; i < 4; ++i)
+        vst1q_f32(Res.m[i], BasicMathSIMDInternal::MulRow(vld1q_f32(m1.m[i]), M2));
+    return Res;
+#else
+    return float4x4::Mul(m1, m2);
+#endif
+}
+
+/// Returns the transposed matrix. Equivalent to float4x4::Transpose().
+inline float4x4 MatrixTransposeSIMD(const float4x4& m)
+{
+#if DILIGENT_SSE2_ENABLED
+    __m128 Row0 = _mm_loadu_ps(m.m[0]);
+    __m128 Row1 = _mm_loadu_ps(m.m[1]);
+    __m128 Row2 = _mm_loadu_ps(m.m[2]);
+    __m128 Row3 = _mm_loadu_ps(m.m[3]);
+    _MM_TRANSPOSE4_PS(Row0, Row1, Row2, Row3);
+
+    float4x4 Res;
+    _mm_storeu_ps(Res.m[0], Row0);
+    _mm_storeu_ps(Res.m[1], Row1);
+    _mm_storeu_ps(Res.m[2], Row2);
+    _mm_storeu_ps(Res.m[3], Row3);
+    return Res;
+#elif DILIGENT_NEON_ENABLED
+    // De-interleaving load returns matrix columns
+    const float32x4x4_t Columns = vld4q_f32(m.m[0]);
+
+    float4x4 Res;
+    vst1q_f32(Res.m[0], Columns.val[0]);
+    vst1q_f32(Res.m[1], Columns.val[1]);
+    vst1q_f32(Res.m[2], Columns.val[2]);
+    vst1q_f32(Res.m[3], Columns.val[3]);
+    return Res;
+#else
+    return m.Transpose();
+#endif
+}
+
+/// Returns the inverse matrix. Equivalent to float4x4::Inverse() up to rounding errors.
+///
+/// \note   SSE2 implementation uses the block-wise method and is several times faster
+///         than the scalar code. On other platforms, float4x4::Inverse() is used.
+float4x4 MatrixInverseSIMD(const float4x4& m);
+
+/// Transforms the vector by the matrix: v * m. Equivalent to float4::operator*(const float4x4&).
+inline float4 TransformVectorSIMD(const float4& v, const float4x4& m)
+{
+#if DILIGENT_SSE2_ENABLED
+    const __m128 M[4] = {
+        _mm_loadu_ps(m.m[0]),
+        _mm_loadu_ps(m.m[1]),
+        _mm_loadu_ps(m.m[2]),
+        _mm_loadu_ps(m.m[3]),
+    };
+
+    float4 Res;
+    _mm_storeu_ps(Res.Data(), BasicMathSIMDInternal::MulRow(_mm_loadu_ps(v.Data()), M));
+    return Res;
+#elif DILIGENT_NEON_ENABLED
+    const float32x4_t M[4] = {
+        vld1q_f32(m.m[0]),
+        vld1q_f32(m.m[1]),
+        vld1q_f32(m.m[2]),
+        vld1q_f32(m.m[3]),
+    };
+
+    float4 Res;
+    vst1q_f32(Res.Data(), BasicMathSIMDInternal::MulRow(vld1q_f32(v.Data()), M));
+    return Res;
+#else
+    return v * m;
+#endif
+}
+
+/// Computes the product of two quaternions q1 * q2. Equivalent to QuaternionF::Mul(q1, q2).
+inline QuaternionF QuaternionMultiplySIMD(const QuaternionF& q1, const QuaternionF& q2)
+{
+    //  x = +q1.x * q2.w + q1.y * q2.z - q1.z * q2.y + q1.w * q2.x
+    //  y = -q1.x * q2.z + q1.y * q2.w + q1.z * q2.x + q1.w * q2.y
+    //  z = +q1.x * q2.y - q1.y * q2.x + q1.z * q2.w + q1.w * q2.z
+    //  w = -q1.x * q2.x - q1.y * q2.y - q1.z * q2.z + q1.w * q2.w
+#if DILIGENT_SSE2_ENABLED
+    const __m128 Q1 = _mm_loadu_ps(q1.q.Data());
+    const __m128 Q2 = _mm_loadu_ps(q2.q.Data());
+
+    const __m128 SignPNPN = _mm_setr_ps(+0.f, -0.f, +0.f, -0.f);
+    const __m128 SignPPNN = _mm_setr_ps(+0.f, +0.f, -0.f, -0.f);
+    const __m128 SignNPPN = _mm_setr_ps(-0.f, +0.f, +0.f, -0.f);
+
+    const __m128 X = _mm_xor_ps(_mm_shuffle_ps(Q2, Q2, _MM_SHUFFLE(0, 1, 2, 3)), SignPNPN); // (+w, -z, +y, -x)
+    const __m128 Y = _mm_xor_ps(_mm_shuffle_ps(Q2, Q2, _MM_SHUFFLE(1, 0, 3, 2)), SignPPNN); // (+z, +w, -x, -y)
+    const __m128 Z = _mm_xor_ps(_mm_shuffle_ps(Q2, Q2, _MM_SHUFFLE(2, 3, 0, 1)), SignNPPN); // (-y, +x, +w, -z)
+
+    __m128 Res = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(Q1, Q1, _MM_SHUFFLE(0, 0, 0, 0)), X),
+                            _mm_mul_ps(_mm_shuffle_ps(Q1, Q1, _MM_SHUFFLE(1, 1, 1, 1)), Y));
+    Res        = _mm_add_ps(Res, _mm_mul_ps(_mm_shuffle_ps(Q1, Q1, _MM_SHUFFLE(2, 2, 2, 2)), Z));
+    Res        = _mm_add_ps(Res, _mm_mul_ps(_mm_shuffle_ps(Q1, Q1, _MM_SHUFFLE(3, 3, 3, 3)), Q2));
+
+    QuaternionF q1_q2;
+    _mm_storeu_ps(q1_q2.q.Data(), Res);
+    return q1_q2;
+#elif DILIGENT_NEON_ENABLED
+    const float32x4_t Q1 = vld1q_f32(q1.q.Data());
+    const float32x4_t Q2 = vld1q_f32(q2.q.Data());
+
+    const float SignPNPN[] = {+1, -1, +1, -1};
+    const float SignPPNN[] = {+1, +1, -1, -1};
+    const float SignNPPN[] = {-1, +1, +1, -1};
+
+    const float32x4_t Q2_wzyx = vrev64q_f32(vextq_f32(Q2, Q2, 2));
+    const float32x4_t Q2_zwxy = vextq_f32(Q2, Q2, 2);
+    const float32x4_t Q2_yxwz = vrev64q_f32(Q2);
+
+    const float32x4_t X = vmulq_f32(Q2_wzyx, vld1q_f32(SignPNPN));
+    const float32x4_t Y = vmulq_f32(Q2_zwxy, vld1q_f32(SignPPNN));
+    const float32x4_t Z = vmulq_f32(Q2_yxwz, vld1q_f32(SignNPPN));
+
+    float32x4_t Res = vaddq_f32(vmulq_n_f32(X, vgetq_lane_f32(Q1, 0)), vmulq_n_f32(Y, vgetq_lane_f32(Q1, 1)));
+    Res             = vaddq_f32(Res, vmulq_n_f32(Z, vgetq_lane_f32(Q1, 2)));
+    Res             = vaddq_f32(Res, vmulq_n_f32(Q2, vgetq_lane_f32(Q1, 3)));
+
+    QuaternionF q1_q2;
+    vst1q_f32(q1_q2.q.Data(), Res);
+    return q1_q2;
+#else
+    return QuaternionF::Mul(q1, q2);
+#endif
+}
+
+
+/// Transforms an array of points by the matrix.
+
+/// \param[in]  pSrc   - Source points.
+/// \param[in]  Count  - The number of points.
+/// \param[in]  Matrix - Transform matrix.
+/// \param[out] pDst   - Destination points. May be the same as pSrc.
+///
+/// Every point is transformed as float4{p, 1} * Matrix. The fourth column of the matrix
+/// is ignored and no perspective division is performed, i.e. the matrix is treated as
+/// an affine transform.
+void TransformPoints(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst);
+
+/// Transforms an array of vectors by the matrix: pDst[i] = pSrc[i] * Matrix.
+
+/// \param[in]  pSrc   - Source vectors.
+/// \param[in]  Count  - The number of vectors.
+/// \param[in]  Matrix - Transform matrix.
+/// \param[out] pDst   - Destination vectors. May be the same as pSrc.
+void TransformVectors(const float4* pSrc, size_t Count, const float4x4& Matrix, float4* pDst);
+
+/// Multiplies an array of matrices by the matrix: pDst[i] = pSrc[i] * Matrix.
+
+/// \param[in]  pSrc   - Source matrices.
+/// \param[in]  Count  - The number of matrices.
+/// \param[in]  Matrix - The matrix to multiply the source matrices by.
+/// \param[out] pDst   - Destination matrices. May be the same as pSrc.
+///
+/// A typical use case is transforming local node matrices into the parent space.
+void MultiplyMatrixArray(const float4x4* pSrc, size_t Count, const float4x4& Matrix, float4x4* pDst);
+
+} // namespace Diligent
@@ -41,7 +41,13 @@
 namespace Diligent
 {
 
-/// Base interface for a data blob
+/// Data blob implementation.
+
+/// The blob object and its payload are co-allocated in a single memory block.
+/// Blocks created with the default raw memory allocator come from a size-class
+/// pool and are recycled when the blob is destroyed. When the blob is resized
+/// past the capacity of its block, the data is moved to a buffer from the same
+/// pool, or to a vector if the size exceeds the largest size class.
 class DataBlobImpl final : public ObjectBase<IDataBlob>
 {
 public:
@@ -69,6 +75,15 @@ public:
     /// Returns const pointer to the internal data buffer
     virtual const void* DILIGENT_CALL_TYPE GetConstDataPtr(size_t Offset = 0) const override;
 
+    /// Returns true if the data is stored in the same memory block as the blob object
+    bool IsInline() const { return m_pData == GetInlineData(); }
+
+    /// Returns the payload capacity of the blob's memory block
+    size_t GetInlineCapacity() const { return m_InlineCapacity; }
+
+    /// Releases the memory blocks cached by the blob pool
+    static void ReleasePooledMemory();
+
     template <typename T>
     T* GetDataPtr(size_t Offset = 0)
     {
@@ -85,15 +100,33 @@ private:
     template <typename AllocatorType, typename ObjectType>
     friend class MakeNewRCObj;
 
+    class MemoryBlock;
+
     DataBlobImpl(IReferenceCounters* pRefCounters,
                  IMemoryAllocator&   Allocator,
-                 size_t              InitialSize = 0,
-                 const void*         pData       = nullptr);
+                 size_t              InlineCapacity,
+                 size_t              InitialSize,
+                 const void*         pData);
 
     DataBlobImpl(IReferenceCounters* pRefCounters,
+                 size_t              InlineCapacity,
                  DataBufferType&&    DataBuff) noexcept;
 
+    Uint8*       GetInlineData();
+    const Uint8* GetInlineData() const;
+
 private:
+    Uint8*       m_pData = nullptr;
+    size_t       m_Size  = 0;
+    const size_t m_InlineCapacity;
+
+    // Size class of the pooled buffer that holds the data, if any
+    Uint32 m_PoolBufferSizeClass = ~Uint32{0};
+
+    // Whether pooled buffers may be used when the data does not fit into the memory block
+    const bool m_UsePool;
+
+    // Used when the data does not fit into the memory block and no pooled buffer is available
     DataBufferType m_DataBuff;
 };
 
@@ -38,11 +38,17 @@
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 #include "CompilerDefinitions.h"
 #include "Align.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
 
 namespace Diligent
 {
 
 /// Implementation of a linear allocator on fixed memory pages
+
+/// The allocator works as a bump-pointer arena: allocations are only made from the
+/// current block. When the current block is exhausted, the allocator moves to the next
+/// retired block or allocates a new one. Discard() and Rollback() retire blocks
+/// without releasing them, so that they can be reused by subsequent allocations.
 class DynamicLinearAllocator
 {
 public:
@@ -72,16 +78,17 @@ public:
             m_pAllocator->Free(block.Data);
         }
         m_Blocks.clear();
+        m_CurrBlock = 0;
 
         m_pAllocator = nullptr;
     }
 
+    /// Retires all blocks. The memory is kept and reused by subsequent allocations.
     void Discard()
     {
-        for (Block& block : m_Blocks)
-        {
-            block.CurrPtr = block.Data;
-        }
+        m_CurrBlock = 0;
+        if (!m_Blocks.empty())
+            m_Blocks[0].CurrPtr = m_Blocks[0].Data;
     }
 
     NODISCARD void* Allocate(size_t size, size_t align)
@@ -89,9 +96,10 @@ public:
         if (size == 0)
             return nullptr;
 
-        for (Block& block : m_Blocks)
+        if (m_CurrBlock < m_Blocks.size())
         {
-            uint8_t* Ptr = AlignUp(block.CurrPtr, align);
+            Block&   block = m_Blocks[m_CurrBlock];
+            uint8_t* Ptr   = AlignUp(block.CurrPtr, align);
             if (Ptr + size <= block.Data + block.Size)
             {
                 block.CurrPtr = Ptr + size;
@@ -99,17 +107,7 @@ public:
             }
         }
 
-        // Create a new block
-        size_t BlockSize = m_BlockSize;
-        while (BlockSize < size + align - 1)
-            BlockSize *= 2;
-        m_Blocks.emplace_back(m_pAllocator->Allocate(BlockSize, "dynamic linear allocator page", __FILE__, __LINE__), BlockSize);
-
-        Block&   block = m_Blocks.back();
-        uint8_t* Ptr   = AlignUp(block.Data, align);
-        VERIFY(Ptr + size <= block.Data + block.Size, "Not enough space in the new block - this is a bug");
-        block.CurrPtr = Ptr + size;
-        return Ptr;
+        return AllocateInNextBlock(size, align);
     }
 
     template <typename T>
@@ -198,6 +196,76 @@ public:
         return m_Blocks.size();
     }
 
+    /// Allocation state that the allocator can be rolled back to.
+    struct Marker
+    {
+        size_t   BlockIdx = 0;
+        uint8_t* CurrPtr  = nullptr;
+    };
+
+    Marker GetMarker() const
+    {
+        return m_CurrBlock < m_Blocks.size() ?
+            Marker{m_CurrBlock, m_Blocks[m_CurrBlock].CurrPtr} :
+            Marker{m_CurrBlock, nullptr};
+    }
+
+    /// Releases all allocations made after the marker was taken.
+    /// Blocks that were used after the marker are retired and reused by subsequent allocations.
+    void Rollback(const Marker& M)
+    {
+        VERIFY(M.BlockIdx <= m_CurrBlock, "The marker is ahead of the current allocation state. "
+                                          "Markers must be rolled back in reverse order and may not be used after Discard().");
+        if (M.CurrPtr == nullptr)
+        {
+            // The marker was taken before the first block was allocated
+            VERIFY_EXPR(M.BlockIdx == 0);
+            Discard();
+            return;
+        }
+
+        VERIFY_EXPR(M.BlockIdx < m_Blocks.size());
+        Block& block = m_Blocks[M.BlockIdx];
+        VERIFY(M.CurrPtr >= block.Data && M.CurrPtr <= block.Data + block.Size, "The marker does not belong to this allocator");
+        VERIFY(M.BlockIdx < m_CurrBlock || M.CurrPtr <= block.CurrPtr, "The marker is ahead of the current allocation state");
+        block.CurrPtr = M.CurrPtr;
+        m_CurrBlock   = M.BlockIdx;
+    }
+
+    /// Rolls the allocator back to the state it had at construction when the object goes out of scope.
+    class ScopedMarker
+    {
+    public:
+        explicit ScopedMarker(DynamicLinearAllocator& Allocator) :
+            m_Allocator{Allocator},
+            m_Marker{Allocator.GetMarker()}
+        {}
+
+        ~ScopedMarker()
+        {
+            m_Allocator.Rollback(m_Marker);
+        }
+
+        // clang-format off
+        ScopedMarker           (const ScopedMarker&) = delete;
+        ScopedMarker           (ScopedMarker&&)      = delete;
+        ScopedMarker& operator=(const ScopedMarker&) = delete;
+        ScopedMarker& operator=(ScopedMarker&&)      = delete;
+        // clang-format on
+
+    private:
+        DynamicLinearAllocator& m_Allocator;
+        const Marker            m_Marker;
+    };
+
+    /// Returns the arena of the calling thread that is meant for short-lived per-frame allocations.
+    /// The owner of the thread is responsible for calling Discard() at the end of every frame.
+    static DynamicLinearAllocator& GetThreadFrameArena()
+    {
+        static thread_local DynamicLinearAllocator FrameArena{DefaultRawMemoryAllocator::GetAllocator(), 64 << 10};
+        return FrameArena;
+    }
+
     template <typename HandlerType>
     void ProcessBlocks(HandlerType&& Handler) const
     {
@@ -206,19 +274,60 @@ public:
     }
 
 private:
+    NODISCARD void* AllocateInNextBlock(size_t size, size_t align)
+    {
+        const size_t FirstRetiredBlock = m_Blocks.empty() ? 0 : m_CurrBlock + 1;
+
+        // Blocks past the current one are retired: look for one that is large enough.
+        // This is typically the first one, so the search only continues for oversized allocations.
+        for (size_t i = FirstRetiredBlock; i < m_Blocks.size(); ++i)
+        {
+            Block&   block = m_Blocks[i];
+            uint8_t* Ptr   = AlignUp(block.Data, align);
+            if (Ptr + size <= block.Data + block.Size)
+            {
+                if (i != FirstRetiredBlock)
+                    std::swap(block, m_Blocks[FirstRetiredBlock]);
+                m_CurrBlock = FirstRetiredBlock;
+
+                Block& curr_block  = m_Blocks[m_CurrBlock];
+                curr_block.CurrPtr = Ptr + size;
+                return Ptr;
+            }
+        }
+
+        // Create a new block
+        size_t BlockSize = m_BlockSize;
+        while (BlockSize < size + align - 1)
+            BlockSize *= 2;
+        m_Blocks.emplace_back(m_pAllocator->Allocate(BlockSize, "dynamic linear allocator page", __FILE__, __LINE__), BlockSize);
+        // Keep the retired blocks after the current one
+        if (FirstRetiredBlock != m_Blocks.size() - 1)
+            std::swap(m_Blocks[FirstRetiredBlock], m_Blocks.back());
+        m_CurrBlock = FirstRetiredBlock;
+
+        Block&   block = m_Blocks[m_CurrBlock];
+        uint8_t* Ptr   = AlignUp(block.Data, align);
+        VERIFY(Ptr + size <= block.Data + block.Size, "Not enough space in the new block - this is a bug");
+        block.CurrPtr = Ptr + size;
+        return Ptr;
+    }
+
     struct Block
     {
-        uint8_t* const Data    = nullptr;
-        size_t const   Size    = 0;
-        uint8_t*       CurrPtr = nullptr;
+        uint8_t* Data    = nullptr;
+        size_t   Size    = 0;
+        uint8_t* CurrPtr = nullptr;
 
         Block(void* _Data, size_t _Size) :
             Data{static_cast<uint8_t*>(_Data)}, Size{_Size}, CurrPtr{Data} {}
     };
 
     std::vector<Block> m_Blocks;
-    const Uint32       m_BlockSize  = 4 << 10;
-    IMemoryAllocator*  m_pAllocator = nullptr;
+    // Index of the block allocations are made from. Blocks past this one are retired.
+    size_t            m_CurrBlock  = 0;
+    const Uint32      m_BlockSize  = 4 << 10;
+    IMemoryAllocator* m_pAllocator = nullptr;
 };
 
 } // namespace Diligent
@@ -72,6 +72,14 @@ private:
 
     void CreateNewPage();
 
+    // Adds the page to the head of the available page list
+    void PushAvailablePage(size_t PageId);
+
+    // Returns the id of the page that contains the block, or InvalidPageId
+    size_t FindPage(const void* Ptr) const;
+
+    static constexpr size_t InvalidPageId = ~size_t{0};
+
     // Memory page class is based on the fixed-size memory pool described in "Fast Efficient Fixed-Size Memory Pool"
     // by Ben Kenwright
     class MemoryPage
@@ -89,33 +97,52 @@ private:
 
         void* GetBlockStartAddress(Uint32 BlockIndex) const;
 
+        const void* GetPageStart() const { return m_pPageStart; }
+
 #ifdef DILIGENT_DEBUG
         void dbgVerifyAddress(const void* pBlockAddr) const;
 #endif
 
         void* Allocate();
-        void  DeAllocate(void* p);
+        // Returns false if the block is not allocated, e.g. when it is freed twice
+        bool DeAllocate(void* p);
 
         bool HasSpace() const { return m_NumFreeBlocks > 0; }
         bool HasAllocations() const { return m_NumFreeBlocks < m_NumInitializedBlocks; }
 
+        // Link in the intrusive list of the pages that have free blocks (see m_FirstAvailablePage).
+        // The list is managed by the allocator.
+        size_t m_NextAvailablePage = InvalidPageId;
+        bool   m_IsAvailable       = false;
+
     private:
         MemoryPage(const MemoryPage&) = delete;
         MemoryPage& operator=(const MemoryPage) = delete;
         MemoryPage& operator=(MemoryPage&&) = delete;
 
+        static constexpr Uint32 BitsPerWord = sizeof(size_t) * 8;
+
+        Uint32 GetBlockIndex(const void* pBlockAddr) const;
+
         Uint32                     m_NumFreeBlocks        = 0;       // Num of remaining blocks
         Uint32                     m_NumInitializedBlocks = 0;       // Num of initialized blocks
         void*                      m_pPageStart           = nullptr; // Beginning of memory pool
         void*                      m_pNextFreeBlock       = nullptr; // Num of next free block
+        size_t*                    m_pAllocatedBits       = nullptr; // One bit per block, stored after the blocks
         FixedBlockMemoryAllocator* m_pOwnerAllocator      = nullptr;
     };
 
-    std::vector<MemoryPage, STDAllocatorRawMem<MemoryPage>>                                          m_PagePool;
-    std::unordered_set<size_t, std::hash<size_t>, std::equal_to<size_t>, STDAllocatorRawMem<size_t>> m_AvailablePages;
+    std::vector<MemoryPage, STDAllocatorRawMem<MemoryPage>> m_PagePool;
+
+    // Head of the singly-linked list of the pages that have free blocks. The links are stored
+    // in the pages, so adding a page to the list or removing it never touches the heap.
+    size_t m_FirstAvailablePage = InvalidPageId;
 
-    using AddrToPageIdMapElem = std::pair<void* const, size_t>;
-    std::unordered_map<void*, size_t, std::hash<void*>, std::equal_to<void*>, STDAllocatorRawMem<AddrToPageIdMapElem>> m_AddrToPageId;
+    // Page start addresses sorted in ascending order, and the corresponding page ids.
+    // The owning page of a block is found by binary search instead of a per-block
+    // address map. Pages are never released, so the list only grows in CreateNewPage().
+    using PageStartElem = std::pair<const void*, size_t>;
+    std::vector<PageStartElem, STDAllocatorRawMem<PageStartElem>> m_SortedPageStarts;
 
     std::mutex m_Mutex;
 
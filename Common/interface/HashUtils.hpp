@@ -246,6 +246,22 @@ public:
         }
     }
 
+    /// Hash of a string computed by CStringHash<Char>
+    struct PrecomputedHash
+    {
+        size_t Value = 0;
+    };
+
+    // Creates a key that references the string without copying it and without
+    // computing the hash, e.g. for an interned string.
+    HashMapStringKey(const Char* _Str, PrecomputedHash Hash) noexcept :
+        Str{_Str},
+        Ownership_Hash{Hash.Value & HashMask}
+    {
+        VERIFY(Str, "String pointer must not be null");
+        VERIFY((CStringHash<Char>{}.operator()(Str) & HashMask) == Ownership_Hash, "Precomputed hash does not match the string");
+    }
+
     // Make this constructor explicit to avoid unintentional string copies
     explicit HashMapStringKey(const String& Str, bool bMakeCopy = true) :
         HashMapStringKey{Str.c_str(), bMakeCopy}
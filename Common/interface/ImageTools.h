@@ -30,6 +30,7 @@
 /// Image processing tools
 
 #include "../../Primitives/interface/BasicTypes.h"
+#include "ThreadPool.h"
 
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
@@ -100,6 +101,13 @@ struct ComputeImageDifferenceAttribs
 
     /// Scale factor for the difference image
     float Scale DEFAULT_INITIALIZER(1.f);
+
+    /// An optional thread pool to use for row-parallel processing.
+    ///
+    /// If null, the difference is computed on the calling thread.
+    /// The calling thread always participates in the work, so the function
+    /// does not rely on the pool having any worker threads.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
 };
 typedef struct ComputeImageDifferenceAttribs ComputeImageDifferenceAttribs;
 
@@ -115,6 +123,11 @@ typedef struct ComputeImageDifferenceAttribs ComputeImageDifferenceAttribs;
 /// The root mean square difference is calculated as the square root of
 /// the average of the squares of all differences, not counting pixels that
 /// are equal.
+///
+/// When possible, the function uses SIMD (AVX2 or NEON) code paths and processes
+/// the rows in parallel using the thread pool specified by Attribs.pThreadPool.
+/// The results are bit-identical regardless of the code path and the number of
+/// threads used.
 void DILIGENT_GLOBAL_FUNCTION(ComputeImageDifference)(const ComputeImageDifferenceAttribs REF Attribs, ImageDiffInfo REF ImageDiff);
 
 
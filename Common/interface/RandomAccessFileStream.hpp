@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the RandomAccessFileStream class
+
+#include <memory>
+
+#include "../../Primitives/interface/RandomAccessFileStream.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Read-only file stream that implements the IRandomAccessFileStream interface.
+
+/// On Linux, random-access reads use pread(), mapped data blobs use mmap() with madvise()
+/// hints, and asynchronous reads are performed through io_uring or a worker-thread fallback.
+/// On other platforms, all operations are emulated with blocking reads.
+class RandomAccessFileStream final : public ObjectBase<IRandomAccessFileStream>
+{
+public:
+    typedef ObjectBase<IRandomAccessFileStream> TBase;
+
+    static RefCntAutoPtr<RandomAccessFileStream> Create(const Char* Path);
+
+    RandomAccessFileStream(IReferenceCounters* pRefCounters,
+                           const Char*         Path);
+    ~RandomAccessFileStream();
+
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_RandomAccessFileStream, IID_FileStream, TBase)
+
+    /// Reads data from the stream
+    virtual void DILIGENT_CALL_TYPE ReadBlob(IDataBlob* pData) override final;
+
+    /// Reads data from the stream
+    virtual bool DILIGENT_CALL_TYPE Read(void* Data, size_t Size) override final;
+
+    /// Writing is not supported by the stream
+    virtual bool DILIGENT_CALL_TYPE Write(const void* Data, size_t Size) override final;
+
+    virtual size_t DILIGENT_CALL_TYPE GetSize() override final;
+
+    virtual size_t DILIGENT_CALL_TYPE GetPos() override final;
+
+    virtual bool DILIGENT_CALL_TYPE SetPos(size_t Offset, int Origin) override final;
+
+    virtual bool DILIGENT_CALL_TYPE IsValid() override final;
+
+    /// Implementation of IRandomAccessFileStream::ReadAt().
+    virtual bool DILIGENT_CALL_TYPE ReadAt(size_t Offset, void* pData, size_t Size) override final;
+
+    /// Implementation of IRandomAccessFileStream::MapData().
+    virtual bool DILIGENT_CALL_TYPE MapData(size_t           Offset,
+                                            size_t           Size,
+                                            FILE_ACCESS_HINT Hint,
+                                            IDataBlob**      ppData) override final;
+
+    /// Implementation of IRandomAccessFileStream::EnqueueReads().
+    virtual void DILIGENT_CALL_TYPE EnqueueReads(const FileReadRequest* pRequests,
+                                                 Uint32                 NumRequests) override final;
+
+    /// Implementation of IRandomAccessFileStream::WaitForReads().
+    virtual bool DILIGENT_CALL_TYPE WaitForReads() override final;
+
+private:
+    // Platform-specific implementation
+    struct Impl;
+    std::unique_ptr<Impl> m_pImpl;
+
+    size_t m_Pos = 0;
+};
+
+} // namespace Diligent
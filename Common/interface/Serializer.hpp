@@ -30,9 +30,11 @@
 #include <array>
 #include <cstring>
 #include <atomic>
+#include <vector>
 
 #include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/MemoryAllocator.h"
+#include "../../Primitives/interface/FileStream.h"
 #include "../../Primitives/interface/CheckBaseStructAlignment.hpp"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 #include "DynamicLinearAllocator.hpp"
@@ -144,6 +146,99 @@ enum class SerializerMode
     Measure
 };
 
+template <SerializerMode Mode>
+class Serializer;
+
+/// A chain of memory chunks that Serializer<SerializerMode::Write> fills in a single pass,
+/// without measuring the data size first.
+///
+/// Serialized items are never split between chunks: when an item does not fit into the
+/// current chunk, the chunk is closed and the item is written to the next one (items
+/// larger than the chunk size get a dedicated chunk). Chunk data is placed in memory so
+/// that the address alignment matches the alignment of the global data offset. As a result,
+/// the concatenation of all chunks is byte-identical to the data produced by the contiguous
+/// serializer, and Serializer<SerializerMode::Read> can read it either from the chunk chain
+/// or from a contiguous copy.
+///
+/// Chunks of the default size are pooled and reused after Clear(). If a file stream is
+/// given, every closed chunk is immediately written to the stream and its memory is reused
+/// for the next chunk, so that only one chunk is kept in memory at a time.
+class SerializedDataChunks
+{
+public:
+    static constexpr size_t DefaultChunkSize = size_t{64} << 10u;
+
+    /// Maximum alignment that is supported by the chunked serialization.
+    static constexpr size_t MaxAlignment = 16;
+
+    explicit SerializedDataChunks(IMemoryAllocator& Allocator,
+                                  size_t            ChunkSize = DefaultChunkSize,
+                                  IFileStream*      pStream   = nullptr) noexcept;
+
+    ~SerializedDataChunks();
+
+    // clang-format off
+    SerializedDataChunks           (const SerializedDataChunks&) = delete;
+    SerializedDataChunks& operator=(const SerializedDataChunks&) = delete;
+    SerializedDataChunks           (SerializedDataChunks&&)      = delete;
+    SerializedDataChunks& operator=(SerializedDataChunks&&)      = delete;
+    // clang-format on
+
+    /// Returns the total size of the data written by all closed serializers,
+    /// including the data that was flushed to the stream.
+    size_t GetSize() const { return m_Size; }
+
+    /// Returns the number of chunks kept in memory. When the data is written to a stream, this is always zero.
+    size_t GetNumChunks() const { return m_Chunks.size(); }
+
+    /// Returns the non-owning view of the data in the chunk with the given index.
+    SerializedData GetChunk(size_t Idx) const;
+
+    /// Copies all chunks to the contiguous memory. DstSize must be at least GetSize().
+    bool CopyTo(void* pDst, size_t DstSize) const;
+
+    /// Copies all chunks into a newly allocated contiguous memory block.
+    SerializedData Flatten(IMemoryAllocator& Allocator) const;
+
+    /// Returns false if writing any chunk to the stream failed.
+    bool IsStreamValid() const { return !m_StreamError; }
+
+    /// Releases all chunks to the pool.
+    void Clear();
+
+private:
+    template <SerializerMode Mode>
+    friend class Serializer;
+
+    // Opens a new chunk that holds at least MinSize bytes of data starting at the global offset Offset.
+    Uint8* OpenChunk(size_t Offset, size_t MinSize, Uint8*& pEnd);
+
+    // Closes the currently open chunk whose data ends at pEnd.
+    void CloseChunk(const Uint8* pEnd);
+
+    struct Chunk
+    {
+        void*  pMemory   = nullptr;
+        size_t AllocSize = 0;
+        Uint8* pData     = nullptr;
+        size_t Size      = 0;
+    };
+    void ReleaseChunk(Chunk& C);
+
+private:
+    IMemoryAllocator&  m_Allocator;
+    const size_t       m_ChunkSize;
+    IFileStream* const m_pStream;
+
+    std::vector<Chunk> m_Chunks;
+    std::vector<Chunk> m_FreeChunks;
+
+    Chunk m_OpenChunk;
+
+    size_t m_Size        = 0;
+    bool   m_StreamError = false;
+};
+
 
 template <SerializerMode Mode>
 class Serializer
@@ -168,6 +263,8 @@ public:
     template <typename T>
     using ConstQual = typename std::conditional_t<Mode == SerializerMode::Read, T, const T>;
 
+    using TChunks = typename std::conditional_t<Mode == SerializerMode::Read, const SerializedDataChunks, SerializedDataChunks>;
+
 
     Serializer() :
         // clang-format off
@@ -189,6 +286,19 @@ public:
         static_assert(Mode == SerializerMode::Read || Mode == SerializerMode::Write, "Only Read or Write mode is supported");
     }
 
+    /// Creates a serializer that reads the data from or writes the data to the chunk chain.
+    ///
+    /// In Write mode, the serializer appends the data to the chunks and closes the last chunk
+    /// when it is destroyed.
+    explicit Serializer(TChunks& Chunks);
+
+    ~Serializer();
+
+    // clang-format off
+    Serializer           (const Serializer&) = delete;
+    Serializer& operator=(const Serializer&) = delete;
+    // clang-format on
+
     template <typename T>
     TEnable<T> Serialize(ConstQual<T>& Value)
     {
@@ -240,8 +350,12 @@ public:
     TReadOnly<T> Cast()
     {
         static_assert(std::is_trivially_destructible<T>::value, "Can not cast to non triavial type");
+        if (!EnsureSpace(sizeof(T)))
+        {
+            UNEXPECTED("Not enough data to read ", sizeof(T), " bytes");
+            return nullptr;
+        }
         VERIFY(reinterpret_cast<size_t>(m_Ptr) % alignof(T) == 0, "Pointer must be properly aligned");
-        VERIFY_EXPR(m_Ptr + sizeof(T) <= m_End);
         auto* Ptr = m_Ptr;
         m_Ptr += sizeof(T);
         return reinterpret_cast<const T*>(Ptr);
@@ -265,13 +379,15 @@ public:
     size_t GetSize() const
     {
         VERIFY_EXPR(m_Ptr >= m_Start);
-        return m_Ptr - m_Start;
+        return m_ChunkOffset + (m_Ptr - m_Start);
     }
 
     size_t GetRemainingSize() const
     {
         VERIFY_EXPR(m_End >= m_Ptr);
-        return m_End - m_Ptr;
+        return m_pChunks != nullptr && Mode == SerializerMode::Read ?
+            m_pChunks->GetSize() - GetSize() :
+            m_End - m_Ptr;
     }
 
     const void* GetCurrentPtr() const
@@ -281,7 +397,9 @@ public:
 
     bool IsEnded() const
     {
-        return m_Ptr == m_End;
+        return m_pChunks != nullptr && Mode == SerializerMode::Read ?
+            GetSize() == m_pChunks->GetSize() :
+            m_Ptr == m_End;
     }
 
     SerializedData AllocateData(IMemoryAllocator& Allocator) const
@@ -296,25 +414,128 @@ private:
     template <typename T>
     bool Copy(T* pData, size_t Size);
 
-    void AlignOffset(size_t Alignment)
+    bool AlignOffset(size_t Alignment)
     {
+        VERIFY(m_pChunks == nullptr || Alignment <= SerializedDataChunks::MaxAlignment,
+               "Alignment (", Alignment, ") exceeds the maximum alignment supported by the chunked serialization");
         const size_t Size       = GetSize();
         const size_t AlignShift = AlignUp(Size, Alignment) - Size;
-        VERIFY_EXPR(m_Ptr + AlignShift <= m_End);
+        if (!EnsureSpace(AlignShift))
+            return false;
         m_Ptr += AlignShift;
+        return true;
     }
 
+    // Makes sure that Size bytes can be read or written at the current position.
+    // In chunked mode, switches to the next chunk if the current one does not have enough space.
+    bool EnsureSpace(size_t Size)
+    {
+        if (m_Ptr + Size <= m_End)
+            return true;
+
+        return m_pChunks != nullptr && SwitchChunk(Size);
+    }
+
+    bool SwitchChunk(size_t Size);
+
 private:
-    TPointer const m_Start = nullptr;
-    TPointer const m_End   = nullptr;
+    TPointer m_Start = nullptr;
+    TPointer m_End   = nullptr;
 
     TPointer m_Ptr = nullptr;
+
+    TChunks* m_pChunks = nullptr;
+    // The global offset of m_Start in the chunk chain
+    size_t m_ChunkOffset = 0;
+    // The index of the current chunk (Read mode only)
+    size_t m_ChunkIdx = 0;
 };
 
+template <SerializerMode Mode>
+Serializer<Mode>::~Serializer()
+{
+}
+
+template <>
+inline Serializer<SerializerMode::Write>::~Serializer()
+{
+    if (m_pChunks != nullptr)
+        m_pChunks->CloseChunk(m_Ptr);
+}
+
+template <SerializerMode Mode>
+bool Serializer<Mode>::SwitchChunk(size_t Size)
+{
+    static_assert(Mode == SerializerMode::Measure, "Unexpected mode");
+    return false;
+}
+
+template <>
+inline bool Serializer<SerializerMode::Read>::SwitchChunk(size_t Size)
+{
+    // The writer only switches chunks at the end of the data in the current chunk
+    if (m_Ptr != m_End || m_ChunkIdx + 1 >= m_pChunks->GetNumChunks())
+        return false;
+
+    m_ChunkOffset += m_End - m_Start;
+    ++m_ChunkIdx;
+
+    const SerializedData Chunk = m_pChunks->GetChunk(m_ChunkIdx);
+
+    m_Start = Chunk.Ptr<const Uint8>();
+    m_End   = m_Start + Chunk.Size();
+    m_Ptr   = m_Start;
+    VERIFY_EXPR(m_Start == nullptr || reinterpret_cast<size_t>(m_Start) % SerializedDataChunks::MaxAlignment == m_ChunkOffset % SerializedDataChunks::MaxAlignment);
+
+    return m_Ptr + Size <= m_End;
+}
+
+template <>
+inline bool Serializer<SerializerMode::Write>::SwitchChunk(size_t Size)
+{
+    m_ChunkOffset = GetSize();
+    m_pChunks->CloseChunk(m_Ptr);
+
+    m_Start = m_pChunks->OpenChunk(m_ChunkOffset, Size, m_End);
+    m_Ptr   = m_Start;
+
+    return m_Start != nullptr;
+}
+
+template <SerializerMode Mode>
+Serializer<Mode>::Serializer(TChunks& Chunks) :
+    m_pChunks{&Chunks}
+{
+    static_assert(Mode == SerializerMode::Read || Mode == SerializerMode::Write, "Only Read or Write mode is supported");
+}
+
+template <>
+inline Serializer<SerializerMode::Read>::Serializer(const SerializedDataChunks& Chunks) :
+    m_pChunks{&Chunks}
+{
+    if (Chunks.GetNumChunks() > 0)
+    {
+        const SerializedData Chunk = Chunks.GetChunk(0);
+
+        m_Start = Chunk.Ptr<const Uint8>();
+        m_End   = m_Start + Chunk.Size();
+        m_Ptr   = m_Start;
+    }
+}
+
+template <>
+inline Serializer<SerializerMode::Write>::Serializer(SerializedDataChunks& Chunks) :
+    m_pChunks{&Chunks},
+    m_ChunkOffset{Chunks.GetSize()}
+{
+    m_Start = Chunks.OpenChunk(m_ChunkOffset, 0, m_End);
+    m_Ptr   = m_Start;
+}
+
 #define CHECK_REMAINING_SIZE(Size, ...) \
     do                                  \
     {                                   \
-        if (m_Ptr + Size > m_End)       \
+        if (!EnsureSpace(Size))         \
         {                               \
             UNEXPECTED(__VA_ARGS__);    \
             return false;               \
@@ -390,7 +611,8 @@ inline bool Serializer<SerializerMode::Read>::SerializeBytes(VoidPtr pBytes, Con
 
     Size = Size32;
 
-    AlignOffset(Alignment);
+    if (!AlignOffset(Alignment))
+        return false;
 
     CHECK_REMAINING_SIZE(Size, "Note enough data to read ", Size, " bytes.");
 
@@ -406,7 +628,8 @@ inline bool Serializer<Mode>::SerializeBytes(VoidPtr pBytes, ConstQual<size_t>&
     static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure, "Unexpected mode");
     if (!Serialize<Uint32>(static_cast<Uint32>(Size)))
         return false;
-    AlignOffset(Alignment);
+    if (!AlignOffset(Alignment))
+        return false;
     return Copy(pBytes, Size);
 }
 
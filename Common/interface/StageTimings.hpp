@@ -0,0 +1,193 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::StageTimings and Diligent::ScopedStageTimer classes
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Per-module collector of the durations of the stages of a long operation,
+/// for instance shader compilation or pipeline creation.
+
+/// Stages are identified by indices in the range [0, MaxStages); the meaning of the
+/// indices is defined by the caller. Recording is disabled by default, in which case
+/// ScopedStageTimer only performs a single relaxed atomic load.
+///
+/// Per-stage statistics are updated with atomic operations, so recording from many
+/// threads does not serialize. Trace events, if enabled, are appended under a lock.
+///
+/// \note   Every module that links the Common library statically has its own instance,
+///         so code in other modules must not assume it records to the same collector.
+class StageTimings
+{
+public:
+    static constexpr Uint32 MaxStages = 32;
+
+    /// Bin i of the histogram counts the durations in the range [2^i, 2^(i+1)) microseconds.
+    /// The first bin also counts all durations below one microsecond, and the last
+    /// bin counts all durations that do not fit into other bins.
+    static constexpr Uint32 NumHistogramBins = 24;
+
+    /// Maximum number of trace events that are kept. Events that do not fit are dropped.
+    static constexpr size_t MaxTraceEvents = size_t{1} << 20u;
+
+    struct StageStats
+    {
+        Uint64 Count   = 0;
+        Uint64 TotalNs = 0;
+        Uint64 MinNs   = 0;
+        Uint64 MaxNs   = 0;
+
+        std::array<Uint64, NumHistogramBins> Histogram = {};
+    };
+
+    struct TraceEvent
+    {
+        Uint32 Stage      = 0;
+        Uint32 ThreadId   = 0;
+        Uint64 StartNs    = 0;
+        Uint64 DurationNs = 0;
+    };
+
+    static StageTimings& Get();
+
+    /// Enables or disables recording. Previously recorded data is kept.
+    void Enable(bool EnableTimings, bool RecordTrace = false);
+
+    bool IsEnabled() const noexcept
+    {
+        return m_Enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Returns the number of nanoseconds elapsed since the instance was created.
+    Uint64 GetTimestamp() const;
+
+    /// Records the stage that started at StartNs and ended at EndNs (see GetTimestamp()).
+    void Record(Uint32 Stage, Uint64 StartNs, Uint64 EndNs);
+
+    StageStats GetStats(Uint32 Stage) const;
+
+    /// Returns the number of trace events dropped because the trace buffer was full.
+    size_t GetNumDroppedTraceEvents() const;
+
+    /// Writes the recorded trace events in Chrome trace event format
+    /// (https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU).
+
+    /// \param [in] StageNames - Array of NumStages stage names used as event names.
+    ///                          Stages without a name are written as "Stage <index>".
+    /// \param [in] NumStages  - The number of elements in StageNames.
+    ///
+    /// The result can be loaded into chrome://tracing or https://ui.perfetto.dev.
+    std::string GetChromeTrace(const char* const* StageNames, Uint32 NumStages) const;
+
+    /// Clears all recorded statistics and trace events.
+    void Reset();
+
+private:
+    StageTimings();
+
+    struct AtomicStageStats
+    {
+        std::atomic<Uint64> Count{0};
+        std::atomic<Uint64> TotalNs{0};
+        std::atomic<Uint64> MinNs{~Uint64{0}};
+        std::atomic<Uint64> MaxNs{0};
+
+        std::array<std::atomic<Uint64>, NumHistogramBins> Histogram = {};
+    };
+
+    std::atomic<bool> m_Enabled{false};
+    std::atomic<bool> m_RecordTrace{false};
+
+    const Uint64 m_Epoch;
+
+    std::array<AtomicStageStats, MaxStages> m_Stats;
+
+    mutable std::mutex      m_TraceMtx;
+    std::vector<TraceEvent> m_Trace;
+    size_t                  m_NumDroppedEvents = 0;
+};
+
+
+/// Records the duration of the scope as the given stage in StageTimings.
+
+/// The stage can be changed before the timer goes out of scope, which is useful
+/// when the stage is only known at the end, for instance cache hit vs. cache miss.
+class ScopedStageTimer
+{
+public:
+    explicit ScopedStageTimer(Uint32 Stage) noexcept :
+        m_Stage{Stage},
+        m_StartNs{StageTimings::Get().IsEnabled() ? StageTimings::Get().GetTimestamp() : ~Uint64{0}}
+    {
+    }
+
+    template <typename StageType>
+    explicit ScopedStageTimer(StageType Stage) noexcept :
+        ScopedStageTimer{static_cast<Uint32>(Stage)}
+    {
+    }
+
+    ~ScopedStageTimer()
+    {
+        if (m_StartNs != ~Uint64{0})
+        {
+            StageTimings& Timings = StageTimings::Get();
+            Timings.Record(m_Stage, m_StartNs, Timings.GetTimestamp());
+        }
+    }
+
+    template <typename StageType>
+    void SetStage(StageType Stage) noexcept
+    {
+        m_Stage = static_cast<Uint32>(Stage);
+    }
+
+    // clang-format off
+    ScopedStageTimer           (const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+    ScopedStageTimer           (ScopedStageTimer&&)      = delete;
+    ScopedStageTimer& operator=(ScopedStageTimer&&)      = delete;
+    // clang-format on
+
+private:
+    Uint32       m_Stage;
+    const Uint64 m_StartNs;
+};
+
+} // namespace Diligent
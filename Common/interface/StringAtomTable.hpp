@@ -0,0 +1,192 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::StringAtom and Diligent::StringAtomTable classes
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "HashUtils.hpp"
+#include "DynamicLinearAllocator.hpp"
+
+namespace Diligent
+{
+
+/// Handle of an interned string.
+
+/// Atoms created by the same table are equal if and only if their strings are equal,
+/// so they are compared by pointer. The string and its hash are stored in the table
+/// and remain valid for the lifetime of the table.
+class StringAtom
+{
+public:
+    StringAtom() noexcept {}
+
+    const Char* GetStr() const noexcept
+    {
+        return m_pData != nullptr ? m_pData->GetStr() : nullptr;
+    }
+
+    /// Returns the hash of the string computed by CStringHash<Char>.
+    size_t GetHash() const noexcept
+    {
+        return m_pData != nullptr ? m_pData->Hash : 0;
+    }
+
+    size_t GetLength() const noexcept
+    {
+        return m_pData != nullptr ? m_pData->Length : 0;
+    }
+
+    /// Returns a non-owning hash map key that references the atom's string
+    /// and uses the precomputed hash.
+    HashMapStringKey GetKey() const noexcept
+    {
+        VERIFY(m_pData != nullptr, "Null atom can't be used as a key");
+        return HashMapStringKey{m_pData->GetStr(), HashMapStringKey::PrecomputedHash{m_pData->Hash}};
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return m_pData != nullptr;
+    }
+
+    bool operator==(const StringAtom& RHS) const noexcept
+    {
+        return m_pData == RHS.m_pData;
+    }
+
+    bool operator!=(const StringAtom& RHS) const noexcept
+    {
+        return m_pData != RHS.m_pData;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const StringAtom& Atom) const noexcept
+        {
+            return Atom.GetHash();
+        }
+    };
+
+private:
+    friend class StringAtomTable;
+
+    struct Data
+    {
+        size_t Hash   = 0;
+        size_t Length = 0;
+
+        // The null-terminated string immediately follows the structure
+        const Char* GetStr() const noexcept
+        {
+            return reinterpret_cast<const Char*>(this + 1);
+        }
+    };
+
+    explicit StringAtom(const Data* pData) noexcept :
+        m_pData{pData}
+    {}
+
+    const Data* m_pData = nullptr;
+};
+
+/// Thread-safe append-only table of interned strings.
+
+/// Strings are stored in pages allocated by a linear allocator and are never released
+/// until the table is destroyed. The table is split into shards selected by the string
+/// hash, each protected by its own lock, so that threads interning different strings
+/// rarely contend.
+class StringAtomTable
+{
+public:
+    explicit StringAtomTable(IMemoryAllocator& RawAllocator);
+    ~StringAtomTable();
+
+    // clang-format off
+    StringAtomTable           (const StringAtomTable&) = delete;
+    StringAtomTable           (StringAtomTable&&)      = delete;
+    StringAtomTable& operator=(const StringAtomTable&) = delete;
+    StringAtomTable& operator=(StringAtomTable&&)      = delete;
+    // clang-format on
+
+    /// Returns the atom for the string, adding the string to the table if necessary.
+    /// Null string produces null atom.
+    StringAtom Intern(const Char* Str);
+
+    /// Same as Intern(const Char*), but uses the hash that is already computed by the key.
+    StringAtom Intern(const HashMapStringKey& Key);
+
+    StringAtom Intern(const String& Str)
+    {
+        return Intern(Str.c_str());
+    }
+
+    /// Returns the atom for the string if it has been interned, and null atom otherwise.
+    StringAtom Find(const Char* Str) const;
+
+    StringAtom Find(const HashMapStringKey& Key) const;
+
+    /// Returns the total number of atoms in the table.
+    size_t GetAtomCount() const;
+
+    /// Returns the total size of the memory used to store the strings, in bytes.
+    size_t GetStorageSize() const;
+
+private:
+    static constexpr size_t NumShards = 16;
+
+    struct Shard
+    {
+        explicit Shard(IMemoryAllocator& RawAllocator) :
+            Storage{RawAllocator, 4 << 10}
+        {}
+
+        mutable std::mutex Mtx;
+
+        std::unordered_map<HashMapStringKey, const StringAtom::Data*, HashMapStringKey::Hasher> Atoms;
+
+        DynamicLinearAllocator Storage;
+    };
+
+    Shard& GetShard(size_t Hash) const
+    {
+        return *m_Shards[Hash % NumShards];
+    }
+
+    std::array<std::unique_ptr<Shard>, NumShards> m_Shards;
+};
+
+} // namespace Diligent
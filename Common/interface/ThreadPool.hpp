@@ -31,9 +31,15 @@
 
 #include "ThreadPool.h"
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -226,4 +232,104 @@ RefCntAutoPtr<IAsyncTask> EnqueueAsyncWork(IThreadPool* pThreadPool,
     return EnqueueAsyncWork(pThreadPool, nullptr, 0, std::move(Handler), fPriority);
 }
 
+
+/// Calls Handler(Index) for every index in the range [0, NumItems) using both the calling
+/// thread and the thread pool workers, and returns when all items have been processed.
+
+/// The calling thread processes the items too and only waits for the items that other
+/// threads have already started, so the function may be called from a worker thread of
+/// the same pool. At most one helper task per worker thread is enqueued, and the helper
+/// tasks that have not started by the time all items are claimed are removed from the queue.
+/// Items are processed in unspecified order, so the handler should write its
+/// results to per-item storage that the caller merges in index order.
+/// If the handler throws for some items, the exception of the item with the smallest index
+/// is rethrown after all items have been processed.
+/// If the thread pool is null or has no worker threads, the items are processed
+/// sequentially by the calling thread.
+template <typename HandlerType>
+void ParallelFor(IThreadPool* pThreadPool, Uint32 NumItems, HandlerType&& Handler)
+{
+    const Uint32 NumWorkers = pThreadPool != nullptr ? pThreadPool->GetThreadCount() : 0;
+    if (NumWorkers == 0 || NumItems <= 1)
+    {
+        for (Uint32 i = 0; i < NumItems; ++i)
+            Handler(i);
+        return;
+    }
+
+    struct SharedState
+    {
+        SharedState(Uint32 _NumItems, std::function<void(Uint32)>&& _Handler) :
+            NumItems{_NumItems},
+            Handler{std::move(_Handler)},
+            Exceptions(_NumItems)
+        {}
+
+        // Tasks that start after all items have been claimed return immediately
+        // and never call the handler, so it may reference the caller's stack.
+        void ProcessItems()
+        {
+            for (Uint32 i = NextItem.fetch_add(1); i < NumItems; i = NextItem.fetch_add(1))
+            {
+                try
+                {
+                    Handler(i);
+                }
+                catch (...)
+                {
+                    Exceptions[i] = std::current_exception();
+                }
+
+                if (NumFinished.fetch_add(1) + 1 == NumItems)
+                {
+                    // The mutex makes sure that the notification is not lost if the
+                    // waiting thread has checked the counter, but has not started waiting yet.
+                    std::lock_guard<std::mutex> Lock{FinishedMtx};
+                    FinishedCV.notify_all();
+                }
+            }
+        }
+
+        void WaitForAllItems()
+        {
+            std::unique_lock<std::mutex> Lock{FinishedMtx};
+            FinishedCV.wait(Lock, [this]() { return NumFinished.load() == NumItems; });
+        }
+
+        const Uint32                      NumItems;
+        const std::function<void(Uint32)> Handler;
+        std::vector<std::exception_ptr>   Exceptions;
+        std::atomic<Uint32>               NextItem{0};
+        std::atomic<Uint32>               NumFinished{0};
+        std::mutex                        FinishedMtx;
+        std::condition_variable           FinishedCV;
+    };
+
+    std::shared_ptr<SharedState> pState = std::make_shared<SharedState>(NumItems, [&Handler](Uint32 Index) { Handler(Index); });
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> HelperTasks(std::min(NumItems - 1, NumWorkers));
+    for (RefCntAutoPtr<IAsyncTask>& pTask : HelperTasks)
+    {
+        pTask = EnqueueAsyncWork(pThreadPool,
+                                 [pState](Uint32 ThreadId) {
+                                     pState->ProcessItems();
+                                     return ASYNC_TASK_STATUS_COMPLETE;
+                                 });
+    }
+
+    pState->ProcessItems();
+
+    // All items have been claimed, so the tasks that are still in the queue have nothing to do.
+    for (RefCntAutoPtr<IAsyncTask>& pTask : HelperTasks)
+        pThreadPool->RemoveTask(pTask);
+
+    pState->WaitForAllItems();
+
+    for (const std::exception_ptr& Exception : pState->Exceptions)
+    {
+        if (Exception)
+            std::rethrow_exception(Exception);
+    }
+}
+
 } // namespace Diligent
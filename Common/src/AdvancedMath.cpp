@@ -0,0 +1,502 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "AdvancedMath.hpp"
+
+#include <algorithm>
+
+#include "Intrinsics.hpp"
+#include "DebugUtilities.hpp"
+#include "PlatformMisc.hpp"
+#include "Align.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Frustum planes prepared for the batched visibility test
+struct CullingPlanes
+{
+    Uint32 NumPlanes = 0;
+
+    float NormalX[ViewFrustum::NUM_PLANES]    = {};
+    float NormalY[ViewFrustum::NUM_PLANES]    = {};
+    float NormalZ[ViewFrustum::NUM_PLANES]    = {};
+    float AbsNormalX[ViewFrustum::NUM_PLANES] = {};
+    float AbsNormalY[ViewFrustum::NUM_PLANES] = {};
+    float AbsNormalZ[ViewFrustum::NUM_PLANES] = {};
+    float Distance[ViewFrustum::NUM_PLANES]   = {};
+
+    CullingPlanes(const ViewFrustum& Frustum, FRUSTUM_PLANE_FLAGS PlaneFlags)
+    {
+        for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+        {
+            if ((PlaneFlags & (1 << plane_idx)) == 0)
+                continue;
+
+            const Plane3D& Plane = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+
+            NormalX[NumPlanes]    = Plane.Normal.x;
+            NormalY[NumPlanes]    = Plane.Normal.y;
+            NormalZ[NumPlanes]    = Plane.Normal.z;
+            AbsNormalX[NumPlanes] = std::abs(Plane.Normal.x);
+            AbsNormalY[NumPlanes] = std::abs(Plane.Normal.y);
+            AbsNormalZ[NumPlanes] = std::abs(Plane.Normal.z);
+            Distance[NumPlanes]   = Plane.Distance;
+            ++NumPlanes;
+        }
+    }
+};
+
+// Processes boxes in the range [StartIdx, EndIdx), where StartIdx is a multiple of 32,
+// and writes the corresponding elements of the visibility masks.
+using CullBoxRangeFuncType = void (*)(const CullingPlanes&    Planes,
+                                      const BoundBoxArraySoA& Boxes,
+                                      size_t                  StartIdx,
+                                      size_t                  EndIdx,
+                                      Uint32*                 pVisibleMask,
+                                      Uint32*                 pFullyVisibleMask);
+
+// Note: all implementations must perform exactly the same operations in the same order
+//       as GetBoxVisibilityAgainstPlane() to produce identical results.
+void GetBoxVisibilityScalar(const CullingPlanes&    Planes,
+                            const BoundBoxArraySoA& Boxes,
+                            size_t                  Idx,
+                            bool&                   IsVisible,
+                            bool&                   IsFullyVisible)
+{
+    const float CenterX = Boxes.MaxX[Idx] + Boxes.MinX[Idx];
+    const float CenterY = Boxes.MaxY[Idx] + Boxes.MinY[Idx];
+    const float CenterZ = Boxes.MaxZ[Idx] + Boxes.MinZ[Idx];
+    const float ExtentX = Boxes.MaxX[Idx] - Boxes.MinX[Idx];
+    const float ExtentY = Boxes.MaxY[Idx] - Boxes.MinY[Idx];
+    const float ExtentZ = Boxes.MaxZ[Idx] - Boxes.MinZ[Idx];
+
+    IsVisible      = true;
+    IsFullyVisible = true;
+    for (Uint32 i = 0; i < Planes.NumPlanes; ++i)
+    {
+        const float DistanceToCenter = (CenterX * Planes.NormalX[i] + CenterY * Planes.NormalY[i] + CenterZ * Planes.NormalZ[i]) * 0.5f + Planes.Distance[i];
+        const float ProjHalfLen      = (ExtentX * Planes.AbsNormalX[i] + ExtentY * Planes.AbsNormalY[i] + ExtentZ * Planes.AbsNormalZ[i]) * 0.5f;
+        if (DistanceToCenter < -ProjHalfLen)
+        {
+            IsVisible      = false;
+            IsFullyVisible = false;
+            return;
+        }
+        if (!(DistanceToCenter > ProjHalfLen))
+            IsFullyVisible = false;
+    }
+}
+
+// Processes the last incomplete group of boxes
+void CullBoxTailScalar(const CullingPlanes&    Planes,
+                       const BoundBoxArraySoA& Boxes,
+                       size_t                  StartIdx,
+                       size_t                  EndIdx,
+                       Uint32&                 VisibleBits,
+                       Uint32&                 FullyVisibleBits)
+{
+    for (size_t Idx = StartIdx; Idx < EndIdx; ++Idx)
+    {
+        bool IsVisible, IsFullyVisible;
+        GetBoxVisibilityScalar(Planes, Boxes, Idx, IsVisible, IsFullyVisible);
+
+        const Uint32 Bit = 1u << (Idx % 32);
+        if (IsVisible)
+            VisibleBits |= Bit;
+        if (IsFullyVisible)
+            FullyVisibleBits |= Bit;
+    }
+}
+
+void CullBoxRangeScalar(const CullingPlanes&    Planes,
+                        const BoundBoxArraySoA& Boxes,
+                        size_t                  StartIdx,
+                        size_t                  EndIdx,
+                        Uint32*                 pVisibleMask,
+                        Uint32*                 pFullyVisibleMask)
+{
+    for (size_t GroupStart = StartIdx; GroupStart < EndIdx; GroupStart += 32)
+    {
+        Uint32 VisibleBits      = 0;
+        Uint32 FullyVisibleBits = 0;
+        CullBoxTailScalar(Planes, Boxes, GroupStart, std::min(GroupStart + 32, EndIdx), VisibleBits, FullyVisibleBits);
+
+        pVisibleMask[GroupStart / 32] = VisibleBits;
+        if (pFullyVisibleMask != nullptr)
+            pFullyVisibleMask[GroupStart / 32] = FullyVisibleBits;
+    }
+}
+
+#if DILIGENT_AVX2_SUPPORTED
+
+DILIGENT_TARGET_SSE2 void CullBoxRangeSSE2(const CullingPlanes&    Planes,
+                                           const BoundBoxArraySoA& Boxes,
+                                           size_t                  StartIdx,
+                                           size_t                  EndIdx,
+                                           Uint32*                 pVisibleMask,
+                                           Uint32*                 pFullyVisibleMask)
+{
+    const __m128 mmHalf = _mm_set1_ps(0.5f);
+    for (size_t GroupStart = StartIdx; GroupStart < EndIdx; GroupStart += 32)
+    {
+        const size_t GroupEnd = std::min(GroupStart + 32, EndIdx);
+
+        Uint32 VisibleBits      = 0;
+        Uint32 FullyVisibleBits = 0;
+
+        size_t Idx = GroupStart;
+        for (; Idx + 4 <= GroupEnd; Idx += 4)
+        {
+            const __m128 mmMinX = _mm_loadu_ps(&Boxes.MinX[Idx]);
+            const __m128 mmMinY = _mm_loadu_ps(&Boxes.MinY[Idx]);
+            const __m128 mmMinZ = _mm_loadu_ps(&Boxes.MinZ[Idx]);
+            const __m128 mmMaxX = _mm_loadu_ps(&Boxes.MaxX[Idx]);
+            const __m128 mmMaxY = _mm_loadu_ps(&Boxes.MaxY[Idx]);
+            const __m128 mmMaxZ = _mm_loadu_ps(&Boxes.MaxZ[Idx]);
+
+            const __m128 mmCenterX = _mm_add_ps(mmMaxX, mmMinX);
+            const __m128 mmCenterY = _mm_add_ps(mmMaxY, mmMinY);
+            const __m128 mmCenterZ = _mm_add_ps(mmMaxZ, mmMinZ);
+            const __m128 mmExtentX = _mm_sub_ps(mmMaxX, mmMinX);
+            const __m128 mmExtentY = _mm_sub_ps(mmMaxY, mmMinY);
+            const __m128 mmExtentZ = _mm_sub_ps(mmMaxZ, mmMinZ);
+
+            __m128 mmInvisible    = _mm_setzero_ps();
+            __m128 mmFullyVisible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (Uint32 i = 0; i < Planes.NumPlanes; ++i)
+            {
+                __m128 mmDist = _mm_add_ps(_mm_mul_ps(mmCenterX, _mm_set1_ps(Planes.NormalX[i])), _mm_mul_ps(mmCenterY, _mm_set1_ps(Planes.NormalY[i])));
+                mmDist        = _mm_add_ps(mmDist, _mm_mul_ps(mmCenterZ, _mm_set1_ps(Planes.NormalZ[i])));
+                mmDist        = _mm_add_ps(_mm_mul_ps(mmDist, mmHalf), _mm_set1_ps(Planes.Distance[i]));
+
+                __m128 mmProjHalfLen = _mm_add_ps(_mm_mul_ps(mmExtentX, _mm_set1_ps(Planes.AbsNormalX[i])), _mm_mul_ps(mmExtentY, _mm_set1_ps(Planes.AbsNormalY[i])));
+                mmProjHalfLen        = _mm_add_ps(mmProjHalfLen, _mm_mul_ps(mmExtentZ, _mm_set1_ps(Planes.AbsNormalZ[i])));
+                mmProjHalfLen        = _mm_mul_ps(mmProjHalfLen, mmHalf);
+
+                const __m128 mmNegProjHalfLen = _mm_sub_ps(_mm_setzero_ps(), mmProjHalfLen);
+
+                mmInvisible    = _mm_or_ps(mmInvisible, _mm_cmplt_ps(mmDist, mmNegProjHalfLen));
+                mmFullyVisible = _mm_and_ps(mmFullyVisible, _mm_cmpgt_ps(mmDist, mmProjHalfLen));
+            }
+
+            const Uint32 InvisibleBits = static_cast<Uint32>(_mm_movemask_ps(mmInvisible));
+            const Uint32 FullyBits     = static_cast<Uint32>(_mm_movemask_ps(mmFullyVisible)) & ~InvisibleBits;
+
+            VisibleBits |= (~InvisibleBits & 0xFu) << (Idx % 32);
+            FullyVisibleBits |= FullyBits << (Idx % 32);
+        }
+
+        CullBoxTailScalar(Planes, Boxes, Idx, GroupEnd, VisibleBits, FullyVisibleBits);
+
+        pVisibleMask[GroupStart / 32] = VisibleBits;
+        if (pFullyVisibleMask != nullptr)
+            pFullyVisibleMask[GroupStart / 32] = FullyVisibleBits;
+    }
+}
+
+DILIGENT_TARGET_AVX2 void CullBoxRangeAVX2(const CullingPlanes&    Planes,
+                                           const BoundBoxArraySoA& Boxes,
+                                           size_t                  StartIdx,
+                                           size_t                  EndIdx,
+                                           Uint32*                 pVisibleMask,
+                                           Uint32*                 pFullyVisibleMask)
+{
+    const __m256 mmHalf = _mm256_set1_ps(0.5f);
+    for (size_t GroupStart = StartIdx; GroupStart < EndIdx; GroupStart += 32)
+    {
+        const size_t GroupEnd = std::min(GroupStart + 32, EndIdx);
+
+        Uint32 VisibleBits      = 0;
+        Uint32 FullyVisibleBits = 0;
+
+        size_t Idx = GroupStart;
+        for (; Idx + 8 <= GroupEnd; Idx += 8)
+        {
+            const __m256 mmMinX = _mm256_loadu_ps(&Boxes.MinX[Idx]);
+            const __m256 mmMinY = _mm256_loadu_ps(&Boxes.MinY[Idx]);
+            const __m256 mmMinZ = _mm256_loadu_ps(&Boxes.MinZ[Idx]);
+            const __m256 mmMaxX = _mm256_loadu_ps(&Boxes.MaxX[Idx]);
+            const __m256 mmMaxY = _mm256_loadu_ps(&Boxes.MaxY[Idx]);
+            const __m256 mmMaxZ = _mm256_loadu_ps(&Boxes.MaxZ[Idx]);
+
+            const __m256 mmCenterX = _mm256_add_ps(mmMaxX, mmMinX);
+            const __m256 mmCenterY = _mm256_add_ps(mmMaxY, mmMinY);
+            const __m256 mmCenterZ = _mm256_add_ps(mmMaxZ, mmMinZ);
+            const __m256 mmExtentX = _mm256_sub_ps(mmMaxX, mmMinX);
+            const __m256 mmExtentY = _mm256_sub_ps(mmMaxY, mmMinY);
+            const __m256 mmExtentZ = _mm256_sub_ps(mmMaxZ, mmMinZ);
+
+            __m256 mmInvisible    = _mm256_setzero_ps();
+            __m256 mmFullyVisible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (Uint32 i = 0; i < Planes.NumPlanes; ++i)
+            {
+                __m256 mmDist = _mm256_add_ps(_mm256_mul_ps(mmCenterX, _mm256_set1_ps(Planes.NormalX[i])), _mm256_mul_ps(mmCenterY, _mm256_set1_ps(Planes.NormalY[i])));
+                mmDist        = _mm256_add_ps(mmDist, _mm256_mul_ps(mmCenterZ, _mm256_set1_ps(Planes.NormalZ[i])));
+                mmDist        = _mm256_add_ps(_mm256_mul_ps(mmDist, mmHalf), _mm256_set1_ps(Planes.Distance[i]));
+
+                __m256 mmProjHalfLen = _mm256_add_ps(_mm256_mul_ps(mmExtentX, _mm256_set1_ps(Planes.AbsNormalX[i])), _mm256_mul_ps(mmExtentY, _mm256_set1_ps(Planes.AbsNormalY[i])));
+                mmProjHalfLen        = _mm256_add_ps(mmProjHalfLen, _mm256_mul_ps(mmExtentZ, _mm256_set1_ps(Planes.AbsNormalZ[i])));
+                mmProjHalfLen        = _mm256_mul_ps(mmProjHalfLen, mmHalf);
+
+                const __m256 mmNegProjHalfLen = _mm256_sub_ps(_mm256_setzero_ps(), mmProjHalfLen);
+
+                mmInvisible    = _mm256_or_ps(mmInvisible, _mm256_cmp_ps(mmDist, mmNegProjHalfLen, _CMP_LT_OQ));
+                mmFullyVisible = _mm256_and_ps(mmFullyVisible, _mm256_cmp_ps(mmDist, mmProjHalfLen, _CMP_GT_OQ));
+            }
+
+            const Uint32 InvisibleBits = static_cast<Uint32>(_mm256_movemask_ps(mmInvisible));
+            const Uint32 FullyBits     = static_cast<Uint32>(_mm256_movemask_ps(mmFullyVisible)) & ~InvisibleBits;
+
+            VisibleBits |= (~InvisibleBits & 0xFFu) << (Idx % 32);
+            FullyVisibleBits |= FullyBits << (Idx % 32);
+        }
+
+        CullBoxTailScalar(Planes, Boxes, Idx, GroupEnd, VisibleBits, FullyVisibleBits);
+
+        pVisibleMask[GroupStart / 32] = VisibleBits;
+        if (pFullyVisibleMask != nullptr)
+            pFullyVisibleMask[GroupStart / 32] = FullyVisibleBits;
+    }
+}
+
+#endif // DILIGENT_AVX2_SUPPORTED
+
+#if DILIGENT_NEON_ENABLED
+
+void CullBoxRangeNEON(const CullingPlanes&    Planes,
+                      const BoundBoxArraySoA& Boxes,
+                      size_t                  StartIdx,
+                      size_t                  EndIdx,
+                      Uint32*                 pVisibleMask,
+                      Uint32*                 pFullyVisibleMask)
+{
+    const float32x4_t mmHalf = vdupq_n_f32(0.5f);
+    // Bit weights used to convert the comparison result into a bit mask
+    const Uint32     BitWeights[4] = {1, 2, 4, 8};
+    const uint32x4_t mmBitWeights  = vld1q_u32(BitWeights);
+    for (size_t GroupStart = StartIdx; GroupStart < EndIdx; GroupStart += 32)
+    {
+        const size_t GroupEnd = std::min(GroupStart + 32, EndIdx);
+
+        Uint32 VisibleBits      = 0;
+        Uint32 FullyVisibleBits = 0;
+
+        size_t Idx = GroupStart;
+        for (; Idx + 4 <= GroupEnd; Idx += 4)
+        {
+            const float32x4_t mmMinX = vld1q_f32(&Boxes.MinX[Idx]);
+            const float32x4_t mmMinY = vld1q_f32(&Boxes.MinY[Idx]);
+            const float32x4_t mmMinZ = vld1q_f32(&Boxes.MinZ[Idx]);
+            const float32x4_t mmMaxX = vld1q_f32(&Boxes.MaxX[Idx]);
+            const float32x4_t mmMaxY = vld1q_f32(&Boxes.MaxY[Idx]);
+            const float32x4_t mmMaxZ = vld1q_f32(&Boxes.MaxZ[Idx]);
+
+            const float32x4_t mmCenterX = vaddq_f32(mmMaxX, mmMinX);
+            const float32x4_t mmCenterY = vaddq_f32(mmMaxY, mmMinY);
+            const float32x4_t mmCenterZ = vaddq_f32(mmMaxZ, mmMinZ);
+            const float32x4_t mmExtentX = vsubq_f32(mmMaxX, mmMinX);
+            const float32x4_t mmExtentY = vsubq_f32(mmMaxY, mmMinY);
+            const float32x4_t mmExtentZ = vsubq_f32(mmMaxZ, mmMinZ);
+
+            uint32x4_t mmInvisible    = vdupq_n_u32(0);
+            uint32x4_t mmFullyVisible = vdupq_n_u32(~0u);
+            for (Uint32 i = 0; i < Planes.NumPlanes; ++i)
+            {
+                // Note: vmlaq_f32 is not used as it may be fused on some architectures
+                float32x4_t mmDist = vaddq_f32(vmulq_n_f32(mmCenterX, Planes.NormalX[i]), vmulq_n_f32(mmCenterY, Planes.NormalY[i]));
+                mmDist             = vaddq_f32(mmDist, vmulq_n_f32(mmCenterZ, Planes.NormalZ[i]));
+                mmDist             = vaddq_f32(vmulq_f32(mmDist, mmHalf), vdupq_n_f32(Planes.Distance[i]));
+
+                float32x4_t mmProjHalfLen = vaddq_f32(vmulq_n_f32(mmExtentX, Planes.AbsNormalX[i]), vmulq_n_f32(mmExtentY, Planes.AbsNormalY[i]));
+                mmProjHalfLen             = vaddq_f32(mmProjHalfLen, vmulq_n_f32(mmExtentZ, Planes.AbsNormalZ[i]));
+                mmProjHalfLen             = vmulq_f32(mmProjHalfLen, mmHalf);
+
+                mmInvisible    = vorrq_u32(mmInvisible, vcltq_f32(mmDist, vnegq_f32(mmProjHalfLen)));
+                mmFullyVisible = vandq_u32(mmFullyVisible, vcgtq_f32(mmDist, mmProjHalfLen));
+            }
+
+            const uint32x4_t mmInvisibleBits = vandq_u32(mmInvisible, mmBitWeights);
+            const uint32x4_t mmFullyBits     = vandq_u32(mmFullyVisible, mmBitWeights);
+
+            Uint32 Bits[4];
+            vst1q_u32(Bits, mmInvisibleBits);
+            const Uint32 InvisibleBits = Bits[0] | Bits[1] | Bits[2] | Bits[3];
+            vst1q_u32(Bits, mmFullyBits);
+            const Uint32 FullyBits = (Bits[0] | Bits[1] | Bits[2] | Bits[3]) & ~InvisibleBits;
+
+            VisibleBits |= (~InvisibleBits & 0xFu) << (Idx % 32);
+            FullyVisibleBits |= FullyBits << (Idx % 32);
+        }
+
+        CullBoxTailScalar(Planes, Boxes, Idx, GroupEnd, VisibleBits, FullyVisibleBits);
+
+        pVisibleMask[GroupStart / 32] = VisibleBits;
+        if (pFullyVisibleMask != nullptr)
+            pFullyVisibleMask[GroupStart / 32] = FullyVisibleBits;
+    }
+}
+
+#endif // DILIGENT_NEON_ENABLED
+
+CullBoxRangeFuncType SelectCullBoxRangeFunc()
+{
+    const CPU_FEATURE_FLAGS CPUFeatures = PlatformMisc::GetCPUFeatures();
+#if DILIGENT_AVX2_SUPPORTED
+    if ((CPUFeatures & CPU_FEATURE_FLAG_AVX2) != 0)
+        return CullBoxRangeAVX2;
+    if ((CPUFeatures & CPU_FEATURE_FLAG_SSE2) != 0)
+        return CullBoxRangeSSE2;
+#endif
+#if DILIGENT_NEON_ENABLED
+    if ((CPUFeatures & CPU_FEATURE_FLAG_NEON) != 0)
+        return CullBoxRangeNEON;
+#endif
+    (void)CPUFeatures;
+    return CullBoxRangeScalar;
+}
+
+void CullBoxRange(const CullingPlanes&    Planes,
+                  const ViewFrustumExt*   pFrustumExt,
+                  const BoundBoxArraySoA& Boxes,
+                  size_t                  StartIdx,
+                  size_t                  EndIdx,
+                  Uint32*                 pVisibleMask,
+                  Uint32*                 pFullyVisibleMask)
+{
+    static const CullBoxRangeFuncType CullBoxRangeFunc = SelectCullBoxRangeFunc();
+    CullBoxRangeFunc(Planes, Boxes, StartIdx, EndIdx, pVisibleMask, pFullyVisibleMask);
+
+    if (pFrustumExt == nullptr)
+        return;
+
+    // Additionally test boxes that intersect the frustum planes against the frustum corners
+    for (size_t GroupStart = StartIdx; GroupStart < EndIdx; GroupStart += 32)
+    {
+        const size_t GroupIdx = GroupStart / 32;
+
+        Uint32 IntersectingBits = pVisibleMask[GroupIdx] & ~pFullyVisibleMask[GroupIdx];
+        while (IntersectingBits != 0)
+        {
+            const Uint32 Bit = PlatformMisc::GetLSB(IntersectingBits);
+            IntersectingBits &= ~(1u << Bit);
+
+            const size_t Idx = GroupStart + Bit;
+            if (IsViewFrustumOutsideBoundBox(*pFrustumExt, Boxes.Get(Idx)))
+                pVisibleMask[GroupIdx] &= ~(1u << Bit);
+        }
+    }
+}
+
+Uint32 GetBoxVisibilityBatchImpl(const ViewFrustum&      Frustum,
+                                 const ViewFrustumExt*   pFrustumExt,
+                                 const BoundBoxArraySoA& Boxes,
+                                 Uint32*                 pVisibleMask,
+                                 Uint32*                 pFullyVisibleMask,
+                                 FRUSTUM_PLANE_FLAGS     PlaneFlags,
+                                 IThreadPool*            pThreadPool)
+{
+    const size_t NumBoxes = Boxes.GetSize();
+    if (NumBoxes == 0)
+        return 0;
+
+    DEV_CHECK_ERR(pVisibleMask != nullptr, "Visibility mask must not be null");
+    DEV_CHECK_ERR(Boxes.MinY.size() == NumBoxes && Boxes.MinZ.size() == NumBoxes &&
+                      Boxes.MaxX.size() == NumBoxes && Boxes.MaxY.size() == NumBoxes && Boxes.MaxZ.size() == NumBoxes,
+                  "All coordinate arrays must have the same size");
+
+    const CullingPlanes Planes{Frustum, PlaneFlags};
+    if ((PlaneFlags & FRUSTUM_PLANE_FLAG_FULL_FRUSTUM) != FRUSTUM_PLANE_FLAG_FULL_FRUSTUM)
+    {
+        // The frustum corner test is only performed when all planes are enabled
+        pFrustumExt = nullptr;
+    }
+
+    // The frustum corner test is only performed for intersecting boxes, so the
+    // fully visible mask is required even if it was not requested.
+    std::vector<Uint32> FullyVisibleMask;
+    if (pFrustumExt != nullptr && pFullyVisibleMask == nullptr)
+    {
+        FullyVisibleMask.resize((NumBoxes + 31) / 32);
+        pFullyVisibleMask = FullyVisibleMask.data();
+    }
+
+    // Chunks must be multiples of 32 boxes so that threads never write to the same mask element.
+    // Small arrays are not worth the overhead of the thread pool.
+    constexpr size_t MinBoxesPerChunk = 4096;
+    constexpr size_t MaxChunks        = 64;
+
+    const size_t NumChunks = std::min((NumBoxes + MinBoxesPerChunk - 1) / MinBoxesPerChunk, MaxChunks);
+    if (pThreadPool == nullptr || NumChunks < 2)
+    {
+        CullBoxRange(Planes, pFrustumExt, Boxes, 0, NumBoxes, pVisibleMask, pFullyVisibleMask);
+    }
+    else
+    {
+        const size_t BoxesPerChunk = AlignUp((NumBoxes + NumChunks - 1) / NumChunks, size_t{32});
+
+        ParallelFor(pThreadPool, static_cast<Uint32>(NumChunks), [&](Uint32 Chunk) {
+            const size_t StartIdx = Chunk * BoxesPerChunk;
+            const size_t EndIdx   = std::min(StartIdx + BoxesPerChunk, NumBoxes);
+            if (StartIdx < EndIdx)
+                CullBoxRange(Planes, pFrustumExt, Boxes, StartIdx, EndIdx, pVisibleMask, pFullyVisibleMask);
+        });
+    }
+
+    Uint32 NumVisible = 0;
+    for (size_t i = 0; i < (NumBoxes + 31) / 32; ++i)
+        NumVisible += PlatformMisc::CountOneBits(pVisibleMask[i]);
+
+    return NumVisible;
+}
+
+} // namespace
+
+Uint32 GetBoxVisibilityBatch(const ViewFrustum&      Frustum,
+                             const BoundBoxArraySoA& Boxes,
+                             Uint32*                 pVisibleMask,
+                             Uint32*                 pFullyVisibleMask,
+                             FRUSTUM_PLANE_FLAGS     PlaneFlags,
+                             IThreadPool*            pThreadPool)
+{
+    return GetBoxVisibilityBatchImpl(Frustum, nullptr, Boxes, pVisibleMask, pFullyVisibleMask, PlaneFlags, pThreadPool);
+}
+
+Uint32 GetBoxVisibilityBatch(const ViewFrustumExt&   FrustumExt,
+                             const BoundBoxArraySoA& Boxes,
+                             Uint32*                 pVisibleMask,
+                             Uint32*                 pFullyVisibleMask,
+                             FRUSTUM_PLANE_FLAGS     PlaneFlags,
+                             IThreadPool*            pThreadPool)
+{
+    return GetBoxVisibilityBatchImpl(FrustumExt, &FrustumExt, Boxes, pVisibleMask, pFullyVisibleMask, PlaneFlags, pThreadPool);
+}
+
+} // namespace Diligent
@@ -27,10 +27,19 @@
 #include "Array2DTools.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
 
 #include "Intrinsics.hpp"
 #include "DebugUtilities.hpp"
 #include "Align.hpp"
+#include "PlatformMisc.hpp"
+
+#if DILIGENT_NEON_ENABLED && (defined(__aarch64__) || defined(_M_ARM64))
+// Double-precision and half-precision NEON instructions are only available on AArch64
+#    define DILIGENT_NEON64_ENABLED 1
+#endif
 
 namespace Diligent
 {
@@ -38,6 +47,90 @@ namespace Diligent
 namespace
 {
 
+// Parameters shared by all histogram implementations
+struct HistogramAttribs
+{
+    float MinValue;
+    float Scale;  // NumBins / (MaxValue - MinValue)
+    float MaxBin; // NumBins - 1
+};
+
+struct Array2DFunctions
+{
+    void (*MinMax)(const float* pData, size_t StrideInFloats, Uint32 Width, Uint32 Height, float& MinValue, float& MaxValue);
+    double (*Sum)(const float* pData, size_t StrideInFloats, Uint32 Width, Uint32 Height);
+    void (*Histogram)(const float* pData, size_t StrideInFloats, Uint32 Width, Uint32 Height, const HistogramAttribs& Attribs, Uint32* pBins);
+    void (*ToUnorm8)(const float* pSrc, size_t SrcStrideInFloats, Uint32 Width, Uint32 Height, float Scale, float Bias, Uint8* pDst, size_t DstStride);
+    void (*ToUnorm16)(const float* pSrc, size_t SrcStrideInFloats, Uint32 Width, Uint32 Height, float Scale, float Bias, Uint16* pDst, size_t DstStride);
+    void (*HalfToFloat)(const Uint16* pSrc, size_t SrcStride, Uint32 Width, Uint32 Height, float* pDst, size_t DstStrideInFloats);
+    // Processes DstWidth x DstHeight pixels, where SrcWidth >= 2 * DstWidth and SrcHeight >= 2 * DstHeight
+    void (*Downsample)(const float* pSrc, size_t SrcStrideInFloats, float* pDst, size_t DstStrideInFloats, Uint32 DstWidth, Uint32 DstHeight);
+};
+
+
+// Scalar functions that replicate the semantics of SSE min/max instructions:
+// if either argument is NaN, the second argument is returned.
+inline float SIMDMax(float a, float b)
+{
+    return a > b ? a : b;
+}
+
+inline float SIMDMin(float a, float b)
+{
+    return a < b ? a : b;
+}
+
+inline Uint32 GetHistogramBin(float Val, const HistogramAttribs& Attribs)
+{
+    const float Bin = SIMDMin(SIMDMax((Val - Attribs.MinValue) * Attribs.Scale, 0.f), Attribs.MaxBin);
+    return static_cast<Uint32>(Bin);
+}
+
+template <typename DstType, Uint32 MaxValue>
+inline DstType FloatToUnorm(float Val, float Scale, float Bias)
+{
+    float Norm = SIMDMin(SIMDMax(Val * Scale + Bias, 0.f), 1.f);
+    return static_cast<DstType>(Norm * static_cast<float>(MaxValue) + 0.5f);
+}
+
+inline float HalfToFloat(Uint16 Half)
+{
+    const Uint32 Sign     = Uint32{Half & 0x8000u} << 16u;
+    const Uint32 Exponent = (Half >> 10u) & 0x1Fu;
+    const Uint32 Mantissa = Half & 0x3FFu;
+
+    Uint32 Bits = 0;
+    if (Exponent == 0)
+    {
+        // Zero or denormal: Mantissa * 2^-24 is exactly representable as a normal float
+        const float Denorm = static_cast<float>(Mantissa) * (1.f / 16777216.f);
+        std::memcpy(&Bits, &Denorm, sizeof(Bits));
+        Bits |= Sign;
+    }
+    else if (Exponent == 0x1F)
+    {
+        // Infinity or NaN
+        Bits = Sign | 0x7F800000u | (Mantissa << 13u);
+    }
+    else
+    {
+        Bits = Sign | ((Exponent + (127u - 15u)) << 23u) | (Mantissa << 13u);
+    }
+
+    float Val;
+    std::memcpy(&Val, &Bits, sizeof(Val));
+    return Val;
+}
+
+inline float Downsample2x2(const float* pRow0, const float* pRow1, size_t Col)
+{
+    // Note: the order of operations must be the same in all implementations
+    return ((pRow0[Col * 2] + pRow1[Col * 2]) + (pRow0[Col * 2 + 1] + pRow1[Col * 2 + 1])) * 0.25f;
+}
+
+
+// ------------------------------------------------- Scalar ------------------------------------------------
+
 void GetArray2DMinMaxValueGeneric(const float* pData,
                                   size_t       StrideInFloats,
                                   Uint32       Width,
@@ -57,26 +150,317 @@ void GetArray2DMinMaxValueGeneric(const float* pData,
     }
 }
 
-#if DILIGENT_AVX2_ENABLED
-bool GetArray2DMinMaxValueAVX2(const float* pData,
-                               size_t       StrideInFloats,
-                               Uint32       Width,
-                               Uint32       Height,
-                               float&       MinValue,
-                               float&       MaxValue)
+double GetArray2DSumGeneric(const float* pData,
+                            size_t       StrideInFloats,
+                            Uint32       Width,
+                            Uint32       Height)
+{
+    double Sum = 0;
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRow = pData + row * StrideInFloats;
+        for (size_t col = 0; col < Width; ++col)
+            Sum += pRow[col];
+    }
+    return Sum;
+}
+
+void ComputeArray2DHistogramRow(const float* pRow, size_t StartCol, Uint32 Width, const HistogramAttribs& Attribs, Uint32* pBins)
+{
+    for (size_t col = StartCol; col < Width; ++col)
+        ++pBins[GetHistogramBin(pRow[col], Attribs)];
+}
+
+void ComputeArray2DHistogramGeneric(const float* pData, size_t StrideInFloats, Uint32 Width, Uint32 Height, const HistogramAttribs& Attribs, Uint32* pBins)
+{
+    for (size_t row = 0; row < Height; ++row)
+        ComputeArray2DHistogramRow(pData + row * StrideInFloats, 0, Width, Attribs, pBins);
+}
+
+template <typename DstType, Uint32 MaxValue>
+void ConvertFloatToUnormRow(const float* pSrc, size_t StartCol, Uint32 Width, float Scale, float Bias, DstType* pDst)
+{
+    for (size_t col = StartCol; col < Width; ++col)
+        pDst[col] = FloatToUnorm<DstType, MaxValue>(pSrc[col], Scale, Bias);
+}
+
+template <typename DstType, Uint32 MaxValue>
+void ConvertArray2DFloatToUnormGeneric(const float* pSrc, size_t SrcStrideInFloats, Uint32 Width, Uint32 Height, float Scale, float Bias, DstType* pDst, size_t DstStride)
+{
+    for (size_t row = 0; row < Height; ++row)
+        ConvertFloatToUnormRow<DstType, MaxValue>(pSrc + row * SrcStrideInFloats, 0, Width, Scale, Bias, pDst + row * DstStride);
+}
+
+void ConvertHalfToFloatRow(const Uint16* pSrc, size_t StartCol, Uint32 Width, float* pDst)
+{
+    for (size_t col = StartCol; col < Width; ++col)
+        pDst[col] = HalfToFloat(pSrc[col]);
+}
+
+void ConvertArray2DHalfToFloatGeneric(const Uint16* pSrc, size_t SrcStride, Uint32 Width, Uint32 Height, float* pDst, size_t DstStrideInFloats)
+{
+    for (size_t row = 0; row < Height; ++row)
+        ConvertHalfToFloatRow(pSrc + row * SrcStride, 0, Width, pDst + row * DstStrideInFloats);
+}
+
+void DownsampleRow(const float* pRow0, const float* pRow1, size_t StartCol, Uint32 DstWidth, float* pDst)
+{
+    for (size_t col = StartCol; col < DstWidth; ++col)
+        pDst[col] = Downsample2x2(pRow0, pRow1, col);
+}
+
+void DownsampleArray2DGeneric(const float* pSrc, size_t SrcStrideInFloats, float* pDst, size_t DstStrideInFloats, Uint32 DstWidth, Uint32 DstHeight)
+{
+    for (size_t row = 0; row < DstHeight; ++row)
+    {
+        const float* pRow0 = pSrc + (row * 2) * SrcStrideInFloats;
+        DownsampleRow(pRow0, pRow0 + SrcStrideInFloats, 0, DstWidth, pDst + row * DstStrideInFloats);
+    }
+}
+
+
+#if DILIGENT_AVX2_SUPPORTED
+
+// -------------------------------------------------- SSE2 -------------------------------------------------
+
+DILIGENT_TARGET_SSE2 void GetArray2DMinMaxValueSSE2(const float* pData,
+                                                    size_t       StrideInFloats,
+                                                    Uint32       Width,
+                                                    Uint32       Height,
+                                                    float&       MinValue,
+                                                    float&       MaxValue)
+{
+    __m128 mmMin = _mm_set1_ps(MinValue);
+    __m128 mmMax = _mm_set1_ps(MaxValue);
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRowStart = pData + row * StrideInFloats;
+        const float* pRowEnd   = pRowStart + Width;
+
+        const float* Ptr = pRowStart;
+        for (; Ptr + 4 <= pRowEnd; Ptr += 4)
+        {
+            const __m128 mmVal = _mm_loadu_ps(Ptr);
+
+            mmMin = _mm_min_ps(mmMin, mmVal);
+            mmMax = _mm_max_ps(mmMax, mmVal);
+        }
+
+        for (; Ptr < pRowEnd; ++Ptr)
+        {
+            MinValue = std::min(MinValue, *Ptr);
+            MaxValue = std::max(MaxValue, *Ptr);
+        }
+    }
+
+    alignas(16) float Min[4];
+    alignas(16) float Max[4];
+    _mm_store_ps(Min, mmMin);
+    _mm_store_ps(Max, mmMax);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        MinValue = std::min(MinValue, Min[i]);
+        MaxValue = std::max(MaxValue, Max[i]);
+    }
+}
+
+DILIGENT_TARGET_SSE2 double GetArray2DSumSSE2(const float* pData,
+                                              size_t       StrideInFloats,
+                                              Uint32       Width,
+                                              Uint32       Height)
+{
+    __m128d mmSum0 = _mm_setzero_pd();
+    __m128d mmSum1 = _mm_setzero_pd();
+
+    double Sum = 0;
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRow = pData + row * StrideInFloats;
+
+        size_t col = 0;
+        for (; col + 4 <= Width; col += 4)
+        {
+            const __m128 mmVal = _mm_loadu_ps(pRow + col);
+
+            mmSum0 = _mm_add_pd(mmSum0, _mm_cvtps_pd(mmVal));
+            mmSum1 = _mm_add_pd(mmSum1, _mm_cvtps_pd(_mm_movehl_ps(mmVal, mmVal)));
+        }
+
+        for (; col < Width; ++col)
+            Sum += pRow[col];
+    }
+
+    alignas(16) double Sums[2];
+    _mm_store_pd(Sums, _mm_add_pd(mmSum0, mmSum1));
+    return Sum + Sums[0] + Sums[1];
+}
+
+DILIGENT_TARGET_SSE2 void ComputeArray2DHistogramSSE2(const float* pData, size_t StrideInFloats, Uint32 Width, Uint32 Height, const HistogramAttribs& Attribs, Uint32* pBins)
 {
-    MinValue   = pData[0];
-    MaxValue   = pData[0];
-    auto mmMin = _mm256_set1_ps(MinValue);
-    auto mmMax = _mm256_set1_ps(MaxValue);
+    const __m128 mmMinValue = _mm_set1_ps(Attribs.MinValue);
+    const __m128 mmScale    = _mm_set1_ps(Attribs.Scale);
+    const __m128 mmMaxBin   = _mm_set1_ps(Attribs.MaxBin);
+    const __m128 mmZero     = _mm_setzero_ps();
+
+    alignas(16) Int32 Bins[4];
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRow = pData + row * StrideInFloats;
+
+        size_t col = 0;
+        for (; col + 4 <= Width; col += 4)
+        {
+            __m128 mmBin = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(pRow + col), mmMinValue), mmScale);
+            mmBin        = _mm_min_ps(_mm_max_ps(mmBin, mmZero), mmMaxBin);
+            _mm_store_si128(reinterpret_cast<__m128i*>(Bins), _mm_cvttps_epi32(mmBin));
+
+            ++pBins[Bins[0]];
+            ++pBins[Bins[1]];
+            ++pBins[Bins[2]];
+            ++pBins[Bins[3]];
+        }
+
+        ComputeArray2DHistogramRow(pRow, col, Width, Attribs, pBins);
+    }
+}
+
+DILIGENT_TARGET_SSE2 inline __m128i FloatToUnormSSE2(__m128 mmVal, __m128 mmScale, __m128 mmBias, __m128 mmMaxValue)
+{
+    __m128 mmNorm = _mm_add_ps(_mm_mul_ps(mmVal, mmScale), mmBias);
+    mmNorm        = _mm_min_ps(_mm_max_ps(mmNorm, _mm_setzero_ps()), _mm_set1_ps(1.f));
+    mmNorm        = _mm_add_ps(_mm_mul_ps(mmNorm, mmMaxValue), _mm_set1_ps(0.5f));
+    return _mm_cvttps_epi32(mmNorm);
+}
+
+DILIGENT_TARGET_SSE2 void ConvertArray2DFloatToUnorm8SSE2(const float* pSrc, size_t SrcStrideInFloats, Uint32 Width, Uint32 Height, float Scale, float Bias, Uint8* pDst, size_t DstStride)
+{
+    const __m128 mmScale    = _mm_set1_ps(Scale);
+    const __m128 mmBias     = _mm_set1_ps(Bias);
+    const __m128 mmMaxValue = _mm_set1_ps(255.f);
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pSrcRow = pSrc + row * SrcStrideInFloats;
+        Uint8*       pDstRow = pDst + row * DstStride;
+
+        size_t col = 0;
+        for (; col + 16 <= Width; col += 16)
+        {
+            const __m128i mmVal0 = FloatToUnormSSE2(_mm_loadu_ps(pSrcRow + col + 0), mmScale, mmBias, mmMaxValue);
+            const __m128i mmVal1 = FloatToUnormSSE2(_mm_loadu_ps(pSrcRow + col + 4), mmScale, mmBias, mmMaxValue);
+            const __m128i mmVal2 = FloatToUnormSSE2(_mm_loadu_ps(pSrcRow + col + 8), mmScale, mmBias, mmMaxValue);
+            const __m128i mmVal3 = FloatToUnormSSE2(_mm_loadu_ps(pSrcRow + col + 12), mmScale, mmBias, mmMaxValue);
+
+            // All values are in [0, 255] range, so saturation never occurs
+            const __m128i mmVal01 = _mm_packs_epi32(mmVal0, mmVal1);
+            const __m128i mmVal23 = _mm_packs_epi32(mmVal2, mmVal3);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDstRow + col), _mm_packus_epi16(mmVal01, mmVal23));
+        }
+
+        ConvertFloatToUnormRow<Uint8, 255>(pSrcRow, col, Width, Scale, Bias, pDstRow);
+    }
+}
+
+DILIGENT_TARGET_SSE2 void ConvertArray2DFloatToUnorm16SSE2(const float* pSrc, size_t SrcStrideInFloats, Uint32 Width, Uint32 Height, float Scale, float Bias, Uint16* pDst, size_t DstStride)
+{
+    const __m128  mmScale    = _mm_set1_ps(Scale);
+    const __m128  mmBias     = _mm_set1_ps(Bias);
+    const __m128  mmMaxValue = _mm_set1_ps(65535.f);
+    const __m128i mmOffset32 = _mm_set1_epi32(32768);
+    const __m128i mmOffset16 = _mm_set1_epi16(-32768);
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pSrcRow = pSrc + row * SrcStrideInFloats;
+        Uint16*      pDstRow = pDst + row * DstStride;
+
+        size_t col = 0;
+        for (; col + 8 <= Width; col += 8)
+        {
+            const __m128i mmVal0 = FloatToUnormSSE2(_mm_loadu_ps(pSrcRow + col + 0), mmScale, mmBias, mmMaxValue);
+            const __m128i mmVal1 = FloatToUnormSSE2(_mm_loadu_ps(pSrcRow + col + 4), mmScale, mmBias, mmMaxValue);
+
+            // SSE2 does not have unsigned 32-bit to 16-bit pack, so shift the values
+            // to the signed range, pack them and shift back.
+            const __m128i mmVal01 = _mm_packs_epi32(_mm_sub_epi32(mmVal0, mmOffset32), _mm_sub_epi32(mmVal1, mmOffset32));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDstRow + col), _mm_xor_si128(mmVal01, mmOffset16));
+        }
+
+        ConvertFloatToUnormRow<Uint16, 65535>(pSrcRow, col, Width, Scale, Bias, pDstRow);
+    }
+}
+
+DILIGENT_TARGET_SSE2 void ConvertArray2DHalfToFloatSSE2(const Uint16* pSrc, size_t SrcStride, Uint32 Width, Uint32 Height, float* pDst, size_t DstStrideInFloats)
+{
+    // Based on the half_to_float_SSE2 function by Fabian Giesen.
+    // Multiplication by 2^112 rebiases the exponent and exactly converts denormals.
+    const __m128i mmMaskNoSign = _mm_set1_epi32(0x7FFF);
+    const __m128  mmMagic      = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+    const __m128i mmWasInfNan  = _mm_set1_epi32(0x7BFF);
+    const __m128  mmExpInfNan  = _mm_castsi128_ps(_mm_set1_epi32(255 << 23));
+    const __m128i mmZero       = _mm_setzero_si128();
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const Uint16* pSrcRow = pSrc + row * SrcStride;
+        float*        pDstRow = pDst + row * DstStrideInFloats;
+
+        size_t col = 0;
+        for (; col + 4 <= Width; col += 4)
+        {
+            const __m128i mmHalf       = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrcRow + col)), mmZero);
+            const __m128i mmExpMant    = _mm_and_si128(mmMaskNoSign, mmHalf);
+            const __m128i mmJustSign   = _mm_xor_si128(mmHalf, mmExpMant);
+            const __m128  mmScaled     = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(mmExpMant, 13)), mmMagic);
+            const __m128  mmIsInfNan   = _mm_castsi128_ps(_mm_cmpgt_epi32(mmExpMant, mmWasInfNan));
+            const __m128  mmSignInfNan = _mm_or_ps(_mm_castsi128_ps(_mm_slli_epi32(mmJustSign, 16)), _mm_and_ps(mmIsInfNan, mmExpInfNan));
+            _mm_storeu_ps(pDstRow + col, _mm_or_ps(mmScaled, mmSignInfNan));
+        }
+
+        ConvertHalfToFloatRow(pSrcRow, col, Width, pDstRow);
+    }
+}
+
+DILIGENT_TARGET_SSE2 void DownsampleArray2DSSE2(const float* pSrc, size_t SrcStrideInFloats, float* pDst, size_t DstStrideInFloats, Uint32 DstWidth, Uint32 DstHeight)
+{
+    const __m128 mmQuarter = _mm_set1_ps(0.25f);
+    for (size_t row = 0; row < DstHeight; ++row)
+    {
+        const float* pRow0   = pSrc + (row * 2) * SrcStrideInFloats;
+        const float* pRow1   = pRow0 + SrcStrideInFloats;
+        float*       pDstRow = pDst + row * DstStrideInFloats;
+
+        size_t col = 0;
+        for (; col + 4 <= DstWidth; col += 4)
+        {
+            const __m128 mmSum0 = _mm_add_ps(_mm_loadu_ps(pRow0 + col * 2 + 0), _mm_loadu_ps(pRow1 + col * 2 + 0));
+            const __m128 mmSum1 = _mm_add_ps(_mm_loadu_ps(pRow0 + col * 2 + 4), _mm_loadu_ps(pRow1 + col * 2 + 4));
+
+            const __m128 mmEven = _mm_shuffle_ps(mmSum0, mmSum1, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m128 mmOdd  = _mm_shuffle_ps(mmSum0, mmSum1, _MM_SHUFFLE(3, 1, 3, 1));
+            _mm_storeu_ps(pDstRow + col, _mm_mul_ps(_mm_add_ps(mmEven, mmOdd), mmQuarter));
+        }
+
+        DownsampleRow(pRow0, pRow1, col, DstWidth, pDstRow);
+    }
+}
+
+
+// -------------------------------------------------- AVX2 -------------------------------------------------
+
+DILIGENT_TARGET_AVX2 void GetArray2DMinMaxValueAVX2(const float* pData,
+                                                    size_t       StrideInFloats,
+                                                    Uint32       Width,
+                                                    Uint32       Height,
+                                                    float&       MinValue,
+                                                    float&       MaxValue)
+{
+    __m256 mmMin = _mm256_set1_ps(MinValue);
+    __m256 mmMax = _mm256_set1_ps(MaxValue);
     for (size_t row = 0; row < Height; ++row)
     {
         const float* pRowStart = pData + row * StrideInFloats;
         const float* pRowEnd   = pRowStart + Width;
-        const float* pAVXEnd   = pRowEnd - 8;
 
         const float* Ptr = pRowStart;
-        for (; Ptr < pAVXEnd; Ptr += 8)
+        for (; Ptr + 8 <= pRowEnd; Ptr += 8)
         {
             // NOTE: MSVC generates vmovups when using _mm256_load_ps regardless,
             //       so no reason to bother with aligning the pointer.
@@ -106,6 +490,7 @@ bool GetArray2DMinMaxValueAVX2(const float* pData,
     // | max(A, B) | max(A, B) | max(C, D) | max(C, D) |  =>  | max(C, D) | max(C, D) | max(A, B) | max(A, B) |
     mmMin = _mm256_min_ps(mmMin, _mm256_permute_ps(mmMin, Shuffle2301));
     mmMax = _mm256_max_ps(mmMax, _mm256_permute_ps(mmMax, Shuffle2301));
+#    undef MAKE_SHUFFLE
 
     // Note that _mm256_permute_ps is faster than _mm256_permutevar8x32_ps
     const auto SelectElement4 = _mm256_set1_epi32(4);
@@ -122,13 +507,536 @@ bool GetArray2DMinMaxValueAVX2(const float* pData,
     _mm_store_ss(&Max0, mMax0123);
     MinValue = std::min(Min0, MinValue);
     MaxValue = std::max(Max0, MaxValue);
+}
 
-    return true;
+DILIGENT_TARGET_AVX2 double GetArray2DSumAVX2(const float* pData,
+                                              size_t       StrideInFloats,
+                                              Uint32       Width,
+                                              Uint32       Height)
+{
+    __m256d mmSum0 = _mm256_setzero_pd();
+    __m256d mmSum1 = _mm256_setzero_pd();
+
+    double Sum = 0;
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRow = pData + row * StrideInFloats;
+
+        size_t col = 0;
+        for (; col + 8 <= Width; col += 8)
+        {
+            const __m256 mmVal = _mm256_loadu_ps(pRow + col);
+
+            mmSum0 = _mm256_add_pd(mmSum0, _mm256_cvtps_pd(_mm256_castps256_ps128(mmVal)));
+            mmSum1 = _mm256_add_pd(mmSum1, _mm256_cvtps_pd(_mm256_extractf128_ps(mmVal, 1)));
+        }
+
+        for (; col < Width; ++col)
+            Sum += pRow[col];
+    }
+
+    alignas(32) double Sums[4];
+    _mm256_store_pd(Sums, _mm256_add_pd(mmSum0, mmSum1));
+    return Sum + (Sums[0] + Sums[1]) + (Sums[2] + Sums[3]);
+}
+
+DILIGENT_TARGET_AVX2 void ComputeArray2DHistogramAVX2(const float* pData, size_t StrideInFloats, Uint32 Width, Uint32 Height, const HistogramAttribs& Attribs, Uint32* pBins)
+{
+    const __m256 mmMinValue = _mm256_set1_ps(Attribs.MinValue);
+    const __m256 mmScale    = _mm256_set1_ps(Attribs.Scale);
+    const __m256 mmMaxBin   = _mm256_set1_ps(Attribs.MaxBin);
+    const __m256 mmZero     = _mm256_setzero_ps();
+
+    alignas(32) Int32 Bins[8];
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRow = pData + row * StrideInFloats;
+
+        size_t col = 0;
+        for (; col + 8 <= Width; col += 8)
+        {
+            __m256 mmBin = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(pRow + col), mmMinValue), mmScale);
+            mmBin        = _mm256_min_ps(_mm256_max_ps(mmBin, mmZero), mmMaxBin);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(Bins), _mm256_cvttps_epi32(mmBin));
+
+            for (size_t i = 0; i < 8; ++i)
+                ++pBins[Bins[i]];
+        }
+
+        ComputeArray2DHistogramRow(pRow, col, Width, Attribs, pBins);
+    }
+}
+
+DILIGENT_TARGET_AVX2 inline __m256i FloatToUnormAVX2(__m256 mmVal, __m256 mmScale, __m256 mmBias, __m256 mmMaxValue)
+{
+    __m256 mmNorm = _mm256_add_ps(_mm256_mul_ps(mmVal, mmScale), mmBias);
+    mmNorm        = _mm256_min_ps(_mm256_max_ps(mmNorm, _mm256_setzero_ps()), _mm256_set1_ps(1.f));
+    mmNorm        = _mm256_add_ps(_mm256_mul_ps(mmNorm, mmMaxValue), _mm256_set1_ps(0.5f));
+    return _mm256_cvttps_epi32(mmNorm);
+}
+
+DILIGENT_TARGET_AVX2 void ConvertArray2DFloatToUnorm8AVX2(const float* pSrc, size_t SrcStrideInFloats, Uint32 Width, Uint32 Height, float Scale, float Bias, Uint8* pDst, size_t DstStride)
+{
+    const __m256  mmScale    = _mm256_set1_ps(Scale);
+    const __m256  mmBias     = _mm256_set1_ps(Bias);
+    const __m256  mmMaxValue = _mm256_set1_ps(255.f);
+    const __m256i mmPermute  = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pSrcRow = pSrc + row * SrcStrideInFloats;
+        Uint8*       pDstRow = pDst + row * DstStride;
+
+        size_t col = 0;
+        for (; col + 32 <= Width; col += 32)
+        {
+            const __m256i mmVal0 = FloatToUnormAVX2(_mm256_loadu_ps(pSrcRow + col + 0), mmScale, mmBias, mmMaxValue);
+            const __m256i mmVal1 = FloatToUnormAVX2(_mm256_loadu_ps(pSrcRow + col + 8), mmScale, mmBias, mmMaxValue);
+            const __m256i mmVal2 = FloatToUnormAVX2(_mm256_loadu_ps(pSrcRow + col + 16), mmScale, mmBias, mmMaxValue);
+            const __m256i mmVal3 = FloatToUnormAVX2(_mm256_loadu_ps(pSrcRow + col + 24), mmScale, mmBias, mmMaxValue);
+
+            // Packing works within 128-bit lanes, so the result contains 4-byte groups in the following order:
+            // | 0-3 | 8-11 | 16-19 | 24-27 | 4-7 | 12-15 | 20-23 | 28-31 |
+            const __m256i mmVal01  = _mm256_packus_epi32(mmVal0, mmVal1);
+            const __m256i mmVal23  = _mm256_packus_epi32(mmVal2, mmVal3);
+            const __m256i mmPacked = _mm256_packus_epi16(mmVal01, mmVal23);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDstRow + col), _mm256_permutevar8x32_epi32(mmPacked, mmPermute));
+        }
+
+        ConvertFloatToUnormRow<Uint8, 255>(pSrcRow, col, Width, Scale, Bias, pDstRow);
+    }
+}
+
+DILIGENT_TARGET_AVX2 void ConvertArray2DFloatToUnorm16AVX2(const float* pSrc, size_t SrcStrideInFloats, Uint32 Width, Uint32 Height, float Scale, float Bias, Uint16* pDst, size_t DstStride)
+{
+    const __m256 mmScale    = _mm256_set1_ps(Scale);
+    const __m256 mmBias     = _mm256_set1_ps(Bias);
+    const __m256 mmMaxValue = _mm256_set1_ps(65535.f);
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pSrcRow = pSrc + row * SrcStrideInFloats;
+        Uint16*      pDstRow = pDst + row * DstStride;
+
+        size_t col = 0;
+        for (; col + 16 <= Width; col += 16)
+        {
+            const __m256i mmVal0 = FloatToUnormAVX2(_mm256_loadu_ps(pSrcRow + col + 0), mmScale, mmBias, mmMaxValue);
+            const __m256i mmVal1 = FloatToUnormAVX2(_mm256_loadu_ps(pSrcRow + col + 8), mmScale, mmBias, mmMaxValue);
+
+            // | 0-3 | 8-11 | 4-7 | 12-15 |  =>  | 0-3 | 4-7 | 8-11 | 12-15 |
+            const __m256i mmPacked = _mm256_packus_epi32(mmVal0, mmVal1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDstRow + col), _mm256_permute4x64_epi64(mmPacked, _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+
+        ConvertFloatToUnormRow<Uint16, 65535>(pSrcRow, col, Width, Scale, Bias, pDstRow);
+    }
 }
+
+DILIGENT_TARGET_AVX2_F16C void ConvertArray2DHalfToFloatF16C(const Uint16* pSrc, size_t SrcStride, Uint32 Width, Uint32 Height, float* pDst, size_t DstStrideInFloats)
+{
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const Uint16* pSrcRow = pSrc + row * SrcStride;
+        float*        pDstRow = pDst + row * DstStrideInFloats;
+
+        size_t col = 0;
+        for (; col + 8 <= Width; col += 8)
+        {
+            const __m128i mmHalf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrcRow + col));
+            _mm256_storeu_ps(pDstRow + col, _mm256_cvtph_ps(mmHalf));
+        }
+
+        ConvertHalfToFloatRow(pSrcRow, col, Width, pDstRow);
+    }
+}
+
+DILIGENT_TARGET_AVX2 void DownsampleArray2DAVX2(const float* pSrc, size_t SrcStrideInFloats, float* pDst, size_t DstStrideInFloats, Uint32 DstWidth, Uint32 DstHeight)
+{
+    const __m256 mmQuarter = _mm256_set1_ps(0.25f);
+    for (size_t row = 0; row < DstHeight; ++row)
+    {
+        const float* pRow0   = pSrc + (row * 2) * SrcStrideInFloats;
+        const float* pRow1   = pRow0 + SrcStrideInFloats;
+        float*       pDstRow = pDst + row * DstStrideInFloats;
+
+        size_t col = 0;
+        for (; col + 8 <= DstWidth; col += 8)
+        {
+            const __m256 mmSum0 = _mm256_add_ps(_mm256_loadu_ps(pRow0 + col * 2 + 0), _mm256_loadu_ps(pRow1 + col * 2 + 0));
+            const __m256 mmSum1 = _mm256_add_ps(_mm256_loadu_ps(pRow0 + col * 2 + 8), _mm256_loadu_ps(pRow1 + col * 2 + 8));
+
+            // Shuffle works within 128-bit lanes, so the 64-bit pairs of the result are in the following order:
+            // | 0, 1 | 4, 5 | 2, 3 | 6, 7 |
+            const __m256 mmEven = _mm256_shuffle_ps(mmSum0, mmSum1, _MM_SHUFFLE(2, 0, 2, 0));
+            const __m256 mmOdd  = _mm256_shuffle_ps(mmSum0, mmSum1, _MM_SHUFFLE(3, 1, 3, 1));
+            const __m256 mmRes  = _mm256_mul_ps(_mm256_add_ps(mmEven, mmOdd), mmQuarter);
+            _mm256_storeu_ps(pDstRow + col, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(mmRes), _MM_SHUFFLE(3, 1, 2, 0))));
+        }
+
+        DownsampleRow(pRow0, pRow1, col, DstWidth, pDstRow);
+    }
+}
+
+#endif // DILIGENT_AVX2_SUPPORTED
+
+
+#if DILIGENT_NEON_ENABLED
+
+// -------------------------------------------------- NEON -------------------------------------------------
+
+void GetArray2DMinMaxValueNEON(const float* pData,
+                               size_t       StrideInFloats,
+                               Uint32       Width,
+                               Uint32       Height,
+                               float&       MinValue,
+                               float&       MaxValue)
+{
+    float32x4_t mmMin = vdupq_n_f32(MinValue);
+    float32x4_t mmMax = vdupq_n_f32(MaxValue);
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRowStart = pData + row * StrideInFloats;
+        const float* pRowEnd   = pRowStart + Width;
+
+        const float* Ptr = pRowStart;
+        for (; Ptr + 4 <= pRowEnd; Ptr += 4)
+        {
+            const float32x4_t mmVal = vld1q_f32(Ptr);
+
+            mmMin = vminq_f32(mmMin, mmVal);
+            mmMax = vmaxq_f32(mmMax, mmVal);
+        }
+
+        for (; Ptr < pRowEnd; ++Ptr)
+        {
+            MinValue = std::min(MinValue, *Ptr);
+            MaxValue = std::max(MaxValue, *Ptr);
+        }
+    }
+
+    float Min[4];
+    float Max[4];
+    vst1q_f32(Min, mmMin);
+    vst1q_f32(Max, mmMax);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        MinValue = std::min(MinValue, Min[i]);
+        MaxValue = std::max(MaxValue, Max[i]);
+    }
+}
+
+#    if DILIGENT_NEON64_ENABLED
+double GetArray2DSumNEON(const float* pData,
+                         size_t       StrideInFloats,
+                         Uint32       Width,
+                         Uint32       Height)
+{
+    float64x2_t mmSum0 = vdupq_n_f64(0);
+    float64x2_t mmSum1 = vdupq_n_f64(0);
+
+    double Sum = 0;
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRow = pData + row * StrideInFloats;
+
+        size_t col = 0;
+        for (; col + 4 <= Width; col += 4)
+        {
+            const float32x4_t mmVal = vld1q_f32(pRow + col);
+
+            mmSum0 = vaddq_f64(mmSum0, vcvt_f64_f32(vget_low_f32(mmVal)));
+            mmSum1 = vaddq_f64(mmSum1, vcvt_f64_f32(vget_high_f32(mmVal)));
+        }
+
+        for (; col < Width; ++col)
+            Sum += pRow[col];
+    }
+
+    const float64x2_t mmSum = vaddq_f64(mmSum0, mmSum1);
+    return Sum + vgetq_lane_f64(mmSum, 0) + vgetq_lane_f64(mmSum, 1);
+}
+#    endif
+
+// Replicates the semantics of SSE max/min instructions (the second argument is returned for NaNs)
+inline float32x4_t SIMDMaxNEON(float32x4_t a, float32x4_t b)
+{
+    return vbslq_f32(vcgtq_f32(a, b), a, b);
+}
+
+inline float32x4_t SIMDMinNEON(float32x4_t a, float32x4_t b)
+{
+    return vbslq_f32(vcltq_f32(a, b), a, b);
+}
+
+void ComputeArray2DHistogramNEON(const float* pData, size_t StrideInFloats, Uint32 Width, Uint32 Height, const HistogramAttribs& Attribs, Uint32* pBins)
+{
+    const float32x4_t mmMinValue = vdupq_n_f32(Attribs.MinValue);
+    const float32x4_t mmScale    = vdupq_n_f32(Attribs.Scale);
+    const float32x4_t mmMaxBin   = vdupq_n_f32(Attribs.MaxBin);
+    const float32x4_t mmZero     = vdupq_n_f32(0);
+
+    Uint32 Bins[4];
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pRow = pData + row * StrideInFloats;
+
+        size_t col = 0;
+        for (; col + 4 <= Width; col += 4)
+        {
+            float32x4_t mmBin = vmulq_f32(vsubq_f32(vld1q_f32(pRow + col), mmMinValue), mmScale);
+            mmBin             = SIMDMinNEON(SIMDMaxNEON(mmBin, mmZero), mmMaxBin);
+            vst1q_u32(Bins, vcvtq_u32_f32(mmBin));
+
+            ++pBins[Bins[0]];
+            ++pBins[Bins[1]];
+            ++pBins[Bins[2]];
+            ++pBins[Bins[3]];
+        }
+
+        ComputeArray2DHistogramRow(pRow, col, Width, Attribs, pBins);
+    }
+}
+
+inline uint32x4_t FloatToUnormNEON(float32x4_t mmVal, float32x4_t mmScale, float32x4_t mmBias, float32x4_t mmMaxValue)
+{
+    float32x4_t mmNorm = vaddq_f32(vmulq_f32(mmVal, mmScale), mmBias);
+    mmNorm             = SIMDMinNEON(SIMDMaxNEON(mmNorm, vdupq_n_f32(0)), vdupq_n_f32(1));
+    mmNorm             = vaddq_f32(vmulq_f32(mmNorm, mmMaxValue), vdupq_n_f32(0.5f));
+    return vcvtq_u32_f32(mmNorm);
+}
+
+void ConvertArray2DFloatToUnorm8NEON(const float* pSrc, size_t SrcStrideInFloats, Uint32 Width, Uint32 Height, float Scale, float Bias, Uint8* pDst, size_t DstStride)
+{
+    const float32x4_t mmScale    = vdupq_n_f32(Scale);
+    const float32x4_t mmBias     = vdupq_n_f32(Bias);
+    const float32x4_t mmMaxValue = vdupq_n_f32(255.f);
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pSrcRow = pSrc + row * SrcStrideInFloats;
+        Uint8*       pDstRow = pDst + row * DstStride;
+
+        size_t col = 0;
+        for (; col + 8 <= Width; col += 8)
+        {
+            const uint32x4_t mmVal0 = FloatToUnormNEON(vld1q_f32(pSrcRow + col + 0), mmScale, mmBias, mmMaxValue);
+            const uint32x4_t mmVal1 = FloatToUnormNEON(vld1q_f32(pSrcRow + col + 4), mmScale, mmBias, mmMaxValue);
+            vst1_u8(pDstRow + col, vmovn_u16(vcombine_u16(vmovn_u32(mmVal0), vmovn_u32(mmVal1))));
+        }
+
+        ConvertFloatToUnormRow<Uint8, 255>(pSrcRow, col, Width, Scale, Bias, pDstRow);
+    }
+}
+
+void ConvertArray2DFloatToUnorm16NEON(const float* pSrc, size_t SrcStrideInFloats, Uint32 Width, Uint32 Height, float Scale, float Bias, Uint16* pDst, size_t DstStride)
+{
+    const float32x4_t mmScale    = vdupq_n_f32(Scale);
+    const float32x4_t mmBias     = vdupq_n_f32(Bias);
+    const float32x4_t mmMaxValue = vdupq_n_f32(65535.f);
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const float* pSrcRow = pSrc + row * SrcStrideInFloats;
+        Uint16*      pDstRow = pDst + row * DstStride;
+
+        size_t col = 0;
+        for (; col + 8 <= Width; col += 8)
+        {
+            const uint32x4_t mmVal0 = FloatToUnormNEON(vld1q_f32(pSrcRow + col + 0), mmScale, mmBias, mmMaxValue);
+            const uint32x4_t mmVal1 = FloatToUnormNEON(vld1q_f32(pSrcRow + col + 4), mmScale, mmBias, mmMaxValue);
+            vst1q_u16(pDstRow + col, vcombine_u16(vmovn_u32(mmVal0), vmovn_u32(mmVal1)));
+        }
+
+        ConvertFloatToUnormRow<Uint16, 65535>(pSrcRow, col, Width, Scale, Bias, pDstRow);
+    }
+}
+
+#    if DILIGENT_NEON64_ENABLED
+void ConvertArray2DHalfToFloatNEON(const Uint16* pSrc, size_t SrcStride, Uint32 Width, Uint32 Height, float* pDst, size_t DstStrideInFloats)
+{
+    for (size_t row = 0; row < Height; ++row)
+    {
+        const Uint16* pSrcRow = pSrc + row * SrcStride;
+        float*        pDstRow = pDst + row * DstStrideInFloats;
+
+        size_t col = 0;
+        for (; col + 4 <= Width; col += 4)
+        {
+            const float16x4_t mmHalf = vreinterpret_f16_u16(vld1_u16(pSrcRow + col));
+            vst1q_f32(pDstRow + col, vcvt_f32_f16(mmHalf));
+        }
+
+        ConvertHalfToFloatRow(pSrcRow, col, Width, pDstRow);
+    }
+}
+#    endif
+
+void DownsampleArray2DNEON(const float* pSrc, size_t SrcStrideInFloats, float* pDst, size_t DstStrideInFloats, Uint32 DstWidth, Uint32 DstHeight)
+{
+    const float32x4_t mmQuarter = vdupq_n_f32(0.25f);
+    for (size_t row = 0; row < DstHeight; ++row)
+    {
+        const float* pRow0   = pSrc + (row * 2) * SrcStrideInFloats;
+        const float* pRow1   = pRow0 + SrcStrideInFloats;
+        float*       pDstRow = pDst + row * DstStrideInFloats;
+
+        size_t col = 0;
+        for (; col + 4 <= DstWidth; col += 4)
+        {
+            // De-interleave even and odd columns
+            const float32x4x2_t mmRow0 = vld2q_f32(pRow0 + col * 2);
+            const float32x4x2_t mmRow1 = vld2q_f32(pRow1 + col * 2);
+
+            const float32x4_t mmEven = vaddq_f32(mmRow0.val[0], mmRow1.val[0]);
+            const float32x4_t mmOdd  = vaddq_f32(mmRow0.val[1], mmRow1.val[1]);
+            vst1q_f32(pDstRow + col, vmulq_f32(vaddq_f32(mmEven, mmOdd), mmQuarter));
+        }
+
+        DownsampleRow(pRow0, pRow1, col, DstWidth, pDstRow);
+    }
+}
+
+#endif // DILIGENT_NEON_ENABLED
+
+
+Array2DFunctions GetArray2DFunctions(ARRAY2D_SIMD_IMPL Impl)
+{
+    Array2DFunctions Funcs{
+        GetArray2DMinMaxValueGeneric,
+        GetArray2DSumGeneric,
+        ComputeArray2DHistogramGeneric,
+        ConvertArray2DFloatToUnormGeneric<Uint8, 255>,
+        ConvertArray2DFloatToUnormGeneric<Uint16, 65535>,
+        ConvertArray2DHalfToFloatGeneric,
+        DownsampleArray2DGeneric,
+    };
+
+    switch (Impl)
+    {
+        case ARRAY2D_SIMD_IMPL_SCALAR:
+            break;
+
+#if DILIGENT_AVX2_SUPPORTED
+        case ARRAY2D_SIMD_IMPL_SSE2:
+            Funcs.MinMax      = GetArray2DMinMaxValueSSE2;
+            Funcs.Sum         = GetArray2DSumSSE2;
+            Funcs.Histogram   = ComputeArray2DHistogramSSE2;
+            Funcs.ToUnorm8    = ConvertArray2DFloatToUnorm8SSE2;
+            Funcs.ToUnorm16   = ConvertArray2DFloatToUnorm16SSE2;
+            Funcs.HalfToFloat = ConvertArray2DHalfToFloatSSE2;
+            Funcs.Downsample  = DownsampleArray2DSSE2;
+            break;
+
+        case ARRAY2D_SIMD_IMPL_AVX2:
+            Funcs.MinMax      = GetArray2DMinMaxValueAVX2;
+            Funcs.Sum         = GetArray2DSumAVX2;
+            Funcs.Histogram   = ComputeArray2DHistogramAVX2;
+            Funcs.ToUnorm8    = ConvertArray2DFloatToUnorm8AVX2;
+            Funcs.ToUnorm16   = ConvertArray2DFloatToUnorm16AVX2;
+            Funcs.HalfToFloat = (PlatformMisc::GetCPUFeatures() & CPU_FEATURE_FLAG_F16C) != 0 ?
+                ConvertArray2DHalfToFloatF16C :
+                ConvertArray2DHalfToFloatSSE2;
+            Funcs.Downsample = DownsampleArray2DAVX2;
+            break;
+#endif
+
+#if DILIGENT_NEON_ENABLED
+        case ARRAY2D_SIMD_IMPL_NEON:
+            Funcs.MinMax = GetArray2DMinMaxValueNEON;
+#    if DILIGENT_NEON64_ENABLED
+            Funcs.Sum         = GetArray2DSumNEON;
+            Funcs.HalfToFloat = ConvertArray2DHalfToFloatNEON;
+#    endif
+            Funcs.Histogram  = ComputeArray2DHistogramNEON;
+            Funcs.ToUnorm8   = ConvertArray2DFloatToUnorm8NEON;
+            Funcs.ToUnorm16  = ConvertArray2DFloatToUnorm16NEON;
+            Funcs.Downsample = DownsampleArray2DNEON;
+            break;
 #endif
 
+        default:
+            UNEXPECTED("Unsupported SIMD implementation");
+    }
+
+    return Funcs;
+}
+
+ARRAY2D_SIMD_IMPL GetBestSupportedArray2DSIMDImpl()
+{
+    if (IsArray2DSIMDImplSupported(ARRAY2D_SIMD_IMPL_AVX2))
+        return ARRAY2D_SIMD_IMPL_AVX2;
+    if (IsArray2DSIMDImplSupported(ARRAY2D_SIMD_IMPL_SSE2))
+        return ARRAY2D_SIMD_IMPL_SSE2;
+    if (IsArray2DSIMDImplSupported(ARRAY2D_SIMD_IMPL_NEON))
+        return ARRAY2D_SIMD_IMPL_NEON;
+    return ARRAY2D_SIMD_IMPL_SCALAR;
+}
+
+// Function tables for all supported implementations, indexed by ARRAY2D_SIMD_IMPL
+using Array2DFunctionTables = std::array<Array2DFunctions, ARRAY2D_SIMD_IMPL_COUNT>;
+
+const Array2DFunctionTables& GetArray2DFunctionTables()
+{
+    static const Array2DFunctionTables Tables = [] {
+        Array2DFunctionTables Tables{};
+        for (Uint32 Impl = ARRAY2D_SIMD_IMPL_SCALAR; Impl < ARRAY2D_SIMD_IMPL_COUNT; ++Impl)
+        {
+            if (IsArray2DSIMDImplSupported(static_cast<ARRAY2D_SIMD_IMPL>(Impl)))
+                Tables[Impl] = GetArray2DFunctions(static_cast<ARRAY2D_SIMD_IMPL>(Impl));
+        }
+        Tables[ARRAY2D_SIMD_IMPL_AUTO] = Tables[GetBestSupportedArray2DSIMDImpl()];
+        return Tables;
+    }();
+    return Tables;
+}
+
+std::atomic<ARRAY2D_SIMD_IMPL> g_Array2DSIMDImpl{ARRAY2D_SIMD_IMPL_AUTO};
+
+const Array2DFunctions& GetCurrentArray2DFunctions()
+{
+    return GetArray2DFunctionTables()[g_Array2DSIMDImpl.load(std::memory_order_relaxed)];
+}
+
 } // namespace
 
+bool IsArray2DSIMDImplSupported(ARRAY2D_SIMD_IMPL Impl)
+{
+    switch (Impl)
+    {
+        case ARRAY2D_SIMD_IMPL_AUTO:
+        case ARRAY2D_SIMD_IMPL_SCALAR:
+            return true;
+
+#if DILIGENT_AVX2_SUPPORTED
+        case ARRAY2D_SIMD_IMPL_SSE2:
+            return (PlatformMisc::GetCPUFeatures() & CPU_FEATURE_FLAG_SSE2) != 0;
+
+        case ARRAY2D_SIMD_IMPL_AVX2:
+            return (PlatformMisc::GetCPUFeatures() & CPU_FEATURE_FLAG_AVX2) != 0;
+#endif
+
+#if DILIGENT_NEON_ENABLED
+        case ARRAY2D_SIMD_IMPL_NEON:
+            return (PlatformMisc::GetCPUFeatures() & CPU_FEATURE_FLAG_NEON) != 0;
+#endif
+
+        default:
+            return false;
+    }
+}
+
+bool SetArray2DSIMDImpl(ARRAY2D_SIMD_IMPL Impl)
+{
+    if (!IsArray2DSIMDImplSupported(Impl))
+        return false;
+
+    g_Array2DSIMDImpl.store(Impl);
+    return true;
+}
+
+ARRAY2D_SIMD_IMPL GetArray2DSIMDImpl()
+{
+    const ARRAY2D_SIMD_IMPL Impl = g_Array2DSIMDImpl.load();
+    return Impl != ARRAY2D_SIMD_IMPL_AUTO ? Impl : GetBestSupportedArray2DSIMDImpl();
+}
+
 void GetArray2DMinMaxValue(const float* pData,
                            size_t       StrideInFloats,
                            Uint32       Width,
@@ -144,12 +1052,146 @@ void GetArray2DMinMaxValue(const float* pData,
     DEV_CHECK_ERR(AlignDown(pData, alignof(float)) == pData, "Data pointer is not naturally aligned");
 
     MinValue = MaxValue = pData[0];
-#if DILIGENT_AVX2_ENABLED
-    if (GetArray2DMinMaxValueAVX2(pData, StrideInFloats, Width, Height, MinValue, MaxValue))
+    GetCurrentArray2DFunctions().MinMax(pData, StrideInFloats, Width, Height, MinValue, MaxValue);
+}
+
+double GetArray2DSum(const float* pData,
+                     size_t       StrideInFloats,
+                     Uint32       Width,
+                     Uint32       Height)
+{
+    if (Width == 0 || Height == 0)
+        return 0;
+
+    DEV_CHECK_ERR(pData != nullptr, "Data pointer must not be null");
+    DEV_CHECK_ERR(Height == 1 || StrideInFloats >= Width, "Row stride (", StrideInFloats, ") must be at least ", Width);
+
+    return GetCurrentArray2DFunctions().Sum(pData, StrideInFloats, Width, Height);
+}
+
+void ComputeArray2DHistogram(const float* pData,
+                             size_t       StrideInFloats,
+                             Uint32       Width,
+                             Uint32       Height,
+                             float        MinValue,
+                             float        MaxValue,
+                             Uint32       NumBins,
+                             Uint32*      pBins)
+{
+    if (Width == 0 || Height == 0 || NumBins == 0)
         return;
-#endif
 
-    GetArray2DMinMaxValueGeneric(pData, StrideInFloats, Width, Height, MinValue, MaxValue);
+    DEV_CHECK_ERR(pData != nullptr, "Data pointer must not be null");
+    DEV_CHECK_ERR(pBins != nullptr, "Bins pointer must not be null");
+    DEV_CHECK_ERR(Height == 1 || StrideInFloats >= Width, "Row stride (", StrideInFloats, ") must be at least ", Width);
+    if (!(MaxValue > MinValue))
+    {
+        DEV_ERROR("Max value (", MaxValue, ") must be greater than min value (", MinValue, ")");
+        return;
+    }
+    // Bin indices are computed in single precision, which represents all integers only up to 2^24.
+    // With more bins, NumBins - 1 may round up to NumBins and the clamped index would go out of range.
+    if (NumBins > (1u << 24u))
+    {
+        DEV_ERROR("The number of bins (", NumBins, ") must not exceed 2^24");
+        return;
+    }
+
+    HistogramAttribs Attribs;
+    Attribs.MinValue = MinValue;
+    Attribs.Scale    = static_cast<float>(NumBins) / (MaxValue - MinValue);
+    Attribs.MaxBin   = static_cast<float>(NumBins - 1);
+    GetCurrentArray2DFunctions().Histogram(pData, StrideInFloats, Width, Height, Attribs, pBins);
+}
+
+void ConvertArray2DFloatToUnorm8(const float* pSrc,
+                                 size_t       SrcStrideInFloats,
+                                 Uint32       Width,
+                                 Uint32       Height,
+                                 float        Scale,
+                                 float        Bias,
+                                 Uint8*       pDst,
+                                 size_t       DstStride)
+{
+    if (Width == 0 || Height == 0)
+        return;
+
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination pointers must not be null");
+    DEV_CHECK_ERR(Height == 1 || (SrcStrideInFloats >= Width && DstStride >= Width), "Row strides must be at least ", Width);
+
+    GetCurrentArray2DFunctions().ToUnorm8(pSrc, SrcStrideInFloats, Width, Height, Scale, Bias, pDst, DstStride);
+}
+
+void ConvertArray2DFloatToUnorm16(const float* pSrc,
+                                  size_t       SrcStrideInFloats,
+                                  Uint32       Width,
+                                  Uint32       Height,
+                                  float        Scale,
+                                  float        Bias,
+                                  Uint16*      pDst,
+                                  size_t       DstStride)
+{
+    if (Width == 0 || Height == 0)
+        return;
+
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination pointers must not be null");
+    DEV_CHECK_ERR(Height == 1 || (SrcStrideInFloats >= Width && DstStride >= Width), "Row strides must be at least ", Width);
+
+    GetCurrentArray2DFunctions().ToUnorm16(pSrc, SrcStrideInFloats, Width, Height, Scale, Bias, pDst, DstStride);
+}
+
+void ConvertArray2DHalfToFloat(const Uint16* pSrc,
+                               size_t        SrcStride,
+                               Uint32        Width,
+                               Uint32        Height,
+                               float*        pDst,
+                               size_t        DstStrideInFloats)
+{
+    if (Width == 0 || Height == 0)
+        return;
+
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination pointers must not be null");
+    DEV_CHECK_ERR(Height == 1 || (SrcStride >= Width && DstStrideInFloats >= Width), "Row strides must be at least ", Width);
+
+    GetCurrentArray2DFunctions().HalfToFloat(pSrc, SrcStride, Width, Height, pDst, DstStrideInFloats);
+}
+
+void DownsampleArray2D(const float* pSrc,
+                       size_t       SrcStrideInFloats,
+                       Uint32       SrcWidth,
+                       Uint32       SrcHeight,
+                       float*       pDst,
+                       size_t       DstStrideInFloats)
+{
+    if (SrcWidth == 0 || SrcHeight == 0)
+        return;
+
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination pointers must not be null");
+    DEV_CHECK_ERR(SrcHeight == 1 || SrcStrideInFloats >= SrcWidth, "Source row stride (", SrcStrideInFloats, ") must be at least ", SrcWidth);
+
+    const Uint32 DstWidth  = std::max(SrcWidth / 2, 1u);
+    const Uint32 DstHeight = std::max(SrcHeight / 2, 1u);
+    DEV_CHECK_ERR(DstHeight == 1 || DstStrideInFloats >= DstWidth, "Destination row stride (", DstStrideInFloats, ") must be at least ", DstWidth);
+
+    if (SrcWidth == 1 || SrcHeight == 1)
+    {
+        // Degenerate case: repeat the single row or column
+        for (Uint32 row = 0; row < DstHeight; ++row)
+        {
+            const float* pRow0 = pSrc + std::min(row * 2 + 0, SrcHeight - 1) * SrcStrideInFloats;
+            const float* pRow1 = pSrc + std::min(row * 2 + 1, SrcHeight - 1) * SrcStrideInFloats;
+            for (Uint32 col = 0; col < DstWidth; ++col)
+            {
+                const Uint32 Col0 = std::min(col * 2 + 0, SrcWidth - 1);
+                const Uint32 Col1 = std::min(col * 2 + 1, SrcWidth - 1);
+
+                pDst[row * DstStrideInFloats + col] = ((pRow0[Col0] + pRow1[Col0]) + (pRow0[Col1] + pRow1[Col1])) * 0.25f;
+            }
+        }
+        return;
+    }
+
+    GetCurrentArray2DFunctions().Downsample(pSrc, SrcStrideInFloats, pDst, DstStrideInFloats, DstWidth, DstHeight);
 }
 
 } // namespace Diligent
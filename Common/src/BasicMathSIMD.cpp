@@ -0,0 +1,485 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BasicMathSIMD.hpp"
+
+#include "DebugUtilities.hpp"
+#include "PlatformMisc.hpp"
+
+namespace Diligent
+{
+
+#if DILIGENT_SSE2_ENABLED
+
+namespace
+{
+
+// 2x2 matrix operations used by the block-wise matrix inversion.
+// 2x2 matrices are stored in row-major order in a single register.
+
+// A * B
+inline __m128 Mat2Mul(__m128 A, __m128 B)
+{
+    return _mm_add_ps(_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 3, 0))),
+                      _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+// adj(A) * B
+inline __m128 Mat2AdjMul(__m128 A, __m128 B)
+{
+    return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(0, 0, 3, 3)), B),
+                      _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+// A * adj(B)
+inline __m128 Mat2MulAdj(__m128 A, __m128 B)
+{
+    return _mm_sub_ps(_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 3, 0, 3))),
+                      _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+} // namespace
+
+float4x4 MatrixInverseSIMD(const float4x4& m)
+{
+    // Block-wise inversion, see
+    // https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+    //
+    //  M = | A  B |    M^-1 = 1/|M| * | X  Y |
+    //      | C  D |                   | Z  W |
+    const __m128 Row0 = _mm_loadu_ps(m.m[0]);
+    const __m128 Row1 = _mm_loadu_ps(m.m[1]);
+    const __m128 Row2 = _mm_loadu_ps(m.m[2]);
+    const __m128 Row3 = _mm_loadu_ps(m.m[3]);
+
+    const __m128 A = _mm_movelh_ps(Row0, Row1);
+    const __m128 B = _mm_movehl_ps(Row1, Row0);
+    const __m128 C = _mm_movelh_ps(Row2, Row3);
+    const __m128 D = _mm_movehl_ps(Row3, Row2);
+
+    // (|A|, |B|, |C|, |D|)
+    const __m128 DetSub = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(Row0, Row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(Row1, Row3, _MM_SHUFFLE(3, 1, 3, 1))),
+                                     _mm_mul_ps(_mm_shuffle_ps(Row0, Row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(Row1, Row3, _MM_SHUFFLE(2, 0, 2, 0))));
+
+    const __m128 DetA = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 DetB = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 DetC = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 DetD = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+    const __m128 D_C = Mat2AdjMul(D, C);
+    const __m128 A_B = Mat2AdjMul(A, B);
+
+    // adj(X) = |D|A - B(adj(D)C)
+    __m128 X_ = _mm_sub_ps(_mm_mul_ps(DetD, A), Mat2Mul(B, D_C));
+    // adj(W) = |A|D - C(adj(A)B)
+    __m128 W_ = _mm_sub_ps(_mm_mul_ps(DetA, D), Mat2Mul(C, A_B));
+    // adj(Y) = |B|C - D adj(adj(A)B)
+    __m128 Y_ = _mm_sub_ps(_mm_mul_ps(DetB, C), Mat2MulAdj(D, A_B));
+    // adj(Z) = |C|B - A adj(adj(D)C)
+    __m128 Z_ = _mm_sub_ps(_mm_mul_ps(DetC, B), Mat2MulAdj(A, D_C));
+
+    // |M| = |A||D| + |B||C| - tr((adj(A)B)(adj(D)C))
+    __m128 Tr = _mm_mul_ps(A_B, _mm_shuffle_ps(D_C, D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+    Tr        = _mm_add_ps(Tr, _mm_shuffle_ps(Tr, Tr, _MM_SHUFFLE(2, 3, 0, 1)));
+    Tr        = _mm_add_ps(Tr, _mm_shuffle_ps(Tr, Tr, _MM_SHUFFLE(1, 0, 3, 2)));
+
+    __m128 DetM = _mm_add_ps(_mm_mul_ps(DetA, DetD), _mm_mul_ps(DetB, DetC));
+    DetM        = _mm_sub_ps(DetM, Tr);
+
+    // (1/|M|, -1/|M|, -1/|M|, 1/|M|)
+    const __m128 RcpDetM = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), DetM);
+
+    X_ = _mm_mul_ps(X_, RcpDetM);
+    Y_ = _mm_mul_ps(Y_, RcpDetM);
+    Z_ = _mm_mul_ps(Z_, RcpDetM);
+    W_ = _mm_mul_ps(W_, RcpDetM);
+
+    // Apply adjugate and store
+    float4x4 Inv;
+    _mm_storeu_ps(Inv.m[0], _mm_shuffle_ps(X_, Y_, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(Inv.m[1], _mm_shuffle_ps(X_, Y_, _MM_SHUFFLE(0, 2, 0, 2)));
+    _mm_storeu_ps(Inv.m[2], _mm_shuffle_ps(Z_, W_, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(Inv.m[3], _mm_shuffle_ps(Z_, W_, _MM_SHUFFLE(0, 2, 0, 2)));
+    return Inv;
+}
+
+#else
+
+float4x4 MatrixInverseSIMD(const float4x4& m)
+{
+    return m.Inverse();
+}
+
+#endif
+
+namespace
+{
+
+// ------------------------------------------------- Scalar ------------------------------------------------
+
+void TransformPointsScalar(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst)
+{
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float3 p = pSrc[i];
+        // Note: the order of operations must be the same in all implementations
+        pDst[i] = float3{
+            p.x * Matrix.m[0][0] + p.y * Matrix.m[1][0] + p.z * Matrix.m[2][0] + Matrix.m[3][0],
+            p.x * Matrix.m[0][1] + p.y * Matrix.m[1][1] + p.z * Matrix.m[2][1] + Matrix.m[3][1],
+            p.x * Matrix.m[0][2] + p.y * Matrix.m[1][2] + p.z * Matrix.m[2][2] + Matrix.m[3][2],
+        };
+    }
+}
+
+void TransformVectorsScalar(const float4* pSrc, size_t Count, const float4x4& Matrix, float4* pDst)
+{
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = pSrc[i] * Matrix;
+}
+
+void MultiplyMatrixArrayScalar(const float4x4* pSrc, size_t Count, const float4x4& Matrix, float4x4* pDst)
+{
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = float4x4::Mul(pSrc[i], Matrix);
+}
+
+
+#if DILIGENT_AVX2_SUPPORTED
+
+// -------------------------------------------------- SSE2 -------------------------------------------------
+
+DILIGENT_TARGET_SSE2 inline __m128 MulRowSSE2(__m128 Row, const __m128 M[4])
+{
+    __m128 Res = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(Row, Row, _MM_SHUFFLE(0, 0, 0, 0)), M[0]),
+                            _mm_mul_ps(_mm_shuffle_ps(Row, Row, _MM_SHUFFLE(1, 1, 1, 1)), M[1]));
+    Res        = _mm_add_ps(Res, _mm_mul_ps(_mm_shuffle_ps(Row, Row, _MM_SHUFFLE(2, 2, 2, 2)), M[2]));
+    return _mm_add_ps(Res, _mm_mul_ps(_mm_shuffle_ps(Row, Row, _MM_SHUFFLE(3, 3, 3, 3)), M[3]));
+}
+
+// Transforms 4 points stored as x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3.
+// The same code is used by the AVX2 implementation as all shuffles work within 128-bit lanes.
+#    define TRANSFORM_4_POINTS(VecType, Shuffle, Mul, Add, Set1, P0, P1, P2, M)                                                           \
+        do                                                                                                                                \
+        {                                                                                                                                 \
+            /* AoS -> SoA */                                                                                                              \
+            const VecType X = Shuffle(P0, Shuffle(P1, P2, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));                             \
+            const VecType Y = Shuffle(Shuffle(P0, P1, _MM_SHUFFLE(0, 0, 1, 1)),                                                           \
+                                      Shuffle(P1, P2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));                                 \
+            const VecType Z = Shuffle(Shuffle(P0, P1, _MM_SHUFFLE(1, 1, 2, 2)),                                                           \
+                                      Shuffle(P2, P2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));                                 \
+                                                                                                                                          \
+            const VecType OX = Add(Add(Add(Mul(X, Set1(M.m[0][0])), Mul(Y, Set1(M.m[1][0]))), Mul(Z, Set1(M.m[2][0]))), Set1(M.m[3][0])); \
+            const VecType OY = Add(Add(Add(Mul(X, Set1(M.m[0][1])), Mul(Y, Set1(M.m[1][1]))), Mul(Z, Set1(M.m[2][1]))), Set1(M.m[3][1])); \
+            const VecType OZ = Add(Add(Add(Mul(X, Set1(M.m[0][2])), Mul(Y, Set1(M.m[1][2]))), Mul(Z, Set1(M.m[2][2]))), Set1(M.m[3][2])); \
+                                                                                                                                          \
+            /* SoA -> AoS */                                                                                                              \
+            P0 = Shuffle(Shuffle(OX, OY, _MM_SHUFFLE(0, 0, 0, 0)),                                                                        \
+                         Shuffle(OZ, OX, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));                                              \
+            P1 = Shuffle(Shuffle(OY, OZ, _MM_SHUFFLE(1, 1, 1, 1)),                                                                        \
+                         Shuffle(OX, OY, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));                                              \
+            P2 = Shuffle(Shuffle(OZ, OX, _MM_SHUFFLE(3, 3, 2, 2)),                                                                        \
+                         Shuffle(OY, OZ, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));                                              \
+        } while (false)
+
+DILIGENT_TARGET_SSE2 void TransformPointsSSE2(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst)
+{
+    static_assert(sizeof(float3) == sizeof(float) * 3, "float3 is expected to be tightly packed");
+
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4)
+    {
+        const float* pSrcData = &pSrc[i].x;
+        float*       pDstData = &pDst[i].x;
+
+        __m128 P0 = _mm_loadu_ps(pSrcData + 0);
+        __m128 P1 = _mm_loadu_ps(pSrcData + 4);
+        __m128 P2 = _mm_loadu_ps(pSrcData + 8);
+        TRANSFORM_4_POINTS(__m128, _mm_shuffle_ps, _mm_mul_ps, _mm_add_ps, _mm_set1_ps, P0, P1, P2, Matrix);
+        _mm_storeu_ps(pDstData + 0, P0);
+        _mm_storeu_ps(pDstData + 4, P1);
+        _mm_storeu_ps(pDstData + 8, P2);
+    }
+
+    TransformPointsScalar(pSrc + i, Count - i, Matrix, pDst + i);
+}
+
+DILIGENT_TARGET_SSE2 void TransformVectorsSSE2(const float4* pSrc, size_t Count, const float4x4& Matrix, float4* pDst)
+{
+    const __m128 M[4] = {
+        _mm_loadu_ps(Matrix.m[0]),
+        _mm_loadu_ps(Matrix.m[1]),
+        _mm_loadu_ps(Matrix.m[2]),
+        _mm_loadu_ps(Matrix.m[3]),
+    };
+    for (size_t i = 0; i < Count; ++i)
+        _mm_storeu_ps(pDst[i].Data(), MulRowSSE2(_mm_loadu_ps(pSrc[i].Data()), M));
+}
+
+DILIGENT_TARGET_SSE2 void MultiplyMatrixArraySSE2(const float4x4* pSrc, size_t Count, const float4x4& Matrix, float4x4* pDst)
+{
+    const __m128 M[4] = {
+        _mm_loadu_ps(Matrix.m[0]),
+        _mm_loadu_ps(Matrix.m[1]),
+        _mm_loadu_ps(Matrix.m[2]),
+        _mm_loadu_ps(Matrix.m[3]),
+    };
+    for (size_t i = 0; i < Count; ++i)
+    {
+        // Load all rows first to allow in-place operation
+        const __m128 Row0 = _mm_loadu_ps(pSrc[i].m[0]);
+        const __m128 Row1 = _mm_loadu_ps(pSrc[i].m[1]);
+        const __m128 Row2 = _mm_loadu_ps(pSrc[i].m[2]);
+        const __m128 Row3 = _mm_loadu_ps(pSrc[i].m[3]);
+        _mm_storeu_ps(pDst[i].m[0], MulRowSSE2(Row0, M));
+        _mm_storeu_ps(pDst[i].m[1], MulRowSSE2(Row1, M));
+        _mm_storeu_ps(pDst[i].m[2], MulRowSSE2(Row2, M));
+        _mm_storeu_ps(pDst[i].m[3], MulRowSSE2(Row3, M));
+    }
+}
+
+
+// -------------------------------------------------- AVX2 -------------------------------------------------
+
+// Multiplies two rows stored in 128-bit lanes by the matrix whose rows are duplicated in both lanes
+DILIGENT_TARGET_AVX2 inline __m256 MulRowsAVX2(__m256 Rows, const __m256 M[4])
+{
+    __m256 Res = _mm256_add_ps(_mm256_mul_ps(_mm256_permute_ps(Rows, _MM_SHUFFLE(0, 0, 0, 0)), M[0]),
+                               _mm256_mul_ps(_mm256_permute_ps(Rows, _MM_SHUFFLE(1, 1, 1, 1)), M[1]));
+    Res        = _mm256_add_ps(Res, _mm256_mul_ps(_mm256_permute_ps(Rows, _MM_SHUFFLE(2, 2, 2, 2)), M[2]));
+    return _mm256_add_ps(Res, _mm256_mul_ps(_mm256_permute_ps(Rows, _MM_SHUFFLE(3, 3, 3, 3)), M[3]));
+}
+
+DILIGENT_TARGET_AVX2 inline __m256 LoadTwoHalvesAVX2(const float* pLo, const float* pHi)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(pLo)), _mm_loadu_ps(pHi), 1);
+}
+
+DILIGENT_TARGET_AVX2 inline void StoreTwoHalvesAVX2(float* pLo, float* pHi, __m256 Val)
+{
+    _mm_storeu_ps(pLo, _mm256_castps256_ps128(Val));
+    _mm_storeu_ps(pHi, _mm256_extractf128_ps(Val, 1));
+}
+
+DILIGENT_TARGET_AVX2 void TransformPointsAVX2(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst)
+{
+    size_t i = 0;
+    for (; i + 8 <= Count; i += 8)
+    {
+        const float* pSrcData = &pSrc[i].x;
+        float*       pDstData = &pDst[i].x;
+
+        // Lower lanes contain points 0-3, upper lanes contain points 4-7
+        __m256 P0 = LoadTwoHalvesAVX2(pSrcData + 0, pSrcData + 12);
+        __m256 P1 = LoadTwoHalvesAVX2(pSrcData + 4, pSrcData + 16);
+        __m256 P2 = LoadTwoHalvesAVX2(pSrcData + 8, pSrcData + 20);
+        TRANSFORM_4_POINTS(__m256, _mm256_shuffle_ps, _mm256_mul_ps, _mm256_add_ps, _mm256_set1_ps, P0, P1, P2, Matrix);
+        StoreTwoHalvesAVX2(pDstData + 0, pDstData + 12, P0);
+        StoreTwoHalvesAVX2(pDstData + 4, pDstData + 16, P1);
+        StoreTwoHalvesAVX2(pDstData + 8, pDstData + 20, P2);
+    }
+
+    TransformPointsSSE2(pSrc + i, Count - i, Matrix, pDst + i);
+}
+
+#    undef TRANSFORM_4_POINTS
+
+DILIGENT_TARGET_AVX2 void TransformVectorsAVX2(const float4* pSrc, size_t Count, const float4x4& Matrix, float4* pDst)
+{
+    const __m256 M[4] = {
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(Matrix.m[0])),
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(Matrix.m[1])),
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(Matrix.m[2])),
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(Matrix.m[3])),
+    };
+
+    size_t i = 0;
+    for (; i + 2 <= Count; i += 2)
+        _mm256_storeu_ps(pDst[i].Data(), MulRowsAVX2(_mm256_loadu_ps(pSrc[i].Data()), M));
+
+    TransformVectorsSSE2(pSrc + i, Count - i, Matrix, pDst + i);
+}
+
+DILIGENT_TARGET_AVX2 void MultiplyMatrixArrayAVX2(const float4x4* pSrc, size_t Count, const float4x4& Matrix, float4x4* pDst)
+{
+    const __m256 M[4] = {
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(Matrix.m[0])),
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(Matrix.m[1])),
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(Matrix.m[2])),
+        _mm256_broadcast_ps(reinterpret_cast<const __m128*>(Matrix.m[3])),
+    };
+    for (size_t i = 0; i < Count; ++i)
+    {
+        // Load both halves first to allow in-place operation
+        const __m256 Rows01 = _mm256_loadu_ps(pSrc[i].m[0]);
+        const __m256 Rows23 = _mm256_loadu_ps(pSrc[i].m[2]);
+        _mm256_storeu_ps(pDst[i].m[0], MulRowsAVX2(Rows01, M));
+        _mm256_storeu_ps(pDst[i].m[2], MulRowsAVX2(Rows23, M));
+    }
+}
+
+#endif // DILIGENT_AVX2_SUPPORTED
+
+
+#if DILIGENT_NEON_ENABLED
+
+// -------------------------------------------------- NEON -------------------------------------------------
+
+void TransformPointsNEON(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst)
+{
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4)
+    {
+        // De-interleaving load converts AoS to SoA
+        const float32x4x3_t P = vld3q_f32(&pSrc[i].x);
+
+        float32x4x3_t Res;
+        for (int c = 0; c < 3; ++c)
+        {
+            float32x4_t R = vaddq_f32(vmulq_n_f32(P.val[0], Matrix.m[0][c]), vmulq_n_f32(P.val[1], Matrix.m[1][c]));
+            R             = vaddq_f32(R, vmulq_n_f32(P.val[2], Matrix.m[2][c]));
+            Res.val[c]    = vaddq_f32(R, vdupq_n_f32(Matrix.m[3][c]));
+        }
+        vst3q_f32(&pDst[i].x, Res);
+    }
+
+    TransformPointsScalar(pSrc + i, Count - i, Matrix, pDst + i);
+}
+
+void TransformVectorsNEON(const float4* pSrc, size_t Count, const float4x4& Matrix, float4* pDst)
+{
+    const float32x4_t M[4] = {
+        vld1q_f32(Matrix.m[0]),
+        vld1q_f32(Matrix.m[1]),
+        vld1q_f32(Matrix.m[2]),
+        vld1q_f32(Matrix.m[3]),
+    };
+    for (size_t i = 0; i < Count; ++i)
+        vst1q_f32(pDst[i].Data(), BasicMathSIMDInternal::MulRow(vld1q_f32(pSrc[i].Data()), M));
+}
+
+void MultiplyMatrixArrayNEON(const float4x4* pSrc, size_t Count, const float4x4& Matrix, float4x4* pDst)
+{
+    const float32x4_t M[4] = {
+        vld1q_f32(Matrix.m[0]),
+        vld1q_f32(Matrix.m[1]),
+        vld1q_f32(Matrix.m[2]),
+        vld1q_f32(Matrix.m[3]),
+    };
+    for (size_t i = 0; i < Count; ++i)
+    {
+        // Load all rows first to allow in-place operation
+        const float32x4_t Row0 = vld1q_f32(pSrc[i].m[0]);
+        const float32x4_t Row1 = vld1q_f32(pSrc[i].m[1]);
+        const float32x4_t Row2 = vld1q_f32(pSrc[i].m[2]);
+        const float32x4_t Row3 = vld1q_f32(pSrc[i].m[3]);
+        vst1q_f32(pDst[i].m[0], BasicMathSIMDInternal::MulRow(Row0, M));
+        vst1q_f32(pDst[i].m[1], BasicMathSIMDInternal::MulRow(Row1, M));
+        vst1q_f32(pDst[i].m[2], BasicMathSIMDInternal::MulRow(Row2, M));
+        vst1q_f32(pDst[i].m[3], BasicMathSIMDInternal::MulRow(Row3, M));
+    }
+}
+
+#endif // DILIGENT_NEON_ENABLED
+
+
+struct BatchedMathFunctions
+{
+    void (*TransformPoints)(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst)         = TransformPointsScalar;
+    void (*TransformVectors)(const float4* pSrc, size_t Count, const float4x4& Matrix, float4* pDst)        = TransformVectorsScalar;
+    void (*MultiplyMatrixArray)(const float4x4* pSrc, size_t Count, const float4x4& Matrix, float4x4* pDst) = MultiplyMatrixArrayScalar;
+};
+
+BatchedMathFunctions SelectBatchedMathFunctions()
+{
+    BatchedMathFunctions Funcs;
+
+    const CPU_FEATURE_FLAGS CPUFeatures = PlatformMisc::GetCPUFeatures();
+#if DILIGENT_AVX2_SUPPORTED
+    if ((CPUFeatures & CPU_FEATURE_FLAG_AVX2) != 0)
+    {
+        Funcs.TransformPoints     = TransformPointsAVX2;
+        Funcs.TransformVectors    = TransformVectorsAVX2;
+        Funcs.MultiplyMatrixArray = MultiplyMatrixArrayAVX2;
+    }
+    else if ((CPUFeatures & CPU_FEATURE_FLAG_SSE2) != 0)
+    {
+        Funcs.TransformPoints     = TransformPointsSSE2;
+        Funcs.TransformVectors    = TransformVectorsSSE2;
+        Funcs.MultiplyMatrixArray = MultiplyMatrixArraySSE2;
+    }
+#endif
+#if DILIGENT_NEON_ENABLED
+    if ((CPUFeatures & CPU_FEATURE_FLAG_NEON) != 0)
+    {
+        Funcs.TransformPoints     = TransformPointsNEON;
+        Funcs.TransformVectors    = TransformVectorsNEON;
+        Funcs.MultiplyMatrixArray = MultiplyMatrixArrayNEON;
+    }
+#endif
+    (void)CPUFeatures;
+
+    return Funcs;
+}
+
+const BatchedMathFunctions& GetBatchedMathFunctions()
+{
+    static const BatchedMathFunctions Funcs = SelectBatchedMathFunctions();
+    return Funcs;
+}
+
+} // namespace
+
+void TransformPoints(const float3* pSrc, size_t Count, const float4x4& Matrix, float3* pDst)
+{
+    if (Count == 0)
+        return;
+
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination pointers must not be null");
+    DEV_CHECK_ERR(pSrc == pDst || pSrc + Count <= pDst || pDst + Count <= pSrc, "Source and destination arrays must either be the same or not overlap");
+    GetBatchedMathFunctions().TransformPoints(pSrc, Count, Matrix, pDst);
+}
+
+void TransformVectors(const float4* pSrc, size_t Count, const float4x4& Matrix, float4* pDst)
+{
+    if (Count == 0)
+        return;
+
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination pointers must not be null");
+    DEV_CHECK_ERR(pSrc == pDst || pSrc + Count <= pDst || pDst + Count <= pSrc, "Source and destination arrays must either be the same or not overlap");
+    GetBatchedMathFunctions().TransformVectors(pSrc, Count, Matrix, pDst);
+}
+
+void MultiplyMatrixArray(const float4x4* pSrc, size_t Count, const float4x4& Matrix, float4x4* pDst)
+{
+    if (Count == 0)
+        return;
+
+    DEV_CHECK_ERR(pSrc != nullptr && pDst != nullptr, "Source and destination pointers must not be null");
+    DEV_CHECK_ERR(pSrc == pDst || pSrc + Count <= pDst || pDst + Count <= pSrc, "Source and destination arrays must either be the same or not overlap");
+    GetBatchedMathFunctions().MultiplyMatrixArray(pSrc, Count, Matrix, pDst);
+}
+
+} // namespace Diligent
@@ -28,17 +28,209 @@
 #include "pch.h"
 #include "DataBlobImpl.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
+#include "SpinLock.hpp"
 
+#include <array>
 #include <cstring>
+#include <mutex>
+#include <new>
 
 namespace Diligent
 {
 
+namespace
+{
+
+constexpr size_t DataBlobAlignment = 16;
+
+constexpr size_t AlignDataBlobOffset(size_t Offset)
+{
+    return (Offset + DataBlobAlignment - 1) & ~(DataBlobAlignment - 1);
+}
+
+// Offset of the blob object from the start of the memory block
+constexpr size_t DataBlobObjectOffset = DataBlobAlignment;
+// Offset of the inline data from the blob object
+constexpr size_t DataBlobInlineOffset = AlignDataBlobOffset(sizeof(DataBlobImpl));
+// Size of the memory block that is not available for the data
+constexpr size_t DataBlobBlockOverhead = DataBlobObjectOffset + DataBlobInlineOffset;
+
+// Size-class pool of data blob memory blocks. Size classes are defined by the payload capacity.
+// Every size class keeps a singly-linked list of free blocks, up to MaxCachedBytesPerClass bytes.
+class DataBlobPool
+{
+public:
+    static constexpr Uint32 InvalidSizeClass       = ~Uint32{0};
+    static constexpr size_t MinCapacity            = 128;
+    static constexpr Uint32 NumSizeClasses         = 10; // 128 B ... 64 KB
+    static constexpr size_t MaxCachedBytesPerClass = size_t{1} << 20;
+
+    static DataBlobPool& Get()
+    {
+        // The pool is never destroyed as blobs may be released during static deinitialization.
+        static DataBlobPool* const pPool = new DataBlobPool{};
+        return *pPool;
+    }
+
+    static Uint32 GetSizeClass(size_t PayloadSize)
+    {
+        Uint32 SizeClass = 0;
+        while (SizeClass < NumSizeClasses && GetCapacity(SizeClass) < PayloadSize)
+            ++SizeClass;
+        return SizeClass < NumSizeClasses ? SizeClass : InvalidSizeClass;
+    }
+
+    static size_t GetCapacity(Uint32 SizeClass)
+    {
+        VERIFY_EXPR(SizeClass < NumSizeClasses);
+        return MinCapacity << SizeClass;
+    }
+
+    static size_t GetBlockSize(Uint32 SizeClass)
+    {
+        return DataBlobBlockOverhead + GetCapacity(SizeClass);
+    }
+
+    void* Allocate(Uint32 SizeClass)
+    {
+        SizeClassPool& Pool = m_Pools[SizeClass];
+        {
+            std::lock_guard<Threading::SpinLock> Lock{Pool.Lock};
+            if (FreeBlock* pBlock = Pool.pFreeList)
+            {
+                Pool.pFreeList = pBlock->pNext;
+                --Pool.NumFreeBlocks;
+                return pBlock;
+            }
+        }
+
+        return DefaultRawMemoryAllocator::GetAllocator().AllocateAligned(GetBlockSize(SizeClass), DataBlobAlignment, "Data blob memory block", __FILE__, __LINE__);
+    }
+
+    void Free(void* pMemory, Uint32 SizeClass)
+    {
+        const size_t   BlockSize = GetBlockSize(SizeClass);
+        SizeClassPool& Pool      = m_Pools[SizeClass];
+        {
+            std::lock_guard<Threading::SpinLock> Lock{Pool.Lock};
+            if ((Pool.NumFreeBlocks + 1) * BlockSize <= MaxCachedBytesPerClass)
+            {
+                FreeBlock* pBlock = new (pMemory) FreeBlock{Pool.pFreeList};
+                Pool.pFreeList    = pBlock;
+                ++Pool.NumFreeBlocks;
+                return;
+            }
+        }
+
+        DefaultRawMemoryAllocator::GetAllocator().FreeAligned(pMemory);
+    }
+
+    void ReleaseMemory()
+    {
+        for (SizeClassPool& Pool : m_Pools)
+        {
+            FreeBlock* pFreeList = nullptr;
+            {
+                std::lock_guard<Threading::SpinLock> Lock{Pool.Lock};
+                pFreeList          = Pool.pFreeList;
+                Pool.pFreeList     = nullptr;
+                Pool.NumFreeBlocks = 0;
+            }
+            while (pFreeList != nullptr)
+            {
+                FreeBlock* pNext = pFreeList->pNext;
+                DefaultRawMemoryAllocator::GetAllocator().FreeAligned(pFreeList);
+                pFreeList = pNext;
+            }
+        }
+    }
+
+private:
+    DataBlobPool() = default;
+
+    struct FreeBlock
+    {
+        FreeBlock* pNext = nullptr;
+    };
+
+    struct SizeClassPool
+    {
+        Threading::SpinLock Lock;
+        FreeBlock*          pFreeList     = nullptr;
+        size_t              NumFreeBlocks = 0;
+    };
+    std::array<SizeClassPool, NumSizeClasses> m_Pools;
+};
+
+} // namespace
+
+// Memory block header that precedes the blob object.
+// The block also serves as the allocator of the blob object: when the object is destroyed,
+// the block is returned to the pool or to the raw allocator.
+class DataBlobImpl::MemoryBlock
+{
+public:
+    static MemoryBlock* Create(IMemoryAllocator& Allocator, size_t PayloadSize, size_t& InlineCapacity);
+
+    void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber);
+
+    void Free(void* Ptr);
+
+private:
+    MemoryBlock(IMemoryAllocator* pRawAllocator, Uint32 SizeClass) noexcept :
+        m_pRawAllocator{pRawAllocator},
+        m_SizeClass{SizeClass}
+    {}
+
+    // Null for pooled blocks
+    IMemoryAllocator* const m_pRawAllocator;
+    const Uint32            m_SizeClass;
+};
+
+DataBlobImpl::MemoryBlock* DataBlobImpl::MemoryBlock::Create(IMemoryAllocator& Allocator, size_t PayloadSize, size_t& InlineCapacity)
+{
+    static_assert(sizeof(MemoryBlock) <= DataBlobObjectOffset, "Memory block header does not fit into the reserved space");
+
+    if (&Allocator == &DefaultRawMemoryAllocator::GetAllocator())
+    {
+        const Uint32 SizeClass = DataBlobPool::GetSizeClass(PayloadSize);
+        if (SizeClass != DataBlobPool::InvalidSizeClass)
+        {
+            void* pMemory  = DataBlobPool::Get().Allocate(SizeClass);
+            InlineCapacity = DataBlobPool::GetCapacity(SizeClass);
+            return new (pMemory) MemoryBlock{nullptr, SizeClass};
+        }
+    }
+
+    void* pMemory  = Allocator.AllocateAligned(DataBlobBlockOverhead + PayloadSize, DataBlobAlignment, "Data blob memory block", __FILE__, __LINE__);
+    InlineCapacity = PayloadSize;
+    return new (pMemory) MemoryBlock{&Allocator, DataBlobPool::InvalidSizeClass};
+}
+
+void* DataBlobImpl::MemoryBlock::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY(Size == sizeof(DataBlobImpl), "Memory block can only hold a DataBlobImpl object");
+    return reinterpret_cast<Uint8*>(this) + DataBlobObjectOffset;
+}
+
+void DataBlobImpl::MemoryBlock::Free(void* Ptr)
+{
+    VERIFY(Ptr == reinterpret_cast<Uint8*>(this) + DataBlobObjectOffset, "The pointer does not belong to this memory block");
+    if (m_pRawAllocator != nullptr)
+        m_pRawAllocator->FreeAligned(this);
+    else
+        DataBlobPool::Get().Free(this, m_SizeClass);
+}
+
+
 RefCntAutoPtr<DataBlobImpl> DataBlobImpl::Create(IMemoryAllocator* pAllocator, size_t InitialSize, const void* pData)
 {
     if (pAllocator == nullptr)
         pAllocator = &DefaultRawMemoryAllocator::GetAllocator();
-    return RefCntAutoPtr<DataBlobImpl>{MakeNewRCObj<DataBlobImpl>()(*pAllocator, InitialSize, pData)};
+
+    size_t       InlineCapacity = 0;
+    MemoryBlock* pBlock         = MemoryBlock::Create(*pAllocator, InitialSize, InlineCapacity);
+    return RefCntAutoPtr<DataBlobImpl>{NEW_RC_OBJ(*pBlock, "DataBlobImpl instance", DataBlobImpl)(*pAllocator, InlineCapacity, InitialSize, pData)};
 }
 
 RefCntAutoPtr<DataBlobImpl> DataBlobImpl::Create(size_t InitialSize, const void* pData)
@@ -48,7 +240,9 @@ RefCntAutoPtr<DataBlobImpl> DataBlobImpl::Create(size_t InitialSize, const void*
 
 RefCntAutoPtr<DataBlobImpl> DataBlobImpl::Create(DataBufferType&& DataBuff) noexcept
 {
-    return RefCntAutoPtr<DataBlobImpl>{MakeNewRCObj<DataBlobImpl>()(std::move(DataBuff))};
+    size_t       InlineCapacity = 0;
+    MemoryBlock* pBlock         = MemoryBlock::Create(DefaultRawMemoryAllocator::GetAllocator(), 0, InlineCapacity);
+    return RefCntAutoPtr<DataBlobImpl>{NEW_RC_OBJ(*pBlock, "DataBlobImpl instance", DataBlobImpl)(InlineCapacity, std::move(DataBuff))};
 }
 
 RefCntAutoPtr<DataBlobImpl> DataBlobImpl::MakeCopy(const IDataBlob* pDataBlob)
@@ -59,51 +253,128 @@ RefCntAutoPtr<DataBlobImpl> DataBlobImpl::MakeCopy(const IDataBlob* pDataBlob)
     return Create(pDataBlob->GetSize(), pDataBlob->GetConstDataPtr());
 }
 
+void DataBlobImpl::ReleasePooledMemory()
+{
+    DataBlobPool::Get().ReleaseMemory();
+}
+
 DataBlobImpl::DataBlobImpl(IReferenceCounters* pRefCounters,
                            IMemoryAllocator&   Allocator,
+                           size_t              InlineCapacity,
                            size_t              InitialSize,
                            const void*         pData) :
     TBase{pRefCounters},
-    m_DataBuff{InitialSize, Uint8{}, STD_ALLOCATOR_RAW_MEM(Uint8, Allocator, "Allocator for vector<Uint8>")}
+    m_Size{InitialSize},
+    m_InlineCapacity{InlineCapacity},
+    m_UsePool{&Allocator == &DefaultRawMemoryAllocator::GetAllocator()},
+    m_DataBuff{STD_ALLOCATOR_RAW_MEM(Uint8, Allocator, "Allocator for vector<Uint8>")}
 {
-    if (!m_DataBuff.empty() && pData != nullptr)
+    if (InitialSize <= m_InlineCapacity)
+    {
+        m_pData = GetInlineData();
+        if (pData != nullptr)
+            std::memcpy(m_pData, pData, InitialSize);
+        else
+            std::memset(m_pData, 0, InitialSize);
+    }
+    else
     {
-        std::memcpy(m_DataBuff.data(), pData, InitialSize);
+        m_DataBuff.resize(InitialSize);
+        m_pData = m_DataBuff.data();
+        if (pData != nullptr)
+            std::memcpy(m_pData, pData, InitialSize);
     }
 }
 
 DataBlobImpl::DataBlobImpl(IReferenceCounters* pRefCounters,
+                           size_t              InlineCapacity,
                            DataBufferType&&    DataBuff) noexcept :
     TBase{pRefCounters},
+    m_InlineCapacity{InlineCapacity},
+    m_UsePool{false},
     m_DataBuff{std::move(DataBuff)}
 {
+    m_pData = m_DataBuff.data();
+    m_Size  = m_DataBuff.size();
 }
 
 DataBlobImpl::~DataBlobImpl()
-{}
+{
+    if (m_PoolBufferSizeClass != DataBlobPool::InvalidSizeClass)
+        DataBlobPool::Get().Free(m_pData, m_PoolBufferSizeClass);
+}
+
+Uint8* DataBlobImpl::GetInlineData()
+{
+    return reinterpret_cast<Uint8*>(this) + DataBlobInlineOffset;
+}
+
+const Uint8* DataBlobImpl::GetInlineData() const
+{
+    return reinterpret_cast<const Uint8*>(this) + DataBlobInlineOffset;
+}
 
 /// Sets the size of the internal data buffer
 void DataBlobImpl::Resize(size_t NewSize)
 {
-    m_DataBuff.resize(NewSize);
+    const bool   IsPooled = m_PoolBufferSizeClass != DataBlobPool::InvalidSizeClass;
+    const size_t Capacity = IsPooled ? DataBlobPool::GetCapacity(m_PoolBufferSizeClass) : m_InlineCapacity;
+    if (!IsPooled && !IsInline())
+    {
+        m_DataBuff.resize(NewSize);
+        m_pData = m_DataBuff.data();
+        m_Size  = NewSize;
+        return;
+    }
+
+    if (NewSize <= Capacity)
+    {
+        if (NewSize > m_Size)
+            std::memset(m_pData + m_Size, 0, NewSize - m_Size);
+        m_Size = NewSize;
+        return;
+    }
+
+    // The data does not fit into the current storage
+    Uint8* const pOldData     = m_pData;
+    const Uint32 OldSizeClass = m_PoolBufferSizeClass;
+
+    const Uint32 SizeClass = m_UsePool ? DataBlobPool::GetSizeClass(NewSize) : DataBlobPool::InvalidSizeClass;
+    if (SizeClass != DataBlobPool::InvalidSizeClass)
+    {
+        m_pData = static_cast<Uint8*>(DataBlobPool::Get().Allocate(SizeClass));
+        std::memcpy(m_pData, pOldData, m_Size);
+        std::memset(m_pData + m_Size, 0, NewSize - m_Size);
+    }
+    else
+    {
+        m_DataBuff.resize(NewSize);
+        std::memcpy(m_DataBuff.data(), pOldData, m_Size);
+        m_pData = m_DataBuff.data();
+    }
+    m_PoolBufferSizeClass = SizeClass;
+    m_Size                = NewSize;
+
+    if (OldSizeClass != DataBlobPool::InvalidSizeClass)
+        DataBlobPool::Get().Free(pOldData, OldSizeClass);
 }
 
 /// Returns the size of the internal data buffer
 size_t DataBlobImpl::GetSize() const
 {
-    return m_DataBuff.size();
+    return m_Size;
 }
 
 /// Returns the pointer to the internal data buffer
 void* DataBlobImpl::GetDataPtr(size_t Offset)
 {
-    return !m_DataBuff.empty() ? &m_DataBuff[Offset] : nullptr;
+    return m_Size != 0 ? m_pData + Offset : nullptr;
 }
 
 /// Returns const pointer to the internal data buffer
 const void* DataBlobImpl::GetConstDataPtr(size_t Offset) const
 {
-    return !m_DataBuff.empty() ? &m_DataBuff[Offset] : nullptr;
+    return m_Size != 0 ? m_pData + Offset : nullptr;
 }
 
 void* DataBlobAllocatorAdapter::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
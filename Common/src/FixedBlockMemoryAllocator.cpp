@@ -51,9 +51,13 @@ FixedBlockMemoryAllocator::MemoryPage::MemoryPage(FixedBlockMemoryAllocator& Own
 {
     const size_t PageSize = OwnerAllocator.m_BlockSize * OwnerAllocator.m_NumBlocksInPage;
     VERIFY_EXPR(PageSize > 0);
-    m_pPageStart = reinterpret_cast<Uint8*>(
-        OwnerAllocator.m_RawMemoryAllocator.Allocate(PageSize, "FixedBlockMemoryAllocator page", __FILE__, __LINE__));
+    // Block size is a multiple of sizeof(void*), so the bits that follow the blocks are properly aligned
+    const size_t BitsSize = (OwnerAllocator.m_NumBlocksInPage + BitsPerWord - 1) / BitsPerWord * sizeof(size_t);
+    m_pPageStart          = reinterpret_cast<Uint8*>(
+        OwnerAllocator.m_RawMemoryAllocator.Allocate(PageSize + BitsSize, "FixedBlockMemoryAllocator page", __FILE__, __LINE__));
     m_pNextFreeBlock = m_pPageStart;
+    m_pAllocatedBits = reinterpret_cast<size_t*>(reinterpret_cast<Uint8*>(m_pPageStart) + PageSize);
+    std::memset(m_pAllocatedBits, 0, BitsSize);
     FillWithDebugPattern(m_pPageStart, NewPageMemPattern, PageSize);
 }
 
@@ -63,13 +67,18 @@ FixedBlockMemoryAllocator::MemoryPage::MemoryPage(MemoryPage&& Page) noexcept :
     m_NumInitializedBlocks{Page.m_NumInitializedBlocks},
     m_pPageStart          {Page.m_pPageStart          },
     m_pNextFreeBlock      {Page.m_pNextFreeBlock      },
+    m_pAllocatedBits      {Page.m_pAllocatedBits      },
     m_pOwnerAllocator     {Page.m_pOwnerAllocator     }
 // clang-format on
 {
+    m_NextAvailablePage = Page.m_NextAvailablePage;
+    m_IsAvailable       = Page.m_IsAvailable;
+
     Page.m_NumFreeBlocks        = 0;
     Page.m_NumInitializedBlocks = 0;
     Page.m_pPageStart           = nullptr;
     Page.m_pNextFreeBlock       = nullptr;
+    Page.m_pAllocatedBits       = nullptr;
     Page.m_pOwnerAllocator      = nullptr;
 }
 
@@ -86,6 +95,12 @@ void* FixedBlockMemoryAllocator::MemoryPage::GetBlockStartAddress(Uint32 BlockIn
     return reinterpret_cast<Uint8*>(m_pPageStart) + BlockIndex * m_pOwnerAllocator->m_BlockSize;
 }
 
+Uint32 FixedBlockMemoryAllocator::MemoryPage::GetBlockIndex(const void* pBlockAddr) const
+{
+    const size_t Delta = reinterpret_cast<const Uint8*>(pBlockAddr) - reinterpret_cast<const Uint8*>(m_pPageStart);
+    return static_cast<Uint32>(Delta / m_pOwnerAllocator->m_BlockSize);
+}
+
 #ifdef DILIGENT_DEBUG
 void FixedBlockMemoryAllocator::MemoryPage::dbgVerifyAddress(const void* pBlockAddr) const
 {
@@ -147,20 +162,35 @@ void* FixedBlockMemoryAllocator::MemoryPage::Allocate()
     else
         VERIFY_EXPR(m_pNextFreeBlock == nullptr);
 
+    const Uint32 BlockIndex = GetBlockIndex(res);
+    VERIFY((m_pAllocatedBits[BlockIndex / BitsPerWord] & (size_t{1} << (BlockIndex % BitsPerWord))) == 0, "Free block is marked as allocated");
+    m_pAllocatedBits[BlockIndex / BitsPerWord] |= size_t{1} << (BlockIndex % BitsPerWord);
+
     FillWithDebugPattern(res, AllocatedBlockMemPattern, m_pOwnerAllocator->m_BlockSize);
     return res;
 }
 
-void FixedBlockMemoryAllocator::MemoryPage::DeAllocate(void* p)
+bool FixedBlockMemoryAllocator::MemoryPage::DeAllocate(void* p)
 {
     VERIFY_EXPR(m_pOwnerAllocator != nullptr);
 
     dbgVerifyAddress(p);
+
+    // Freeing a block that is not allocated would corrupt the free list, so check the
+    // allocation bit in all build configurations.
+    const Uint32 BlockIndex = GetBlockIndex(p);
+    size_t&      BitsWord   = m_pAllocatedBits[BlockIndex / BitsPerWord];
+    const size_t BlockBit   = size_t{1} << (BlockIndex % BitsPerWord);
+    if ((BitsWord & BlockBit) == 0 || GetBlockStartAddress(BlockIndex) != p)
+        return false;
+    BitsWord &= ~BlockBit;
+
     FillWithDebugPattern(p, DeallocatedBlockMemPattern, m_pOwnerAllocator->m_BlockSize);
     // Add block to the beginning of the linked list
     *reinterpret_cast<void**>(p) = m_pNextFreeBlock;
     m_pNextFreeBlock             = p;
     ++m_NumFreeBlocks;
+    return true;
 }
 
 
@@ -174,8 +204,7 @@ FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemory
                                                      Uint32            NumBlocksInPage) :
     // clang-format off
     m_PagePool          (STD_ALLOCATOR_RAW_MEM(MemoryPage, RawMemoryAllocator, "Allocator for vector<MemoryPage>")),
-    m_AvailablePages    (STD_ALLOCATOR_RAW_MEM(size_t, RawMemoryAllocator, "Allocator for unordered_set<size_t>") ),
-    m_AddrToPageId      (STD_ALLOCATOR_RAW_MEM(AddrToPageIdMapElem, RawMemoryAllocator, "Allocator for unordered_map<void*, size_t>")),
+    m_SortedPageStarts  (STD_ALLOCATOR_RAW_MEM(PageStartElem, RawMemoryAllocator, "Allocator for vector<PageStartElem>")),
     m_RawMemoryAllocator{RawMemoryAllocator        },
     m_BlockSize         {AdjustBlockSize(BlockSize)},
     m_NumBlocksInPage   {NumBlocksInPage           }
@@ -194,7 +223,7 @@ FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
     for (size_t p = 0; p < m_PagePool.size(); ++p)
     {
         VERIFY(!m_PagePool[p].HasAllocations(), "Memory leak detected: memory page has allocated block");
-        VERIFY(m_AvailablePages.find(p) != m_AvailablePages.end(), "Memory page is not in the available page pool");
+        VERIFY(m_PagePool[p].m_IsAvailable, "Memory page is not in the available page list");
     }
 #endif
 }
@@ -203,8 +232,36 @@ void FixedBlockMemoryAllocator::CreateNewPage()
 {
     VERIFY_EXPR(m_BlockSize > 0);
     m_PagePool.emplace_back(*this);
-    m_AvailablePages.insert(m_PagePool.size() - 1);
-    m_AddrToPageId.reserve(m_PagePool.size() * m_NumBlocksInPage);
+    const size_t      NewPageId  = m_PagePool.size() - 1;
+    const void* const pPageStart = m_PagePool[NewPageId].GetPageStart();
+    PushAvailablePage(NewPageId);
+
+    auto InsertIt = std::upper_bound(m_SortedPageStarts.begin(), m_SortedPageStarts.end(), pPageStart,
+                                     [](const void* pAddr, const PageStartElem& Elem) { return pAddr < Elem.first; });
+    m_SortedPageStarts.emplace(InsertIt, pPageStart, NewPageId);
+}
+
+void FixedBlockMemoryAllocator::PushAvailablePage(size_t PageId)
+{
+    MemoryPage& Page = m_PagePool[PageId];
+    VERIFY_EXPR(!Page.m_IsAvailable && Page.HasSpace());
+    Page.m_NextAvailablePage = m_FirstAvailablePage;
+    Page.m_IsAvailable       = true;
+    m_FirstAvailablePage     = PageId;
+}
+
+size_t FixedBlockMemoryAllocator::FindPage(const void* Ptr) const
+{
+    // Find the last page that starts at or before Ptr
+    auto It = std::upper_bound(m_SortedPageStarts.begin(), m_SortedPageStarts.end(), Ptr,
+                               [](const void* pAddr, const PageStartElem& Elem) { return pAddr < Elem.first; });
+    if (It == m_SortedPageStarts.begin())
+        return InvalidPageId;
+    --It;
+
+    const size_t PageSize = m_BlockSize * m_NumBlocksInPage;
+    const size_t Offset   = static_cast<size_t>(reinterpret_cast<const Uint8*>(Ptr) - reinterpret_cast<const Uint8*>(It->first));
+    return Offset < PageSize ? It->second : InvalidPageId;
 }
 
 void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
@@ -216,18 +273,20 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
 
     std::lock_guard<std::mutex> LockGuard(m_Mutex);
 
-    if (m_AvailablePages.empty())
+    if (m_FirstAvailablePage == InvalidPageId)
     {
         CreateNewPage();
     }
 
-    auto        PageId = *m_AvailablePages.begin();
-    MemoryPage& Page   = m_PagePool[PageId];
-    void*       Ptr    = Page.Allocate();
-    m_AddrToPageId.insert(std::make_pair(Ptr, PageId));
+    const size_t PageId = m_FirstAvailablePage;
+    MemoryPage&  Page   = m_PagePool[PageId];
+    void*        Ptr    = Page.Allocate();
     if (!Page.HasSpace())
     {
-        m_AvailablePages.erase(m_AvailablePages.begin());
+        // Remove the page from the head of the list
+        m_FirstAvailablePage     = Page.m_NextAvailablePage;
+        Page.m_NextAvailablePage = InvalidPageId;
+        Page.m_IsAvailable       = false;
     }
 
     return Ptr;
@@ -236,26 +295,24 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
 void FixedBlockMemoryAllocator::Free(void* Ptr)
 {
     std::lock_guard<std::mutex> LockGuard(m_Mutex);
-    auto                        PageIdIt = m_AddrToPageId.find(Ptr);
-    if (PageIdIt != m_AddrToPageId.end())
+
+    const size_t PageId = FindPage(Ptr);
+    if (PageId != InvalidPageId)
     {
-        size_t PageId = PageIdIt->second;
         VERIFY_EXPR(PageId < m_PagePool.size());
-        m_PagePool[PageId].DeAllocate(Ptr);
-        m_AvailablePages.insert(PageId);
-        m_AddrToPageId.erase(PageIdIt);
-        if (m_AvailablePages.size() > 1 && !m_PagePool[PageId].HasAllocations())
+        if (!m_PagePool[PageId].DeAllocate(Ptr))
         {
-            // In current implementation pages are never released!
-            // Note that if we delete a page, all indices past it will be invalid
-
-            //m_PagePool.erase(m_PagePool.begin() + PageId);
-            //m_AvailablePages.erase(PageId);
+            LOG_ERROR_MESSAGE("Address ", Ptr, " is not allocated - double freeing memory?");
+            return;
         }
+        // In current implementation pages are never released!
+        // Note that if we delete a page, all indices past it will be invalid
+        if (!m_PagePool[PageId].m_IsAvailable)
+            PushAvailablePage(PageId);
     }
     else
     {
-        UNEXPECTED("Address not found in the allocations list - double freeing memory?");
+        UNEXPECTED("Address ", Ptr, " does not belong to any page of this allocator");
     }
 }
 
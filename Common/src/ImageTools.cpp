@@ -28,12 +28,390 @@
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "DebugUtilities.hpp"
+#include "Intrinsics.hpp"
+#include "PlatformMisc.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
 
+namespace
+{
+
+// Image difference statistics accumulated over a range of rows.
+// All accumulators are integer, so the final result does not depend on the
+// order in which the rows are processed or on the code path that processed them.
+struct ImageDiffStats
+{
+    Uint32 NumDiffPixels               = 0;
+    Uint32 NumDiffPixelsAboveThreshold = 0;
+    Uint32 MaxDiff                     = 0;
+    Uint64 SumDiff                     = 0;
+    Uint64 SumSqDiff                   = 0;
+
+    ImageDiffStats& operator+=(const ImageDiffStats& Other)
+    {
+        NumDiffPixels += Other.NumDiffPixels;
+        NumDiffPixelsAboveThreshold += Other.NumDiffPixelsAboveThreshold;
+        MaxDiff = std::max(MaxDiff, Other.MaxDiff);
+        SumDiff += Other.SumDiff;
+        SumSqDiff += Other.SumSqDiff;
+        return *this;
+    }
+};
+
+struct ImageDiffRowInfo
+{
+    const Uint8* pRow1    = nullptr;
+    const Uint8* pRow2    = nullptr;
+    Uint8*       pDiffRow = nullptr;
+};
+
+// Processes pixels [StartCol, Width) of a single row.
+void ComputeRowDifferenceGeneric(const ComputeImageDifferenceAttribs& Attribs,
+                                 Uint32                               NumSrcChannels,
+                                 Uint32                               NumDiffChannels,
+                                 const ImageDiffRowInfo&              Row,
+                                 Uint32                               StartCol,
+                                 ImageDiffStats&                      Stats)
+{
+    for (Uint32 col = StartCol; col < Attribs.Width; ++col)
+    {
+        Uint32 PixelDiff = 0;
+        for (Uint32 ch = 0; ch < NumSrcChannels; ++ch)
+        {
+            const Uint32 ChannelDiff = static_cast<Uint32>(
+                std::abs(static_cast<int>(Row.pRow1[col * Attribs.NumChannels1 + ch]) -
+                         static_cast<int>(Row.pRow2[col * Attribs.NumChannels2 + ch])));
+            PixelDiff = std::max(PixelDiff, ChannelDiff);
+
+            if (Row.pDiffRow != nullptr && ch < NumDiffChannels)
+            {
+                Row.pDiffRow[col * NumDiffChannels + ch] = static_cast<Uint8>(std::min(ChannelDiff * Attribs.Scale, 255.f));
+            }
+        }
+
+        if (Row.pDiffRow != nullptr)
+        {
+            for (Uint32 ch = NumSrcChannels; ch < NumDiffChannels; ++ch)
+            {
+                Row.pDiffRow[col * NumDiffChannels + ch] = ch == 3 ? 255 : 0;
+            }
+        }
+
+        if (PixelDiff != 0)
+        {
+            ++Stats.NumDiffPixels;
+            Stats.SumDiff += PixelDiff;
+            Stats.SumSqDiff += PixelDiff * PixelDiff;
+            Stats.MaxDiff = std::max(Stats.MaxDiff, PixelDiff);
+
+            if (PixelDiff > Attribs.Threshold)
+            {
+                ++Stats.NumDiffPixelsAboveThreshold;
+            }
+        }
+    }
+}
+
+#if DILIGENT_AVX2_ENABLED
+// Processes 8 four-channel pixels per iteration and returns the number of processed pixels.
+// The remaining pixels must be processed by the generic path.
+Uint32 ComputeRowDifferenceRGBA8AVX2(const ComputeImageDifferenceAttribs& Attribs,
+                                     const ImageDiffRowInfo&              Row,
+                                     ImageDiffStats&                      Stats)
+{
+    const Uint32 NumPixels = Attribs.Width & ~7u;
+    if (NumPixels == 0)
+        return 0;
+
+    // Each 32-bit lane of the squared difference accumulator receives at most 255^2 per
+    // iteration, so it must be flushed before it may overflow.
+    constexpr Uint32 MaxItersBeforeFlush = 32768;
+
+    const __m256i Zero        = _mm256_setzero_si256();
+    const __m256i LowByteMask = _mm256_set1_epi32(0xFF);
+    const __m256i Threshold   = _mm256_set1_epi32(static_cast<int>(std::min(Attribs.Threshold, 255u)));
+    const __m256  Scale       = _mm256_set1_ps(Attribs.Scale);
+    const __m256  MaxValue    = _mm256_set1_ps(255.f);
+    const bool    UnitScale   = Attribs.Scale == 1.f;
+
+    __m256i mmMax    = Zero;
+    __m256i mmSum    = Zero;
+    __m256i mmSumSq  = Zero;
+    Uint32  NumIters = 0;
+
+    auto FlushSums = [&]() {
+        alignas(32) Uint32 Sum[8];
+        alignas(32) Uint32 SumSq[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(Sum), mmSum);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(SumSq), mmSumSq);
+        for (size_t i = 0; i < 8; ++i)
+        {
+            Stats.SumDiff += Sum[i];
+            Stats.SumSqDiff += SumSq[i];
+        }
+        mmSum    = Zero;
+        mmSumSq  = Zero;
+        NumIters = 0;
+    };
+
+    auto ScaleDiff = [&](__m256i Diff) {
+        // Same operations as in the generic path: float(Diff) * Scale, clamped to 255 and truncated.
+        // Negative values are clamped to 0 by the saturating pack.
+        __m256 fDiff = _mm256_mul_ps(_mm256_cvtepi32_ps(Diff), Scale);
+        fDiff        = _mm256_min_ps(fDiff, MaxValue);
+        return _mm256_cvttps_epi32(fDiff);
+    };
+
+    for (Uint32 col = 0; col < NumPixels; col += 8)
+    {
+        const __m256i Pixels1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Row.pRow1 + col * 4));
+        const __m256i Pixels2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Row.pRow2 + col * 4));
+
+        // |a - b| for unsigned bytes
+        const __m256i AbsDiff = _mm256_or_si256(_mm256_subs_epu8(Pixels1, Pixels2), _mm256_subs_epu8(Pixels2, Pixels1));
+
+        // Max over 4 channels of each pixel ends up in the lowest byte of each 32-bit lane
+        __m256i PixelDiff = _mm256_max_epu8(AbsDiff, _mm256_srli_epi32(AbsDiff, 8));
+        PixelDiff         = _mm256_max_epu8(PixelDiff, _mm256_srli_epi32(PixelDiff, 16));
+        PixelDiff         = _mm256_and_si256(PixelDiff, LowByteMask);
+
+        const int NonZeroMask        = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(PixelDiff, Zero)));
+        const int AboveThresholdMask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(PixelDiff, Threshold)));
+        Stats.NumDiffPixels += PlatformMisc::CountOneBits(static_cast<Uint32>(NonZeroMask));
+        Stats.NumDiffPixelsAboveThreshold += PlatformMisc::CountOneBits(static_cast<Uint32>(AboveThresholdMask));
+
+        mmMax   = _mm256_max_epi32(mmMax, PixelDiff);
+        mmSum   = _mm256_add_epi32(mmSum, PixelDiff);
+        mmSumSq = _mm256_add_epi32(mmSumSq, _mm256_madd_epi16(PixelDiff, PixelDiff));
+        if (++NumIters == MaxItersBeforeFlush)
+            FlushSums();
+
+        if (Row.pDiffRow != nullptr)
+        {
+            __m256i* pDst = reinterpret_cast<__m256i*>(Row.pDiffRow + col * 4);
+            if (UnitScale)
+            {
+                _mm256_storeu_si256(pDst, AbsDiff);
+            }
+            else
+            {
+                // Unpack and pack operate within 128-bit lanes, so packing restores the original order.
+                const __m256i Lo16 = _mm256_unpacklo_epi8(AbsDiff, Zero);
+                const __m256i Hi16 = _mm256_unpackhi_epi8(AbsDiff, Zero);
+
+                const __m256i Scaled0 = ScaleDiff(_mm256_unpacklo_epi16(Lo16, Zero));
+                const __m256i Scaled1 = ScaleDiff(_mm256_unpackhi_epi16(Lo16, Zero));
+                const __m256i Scaled2 = ScaleDiff(_mm256_unpacklo_epi16(Hi16, Zero));
+                const __m256i Scaled3 = ScaleDiff(_mm256_unpackhi_epi16(Hi16, Zero));
+
+                const __m256i ScaledLo16 = _mm256_packus_epi32(Scaled0, Scaled1);
+                const __m256i ScaledHi16 = _mm256_packus_epi32(Scaled2, Scaled3);
+                _mm256_storeu_si256(pDst, _mm256_packus_epi16(ScaledLo16, ScaledHi16));
+            }
+        }
+    }
+    FlushSums();
+
+    alignas(32) Uint32 Max[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(Max), mmMax);
+    for (size_t i = 0; i < 8; ++i)
+        Stats.MaxDiff = std::max(Stats.MaxDiff, Max[i]);
+
+    return NumPixels;
+}
+#endif
+
+#if DILIGENT_NEON_ENABLED
+// Processes 16 four-channel pixels per iteration and returns the number of processed pixels.
+// The remaining pixels must be processed by the generic path.
+Uint32 ComputeRowDifferenceRGBA8NEON(const ComputeImageDifferenceAttribs& Attribs,
+                                     const ImageDiffRowInfo&              Row,
+                                     ImageDiffStats&                      Stats)
+{
+    const Uint32 NumPixels = Attribs.Width & ~15u;
+    if (NumPixels == 0)
+        return 0;
+
+    // Each 32-bit lane of the squared difference accumulator receives at most 4 * 255^2 per
+    // iteration, so it must be flushed before it may overflow.
+    constexpr Uint32 MaxItersBeforeFlush = 8192;
+
+    const uint8x16_t  Threshold = vdupq_n_u8(static_cast<Uint8>(std::min(Attribs.Threshold, 255u)));
+    const uint8x16_t  Zero      = vdupq_n_u8(0);
+    const float32x4_t MaxValue  = vdupq_n_f32(255.f);
+    const bool        UnitScale = Attribs.Scale == 1.f;
+
+    uint8x16_t mmMax         = Zero;
+    uint32x4_t mmNumDiff     = vdupq_n_u32(0);
+    uint32x4_t mmNumAboveThr = vdupq_n_u32(0);
+    uint32x4_t mmSum         = vdupq_n_u32(0);
+    uint32x4_t mmSumSq       = vdupq_n_u32(0);
+    Uint32     NumIters      = 0;
+
+    auto FlushSums = [&]() {
+        Uint32 NumDiff[4];
+        Uint32 NumAboveThr[4];
+        Uint32 Sum[4];
+        Uint32 SumSq[4];
+        vst1q_u32(NumDiff, mmNumDiff);
+        vst1q_u32(NumAboveThr, mmNumAboveThr);
+        vst1q_u32(Sum, mmSum);
+        vst1q_u32(SumSq, mmSumSq);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            Stats.NumDiffPixels += NumDiff[i];
+            Stats.NumDiffPixelsAboveThreshold += NumAboveThr[i];
+            Stats.SumDiff += Sum[i];
+            Stats.SumSqDiff += SumSq[i];
+        }
+        mmNumDiff     = vdupq_n_u32(0);
+        mmNumAboveThr = vdupq_n_u32(0);
+        mmSum         = vdupq_n_u32(0);
+        mmSumSq       = vdupq_n_u32(0);
+        NumIters      = 0;
+    };
+
+    auto ScaleDiff = [&](uint8x16_t Diff) {
+        const float32x4_t Scale = vdupq_n_f32(Attribs.Scale);
+
+        const uint16x8_t Lo16 = vmovl_u8(vget_low_u8(Diff));
+        const uint16x8_t Hi16 = vmovl_u8(vget_high_u8(Diff));
+
+        // Same operations as in the generic path: float(Diff) * Scale, clamped to 255 and truncated.
+        // vcvtq_u32_f32 rounds toward zero and saturates negative values to 0.
+        auto ScaleU32 = [&](uint16x4_t Val) {
+            float32x4_t fVal = vmulq_f32(vcvtq_f32_u32(vmovl_u16(Val)), Scale);
+            fVal             = vminq_f32(fVal, MaxValue);
+            return vmovn_u32(vcvtq_u32_f32(fVal));
+        };
+
+        const uint16x8_t ScaledLo = vcombine_u16(ScaleU32(vget_low_u16(Lo16)), ScaleU32(vget_high_u16(Lo16)));
+        const uint16x8_t ScaledHi = vcombine_u16(ScaleU32(vget_low_u16(Hi16)), ScaleU32(vget_high_u16(Hi16)));
+        return vcombine_u8(vmovn_u16(ScaledLo), vmovn_u16(ScaledHi));
+    };
+
+    for (Uint32 col = 0; col < NumPixels; col += 16)
+    {
+        // De-interleave 16 RGBA pixels into four channel vectors
+        const uint8x16x4_t Pixels1 = vld4q_u8(Row.pRow1 + col * 4);
+        const uint8x16x4_t Pixels2 = vld4q_u8(Row.pRow2 + col * 4);
+
+        uint8x16x4_t AbsDiff;
+        AbsDiff.val[0] = vabdq_u8(Pixels1.val[0], Pixels2.val[0]);
+        AbsDiff.val[1] = vabdq_u8(Pixels1.val[1], Pixels2.val[1]);
+        AbsDiff.val[2] = vabdq_u8(Pixels1.val[2], Pixels2.val[2]);
+        AbsDiff.val[3] = vabdq_u8(Pixels1.val[3], Pixels2.val[3]);
+
+        const uint8x16_t PixelDiff = vmaxq_u8(vmaxq_u8(AbsDiff.val[0], AbsDiff.val[1]), vmaxq_u8(AbsDiff.val[2], AbsDiff.val[3]));
+
+        // Comparison results are 0xFF or 0; shift right by 7 to get 1 or 0
+        const uint8x16_t NonZero        = vshrq_n_u8(vcgtq_u8(PixelDiff, Zero), 7);
+        const uint8x16_t AboveThreshold = vshrq_n_u8(vcgtq_u8(PixelDiff, Threshold), 7);
+        mmNumDiff                       = vpadalq_u16(mmNumDiff, vpaddlq_u8(NonZero));
+        mmNumAboveThr                   = vpadalq_u16(mmNumAboveThr, vpaddlq_u8(AboveThreshold));
+
+        mmMax   = vmaxq_u8(mmMax, PixelDiff);
+        mmSum   = vpadalq_u16(mmSum, vpaddlq_u8(PixelDiff));
+        mmSumSq = vpadalq_u16(mmSumSq, vmull_u8(vget_low_u8(PixelDiff), vget_low_u8(PixelDiff)));
+        mmSumSq = vpadalq_u16(mmSumSq, vmull_u8(vget_high_u8(PixelDiff), vget_high_u8(PixelDiff)));
+        if (++NumIters == MaxItersBeforeFlush)
+            FlushSums();
+
+        if (Row.pDiffRow != nullptr)
+        {
+            if (!UnitScale)
+            {
+                AbsDiff.val[0] = ScaleDiff(AbsDiff.val[0]);
+                AbsDiff.val[1] = ScaleDiff(AbsDiff.val[1]);
+                AbsDiff.val[2] = ScaleDiff(AbsDiff.val[2]);
+                AbsDiff.val[3] = ScaleDiff(AbsDiff.val[3]);
+            }
+            vst4q_u8(Row.pDiffRow + col * 4, AbsDiff);
+        }
+    }
+    FlushSums();
+
+    Uint8 Max[16];
+    vst1q_u8(Max, mmMax);
+    for (size_t i = 0; i < 16; ++i)
+        Stats.MaxDiff = std::max(Stats.MaxDiff, Uint32{Max[i]});
+
+    return NumPixels;
+}
+#endif
+
+void ComputeRowRangeDifference(const ComputeImageDifferenceAttribs& Attribs,
+                               Uint32                               NumSrcChannels,
+                               Uint32                               NumDiffChannels,
+                               Uint32                               StartRow,
+                               Uint32                               EndRow,
+                               ImageDiffStats&                      Stats)
+{
+#if DILIGENT_AVX2_ENABLED || DILIGENT_NEON_ENABLED
+    // SIMD paths handle the most common case of two RGBA8 images and
+    // an optional RGBA8 difference image.
+    const bool UseSIMD =
+        Attribs.NumChannels1 == 4 &&
+        Attribs.NumChannels2 == 4 &&
+        (Attribs.pDiffImage == nullptr || NumDiffChannels == 4);
+#endif
+
+    for (Uint32 row = StartRow; row < EndRow; ++row)
+    {
+        ImageDiffRowInfo Row;
+        Row.pRow1    = reinterpret_cast<const Uint8*>(Attribs.pImage1) + size_t{row} * Attribs.Stride1;
+        Row.pRow2    = reinterpret_cast<const Uint8*>(Attribs.pImage2) + size_t{row} * Attribs.Stride2;
+        Row.pDiffRow = Attribs.pDiffImage != nullptr ? reinterpret_cast<Uint8*>(Attribs.pDiffImage) + size_t{row} * Attribs.DiffStride : nullptr;
+
+        Uint32 StartCol = 0;
+#if DILIGENT_AVX2_ENABLED
+        if (UseSIMD)
+            StartCol = ComputeRowDifferenceRGBA8AVX2(Attribs, Row, Stats);
+#elif DILIGENT_NEON_ENABLED
+        if (UseSIMD)
+            StartCol = ComputeRowDifferenceRGBA8NEON(Attribs, Row, Stats);
+#endif
+
+        ComputeRowDifferenceGeneric(Attribs, NumSrcChannels, NumDiffChannels, Row, StartCol, Stats);
+    }
+}
+
+void ComputeImageDifferenceParallel(const ComputeImageDifferenceAttribs& Attribs,
+                                    Uint32                               NumSrcChannels,
+                                    Uint32                               NumDiffChannels,
+                                    ImageDiffStats&                      Stats)
+{
+    // Small images are not worth the overhead of the thread pool
+    constexpr Uint32 MinRowsPerChunk = 32;
+    constexpr Uint32 MaxChunks       = 64;
+
+    const Uint32 NumChunks = std::min((Attribs.Height + MinRowsPerChunk - 1) / MinRowsPerChunk, MaxChunks);
+    if (Attribs.pThreadPool == nullptr || NumChunks < 2)
+    {
+        ComputeRowRangeDifference(Attribs, NumSrcChannels, NumDiffChannels, 0, Attribs.Height, Stats);
+        return;
+    }
+
+    const Uint32 RowsPerChunk = (Attribs.Height + NumChunks - 1) / NumChunks;
+
+    std::vector<ImageDiffStats> ChunkStats(NumChunks);
+    ParallelFor(Attribs.pThreadPool, NumChunks, [&](Uint32 Chunk) {
+        const Uint32 StartRow = Chunk * RowsPerChunk;
+        const Uint32 EndRow   = std::min(StartRow + RowsPerChunk, Attribs.Height);
+        ComputeRowRangeDifference(Attribs, NumSrcChannels, NumDiffChannels, StartRow, EndRow, ChunkStats[Chunk]);
+    });
+
+    for (const ImageDiffStats& Chunk : ChunkStats)
+        Stats += Chunk;
+}
+
+} // namespace
+
 void ComputeImageDifference(const ComputeImageDifferenceAttribs& Attribs,
                             ImageDiffInfo&                       Diff)
 {
@@ -79,55 +457,16 @@ void ComputeImageDifference(const ComputeImageDifferenceAttribs& Attribs,
         }
     }
 
-    for (Uint32 row = 0; row < Attribs.Height; ++row)
-    {
-        const Uint8* pRow1    = reinterpret_cast<const Uint8*>(Attribs.pImage1) + row * Attribs.Stride1;
-        const Uint8* pRow2    = reinterpret_cast<const Uint8*>(Attribs.pImage2) + row * Attribs.Stride2;
-        Uint8*       pDiffRow = Attribs.pDiffImage != nullptr ? reinterpret_cast<Uint8*>(Attribs.pDiffImage) + row * Attribs.DiffStride : nullptr;
-
-        for (Uint32 col = 0; col < Attribs.Width; ++col)
-        {
-            Uint32 PixelDiff = 0;
-            for (Uint32 ch = 0; ch < NumSrcChannels; ++ch)
-            {
-                const Uint32 ChannelDiff = static_cast<Uint32>(
-                    std::abs(static_cast<int>(pRow1[col * Attribs.NumChannels1 + ch]) -
-                             static_cast<int>(pRow2[col * Attribs.NumChannels2 + ch])));
-                PixelDiff = std::max(PixelDiff, ChannelDiff);
-
-                if (pDiffRow != nullptr && ch < NumDiffChannels)
-                {
-                    pDiffRow[col * NumDiffChannels + ch] = static_cast<Uint8>(std::min(ChannelDiff * Attribs.Scale, 255.f));
-                }
-            }
-
-            if (pDiffRow != nullptr)
-            {
-                for (Uint32 ch = NumSrcChannels; ch < NumDiffChannels; ++ch)
-                {
-                    pDiffRow[col * NumDiffChannels + ch] = ch == 3 ? 255 : 0;
-                }
-            }
-
-            if (PixelDiff != 0)
-            {
-                ++Diff.NumDiffPixels;
-                Diff.AvgDiff += static_cast<float>(PixelDiff);
-                Diff.RmsDiff += static_cast<float>(PixelDiff * PixelDiff);
-                Diff.MaxDiff = std::max(Diff.MaxDiff, PixelDiff);
-
-                if (PixelDiff > Attribs.Threshold)
-                {
-                    ++Diff.NumDiffPixelsAboveThreshold;
-                }
-            }
-        }
-    }
+    ImageDiffStats Stats;
+    ComputeImageDifferenceParallel(Attribs, NumSrcChannels, NumDiffChannels, Stats);
 
-    if (Diff.NumDiffPixels > 0)
+    Diff.NumDiffPixels               = Stats.NumDiffPixels;
+    Diff.NumDiffPixelsAboveThreshold = Stats.NumDiffPixelsAboveThreshold;
+    Diff.MaxDiff                     = Stats.MaxDiff;
+    if (Stats.NumDiffPixels > 0)
     {
-        Diff.AvgDiff /= static_cast<float>(Diff.NumDiffPixels);
-        Diff.RmsDiff = std::sqrt(Diff.RmsDiff / static_cast<float>(Diff.NumDiffPixels));
+        Diff.AvgDiff = static_cast<float>(static_cast<double>(Stats.SumDiff) / static_cast<double>(Stats.NumDiffPixels));
+        Diff.RmsDiff = static_cast<float>(std::sqrt(static_cast<double>(Stats.SumSqDiff) / static_cast<double>(Stats.NumDiffPixels)));
     }
 }
 
@@ -0,0 +1,393 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "RandomAccessFileStream.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "DataBlobImpl.hpp"
+#include "ProxyDataBlob.hpp"
+
+#if PLATFORM_LINUX
+#    include "LinuxFileIO.hpp"
+#else
+#    include "FileWrapper.hpp"
+#endif
+
+namespace Diligent
+{
+
+#if PLATFORM_LINUX
+
+namespace
+{
+
+// Keeps the file mapping alive while the data blob that references it exists
+class FileMappingHolder final : public ObjectBase<IObject>
+{
+public:
+    FileMappingHolder(IReferenceCounters* pRefCounters, LinuxFileMapping&& Mapping) :
+        ObjectBase<IObject>{pRefCounters},
+        m_Mapping{std::move(Mapping)}
+    {}
+
+    const LinuxFileMapping& GetMapping() const { return m_Mapping; }
+
+private:
+    LinuxFileMapping m_Mapping;
+};
+
+LinuxFileAccessHint FileAccessHintToLinuxHint(FILE_ACCESS_HINT Hint)
+{
+    switch (Hint)
+    {
+        // clang-format off
+        case FILE_ACCESS_HINT_NORMAL:     return LinuxFileAccessHint::Normal;
+        case FILE_ACCESS_HINT_SEQUENTIAL: return LinuxFileAccessHint::Sequential;
+        case FILE_ACCESS_HINT_RANDOM:     return LinuxFileAccessHint::Random;
+        case FILE_ACCESS_HINT_WILL_NEED:  return LinuxFileAccessHint::WillNeed;
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected file access hint");
+            return LinuxFileAccessHint::Normal;
+    }
+}
+
+// All streams share one reader so that the number of rings and threads does not grow with the number
+// of open files. The reader is created on first use to avoid starting threads in processes that only
+// read files synchronously.
+LinuxAsyncFileReader& GetSharedAsyncFileReader()
+{
+    static LinuxAsyncFileReader Reader;
+    return Reader;
+}
+
+} // namespace
+
+struct RandomAccessFileStream::Impl
+{
+    explicit Impl(const Char* Path) :
+        File{Path}
+    {}
+
+    ~Impl()
+    {
+        // Completion callbacks reference this object
+        WaitForReads();
+    }
+
+    // Tracks the reads of this stream in the shared reader
+    struct PendingRead
+    {
+        Impl*                pOwner    = nullptr;
+        FileReadCallbackType Callback  = nullptr;
+        void*                pUserData = nullptr;
+    };
+
+    static void OnReadComplete(bool Success, size_t BytesRead, void* pUserData)
+    {
+        std::unique_ptr<PendingRead> pRead{static_cast<PendingRead*>(pUserData)};
+        if (pRead->Callback != nullptr)
+            pRead->Callback(Success, BytesRead, pRead->pUserData);
+
+        Impl& Owner = *pRead->pOwner;
+        {
+            std::lock_guard<std::mutex> Lock{Owner.PendingMtx};
+            if (!Success)
+                Owner.ReadFailed = true;
+            VERIFY_EXPR(Owner.NumPending > 0);
+            if (--Owner.NumPending == 0)
+                Owner.PendingCV.notify_all();
+        }
+    }
+
+    bool WaitForReads()
+    {
+        std::unique_lock<std::mutex> Lock{PendingMtx};
+        PendingCV.wait(Lock, [this]() { return NumPending == 0; });
+
+        const bool Success = !ReadFailed;
+        ReadFailed         = false;
+        return Success;
+    }
+
+    LinuxNativeFile File;
+
+    std::mutex              PendingMtx;
+    std::condition_variable PendingCV;
+    size_t                  NumPending = 0;
+    bool                    ReadFailed = false;
+};
+
+#else
+
+struct RandomAccessFileStream::Impl
+{
+    explicit Impl(const Char* Path) :
+        File{Path, EFileAccessMode::Read}
+    {}
+
+    bool ReadAt(size_t Offset, void* pData, size_t Size)
+    {
+        std::lock_guard<std::mutex> Lock{Mtx};
+        return File->SetPos(Offset, FilePosOrigin::Start) && File->Read(pData, Size);
+    }
+
+    FileWrapper File;
+    std::mutex  Mtx;
+
+    std::atomic<bool> ReadFailed{false};
+};
+
+#endif
+
+
+RefCntAutoPtr<RandomAccessFileStream> RandomAccessFileStream::Create(const Char* Path)
+{
+    if (Path == nullptr || Path[0] == '\0')
+    {
+        DEV_ERROR("Path must not be null or empty");
+        return {};
+    }
+
+    return RefCntAutoPtr<RandomAccessFileStream>{MakeNewRCObj<RandomAccessFileStream>()(Path)};
+}
+
+RandomAccessFileStream::RandomAccessFileStream(IReferenceCounters* pRefCounters,
+                                               const Char*         Path) :
+    TBase{pRefCounters},
+    m_pImpl{std::make_unique<Impl>(Path)}
+{
+}
+
+RandomAccessFileStream::~RandomAccessFileStream()
+{
+}
+
+bool RandomAccessFileStream::IsValid()
+{
+#if PLATFORM_LINUX
+    return m_pImpl->File.IsValid();
+#else
+    return !!m_pImpl->File;
+#endif
+}
+
+size_t RandomAccessFileStream::GetSize()
+{
+    if (!IsValid())
+        return 0;
+
+#if PLATFORM_LINUX
+    return m_pImpl->File.GetSize();
+#else
+    std::lock_guard<std::mutex> Lock{m_pImpl->Mtx};
+    return m_pImpl->File->GetSize();
+#endif
+}
+
+size_t RandomAccessFileStream::GetPos()
+{
+    return m_Pos;
+}
+
+bool RandomAccessFileStream::SetPos(size_t Offset, int Origin)
+{
+    switch (static_cast<FilePosOrigin>(Origin))
+    {
+        case FilePosOrigin::Start:
+            m_Pos = Offset;
+            break;
+
+        case FilePosOrigin::Curr:
+            m_Pos += Offset;
+            break;
+
+        case FilePosOrigin::End:
+            m_Pos = GetSize() + Offset;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected origin");
+            return false;
+    }
+
+    return true;
+}
+
+bool RandomAccessFileStream::Read(void* Data, size_t Size)
+{
+    if (!ReadAt(m_Pos, Data, Size))
+        return false;
+
+    m_Pos += Size;
+    return true;
+}
+
+void RandomAccessFileStream::ReadBlob(IDataBlob* pData)
+{
+    const size_t FileSize  = GetSize();
+    const size_t BytesLeft = FileSize > m_Pos ? FileSize - m_Pos : 0;
+    pData->Resize(BytesLeft);
+    if (BytesLeft > 0)
+    {
+        bool res = Read(pData->GetDataPtr(), BytesLeft);
+        VERIFY_EXPR(res);
+        (void)res;
+    }
+}
+
+bool RandomAccessFileStream::Write(const void* Data, size_t Size)
+{
+    UNSUPPORTED("Random-access file stream is read-only");
+    return false;
+}
+
+bool RandomAccessFileStream::ReadAt(size_t Offset, void* pData, size_t Size)
+{
+    if (Size == 0)
+        return true;
+
+    if (!IsValid() || pData == nullptr)
+        return false;
+
+#if PLATFORM_LINUX
+    return m_pImpl->File.ReadAt(Offset, pData, Size);
+#else
+    return m_pImpl->ReadAt(Offset, pData, Size);
+#endif
+}
+
+bool RandomAccessFileStream::MapData(size_t           Offset,
+                                     size_t           Size,
+                                     FILE_ACCESS_HINT Hint,
+                                     IDataBlob**      ppData)
+{
+    DEV_CHECK_ERR(ppData != nullptr, "ppData must not be null");
+    DEV_CHECK_ERR(ppData == nullptr || *ppData == nullptr, "*ppData is not null. Overwriting it may cause memory leak");
+    if (ppData == nullptr || !IsValid())
+        return false;
+
+    const size_t FileSize = GetSize();
+    if (Offset > FileSize || (Size != 0 && Offset + Size > FileSize))
+    {
+        LOG_ERROR_MESSAGE("The region [", Offset, ", ", Offset + Size, ") exceeds the file size (", FileSize, ")");
+        return false;
+    }
+    if (Size == 0)
+        Size = FileSize - Offset;
+
+    if (Size == 0)
+    {
+        *ppData = DataBlobImpl::Create().Detach();
+        return true;
+    }
+
+#if PLATFORM_LINUX
+    LinuxFileMapping Mapping = m_pImpl->File.Map(Offset, Size, FileAccessHintToLinuxHint(Hint));
+    if (!Mapping)
+        return false;
+
+    RefCntAutoPtr<FileMappingHolder> pHolder{MakeNewRCObj<FileMappingHolder>()(std::move(Mapping))};
+
+    const LinuxFileMapping& MappedData = pHolder->GetMapping();
+    *ppData                            = ProxyDataBlob::Create(MappedData.GetData(), MappedData.GetSize(), pHolder).Detach();
+    return true;
+#else
+    RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create(Size);
+    if (!ReadAt(Offset, pBlob->GetDataPtr(), Size))
+        return false;
+
+    *ppData = pBlob.Detach();
+    return true;
+#endif
+}
+
+void RandomAccessFileStream::EnqueueReads(const FileReadRequest* pRequests,
+                                          Uint32                 NumRequests)
+{
+    DEV_CHECK_ERR(pRequests != nullptr || NumRequests == 0, "pRequests must not be null");
+    if (pRequests == nullptr || NumRequests == 0)
+        return;
+
+#if PLATFORM_LINUX
+    if (!IsValid())
+    {
+        for (Uint32 i = 0; i < NumRequests; ++i)
+        {
+            if (pRequests[i].Callback != nullptr)
+                pRequests[i].Callback(false, 0, pRequests[i].pCallbackUserData);
+        }
+        return;
+    }
+
+    std::vector<LinuxAsyncFileReader::Request> Requests(NumRequests);
+    for (Uint32 i = 0; i < NumRequests; ++i)
+    {
+        const FileReadRequest&         Src = pRequests[i];
+        LinuxAsyncFileReader::Request& Dst = Requests[i];
+
+        Dst.Fd        = m_pImpl->File.GetDescriptor();
+        Dst.Offset    = Src.Offset;
+        Dst.Size      = Src.Size;
+        Dst.pData     = Src.pData;
+        Dst.Callback  = Impl::OnReadComplete;
+        Dst.pUserData = new Impl::PendingRead{m_pImpl.get(), Src.Callback, Src.pCallbackUserData};
+    }
+    {
+        std::lock_guard<std::mutex> Lock{m_pImpl->PendingMtx};
+        m_pImpl->NumPending += NumRequests;
+    }
+    GetSharedAsyncFileReader().Enqueue(Requests.data(), Requests.size());
+#else
+    // Emulate asynchronous reads with blocking reads
+    for (Uint32 i = 0; i < NumRequests; ++i)
+    {
+        const FileReadRequest& Req = pRequests[i];
+
+        const bool Success = ReadAt(Req.Offset, Req.pData, Req.Size);
+        if (!Success)
+            m_pImpl->ReadFailed.store(true);
+
+        if (Req.Callback != nullptr)
+            Req.Callback(Success, Success ? Req.Size : 0, Req.pCallbackUserData);
+    }
+#endif
+}
+
+bool RandomAccessFileStream::WaitForReads()
+{
+#if PLATFORM_LINUX
+    return m_pImpl->WaitForReads();
+#else
+    return !m_pImpl->ReadFailed.exchange(false);
+#endif
+}
+
+} // namespace Diligent
@@ -26,6 +26,8 @@
 
 #include "Serializer.hpp"
 
+#include <algorithm>
+
 #include "HashUtils.hpp"
 
 namespace Diligent
@@ -115,4 +117,145 @@ SerializedData SerializedData::MakeCopy(IMemoryAllocator& Allocator) const
     return Copy;
 }
 
+
+SerializedDataChunks::SerializedDataChunks(IMemoryAllocator& Allocator,
+                                           size_t            ChunkSize,
+                                           IFileStream*      pStream) noexcept :
+    m_Allocator{Allocator},
+    m_ChunkSize{std::max(ChunkSize, MaxAlignment)},
+    m_pStream{pStream}
+{
+}
+
+SerializedDataChunks::~SerializedDataChunks()
+{
+    VERIFY(m_OpenChunk.pMemory == nullptr, "Serializer that writes to the chunks has not been destroyed");
+    Clear();
+    for (Chunk& C : m_FreeChunks)
+        m_Allocator.Free(C.pMemory);
+}
+
+void SerializedDataChunks::ReleaseChunk(Chunk& C)
+{
+    if (C.AllocSize == m_ChunkSize + MaxAlignment * 2)
+    {
+        // Keep default-size chunks in the pool
+        m_FreeChunks.emplace_back(C);
+    }
+    else
+    {
+        m_Allocator.Free(C.pMemory);
+    }
+    C = {};
+}
+
+void SerializedDataChunks::Clear()
+{
+    for (Chunk& C : m_Chunks)
+        ReleaseChunk(C);
+    m_Chunks.clear();
+    m_Size        = 0;
+    m_StreamError = false;
+}
+
+Uint8* SerializedDataChunks::OpenChunk(size_t Offset, size_t MinSize, Uint8*& pEnd)
+{
+    VERIFY(m_OpenChunk.pMemory == nullptr, "Only one serializer may write to the chunks at a time");
+    VERIFY(Offset == m_Size, "Chunks must be written sequentially");
+
+    Chunk C;
+    if (MinSize <= m_ChunkSize && !m_FreeChunks.empty())
+    {
+        C = m_FreeChunks.back();
+        m_FreeChunks.pop_back();
+    }
+    else
+    {
+        // Reserve space to align the data start and to offset it by the global offset alignment
+        C.AllocSize = std::max(MinSize, m_ChunkSize) + MaxAlignment * 2;
+        C.pMemory   = m_Allocator.Allocate(C.AllocSize, "Serialized data chunk", __FILE__, __LINE__);
+    }
+
+    // Make the address alignment match the global offset alignment so that
+    // aligned items are also properly aligned in memory.
+    C.pData = AlignUp(static_cast<Uint8*>(C.pMemory), MaxAlignment) + Offset % MaxAlignment;
+    C.Size  = 0;
+
+    pEnd = static_cast<Uint8*>(C.pMemory) + C.AllocSize;
+    VERIFY_EXPR(pEnd >= C.pData + MinSize);
+
+    // Zero out the memory so that the alignment gaps do not contain garbage
+    std::memset(C.pData, 0, pEnd - C.pData);
+
+    m_OpenChunk = C;
+    return C.pData;
+}
+
+void SerializedDataChunks::CloseChunk(const Uint8* pEnd)
+{
+    VERIFY(m_OpenChunk.pMemory != nullptr, "There is no open chunk");
+    VERIFY_EXPR(pEnd >= m_OpenChunk.pData && pEnd <= static_cast<const Uint8*>(m_OpenChunk.pMemory) + m_OpenChunk.AllocSize);
+
+    Chunk C     = m_OpenChunk;
+    m_OpenChunk = {};
+    C.Size      = pEnd - C.pData;
+    m_Size += C.Size;
+
+    if (m_pStream != nullptr)
+    {
+        if (C.Size > 0 && !m_StreamError && !m_pStream->Write(C.pData, C.Size))
+        {
+            LOG_ERROR_MESSAGE("Failed to write ", C.Size, " bytes of serialized data to the stream");
+            m_StreamError = true;
+        }
+        ReleaseChunk(C);
+    }
+    else
+    {
+        m_Chunks.emplace_back(C);
+    }
+}
+
+SerializedData SerializedDataChunks::GetChunk(size_t Idx) const
+{
+    VERIFY_EXPR(Idx < m_Chunks.size());
+    const Chunk& C = m_Chunks[Idx];
+    return SerializedData{C.Size > 0 ? C.pData : nullptr, C.Size};
+}
+
+bool SerializedDataChunks::CopyTo(void* pDst, size_t DstSize) const
+{
+    if (m_pStream != nullptr)
+    {
+        UNEXPECTED("Chunks that are written to the stream can't be copied");
+        return false;
+    }
+
+    if (DstSize < m_Size)
+    {
+        UNEXPECTED("Destination size (", DstSize, ") is not enough to copy ", m_Size, " bytes");
+        return false;
+    }
+
+    Uint8* pDstPtr = static_cast<Uint8*>(pDst);
+    for (const Chunk& C : m_Chunks)
+    {
+        if (C.Size == 0)
+            continue;
+        std::memcpy(pDstPtr, C.pData, C.Size);
+        pDstPtr += C.Size;
+    }
+
+    return true;
+}
+
+SerializedData SerializedDataChunks::Flatten(IMemoryAllocator& Allocator) const
+{
+    SerializedData Data{m_Size, Allocator};
+    if (!CopyTo(Data.Ptr(), Data.Size()))
+        return {};
+
+    return Data;
+}
+
 } // namespace Diligent
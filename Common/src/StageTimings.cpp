@@ -0,0 +1,218 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "StageTimings.hpp"
+
+#include <chrono>
+#include <sstream>
+
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+Uint64 GetSteadyClockNs()
+{
+    return static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+Uint32 GetHistogramBin(Uint64 DurationNs)
+{
+    Uint64 DurationUs = DurationNs / 1000;
+    Uint32 Bin        = 0;
+    while (DurationUs > 1 && Bin + 1 < StageTimings::NumHistogramBins)
+    {
+        DurationUs >>= 1u;
+        ++Bin;
+    }
+    return Bin;
+}
+
+Uint32 GetTraceThreadId()
+{
+    // Small sequential ids make the trace easier to read than native thread ids
+    static std::atomic<Uint32> NextThreadId{0};
+    thread_local const Uint32  ThreadId = NextThreadId.fetch_add(1);
+    return ThreadId;
+}
+
+void WriteJsonString(std::ostream& Stream, const char* Str)
+{
+    Stream << '"';
+    for (const char* c = Str; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+            Stream << '\\' << *c;
+        else if (static_cast<unsigned char>(*c) < 0x20)
+            Stream << ' ';
+        else
+            Stream << *c;
+    }
+    Stream << '"';
+}
+
+} // namespace
+
+StageTimings& StageTimings::Get()
+{
+    static StageTimings Instance;
+    return Instance;
+}
+
+StageTimings::StageTimings() :
+    m_Epoch{GetSteadyClockNs()}
+{
+}
+
+void StageTimings::Enable(bool EnableTimings, bool RecordTrace)
+{
+    m_RecordTrace.store(EnableTimings && RecordTrace);
+    m_Enabled.store(EnableTimings);
+}
+
+Uint64 StageTimings::GetTimestamp() const
+{
+    return GetSteadyClockNs() - m_Epoch;
+}
+
+void StageTimings::Record(Uint32 Stage, Uint64 StartNs, Uint64 EndNs)
+{
+    if (Stage >= MaxStages)
+    {
+        UNEXPECTED("Stage index (", Stage, ") is out of range");
+        return;
+    }
+
+    const Uint64 DurationNs = EndNs > StartNs ? EndNs - StartNs : 0;
+
+    AtomicStageStats& Stats = m_Stats[Stage];
+    Stats.Count.fetch_add(1, std::memory_order_relaxed);
+    Stats.TotalNs.fetch_add(DurationNs, std::memory_order_relaxed);
+    Stats.Histogram[GetHistogramBin(DurationNs)].fetch_add(1, std::memory_order_relaxed);
+
+    Uint64 MinNs = Stats.MinNs.load(std::memory_order_relaxed);
+    while (DurationNs < MinNs && !Stats.MinNs.compare_exchange_weak(MinNs, DurationNs, std::memory_order_relaxed))
+    {
+    }
+    Uint64 MaxNs = Stats.MaxNs.load(std::memory_order_relaxed);
+    while (DurationNs > MaxNs && !Stats.MaxNs.compare_exchange_weak(MaxNs, DurationNs, std::memory_order_relaxed))
+    {
+    }
+
+    if (m_RecordTrace.load(std::memory_order_relaxed))
+    {
+        TraceEvent Event;
+        Event.Stage      = Stage;
+        Event.ThreadId   = GetTraceThreadId();
+        Event.StartNs    = StartNs;
+        Event.DurationNs = DurationNs;
+
+        std::lock_guard<std::mutex> Guard{m_TraceMtx};
+        if (m_Trace.size() < MaxTraceEvents)
+            m_Trace.push_back(Event);
+        else
+            ++m_NumDroppedEvents;
+    }
+}
+
+StageTimings::StageStats StageTimings::GetStats(Uint32 Stage) const
+{
+    StageStats Stats;
+    if (Stage >= MaxStages)
+    {
+        UNEXPECTED("Stage index (", Stage, ") is out of range");
+        return Stats;
+    }
+
+    const AtomicStageStats& SrcStats = m_Stats[Stage];
+
+    Stats.Count   = SrcStats.Count.load(std::memory_order_relaxed);
+    Stats.TotalNs = SrcStats.TotalNs.load(std::memory_order_relaxed);
+    Stats.MinNs   = Stats.Count > 0 ? SrcStats.MinNs.load(std::memory_order_relaxed) : 0;
+    Stats.MaxNs   = SrcStats.MaxNs.load(std::memory_order_relaxed);
+    for (Uint32 i = 0; i < NumHistogramBins; ++i)
+        Stats.Histogram[i] = SrcStats.Histogram[i].load(std::memory_order_relaxed);
+
+    return Stats;
+}
+
+size_t StageTimings::GetNumDroppedTraceEvents() const
+{
+    std::lock_guard<std::mutex> Guard{m_TraceMtx};
+    return m_NumDroppedEvents;
+}
+
+std::string StageTimings::GetChromeTrace(const char* const* StageNames, Uint32 NumStages) const
+{
+    std::ostringstream Stream;
+    Stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    {
+        std::lock_guard<std::mutex> Guard{m_TraceMtx};
+        for (size_t i = 0; i < m_Trace.size(); ++i)
+        {
+            const TraceEvent& Event = m_Trace[i];
+
+            if (i > 0)
+                Stream << ',';
+            Stream << "\n{\"name\":";
+            if (Event.Stage < NumStages && StageNames != nullptr && StageNames[Event.Stage] != nullptr)
+                WriteJsonString(Stream, StageNames[Event.Stage]);
+            else
+                Stream << "\"Stage " << Event.Stage << '"';
+            // Timestamps and durations are in microseconds
+            Stream << ",\"cat\":\"Diligent\",\"ph\":\"X\",\"pid\":0,\"tid\":" << Event.ThreadId
+                   << ",\"ts\":" << Event.StartNs / 1000 << '.' << (Event.StartNs % 1000) / 100
+                   << ",\"dur\":" << Event.DurationNs / 1000 << '.' << (Event.DurationNs % 1000) / 100 << '}';
+        }
+    }
+
+    Stream << "\n]}\n";
+    return Stream.str();
+}
+
+void StageTimings::Reset()
+{
+    for (AtomicStageStats& Stats : m_Stats)
+    {
+        Stats.Count.store(0);
+        Stats.TotalNs.store(0);
+        Stats.MinNs.store(~Uint64{0});
+        Stats.MaxNs.store(0);
+        for (std::atomic<Uint64>& Bin : Stats.Histogram)
+            Bin.store(0);
+    }
+
+    std::lock_guard<std::mutex> Guard{m_TraceMtx};
+    m_Trace.clear();
+    m_NumDroppedEvents = 0;
+}
+
+} // namespace Diligent
@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "StringAtomTable.hpp"
+
+#include <cstring>
+
+namespace Diligent
+{
+
+StringAtomTable::StringAtomTable(IMemoryAllocator& RawAllocator)
+{
+    for (std::unique_ptr<Shard>& pShard : m_Shards)
+        pShard = std::make_unique<Shard>(RawAllocator);
+}
+
+StringAtomTable::~StringAtomTable()
+{
+}
+
+StringAtom StringAtomTable::Intern(const Char* Str)
+{
+    if (Str == nullptr)
+        return {};
+
+    return Intern(HashMapStringKey{Str});
+}
+
+StringAtom StringAtomTable::Intern(const HashMapStringKey& Key)
+{
+    if (!Key)
+        return {};
+
+    Shard& shard = GetShard(Key.GetHash());
+
+    std::lock_guard<std::mutex> Lock{shard.Mtx};
+
+    auto it = shard.Atoms.find(Key);
+    if (it != shard.Atoms.end())
+        return StringAtom{it->second};
+
+    const size_t Len   = strlen(Key.GetStr());
+    void*        pMem  = shard.Storage.Allocate(sizeof(StringAtom::Data) + Len + 1, alignof(StringAtom::Data));
+    auto*        pData = new (pMem) StringAtom::Data{Key.GetHash(), Len};
+    Char*        pStr  = reinterpret_cast<Char*>(pData + 1);
+    std::memcpy(pStr, Key.GetStr(), Len + 1);
+
+    shard.Atoms.emplace(HashMapStringKey{pStr, HashMapStringKey::PrecomputedHash{pData->Hash}}, pData);
+    return StringAtom{pData};
+}
+
+StringAtom StringAtomTable::Find(const Char* Str) const
+{
+    if (Str == nullptr)
+        return {};
+
+    return Find(HashMapStringKey{Str});
+}
+
+StringAtom StringAtomTable::Find(const HashMapStringKey& Key) const
+{
+    if (!Key)
+        return {};
+
+    const Shard& shard = GetShard(Key.GetHash());
+
+    std::lock_guard<std::mutex> Lock{shard.Mtx};
+
+    auto it = shard.Atoms.find(Key);
+    return it != shard.Atoms.end() ? StringAtom{it->second} : StringAtom{};
+}
+
+size_t StringAtomTable::GetAtomCount() const
+{
+    size_t Count = 0;
+    for (const std::unique_ptr<Shard>& pShard : m_Shards)
+    {
+        std::lock_guard<std::mutex> Lock{pShard->Mtx};
+        Count += pShard->Atoms.size();
+    }
+    return Count;
+}
+
+size_t StringAtomTable::GetStorageSize() const
+{
+    size_t Size = 0;
+    for (const std::unique_ptr<Shard>& pShard : m_Shards)
+    {
+        std::lock_guard<std::mutex> Lock{pShard->Mtx};
+        pShard->Storage.ProcessBlocks([&Size](const void*, size_t BlockSize) {
+            Size += BlockSize;
+        });
+    }
+    return Size;
+}
+
+} // namespace Diligent
@@ -72,6 +72,7 @@ public:
                         PoolCI.OnThreadExiting(i);
                 });
         }
+        m_NumThreads.store(static_cast<Uint32>(m_WorkerThreads.size()));
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ThreadPool, TBase)
@@ -242,6 +243,7 @@ public:
             worker.join();
 
         m_WorkerThreads.clear();
+        m_NumThreads.store(0);
     }
 
     virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
@@ -322,6 +324,11 @@ public:
         return m_NumRunningTasks.load();
     }
 
+    virtual Uint32 DILIGENT_CALL_TYPE GetThreadCount() const override final
+    {
+        return m_NumThreads.load();
+    }
+
     ~ThreadPoolImpl()
     {
         StopThreads();
@@ -348,6 +355,9 @@ private:
     std::atomic<bool>       m_Stop{false};
 
     std::atomic<int> m_NumRunningTasks{0};
+
+    // The number of worker threads, which may be queried from any thread
+    std::atomic<Uint32> m_NumThreads{0};
 };
 
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI)
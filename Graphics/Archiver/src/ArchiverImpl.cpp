@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "PSOSerializer.hpp"
+#include "StateCreationStageTimer.hpp"
 
 namespace Diligent
 {
@@ -69,14 +70,8 @@ ArchiverImpl::~ArchiverImpl()
 {
 }
 
-Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
+void ArchiverImpl::PopulateArchive(DeviceObjectArchive& Archive)
 {
-    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
-    if (ppBlob == nullptr)
-        return false;
-
-    DeviceObjectArchive Archive{ContentVersion};
-
     // A hash map that maps shader byte code to the index in the archive, for each device type
     std::array<std::unordered_map<size_t, Uint32>, static_cast<size_t>(DeviceType::Count)> BytecodeHashToIdx;
 
@@ -234,6 +229,18 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
             VERIFY_EXPR(Ser.IsEnded());
         }
     }
+}
+
+Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
+{
+    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
+    if (ppBlob == nullptr)
+        return false;
+
+    ScopedStateCreationStageTimer Timer{m_pSerializationDevice, STATE_CREATION_STAGE_ARCHIVE_SERIALIZATION};
+
+    DeviceObjectArchive Archive{ContentVersion};
+    PopulateArchive(Archive);
 
     Archive.Serialize(ppBlob);
 
@@ -247,11 +254,13 @@ Bool ArchiverImpl::SerializeToStream(Uint32 ContentVersion, IFileStream* pStream
     if (pStream == nullptr)
         return false;
 
-    RefCntAutoPtr<IDataBlob> pDataBlob;
-    if (!SerializeToBlob(ContentVersion, &pDataBlob))
-        return false;
+    ScopedStateCreationStageTimer Timer{m_pSerializationDevice, STATE_CREATION_STAGE_ARCHIVE_SERIALIZATION};
+
+    DeviceObjectArchive Archive{ContentVersion};
+    PopulateArchive(Archive);
 
-    return pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
+    // Stream the archive in one pass instead of serializing it into an intermediate blob
+    return Archive.Serialize(pStream);
 }
 
 template <typename ObjectImplType,
@@ -34,6 +34,7 @@
 #include "PSOSerializer.hpp"
 #include "Align.hpp"
 #include "FileSystem.hpp"
+#include "StateCreationStageTimer.hpp"
 
 namespace Diligent
 {
@@ -414,6 +415,7 @@ SerializedPipelineStateImpl::SerializedPipelineStateImpl(IReferenceCounters*
 #endif
                 try
                 {
+                    ScopedStateCreationStageTimer Timer{m_pSerializationDevice, STATE_CREATION_STAGE_ARCHIVER_PIPELINE_CREATION};
                     Initialize(static_cast<const PSOCreateInfoType&>(CreateInfo), ArchiveInfo);
                     m_Status.store(PIPELINE_STATE_STATUS_READY);
                 }
@@ -428,6 +430,7 @@ SerializedPipelineStateImpl::SerializedPipelineStateImpl(IReferenceCounters*
     }
     else
     {
+        ScopedStateCreationStageTimer Timer{m_pSerializationDevice, STATE_CREATION_STAGE_ARCHIVER_PIPELINE_CREATION};
         Initialize(static_cast<const PSOCreateInfoType&>(CreateInfo), ArchiveInfo);
         m_Status.store(PIPELINE_STATE_STATUS_READY);
     }
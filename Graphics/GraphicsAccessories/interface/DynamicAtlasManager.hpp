@@ -33,6 +33,7 @@
 
 #include <map>
 #include <unordered_map>
+#include <memory>
 
 #include "../../../Primitives/interface/BasicTypes.h"
 #include "../../../Common/interface/HashUtils.hpp"
@@ -47,6 +48,9 @@ namespace Diligent
 /// Region structure, which contains the x and y coordinates of the top-left
 /// corner, as well as the width and height of the region.
 ///
+/// The allocation strategy is selected at construction time, see
+/// DynamicAtlasManager::ALLOCATION_STRATEGY.
+///
 /// \warning The class is not thread-safe. All operations on the atlas must be
 ///          must be protected by a mutex or other synchronization mechanism.
 class DynamicAtlasManager
@@ -114,13 +118,80 @@ public:
         };
     };
 
-    DynamicAtlasManager(Uint32 Width, Uint32 Height);
+    /// Region allocation strategy.
+    enum ALLOCATION_STRATEGY : Uint8
+    {
+        /// Free regions are kept in the tree and are indexed by width and height.
+        /// Allocation picks the smallest free region that fits the request and
+        /// splits it into two or three sub-regions. Works well for arbitrary
+        /// region sizes and keeps fragmentation low, but every operation
+        /// involves several map updates.
+        ALLOCATION_STRATEGY_TREE = 0,
+
+        /// The atlas is divided into horizontal shelves. Each shelf keeps a sorted
+        /// list of free horizontal spans whose nodes are taken from a pool, so that
+        /// allocation and deallocation do not touch the heap in the steady state.
+        /// This strategy is the best choice for workloads where many regions share
+        /// the same height (e.g. glyph caches).
+        ALLOCATION_STRATEGY_SHELF,
+
+        /// Buddy quadtree: the atlas is tiled with square power-of-two blocks
+        /// that are recursively split into four children. Free blocks on every
+        /// level are tracked by hierarchical bitmaps. Requests are rounded up to
+        /// the next power of two, which makes this strategy a good fit for
+        /// power-of-two regions (e.g. shadow map tiles or texture pages).
+        /// Atlas dimensions must be powers of two.
+        ALLOCATION_STRATEGY_BUDDY,
+
+        ALLOCATION_STRATEGY_COUNT
+    };
+
+    /// Fragmentation statistics, see DynamicAtlasManager::GetFragmentationStats().
+    struct FragmentationStats
+    {
+        /// The number of allocated regions.
+        Uint32 AllocatedRegionCount = 0;
+
+        /// The number of free regions.
+        Uint32 FreeRegionCount = 0;
+
+        /// The total free area, same as GetTotalFreeArea().
+        Uint64 TotalFreeArea = 0;
+
+        /// The area of the largest free region.
+        Uint64 LargestFreeRegionArea = 0;
+
+        /// The area that is neither free nor occupied by allocated regions.
+
+        /// This is the space lost to internal fragmentation: the padding of buddy
+        /// blocks and the slack between the region height and the shelf height.
+        Uint64 WastedArea = 0;
+
+        /// External fragmentation, 1 - LargestFreeRegionArea / TotalFreeArea.
+
+        /// 0 means that all free space is available as a single region,
+        /// values close to 1 mean that free space is scattered across many small regions.
+        float ExternalFragmentation = 0;
+    };
+
+    /// Creates the atlas manager.
+
+    /// \param Width        - Atlas width.
+    /// \param Height       - Atlas height.
+    /// \param Strategy     - Allocation strategy.
+    /// \param MinBlockSize - Minimum block size for the buddy strategy, must be a power of two.
+    ///                       Larger values reduce the memory used by the bitmaps at the
+    ///                       cost of coarser allocations. Ignored by other strategies.
+    DynamicAtlasManager(Uint32              Width,
+                        Uint32              Height,
+                        ALLOCATION_STRATEGY Strategy     = ALLOCATION_STRATEGY_TREE,
+                        Uint32              MinBlockSize = 1);
     ~DynamicAtlasManager();
 
     // clang-format off
     DynamicAtlasManager             (const DynamicAtlasManager&)  = delete;
     DynamicAtlasManager& operator = (const DynamicAtlasManager&)  = delete;
-    DynamicAtlasManager             (      DynamicAtlasManager&&) = default;
+    DynamicAtlasManager             (      DynamicAtlasManager&&);
     DynamicAtlasManager& operator = (      DynamicAtlasManager&&) = delete;
     // clang-format on
 
@@ -142,11 +213,7 @@ public:
 
 
     /// Returns the number of free regions in the atlas.
-    Uint32 GetFreeRegionCount() const
-    {
-        VERIFY_EXPR(m_FreeRegionsByWidth.size() == m_FreeRegionsByHeight.size());
-        return static_cast<Uint32>(m_FreeRegionsByWidth.size());
-    }
+    Uint32 GetFreeRegionCount() const;
 
     /// Returns the atlas width.
     Uint32 GetWidth() const { return m_Width; }
@@ -158,15 +225,16 @@ public:
 
     /// The total free area is the sum of the areas of all free regions in the atlas,
     /// and thus may be fragmented.
-    Uint64 GetTotalFreeArea() const { return m_TotalFreeArea; }
+    Uint64 GetTotalFreeArea() const;
 
     /// Checks if the atlas is empty, i.e. if there are no allocated regions.
-    bool IsEmpty() const
-    {
-        VERIFY_EXPR(m_AllocatedRegions.empty() && (m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height}) ||
-                    !m_AllocatedRegions.empty() && (m_TotalFreeArea < Uint64{m_Width} * Uint64{m_Height}));
-        return m_AllocatedRegions.empty();
-    }
+    bool IsEmpty() const;
+
+    /// Returns the allocation strategy.
+    ALLOCATION_STRATEGY GetStrategy() const { return m_Strategy; }
+
+    /// Returns the fragmentation statistics.
+    FragmentationStats GetFragmentationStats() const;
 
 #define CMP(Member)                 \
     if (R0.Member < R1.Member)      \
@@ -206,8 +274,9 @@ private:
     void DbgRecursiveVerifyConsistency(const Node& N, Uint32& Area) const;
 #endif
 
-    const Uint32 m_Width;
-    const Uint32 m_Height;
+    const Uint32              m_Width;
+    const Uint32              m_Height;
+    const ALLOCATION_STRATEGY m_Strategy;
 
     Uint64 m_TotalFreeArea = 0;
 
@@ -269,6 +338,12 @@ private:
     std::map<Region, Node*, HeightFirstCompare> m_FreeRegionsByHeight;
     // Allocated regions
     std::unordered_map<Region, Node*, Region::Hasher> m_AllocatedRegions;
+
+    // Implementation of the shelf and buddy strategies; null for the tree strategy.
+    class RegionAllocator;
+    class ShelfAllocator;
+    class BuddyAllocator;
+    std::unique_ptr<RegionAllocator> m_pAllocator;
 };
 
 } // namespace Diligent
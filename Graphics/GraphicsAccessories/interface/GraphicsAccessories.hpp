@@ -412,6 +412,10 @@ const Char* GetShaderStatusString(SHADER_STATUS ShaderStatus, bool GetEnumString
 /// GetEnumString is true, or "Uninitialized" when GetEnumString is false).
 const Char* GetPipelineStateStatusString(PIPELINE_STATE_STATUS PipelineStatus, bool GetEnumString = false);
 
+/// Returns the string containing the state creation stage (e.g. "STATE_CREATION_STAGE_SHADER_COMPILATION" when
+/// GetEnumString is true, or "Shader compilation" when GetEnumString is false).
+const Char* GetStateCreationStageString(STATE_CREATION_STAGE Stage, bool GetEnumString = false);
+
 
 /// Helper template function that converts object description into a string
 template <typename TObjectDescType>
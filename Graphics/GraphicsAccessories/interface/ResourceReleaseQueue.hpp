@@ -35,6 +35,7 @@
 
 #include <mutex>
 #include <deque>
+#include <vector>
 #include <atomic>
 
 #include "../../../Primitives/interface/MemoryAllocator.h"
@@ -227,8 +228,9 @@ class ResourceReleaseQueue
 public:
     // clang-format off
     ResourceReleaseQueue(IMemoryAllocator& Allocator) :
-        m_ReleaseQueue  (STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>")),
-        m_StaleResources(STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>"))
+        m_ReleaseQueue           (STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>")),
+        m_CompletedResourcesCache(STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for vector<ReleaseQueueElemType>")),
+        m_StaleResources         (STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>"))
     {}
     // clang-format on
 
@@ -357,17 +359,41 @@ public:
     /// \param [in] CompletedFenceValue  -  Value of the fence that has been completed by the GPU
     void Purge(Uint64 CompletedFenceValue)
     {
-        std::lock_guard<std::mutex> LockGuard(m_ReleaseQueueMutex);
+        // Completed objects are destroyed after the mutex is released. Destructors may be
+        // expensive or acquire other locks (e.g. to return memory to a shared manager), and
+        // must not block threads that release resources from deferred contexts meanwhile.
+        // The array that holds them is reused between the calls, so that purging does not
+        // allocate memory once it has grown large enough.
+        std::vector<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> CompletedResources{m_ReleaseQueue.get_allocator()};
+        {
+            std::lock_guard<std::mutex> LockGuard(m_ReleaseQueueMutex);
+
+            // Release all objects whose associated fence value is at most CompletedFenceValue
+            // See http://diligentgraphics.com/diligent-engine/architecture/d3d12/managing-resource-lifetimes/
+            if (m_ReleaseQueue.empty() || m_ReleaseQueue.front().first > CompletedFenceValue)
+                return;
+
+            // A destructor that purges the queue recursively will find the cache empty and use its own array
+            CompletedResources.swap(m_CompletedResourcesCache);
+            while (!m_ReleaseQueue.empty())
+            {
+                ReleaseQueueElemType& FirstObj = m_ReleaseQueue.front();
+                if (FirstObj.first <= CompletedFenceValue)
+                {
+                    CompletedResources.emplace_back(std::move(FirstObj));
+                    m_ReleaseQueue.pop_front();
+                }
+                else
+                    break;
+            }
+        }
+
+        CompletedResources.clear();
 
-        // Release all objects whose associated fence value is at most CompletedFenceValue
-        // See http://diligentgraphics.com/diligent-engine/architecture/d3d12/managing-resource-lifetimes/
-        while (!m_ReleaseQueue.empty())
         {
-            ReleaseQueueElemType& FirstObj = m_ReleaseQueue.front();
-            if (FirstObj.first <= CompletedFenceValue)
-                m_ReleaseQueue.pop_front();
-            else
-                break;
+            std::lock_guard<std::mutex> LockGuard(m_ReleaseQueueMutex);
+            if (CompletedResources.capacity() > m_CompletedResourcesCache.capacity())
+                m_CompletedResourcesCache.swap(CompletedResources);
         }
     }
 
@@ -387,6 +413,8 @@ private:
     std::mutex m_ReleaseQueueMutex;
     using ReleaseQueueElemType = std::pair<Uint64, ResourceWrapperType>;
     std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_ReleaseQueue;
+    // Storage for the resources being destroyed by Purge(), protected by m_ReleaseQueueMutex
+    std::vector<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_CompletedResourcesCache;
 
     std::mutex                                                                 m_StaleObjectsMutex;
     std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_StaleResources;
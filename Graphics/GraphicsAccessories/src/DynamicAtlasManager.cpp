@@ -28,8 +28,11 @@
 #include "DynamicAtlasManager.hpp"
 
 #include <climits>
+#include <algorithm>
+#include <vector>
 
 #include "AdvancedMath.hpp"
+#include "Align.hpp"
 
 namespace Diligent
 {
@@ -110,19 +113,736 @@ void DynamicAtlasManager::Node::MergeChildren()
 }
 
 
-DynamicAtlasManager::DynamicAtlasManager(Uint32 Width, Uint32 Height) :
+// Base class for the shelf and buddy strategies.
+class DynamicAtlasManager::RegionAllocator
+{
+public:
+    virtual ~RegionAllocator() {}
+
+    virtual Region Allocate(Uint32 Width, Uint32 Height) = 0;
+    virtual bool   Free(const Region& R)                 = 0;
+
+    virtual Uint32 GetFreeRegionCount() const       = 0;
+    virtual Uint64 GetTotalFreeArea() const         = 0;
+    virtual Uint64 GetLargestFreeRegionArea() const = 0;
+
+    Uint32 GetAllocatedRegionCount() const { return static_cast<Uint32>(m_AllocatedRegions.GetSize()); }
+    Uint64 GetAllocatedArea() const { return m_AllocatedArea; }
+
+protected:
+    // Neither strategy can tell a region returned by Allocate() from a region that
+    // merely looks valid (e.g. spans two allocations), so allocations are tracked exactly.
+    bool IsAllocated(const Region& R) const
+    {
+        return m_AllocatedRegions.Contains(R);
+    }
+
+    void OnAllocate(const Region& R)
+    {
+        const bool Inserted = m_AllocatedRegions.Insert(R);
+        VERIFY(Inserted, "Region [", R.x, ", ", R.x + R.width, ") x [", R.y, ", ", R.y + R.height, ") is already allocated");
+        (void)Inserted;
+        m_AllocatedArea += Uint64{R.width} * Uint64{R.height};
+    }
+    void OnFree(const Region& R)
+    {
+        const bool Erased = m_AllocatedRegions.Erase(R);
+        VERIFY_EXPR(Erased && m_AllocatedArea >= Uint64{R.width} * Uint64{R.height});
+        (void)Erased;
+        m_AllocatedArea -= Uint64{R.width} * Uint64{R.height};
+    }
+
+private:
+    // Open-addressing hash set with linear probing. The table never shrinks, so once it
+    // has grown to the peak number of allocations, insertion and removal do not allocate.
+    class RegionSet
+    {
+    public:
+        size_t GetSize() const { return m_Size; }
+
+        bool Contains(const Region& R) const
+        {
+            return !m_Slots.empty() && !m_Slots[FindSlot(R)].IsEmpty();
+        }
+
+        bool Insert(const Region& R)
+        {
+            VERIFY_EXPR(!R.IsEmpty());
+            // Keep the load factor at or below 1/2
+            if ((m_Size + 1) * 2 > m_Slots.size())
+                Grow();
+
+            Region& Slot = m_Slots[FindSlot(R)];
+            if (!Slot.IsEmpty())
+                return false;
+
+            Slot = R;
+            ++m_Size;
+            return true;
+        }
+
+        bool Erase(const Region& R)
+        {
+            if (m_Slots.empty())
+                return false;
+
+            size_t Hole = FindSlot(R);
+            if (m_Slots[Hole].IsEmpty())
+                return false;
+
+            // Shift back the entries that follow the erased one in the probe sequence,
+            // so that no tombstones are needed.
+            const size_t Mask = m_Slots.size() - 1;
+            for (size_t i = (Hole + 1) & Mask; !m_Slots[i].IsEmpty(); i = (i + 1) & Mask)
+            {
+                const size_t Home = Region::Hasher{}(m_Slots[i]) & Mask;
+                // The entry can be moved to the hole unless its home slot is cyclically in (Hole, i]
+                const bool CanMove = Hole <= i ?
+                    (Home <= Hole || Home > i) :
+                    (Home <= Hole && Home > i);
+                if (CanMove)
+                {
+                    m_Slots[Hole] = m_Slots[i];
+                    Hole          = i;
+                }
+            }
+            m_Slots[Hole] = Region{};
+            --m_Size;
+            return true;
+        }
+
+    private:
+        // Returns the slot that contains the region or the empty slot where it should be inserted
+        size_t FindSlot(const Region& R) const
+        {
+            const size_t Mask = m_Slots.size() - 1;
+            size_t       i    = Region::Hasher{}(R) & Mask;
+            while (!m_Slots[i].IsEmpty() && m_Slots[i] != R)
+                i = (i + 1) & Mask;
+            return i;
+        }
+
+        void Grow()
+        {
+            std::vector<Region> OldSlots{std::move(m_Slots)};
+            m_Slots.clear();
+            m_Slots.resize(std::max(OldSlots.size() * 2, size_t{64}));
+            for (const Region& R : OldSlots)
+            {
+                if (!R.IsEmpty())
+                    m_Slots[FindSlot(R)] = R;
+            }
+        }
+
+        // Empty regions mark free slots. The size is a power of two.
+        std::vector<Region> m_Slots;
+        size_t              m_Size = 0;
+    };
+    RegionSet m_AllocatedRegions;
+
+    Uint64 m_AllocatedArea = 0;
+};
+
+
+//   _______________________________
+//  |                               |
+//  |          Free space           | <- m_Top
+//  |_______________________________|
+//  |    |    |    |                |
+//  | R  | R  | R  |   Free span    | <- Shelf 2
+//  |____|____|____|________________|
+//  |      |      |       |         |
+//  |  R   | Free |   R   |  Free   | <- Shelf 1
+//  |______|______|_______|_________|
+//  |   |   |   |   |   |   |   |   |
+//  | R | R | R | R | R | R | R | R | <- Shelf 0
+//  |___|___|___|___|___|___|___|___|
+//
+// Shelves tile the atlas from the bottom up to m_Top without gaps. Every shelf keeps
+// a singly-linked list of free spans sorted by x. Span nodes are allocated from a pool.
+class DynamicAtlasManager::ShelfAllocator final : public DynamicAtlasManager::RegionAllocator
+{
+public:
+    ShelfAllocator(Uint32 Width, Uint32 Height) :
+        m_Width{Width},
+        m_Height{Height}
+    {}
+
+    ~ShelfAllocator()
+    {
+        DEV_CHECK_ERR(m_Shelves.empty(), "There must be no allocated regions");
+    }
+
+    virtual Region Allocate(Uint32 Width, Uint32 Height) override final
+    {
+        if (Width == 0 || Height == 0 || Width > m_Width || Height > m_Height)
+            return Region{};
+
+        // Find the shelf that fits the region with the smallest vertical waste.
+        // Empty shelves can be split and thus have no waste.
+        size_t BestShelf = InvalidShelf;
+        Uint32 BestWaste = UINT_MAX;
+        for (size_t i = 0; i < m_Shelves.size(); ++i)
+        {
+            const Shelf& S = m_Shelves[i];
+            if (S.Height < Height)
+                continue;
+
+            const Uint32 Waste = S.NumAllocations == 0 ? 0 : S.Height - Height;
+            if (Waste >= BestWaste)
+                continue;
+
+            if (FindSpan(S, Width) == InvalidSpan)
+                continue;
+
+            BestShelf = i;
+            BestWaste = Waste;
+            if (Waste == 0)
+                break;
+        }
+
+        // Start a new shelf if there is no suitable one or if the best one is too tall.
+        if ((BestShelf == InvalidShelf || BestWaste > Height / 2) && m_Height - m_Top >= Height)
+        {
+            BestShelf = m_Shelves.size();
+            m_Shelves.emplace_back(Shelf{m_Top, Height, AllocateSpan(0, m_Width, InvalidSpan)});
+            m_Top += Height;
+            m_FreeSpanArea += Uint64{m_Width} * Uint64{Height};
+        }
+
+        if (BestShelf == InvalidShelf)
+            return Region{};
+
+        if (m_Shelves[BestShelf].NumAllocations == 0 && m_Shelves[BestShelf].Height > Height)
+        {
+            // Split the empty shelf
+            Shelf& S = m_Shelves[BestShelf];
+            VERIFY_EXPR(m_Spans[S.FirstSpan].x == 0 && m_Spans[S.FirstSpan].Width == m_Width);
+            const Shelf Upper{S.y + Height, S.Height - Height, AllocateSpan(0, m_Width, InvalidSpan)};
+            S.Height = Height;
+            m_Shelves.emplace(m_Shelves.begin() + BestShelf + 1, Upper);
+        }
+
+        Shelf& S = m_Shelves[BestShelf];
+
+        Uint32       PrevSpan = InvalidSpan;
+        const Uint32 SpanIdx  = FindSpan(S, Width, &PrevSpan);
+        VERIFY_EXPR(SpanIdx != InvalidSpan);
+
+        Span&        FreeSpan = m_Spans[SpanIdx];
+        const Region R{FreeSpan.x, S.y, Width, Height};
+
+        FreeSpan.x += Width;
+        FreeSpan.Width -= Width;
+        if (FreeSpan.Width == 0)
+        {
+            (PrevSpan != InvalidSpan ? m_Spans[PrevSpan].Next : S.FirstSpan) = FreeSpan.Next;
+            ReleaseSpan(SpanIdx);
+        }
+
+        ++S.NumAllocations;
+        VERIFY_EXPR(m_FreeSpanArea >= Uint64{Width} * Uint64{S.Height});
+        m_FreeSpanArea -= Uint64{Width} * Uint64{S.Height};
+        OnAllocate(R);
+
+        return R;
+    }
+
+    virtual bool Free(const Region& R) override final
+    {
+        if (!IsAllocated(R))
+            return false;
+
+        auto it = std::upper_bound(m_Shelves.begin(), m_Shelves.end(), R.y,
+                                   [](Uint32 y, const Shelf& S) { return y < S.y; });
+        if (it == m_Shelves.begin() || std::prev(it)->y != R.y || std::prev(it)->Height < R.height || std::prev(it)->NumAllocations == 0)
+            return false;
+
+        size_t ShelfIdx = static_cast<size_t>(std::prev(it) - m_Shelves.begin());
+        Shelf& S        = m_Shelves[ShelfIdx];
+
+        // Find the spans that surround the region
+        Uint32 PrevSpan = InvalidSpan;
+        Uint32 NextSpan = S.FirstSpan;
+        while (NextSpan != InvalidSpan && m_Spans[NextSpan].x < R.x)
+        {
+            PrevSpan = NextSpan;
+            NextSpan = m_Spans[NextSpan].Next;
+        }
+
+        if ((PrevSpan != InvalidSpan && m_Spans[PrevSpan].x + m_Spans[PrevSpan].Width > R.x) ||
+            (NextSpan != InvalidSpan && m_Spans[NextSpan].x < R.x + R.width))
+        {
+            // The region overlaps a free span
+            return false;
+        }
+
+        const bool MergeWithPrev = PrevSpan != InvalidSpan && m_Spans[PrevSpan].x + m_Spans[PrevSpan].Width == R.x;
+        const bool MergeWithNext = NextSpan != InvalidSpan && R.x + R.width == m_Spans[NextSpan].x;
+        if (MergeWithPrev && MergeWithNext)
+        {
+            m_Spans[PrevSpan].Width += R.width + m_Spans[NextSpan].Width;
+            m_Spans[PrevSpan].Next = m_Spans[NextSpan].Next;
+            ReleaseSpan(NextSpan);
+        }
+        else if (MergeWithPrev)
+        {
+            m_Spans[PrevSpan].Width += R.width;
+        }
+        else if (MergeWithNext)
+        {
+            m_Spans[NextSpan].x = R.x;
+            m_Spans[NextSpan].Width += R.width;
+        }
+        else
+        {
+            (PrevSpan != InvalidSpan ? m_Spans[PrevSpan].Next : S.FirstSpan) = AllocateSpan(R.x, R.width, NextSpan);
+        }
+
+        m_FreeSpanArea += Uint64{R.width} * Uint64{S.Height};
+        --S.NumAllocations;
+        OnFree(R);
+
+        if (S.NumAllocations == 0)
+        {
+            VERIFY_EXPR(S.FirstSpan != InvalidSpan && m_Spans[S.FirstSpan].x == 0 && m_Spans[S.FirstSpan].Width == m_Width);
+            // Merge empty neighbors
+            if (ShelfIdx + 1 < m_Shelves.size() && m_Shelves[ShelfIdx + 1].NumAllocations == 0)
+            {
+                MergeShelfWithNext(ShelfIdx);
+            }
+            if (ShelfIdx > 0 && m_Shelves[ShelfIdx - 1].NumAllocations == 0)
+            {
+                --ShelfIdx;
+                MergeShelfWithNext(ShelfIdx);
+            }
+            if (ShelfIdx + 1 == m_Shelves.size())
+            {
+                // Return the top shelf to the free space
+                const Shelf& Top = m_Shelves.back();
+                VERIFY_EXPR(m_Top == Top.y + Top.Height);
+                m_Top = Top.y;
+                m_FreeSpanArea -= Uint64{m_Width} * Uint64{Top.Height};
+                ReleaseSpan(Top.FirstSpan);
+                m_Shelves.pop_back();
+            }
+        }
+
+#if DILIGENT_DEBUG
+        DbgVerifyConsistency();
+#endif
+
+        return true;
+    }
+
+    virtual Uint32 GetFreeRegionCount() const override final
+    {
+        return m_NumFreeSpans + (m_Top < m_Height ? 1 : 0);
+    }
+
+    virtual Uint64 GetTotalFreeArea() const override final
+    {
+        return m_FreeSpanArea + Uint64{m_Width} * Uint64{m_Height - m_Top};
+    }
+
+    virtual Uint64 GetLargestFreeRegionArea() const override final
+    {
+        Uint64 LargestArea = Uint64{m_Width} * Uint64{m_Height - m_Top};
+        for (const Shelf& S : m_Shelves)
+        {
+            for (Uint32 SpanIdx = S.FirstSpan; SpanIdx != InvalidSpan; SpanIdx = m_Spans[SpanIdx].Next)
+                LargestArea = std::max(LargestArea, Uint64{m_Spans[SpanIdx].Width} * Uint64{S.Height});
+        }
+        return LargestArea;
+    }
+
+private:
+    static constexpr Uint32 InvalidSpan  = ~0u;
+    static constexpr size_t InvalidShelf = ~size_t{0};
+
+    struct Span
+    {
+        Uint32 x     = 0;
+        Uint32 Width = 0;
+        Uint32 Next  = InvalidSpan;
+    };
+
+    struct Shelf
+    {
+        Uint32 y              = 0;
+        Uint32 Height         = 0;
+        Uint32 FirstSpan      = InvalidSpan;
+        Uint32 NumAllocations = 0;
+    };
+
+    Uint32 AllocateSpan(Uint32 x, Uint32 Width, Uint32 Next)
+    {
+        Uint32 SpanIdx = m_FirstFreeSpan;
+        if (SpanIdx != InvalidSpan)
+        {
+            m_FirstFreeSpan = m_Spans[SpanIdx].Next;
+        }
+        else
+        {
+            SpanIdx = static_cast<Uint32>(m_Spans.size());
+            m_Spans.emplace_back();
+        }
+        m_Spans[SpanIdx] = Span{x, Width, Next};
+        ++m_NumFreeSpans;
+        return SpanIdx;
+    }
+
+    void ReleaseSpan(Uint32 SpanIdx)
+    {
+        VERIFY_EXPR(m_NumFreeSpans > 0);
+        m_Spans[SpanIdx].Next = m_FirstFreeSpan;
+        m_FirstFreeSpan       = SpanIdx;
+        --m_NumFreeSpans;
+    }
+
+    Uint32 FindSpan(const Shelf& S, Uint32 Width, Uint32* pPrevSpan = nullptr) const
+    {
+        Uint32 PrevSpan = InvalidSpan;
+        for (Uint32 SpanIdx = S.FirstSpan; SpanIdx != InvalidSpan; SpanIdx = m_Spans[SpanIdx].Next)
+        {
+            if (m_Spans[SpanIdx].Width >= Width)
+            {
+                if (pPrevSpan != nullptr)
+                    *pPrevSpan = PrevSpan;
+                return SpanIdx;
+            }
+            PrevSpan = SpanIdx;
+        }
+        return InvalidSpan;
+    }
+
+    // Merges two adjacent empty shelves
+    void MergeShelfWithNext(size_t ShelfIdx)
+    {
+        Shelf&       S    = m_Shelves[ShelfIdx];
+        const Shelf& Next = m_Shelves[ShelfIdx + 1];
+        VERIFY_EXPR(S.NumAllocations == 0 && Next.NumAllocations == 0 && S.y + S.Height == Next.y);
+        S.Height += Next.Height;
+        ReleaseSpan(Next.FirstSpan);
+        m_Shelves.erase(m_Shelves.begin() + ShelfIdx + 1);
+    }
+
+#if DILIGENT_DEBUG
+    void DbgVerifyConsistency() const
+    {
+        Uint32 y        = 0;
+        Uint32 NumSpans = 0;
+        Uint64 FreeArea = 0;
+        for (const Shelf& S : m_Shelves)
+        {
+            VERIFY(S.y == y, "Shelves must tile the atlas without gaps");
+            y += S.Height;
+
+            Uint32 x = 0;
+            for (Uint32 SpanIdx = S.FirstSpan; SpanIdx != InvalidSpan; SpanIdx = m_Spans[SpanIdx].Next)
+            {
+                const Span& FreeSpan = m_Spans[SpanIdx];
+                VERIFY(FreeSpan.Width > 0, "Free span must not be empty");
+                VERIFY(FreeSpan.x >= x && (x == 0 || FreeSpan.x > x), "Free spans must be sorted and must not overlap or touch");
+                x = FreeSpan.x + FreeSpan.Width;
+                VERIFY(x <= m_Width, "Free span exceeds atlas width");
+                FreeArea += Uint64{FreeSpan.Width} * Uint64{S.Height};
+                ++NumSpans;
+            }
+        }
+        VERIFY(y == m_Top, "Shelves must end at the top");
+        VERIFY_EXPR(NumSpans == m_NumFreeSpans);
+        VERIFY_EXPR(FreeArea == m_FreeSpanArea);
+    }
+#endif
+
+    const Uint32 m_Width;
+    const Uint32 m_Height;
+
+    // Shelves sorted by y
+    std::vector<Shelf> m_Shelves;
+    // Bottom of the unused space above the last shelf
+    Uint32 m_Top = 0;
+
+    // Span pool
+    std::vector<Span> m_Spans;
+    Uint32            m_FirstFreeSpan = InvalidSpan;
+
+    Uint32 m_NumFreeSpans = 0;
+    Uint64 m_FreeSpanArea = 0;
+};
+
+
+// Buddy quadtree allocator.
+// Level 0 contains blocks of m_MinBlockSize x m_MinBlockSize size, every next level
+// doubles the block size. The top level block size is min(Width, Height), so that
+// top level blocks tile the atlas. Every level keeps a bitmap of free blocks and a
+// summary bitmap that has one bit per 64-bit word of the free block bitmap, so
+// that finding a free block takes at most a couple of scans over short arrays.
+class DynamicAtlasManager::BuddyAllocator final : public DynamicAtlasManager::RegionAllocator
+{
+public:
+    BuddyAllocator(Uint32 Width, Uint32 Height, Uint32 MinBlockSize) :
+        m_Width{Width},
+        m_Height{Height},
+        m_MinBlockSize{std::min(std::max(MinBlockSize, 1u), std::min(Width, Height))}
+    {
+        DEV_CHECK_ERR(IsPowerOfTwo(Width) && IsPowerOfTwo(Height), "Atlas dimensions (", Width, " x ", Height, ") must be powers of two when buddy allocation strategy is used");
+        DEV_CHECK_ERR(IsPowerOfTwo(MinBlockSize), "Minimum block size (", MinBlockSize, ") must be a power of two");
+
+        const Uint32 TopBlockSize = std::min(Width, Height);
+        for (Uint32 BlockSize = m_MinBlockSize; BlockSize <= TopBlockSize; BlockSize *= 2)
+        {
+            Level L;
+            L.BlockSize  = BlockSize;
+            L.GridWidth  = Width / BlockSize;
+            L.GridHeight = Height / BlockSize;
+
+            const size_t NumBlocks = size_t{L.GridWidth} * size_t{L.GridHeight};
+            L.FreeBits.resize((NumBlocks + 63) / 64);
+            L.Summary.resize((L.FreeBits.size() + 63) / 64);
+            m_Levels.emplace_back(std::move(L));
+        }
+
+        Level& Top = m_Levels.back();
+        for (Uint32 i = 0; i < Top.GridWidth * Top.GridHeight; ++i)
+            SetFree(Top, i);
+    }
+
+    ~BuddyAllocator()
+    {
+        DEV_CHECK_ERR(GetAllocatedRegionCount() == 0, "There must be no allocated regions");
+    }
+
+    virtual Region Allocate(Uint32 Width, Uint32 Height) override final
+    {
+        if (Width == 0 || Height == 0)
+            return Region{};
+
+        const Uint32 BlockSize = std::max(AlignUpToPowerOfTwo(std::max(Width, Height)), m_MinBlockSize);
+        if (BlockSize > m_Levels.back().BlockSize)
+            return Region{};
+
+        const Uint32 TargetLevel = PlatformMisc::GetMSB(BlockSize / m_MinBlockSize);
+        VERIFY_EXPR(m_Levels[TargetLevel].BlockSize == BlockSize);
+
+        Uint32 LevelIdx = TargetLevel;
+        while (LevelIdx < m_Levels.size() && m_Levels[LevelIdx].NumFree == 0)
+            ++LevelIdx;
+        if (LevelIdx == m_Levels.size())
+            return Region{};
+
+        Uint32 BlockIdx = FindFree(m_Levels[LevelIdx]);
+        VERIFY_EXPR(BlockIdx != InvalidBlock);
+        ClearFree(m_Levels[LevelIdx], BlockIdx);
+
+        // Split the block until we reach the target level
+        while (LevelIdx > TargetLevel)
+        {
+            const Uint32 bx = BlockIdx % m_Levels[LevelIdx].GridWidth;
+            const Uint32 by = BlockIdx / m_Levels[LevelIdx].GridWidth;
+
+            --LevelIdx;
+            Level& Child = m_Levels[LevelIdx];
+            BlockIdx     = (by * 2) * Child.GridWidth + bx * 2;
+            SetFree(Child, BlockIdx + 1);
+            SetFree(Child, BlockIdx + Child.GridWidth);
+            SetFree(Child, BlockIdx + Child.GridWidth + 1);
+        }
+
+        const Level& L = m_Levels[TargetLevel];
+        const Region R{(BlockIdx % L.GridWidth) * BlockSize, (BlockIdx / L.GridWidth) * BlockSize, Width, Height};
+        OnAllocate(R);
+
+        return R;
+    }
+
+    virtual bool Free(const Region& R) override final
+    {
+        if (!IsAllocated(R))
+            return false;
+
+        const Uint32 BlockSize = std::max(AlignUpToPowerOfTwo(std::max(R.width, R.height)), m_MinBlockSize);
+        if (BlockSize > m_Levels.back().BlockSize || (R.x % BlockSize) != 0 || (R.y % BlockSize) != 0 ||
+            R.x + BlockSize > m_Width || R.y + BlockSize > m_Height)
+            return false;
+
+        Uint32 LevelIdx = PlatformMisc::GetMSB(BlockSize / m_MinBlockSize);
+        Uint32 bx       = R.x / BlockSize;
+        Uint32 by       = R.y / BlockSize;
+        if (IsFree(m_Levels[LevelIdx], by * m_Levels[LevelIdx].GridWidth + bx))
+            return false;
+
+        // Merge free buddies
+        while (LevelIdx + 1 < m_Levels.size())
+        {
+            Level&       L          = m_Levels[LevelIdx];
+            const Uint32 FirstBuddy = (by & ~1u) * L.GridWidth + (bx & ~1u);
+            const Uint32 BlockIdx   = by * L.GridWidth + bx;
+
+            const Uint32 Buddies[] = {FirstBuddy, FirstBuddy + 1, FirstBuddy + L.GridWidth, FirstBuddy + L.GridWidth + 1};
+
+            bool AllBuddiesFree = true;
+            for (Uint32 Buddy : Buddies)
+            {
+                if (Buddy != BlockIdx && !IsFree(L, Buddy))
+                {
+                    AllBuddiesFree = false;
+                    break;
+                }
+            }
+            if (!AllBuddiesFree)
+                break;
+
+            for (Uint32 Buddy : Buddies)
+            {
+                if (Buddy != BlockIdx)
+                    ClearFree(L, Buddy);
+            }
+
+            ++LevelIdx;
+            bx /= 2;
+            by /= 2;
+        }
+        SetFree(m_Levels[LevelIdx], by * m_Levels[LevelIdx].GridWidth + bx);
+
+        OnFree(R);
+
+        return true;
+    }
+
+    virtual Uint32 GetFreeRegionCount() const override final
+    {
+        Uint32 Count = 0;
+        for (const Level& L : m_Levels)
+            Count += L.NumFree;
+        return Count;
+    }
+
+    virtual Uint64 GetTotalFreeArea() const override final
+    {
+        return m_FreeArea;
+    }
+
+    virtual Uint64 GetLargestFreeRegionArea() const override final
+    {
+        for (size_t i = m_Levels.size(); i > 0; --i)
+        {
+            const Level& L = m_Levels[i - 1];
+            if (L.NumFree > 0)
+                return Uint64{L.BlockSize} * Uint64{L.BlockSize};
+        }
+        return 0;
+    }
+
+private:
+    static constexpr Uint32 InvalidBlock = ~0u;
+
+    struct Level
+    {
+        Uint32 BlockSize  = 0;
+        Uint32 GridWidth  = 0;
+        Uint32 GridHeight = 0;
+        Uint32 NumFree    = 0;
+
+        // One bit per block
+        std::vector<Uint64> FreeBits;
+        // One bit per non-zero FreeBits word
+        std::vector<Uint64> Summary;
+    };
+
+    static bool IsFree(const Level& L, Uint32 BlockIdx)
+    {
+        return (L.FreeBits[BlockIdx / 64] & (Uint64{1} << (BlockIdx % 64))) != 0;
+    }
+
+    void SetFree(Level& L, Uint32 BlockIdx)
+    {
+        VERIFY_EXPR(!IsFree(L, BlockIdx));
+        const Uint32 Word = BlockIdx / 64;
+        L.FreeBits[Word] |= Uint64{1} << (BlockIdx % 64);
+        L.Summary[Word / 64] |= Uint64{1} << (Word % 64);
+        ++L.NumFree;
+        m_FreeArea += Uint64{L.BlockSize} * Uint64{L.BlockSize};
+    }
+
+    void ClearFree(Level& L, Uint32 BlockIdx)
+    {
+        VERIFY_EXPR(IsFree(L, BlockIdx));
+        const Uint32 Word = BlockIdx / 64;
+        L.FreeBits[Word] &= ~(Uint64{1} << (BlockIdx % 64));
+        if (L.FreeBits[Word] == 0)
+            L.Summary[Word / 64] &= ~(Uint64{1} << (Word % 64));
+        VERIFY_EXPR(L.NumFree > 0);
+        --L.NumFree;
+        m_FreeArea -= Uint64{L.BlockSize} * Uint64{L.BlockSize};
+    }
+
+    static Uint32 FindFree(const Level& L)
+    {
+        for (size_t i = 0; i < L.Summary.size(); ++i)
+        {
+            if (L.Summary[i] != 0)
+            {
+                const Uint32 Word = static_cast<Uint32>(i * 64 + PlatformMisc::GetLSB(L.Summary[i]));
+                VERIFY_EXPR(L.FreeBits[Word] != 0);
+                return Word * 64 + PlatformMisc::GetLSB(L.FreeBits[Word]);
+            }
+        }
+        return InvalidBlock;
+    }
+
+    const Uint32 m_Width;
+    const Uint32 m_Height;
+    const Uint32 m_MinBlockSize;
+
+    std::vector<Level> m_Levels;
+
+    Uint64 m_FreeArea = 0;
+};
+
+
+DynamicAtlasManager::DynamicAtlasManager(Uint32              Width,
+                                         Uint32              Height,
+                                         ALLOCATION_STRATEGY Strategy,
+                                         Uint32              MinBlockSize) :
     m_Width{Width},
     m_Height{Height},
+    m_Strategy{Strategy},
     m_TotalFreeArea{Uint64{Width} * Uint64{Height}}
 {
-    m_Root->R = Region{0, 0, Width, Height};
-    RegisterNode(*m_Root);
+    switch (m_Strategy)
+    {
+        case ALLOCATION_STRATEGY_TREE:
+            m_Root->R = Region{0, 0, Width, Height};
+            RegisterNode(*m_Root);
+            break;
+
+        case ALLOCATION_STRATEGY_SHELF:
+            m_Root.reset();
+            m_pAllocator = std::make_unique<ShelfAllocator>(Width, Height);
+            break;
+
+        case ALLOCATION_STRATEGY_BUDDY:
+            m_Root.reset();
+            m_pAllocator = std::make_unique<BuddyAllocator>(Width, Height, MinBlockSize);
+            break;
+
+        default:
+            UNEXPECTED("Unknown allocation strategy");
+    }
 }
 
+DynamicAtlasManager::DynamicAtlasManager(DynamicAtlasManager&&) = default;
 
 DynamicAtlasManager::~DynamicAtlasManager()
 {
-    if (m_Root)
+    if (m_pAllocator)
+    {
+        VERIFY_EXPR(!m_Root);
+        DEV_CHECK_ERR(m_pAllocator->GetAllocatedRegionCount() == 0, "There must be no allocated regions");
+    }
+    else if (m_Root)
     {
 #if DILIGENT_DEBUG
         DbgVerifyConsistency();
@@ -141,6 +861,60 @@ DynamicAtlasManager::~DynamicAtlasManager()
     }
 }
 
+Uint32 DynamicAtlasManager::GetFreeRegionCount() const
+{
+    if (m_pAllocator)
+        return m_pAllocator->GetFreeRegionCount();
+
+    VERIFY_EXPR(m_FreeRegionsByWidth.size() == m_FreeRegionsByHeight.size());
+    return static_cast<Uint32>(m_FreeRegionsByWidth.size());
+}
+
+Uint64 DynamicAtlasManager::GetTotalFreeArea() const
+{
+    return m_pAllocator ? m_pAllocator->GetTotalFreeArea() : m_TotalFreeArea;
+}
+
+bool DynamicAtlasManager::IsEmpty() const
+{
+    if (m_pAllocator)
+        return m_pAllocator->GetAllocatedRegionCount() == 0;
+
+    VERIFY_EXPR(m_AllocatedRegions.empty() && (m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height}) ||
+                !m_AllocatedRegions.empty() && (m_TotalFreeArea < Uint64{m_Width} * Uint64{m_Height}));
+    return m_AllocatedRegions.empty();
+}
+
+DynamicAtlasManager::FragmentationStats DynamicAtlasManager::GetFragmentationStats() const
+{
+    FragmentationStats Stats;
+
+    Uint64 AllocatedArea = 0;
+    if (m_pAllocator)
+    {
+        Stats.AllocatedRegionCount  = m_pAllocator->GetAllocatedRegionCount();
+        Stats.LargestFreeRegionArea = m_pAllocator->GetLargestFreeRegionArea();
+        AllocatedArea               = m_pAllocator->GetAllocatedArea();
+    }
+    else
+    {
+        Stats.AllocatedRegionCount = static_cast<Uint32>(m_AllocatedRegions.size());
+        for (const auto& it : m_FreeRegionsByWidth)
+            Stats.LargestFreeRegionArea = std::max(Stats.LargestFreeRegionArea, Uint64{it.first.width} * Uint64{it.first.height});
+        AllocatedArea = Uint64{m_Width} * Uint64{m_Height} - m_TotalFreeArea;
+    }
+    Stats.FreeRegionCount = GetFreeRegionCount();
+    Stats.TotalFreeArea   = GetTotalFreeArea();
+
+    VERIFY_EXPR(Stats.TotalFreeArea + AllocatedArea <= Uint64{m_Width} * Uint64{m_Height});
+    Stats.WastedArea = Uint64{m_Width} * Uint64{m_Height} - Stats.TotalFreeArea - AllocatedArea;
+
+    if (Stats.TotalFreeArea > 0)
+        Stats.ExternalFragmentation = 1.f - static_cast<float>(static_cast<double>(Stats.LargestFreeRegionArea) / static_cast<double>(Stats.TotalFreeArea));
+
+    return Stats;
+}
+
 void DynamicAtlasManager::RegisterNode(Node& N)
 {
     VERIFY(!N.HasChildren(), "Registering node that has children");
@@ -184,6 +958,9 @@ void DynamicAtlasManager::UnregisterNode(const Node& N)
 
 DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 Height)
 {
+    if (m_pAllocator)
+        return m_pAllocator->Allocate(Width, Height);
+
     auto it_w = m_FreeRegionsByWidth.lower_bound(Region{0, 0, Width, 0});
     while (it_w != m_FreeRegionsByWidth.end() && it_w->first.height < Height)
         ++it_w;
@@ -333,6 +1110,14 @@ void DynamicAtlasManager::Free(Region&& R)
     DbgVerifyRegion(R);
 #endif
 
+    if (m_pAllocator)
+    {
+        if (!m_pAllocator->Free(R))
+            UNEXPECTED("Region [", R.x, ", ", R.x + R.width, ") x [", R.y, ", ", R.y + R.height, ") is not a valid allocated region. Have you ever allocated it?");
+        R = InvalidRegion;
+        return;
+    }
+
     auto node_it = m_AllocatedRegions.find(R);
     if (node_it == m_AllocatedRegions.end())
     {
@@ -1574,7 +1574,7 @@ const char* GetDeviceFeatureStateString(DEVICE_FEATURE_STATE State, bool bGetFul
 
 const char* GetRenderDeviceTypeString(RENDER_DEVICE_TYPE DeviceType, bool bGetEnumString)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Did you add a new device type? Please update the switch below.");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Did you add a new device type? Please update the switch below.");
     switch (DeviceType)
     {
         // clang-format off
@@ -1586,6 +1586,7 @@ const char* GetRenderDeviceTypeString(RENDER_DEVICE_TYPE DeviceType, bool bGetEn
         case RENDER_DEVICE_TYPE_VULKAN:    return bGetEnumString ? "RENDER_DEVICE_TYPE_VULKAN"    : "Vulkan";     break;
         case RENDER_DEVICE_TYPE_METAL:     return bGetEnumString ? "RENDER_DEVICE_TYPE_METAL"     : "Metal";      break;
         case RENDER_DEVICE_TYPE_WEBGPU:    return bGetEnumString ? "RENDER_DEVICE_TYPE_WEBGPU"    : "WebGPU";     break;
+        case RENDER_DEVICE_TYPE_NULL:      return bGetEnumString ? "RENDER_DEVICE_TYPE_NULL"      : "Null";       break;
         // clang-format on
         default: UNEXPECTED("Unknown/unsupported device type"); return "UNKNOWN";
     }
@@ -1593,7 +1594,7 @@ const char* GetRenderDeviceTypeString(RENDER_DEVICE_TYPE DeviceType, bool bGetEn
 
 const char* GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE DeviceType, bool Capital)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Did you add a new device type? Please update the switch below.");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Did you add a new device type? Please update the switch below.");
     switch (DeviceType)
     {
         // clang-format off
@@ -1605,6 +1606,7 @@ const char* GetRenderDeviceTypeShortString(RENDER_DEVICE_TYPE DeviceType, bool C
         case RENDER_DEVICE_TYPE_VULKAN:    return Capital ? "VK"        : "vk";        break;
         case RENDER_DEVICE_TYPE_METAL:     return Capital ? "MTL"       : "mtl";       break;
         case RENDER_DEVICE_TYPE_WEBGPU:    return Capital ? "WGPU"      : "wgpu";      break;
+        case RENDER_DEVICE_TYPE_NULL:      return Capital ? "NULL"      : "null";      break;
         // clang-format on
         default: UNEXPECTED("Unknown/unsupported device type"); return "UNKNOWN";
     }
@@ -1895,7 +1897,7 @@ BIND_FLAGS SwapChainUsageFlagsToBindFlags(SWAP_CHAIN_USAGE_FLAGS SwapChainUsage)
 
 ARCHIVE_DEVICE_DATA_FLAGS RenderDeviceTypeToArchiveDataFlag(RENDER_DEVICE_TYPE DevType)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please update the switch below to handle the new device type");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Please update the switch below to handle the new device type");
     switch (DevType)
     {
         case RENDER_DEVICE_TYPE_D3D11:
@@ -1926,6 +1928,10 @@ ARCHIVE_DEVICE_DATA_FLAGS RenderDeviceTypeToArchiveDataFlag(RENDER_DEVICE_TYPE D
         case RENDER_DEVICE_TYPE_WEBGPU:
             return ARCHIVE_DEVICE_DATA_FLAG_WEBGPU;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            // Null device does not have device-specific archive data
+            return ARCHIVE_DEVICE_DATA_FLAG_NONE;
+
         default:
             UNEXPECTED("Unexpected device type");
             return ARCHIVE_DEVICE_DATA_FLAG_NONE;
@@ -2560,6 +2566,29 @@ const Char* GetPipelineStateStatusString(PIPELINE_STATE_STATUS PipelineStatus, b
     }
 }
 
+const Char* GetStateCreationStageString(STATE_CREATION_STAGE Stage, bool GetEnumString)
+{
+    static_assert(STATE_CREATION_STAGE_COUNT == 10, "Please update the switch below to handle the new state creation stage");
+    switch (Stage)
+    {
+        // clang-format off
+        case STATE_CREATION_STAGE_SHADER_PREPROCESSING:         return GetEnumString ? "STATE_CREATION_STAGE_SHADER_PREPROCESSING"         : "Shader preprocessing";
+        case STATE_CREATION_STAGE_SHADER_COMPILATION:           return GetEnumString ? "STATE_CREATION_STAGE_SHADER_COMPILATION"           : "Shader compilation";
+        case STATE_CREATION_STAGE_SPIRV_OPTIMIZATION:           return GetEnumString ? "STATE_CREATION_STAGE_SPIRV_OPTIMIZATION"           : "SPIRV optimization";
+        case STATE_CREATION_STAGE_SHADER_REFLECTION:            return GetEnumString ? "STATE_CREATION_STAGE_SHADER_REFLECTION"            : "Shader reflection";
+        case STATE_CREATION_STAGE_SHADER_PATCHING:              return GetEnumString ? "STATE_CREATION_STAGE_SHADER_PATCHING"              : "Shader patching";
+        case STATE_CREATION_STAGE_PIPELINE_CREATION:            return GetEnumString ? "STATE_CREATION_STAGE_PIPELINE_CREATION"            : "Pipeline creation";
+        case STATE_CREATION_STAGE_ARCHIVER_PIPELINE_CREATION:   return GetEnumString ? "STATE_CREATION_STAGE_ARCHIVER_PIPELINE_CREATION"   : "Archiver pipeline creation";
+        case STATE_CREATION_STAGE_ARCHIVE_SERIALIZATION:        return GetEnumString ? "STATE_CREATION_STAGE_ARCHIVE_SERIALIZATION"        : "Archive serialization";
+        case STATE_CREATION_STAGE_RENDER_STATE_CACHE_HIT:       return GetEnumString ? "STATE_CREATION_STAGE_RENDER_STATE_CACHE_HIT"       : "Render state cache hit";
+        case STATE_CREATION_STAGE_RENDER_STATE_CACHE_MISS:      return GetEnumString ? "STATE_CREATION_STAGE_RENDER_STATE_CACHE_MISS"      : "Render state cache miss";
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected state creation stage");
+            return "Unknown";
+    }
+}
+
 TEXTURE_FORMAT UnormFormatToSRGB(TEXTURE_FORMAT Fmt)
 {
     static_assert(TEX_FORMAT_NUM_FORMATS == 106, "Please update the switch below to handle the new texture format, if needed");
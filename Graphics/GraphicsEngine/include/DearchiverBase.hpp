@@ -33,6 +33,8 @@
 #include <vector>
 #include <unordered_map>
 #include <mutex>
+#include <shared_mutex>
+#include <array>
 
 #include "Dearchiver.h"
 #include "RenderDevice.h"
@@ -73,6 +75,13 @@ public:
     virtual void DILIGENT_CALL_TYPE UnpackPipelineState(const PipelineStateUnpackInfo& DeArchiveInfo,
                                                         IPipelineState**               ppPSO) override final;
 
+    /// Implementation of IDearchiver::UnpackPipelineStates().
+    virtual void DILIGENT_CALL_TYPE UnpackPipelineStates(const PipelineStateBatchUnpackInfo& UnpackInfo,
+                                                         IPipelineState**                    ppPSOs) override final;
+
+    /// Implementation of IDearchiver::Prefetch().
+    virtual Uint32 DILIGENT_CALL_TYPE Prefetch(const PipelineStatePrefetchInfo& PrefetchInfo) override final;
+
     /// Implementation of IDearchiver::UnpackResourceSignature().
     virtual void DILIGENT_CALL_TYPE UnpackResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo,
                                                             IPipelineResourceSignature**       ppSignature) override final;
@@ -99,6 +108,9 @@ protected:
     virtual RefCntAutoPtr<IPipelineResourceSignature> UnpackResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo,
                                                                               bool                               IsImplicit) = 0;
 
+    template <typename RenderDeviceImplType, typename PRSSerializerType>
+    RefCntAutoPtr<IPipelineResourceSignature> CreateResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo);
+
     virtual RefCntAutoPtr<IShader> UnpackShader(const ShaderCreateInfo& ShaderCI,
                                                 IRenderDevice*          pDevice);
 
@@ -109,6 +121,11 @@ protected:
     using TPRSNames            = DeviceObjectArchive::TPRSNames;
     using ResourceKey          = DeviceObjectArchive::NamedResourceKey;
 
+    /// Thread-safe cache of named resources.
+
+    /// Cache hits only take a shared lock, so that concurrent lookups do not serialize.
+    /// Creation of every resource is guarded by a per-name mutex, so that
+    /// concurrent requests for the same resource only create it once.
     template <typename ResType>
     class NamedResourceCache
     {
@@ -118,19 +135,44 @@ protected:
         // clang-format off
         NamedResourceCache           (const NamedResourceCache&) = delete;
         NamedResourceCache& operator=(const NamedResourceCache&) = delete;
-        NamedResourceCache           (NamedResourceCache&&)      = default;
-        NamedResourceCache& operator=(NamedResourceCache&&)      = default;
+        NamedResourceCache           (NamedResourceCache&&)      = delete;
+        NamedResourceCache& operator=(NamedResourceCache&&)      = delete;
         // clang-format on
 
-        bool Get(ResourceType Type, const char* Name, ResType** ppResource);
-        void Set(ResourceType Type, const char* Name, ResType* pResource);
+        /// Returns the resource from the cache, or null if the resource is not found.
+        RefCntAutoPtr<ResType> Get(ResourceType Type, const char* Name);
+
+        /// Returns the resource from the cache. If the resource is not found, creates it
+        /// using CreateResource and adds it to the cache.
+
+        /// If several threads request the same resource that is not in the cache,
+        /// one of them calls CreateResource while the others wait for it to finish.
+        /// If CreateResource returns null, the next waiting thread will try to create the resource.
+        template <typename CreateResourceType>
+        RefCntAutoPtr<ResType> GetOrCreate(ResourceType Type, const char* Name, CreateResourceType&& CreateResource) noexcept(false);
+
+        void Clear()
+        {
+            std::unique_lock<std::shared_mutex> Lock{m_Mtx};
+            m_Map.clear();
+        }
+
+    private:
+        struct Entry
+        {
+            // Serializes creation of the resource
+            std::mutex CreateMtx;
+
+            // Protected by the cache mutex
+            RefCntWeakPtr<ResType> wpResource;
+        };
 
-        void Clear() { m_Map.clear(); }
+        RefCntAutoPtr<ResType> Get(ResourceType Type, const char* Name, std::shared_ptr<Entry>* ppEntry);
 
     private:
-        std::mutex m_Mtx;
+        std::shared_mutex m_Mtx;
         // Keep weak resource references in the cache
-        std::unordered_map<ResourceKey, RefCntWeakPtr<ResType>, ResourceKey::Hasher> m_Map;
+        std::unordered_map<ResourceKey, std::shared_ptr<Entry>, ResourceKey::Hasher> m_Map;
     };
 
     struct ResourceCache
@@ -164,10 +206,20 @@ private:
 
     struct ShaderCacheData
     {
-        std::mutex Mtx;
+        std::shared_mutex Mtx;
 
         std::vector<RefCntAutoPtr<IShader>> Shaders;
 
+        // Serialize creation of the shaders that map to the same mutex, so that concurrent
+        // requests for the same shader that is not in the cache only create it once.
+        static constexpr size_t                  NumCreateMutexes = 32;
+        std::array<std::mutex, NumCreateMutexes> CreateMtx;
+
+        RefCntAutoPtr<IShader> Get(Uint32 Idx);
+        void                   Set(Uint32 Idx, IShader* pShader);
+
+        std::mutex& GetCreateMutex(Uint32 Idx) { return CreateMtx[Idx % NumCreateMutexes]; }
+
         ShaderCacheData() = default;
         ShaderCacheData(ShaderCacheData&& rhs) noexcept :
             Shaders{std::move(rhs.Shaders)}
@@ -208,11 +260,36 @@ private:
                           IRenderDevice*           pDevice);
 
     template <typename CreateInfoType>
-    void UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO);
+    bool LoadPSOCommonData(ArchiveData&             Archive,
+                           PSOData<CreateInfoType>& PSO,
+                           const char*              Name,
+                           IRenderDevice*           pDevice);
+
+    template <typename CreateInfoType>
+    void UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
+                                 PSO_CREATE_FLAGS               CreateFlags,
+                                 IPipelineState**               ppPSO);
+
+    template <typename CreateInfoType>
+    RefCntAutoPtr<IPipelineState> CreatePipelineState(const PipelineStateUnpackInfo& UnpackInfo,
+                                                      PSO_CREATE_FLAGS               CreateFlags);
+
+    RefCntAutoPtr<IRenderPass> CreateRenderPass(const RenderPassUnpackInfo& UnpackInfo);
+
+    void UnpackPipelineStateInternal(const PipelineStateUnpackInfo& UnpackInfo,
+                                     PSO_CREATE_FLAGS               CreateFlags,
+                                     IPipelineState**               ppPSO);
+
+    template <typename CreateInfoType>
+    bool PrefetchPSOShaders(const char* Name, IRenderDevice* pDevice);
 
     ArchiveData* FindArchive(ResourceType ResType, const char* ResName);
 
 private:
+    // Interned resource names referenced by m_ResNameToArchiveIdx. The table lives as long
+    // as the dearchiver, so the names of all archives ever loaded are kept until it is destroyed.
+    StringAtomTable m_ResNameAtoms{GetRawAllocator()};
+
     // Resource type and name -> archive index that contains this resource.
     // Names must be unique for each resource type.
     using NamedResourceKey = DeviceObjectArchive::NamedResourceKey;
@@ -227,16 +304,23 @@ RefCntAutoPtr<IPipelineResourceSignature> DearchiverBase::UnpackResourceSignatur
     const ResourceSignatureUnpackInfo& DeArchiveInfo,
     bool                               IsImplicit)
 {
-    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
     // Do not reuse implicit signatures
     if (!IsImplicit)
     {
         // Since signature names must be unique, we use a single cache for all
         // loaded archives.
-        if (m_Cache.Sign.Get(PRSData::ArchiveResType, DeArchiveInfo.Name, pSignature.RawDblPtr()))
-            return pSignature;
+        return m_Cache.Sign.GetOrCreate(PRSData::ArchiveResType, DeArchiveInfo.Name,
+                                        [&]() {
+                                            return CreateResourceSignature<RenderDeviceImplType, PRSSerializerType>(DeArchiveInfo);
+                                        });
     }
 
+    return CreateResourceSignature<RenderDeviceImplType, PRSSerializerType>(DeArchiveInfo);
+}
+
+template <typename RenderDeviceImplType, typename PRSSerializerType>
+RefCntAutoPtr<IPipelineResourceSignature> DearchiverBase::CreateResourceSignature(const ResourceSignatureUnpackInfo& DeArchiveInfo)
+{
     // Find the archive that contains this signature
     auto archive_idx_it = m_ResNameToArchiveIdx.find(NamedResourceKey{PRSData::ArchiveResType, DeArchiveInfo.Name});
     if (archive_idx_it == m_ResNameToArchiveIdx.end())
@@ -290,12 +374,80 @@ RefCntAutoPtr<IPipelineResourceSignature> DearchiverBase::UnpackResourceSignatur
     VERIFY_EXPR(Ser.IsEnded());
 
     RenderDeviceImplType* pRenderDevice = ClassPtrCast<RenderDeviceImplType>(DeArchiveInfo.pDevice);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
     pRenderDevice->CreatePipelineResourceSignature(PRS.Desc, InternalData, &pSignature);
+    return pSignature;
+}
 
-    if (!IsImplicit)
-        m_Cache.Sign.Set(PRSData::ArchiveResType, DeArchiveInfo.Name, pSignature.RawPtr());
+template <typename ResType>
+RefCntAutoPtr<ResType> DearchiverBase::NamedResourceCache<ResType>::Get(ResourceType Type, const char* Name, std::shared_ptr<Entry>* ppEntry)
+{
+    VERIFY_EXPR(Name != nullptr && Name[0] != '\0');
 
-    return pSignature;
+    RefCntWeakPtr<ResType> wpResource;
+    {
+        std::shared_lock<std::shared_mutex> Lock{m_Mtx};
+
+        auto it = m_Map.find(ResourceKey{Type, Name});
+        if (it == m_Map.end())
+            return {};
+
+        if (ppEntry != nullptr)
+            *ppEntry = it->second;
+        // Copy the weak pointer as RefCntWeakPtr::Lock() modifies the pointer
+        // when the object has been destroyed.
+        wpResource = it->second->wpResource;
+    }
+
+    return wpResource.Lock();
+}
+
+template <typename ResType>
+RefCntAutoPtr<ResType> DearchiverBase::NamedResourceCache<ResType>::Get(ResourceType Type, const char* Name)
+{
+    return Get(Type, Name, nullptr);
+}
+
+template <typename ResType>
+template <typename CreateResourceType>
+RefCntAutoPtr<ResType> DearchiverBase::NamedResourceCache<ResType>::GetOrCreate(ResourceType         Type,
+                                                                                const char*          Name,
+                                                                                CreateResourceType&& CreateResource) noexcept(false)
+{
+    std::shared_ptr<Entry> pEntry;
+    if (RefCntAutoPtr<ResType> pResource = Get(Type, Name, &pEntry))
+        return pResource;
+
+    if (!pEntry)
+    {
+        std::unique_lock<std::shared_mutex> Lock{m_Mtx};
+
+        auto it = m_Map.find(ResourceKey{Type, Name});
+        if (it == m_Map.end())
+            it = m_Map.emplace(ResourceKey{Type, Name, /*CopyName = */ true}, std::make_shared<Entry>()).first;
+        pEntry = it->second;
+    }
+
+    std::lock_guard<std::mutex> CreateGuard{pEntry->CreateMtx};
+
+    // The resource may have been created by another thread while we were waiting for the lock
+    {
+        std::shared_lock<std::shared_mutex> Lock{m_Mtx};
+        RefCntWeakPtr<ResType>              wpResource{pEntry->wpResource};
+        Lock.unlock();
+        if (RefCntAutoPtr<ResType> pResource = wpResource.Lock())
+            return pResource;
+    }
+
+    RefCntAutoPtr<ResType> pResource = CreateResource(); // May throw
+    if (pResource)
+    {
+        std::unique_lock<std::shared_mutex> Lock{m_Mtx};
+        pEntry->wpResource = pResource;
+    }
+
+    return pResource;
 }
 
 } // namespace Diligent
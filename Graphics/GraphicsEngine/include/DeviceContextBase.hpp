@@ -786,6 +786,12 @@ inline bool DeviceContextBase<ImplementationTraits>::SetPipelineState(
     DEV_CHECK_ERR(pPipelineState->GetStatus() == PIPELINE_STATE_STATUS_READY, "PSO '", pPipelineState->GetDesc().Name,
                   "' is not ready. Use GetStatus() to check the pipeline status.");
 
+    // Rebinding the same pipeline is common, and querying the implementation below touches the
+    // reference counter that is shared by all contexts using this pipeline. Detect this case
+    // without AddRef()/Release() so that contexts recording in parallel do not contend on it.
+    if (m_pPipelineState && static_cast<IPipelineState*>(m_pPipelineState.RawPtr()) == pPipelineState)
+        return false;
+
     // Note that pPipelineStateImpl may not be the same as pPipelineState (for example, if pPipelineState
     // is a reloadable pipeline).
     RefCntAutoPtr<PipelineStateImplType> pPipelineStateImpl{pPipelineState, IID_PSOImpl};
@@ -37,6 +37,7 @@
 #include "FileStream.h"
 
 #include "HashUtils.hpp"
+#include "StringAtomTable.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "DynamicLinearAllocator.hpp"
 #include "Serializer.hpp"
@@ -187,6 +188,11 @@ public:
             Name{_Name, CopyName}
         {}
 
+        NamedResourceKey(ResourceType _Type, const StringAtom& _Name) noexcept :
+            Type{_Type},
+            Name{_Name.GetKey()}
+        {}
+
         struct Hasher
         {
             size_t operator()(const NamedResourceKey& Key) const noexcept
@@ -243,7 +249,7 @@ public:
     void Merge(const DeviceObjectArchive& Src) noexcept(false);
 
     bool Deserialize(const CreateInfo& CI) noexcept;
-    void Serialize(IFileStream* pStream) const;
+    bool Serialize(IFileStream* pStream) const;
     void Serialize(IDataBlob** ppDataBlob) const;
 
     std::string ToString() const;
@@ -303,6 +309,9 @@ public:
     void Clear() noexcept;
 
 private:
+    template <SerializerMode Mode>
+    void SerializeImpl(Serializer<Mode>& Ser) const;
+
     // Named resources
     std::unordered_map<NamedResourceKey, ResourceData, NamedResourceKey::Hasher> m_NamedResources;
 
@@ -37,6 +37,7 @@
 #include <functional>
 #include <vector>
 #include <unordered_set>
+#include <mutex>
 
 #include "PrivateConstants.h"
 #include "PipelineResourceSignature.h"
@@ -49,6 +50,7 @@
 #include "SRBMemoryAllocator.hpp"
 #include "ShaderResourceCacheCommon.hpp"
 #include "HashUtils.hpp"
+#include "ResourceNameTable.hpp"
 
 #if defined(_MSC_VER) && defined(FindResource)
 #    error One of Windows headers leaks FindResource macro, which may result in odd errors. You need to undef the macro.
@@ -57,6 +59,9 @@
 namespace Diligent
 {
 
+template <typename EngineImplTraits>
+struct ShaderResourceBindingData;
+
 /// Validates pipeline resource signature description and throws an exception in case of an error.
 /// \note  pDevice can be null if PRS is used for serialization.
 void ValidatePipelineResourceSignatureDesc(const PipelineResourceSignatureDesc& Desc,
@@ -89,6 +94,20 @@ bool PipelineResourceSignaturesCompatible(const PipelineResourceSignatureDesc& D
 /// Calculates hash of the pipeline resource signature description.
 size_t CalculatePipelineResourceSignatureDescHash(const PipelineResourceSignatureDesc& Desc) noexcept;
 
+/// Returns true if an implicit signature created from the given description may be shared between
+/// pipeline states, i.e. the signature has no static resources that each pipeline binds independently.
+bool IsShareableImplicitSignatureDesc(const PipelineResourceSignatureDesc& Desc) noexcept;
+
+/// Calculates hash of the implicit pipeline resource signature description.
+/// Unlike CalculatePipelineResourceSignatureDescHash, the hash includes resource names and does not depend on the
+/// relative order of resources with different variable types, so that it matches the description of the created signature.
+size_t CalculateImplicitSignatureDescHash(const PipelineResourceSignatureDesc& Desc) noexcept;
+
+/// Returns true if the signature description SignDesc, where resources are sorted by variable type,
+/// was created from the description Desc.
+bool ImplicitSignatureDescMatches(const PipelineResourceSignatureDesc& SignDesc,
+                                  const PipelineResourceSignatureDesc& Desc) noexcept;
+
 
 /// Reserves space for pipeline resource signature description in the Allocator
 void ReserveSpaceForPipelineResourceSignatureDesc(FixedLinearAllocator&                Allocator,
@@ -346,6 +365,9 @@ public:
     // Pipeline resource signature implementation type (PipelineResourceSignatureD3D12Impl, PipelineResourceSignatureVkImpl, etc.)
     using PipelineResourceSignatureImplType = typename EngineImplTraits::PipelineResourceSignatureImplType;
 
+    // Shader resource cache and variable managers of an SRB (see ShaderResourceBindingBase).
+    using SRBDataType = ShaderResourceBindingData<EngineImplTraits>;
+
     // Pipeline resource attribs type (PipelineResourceAttribsD3D12, PipelineResourceAttribsVk, etc.)
     using PipelineResourceAttribsType = typename EngineImplTraits::PipelineResourceAttribsType;
 
@@ -539,6 +561,96 @@ public:
         pResBindingImpl->QueryInterface(IID_ShaderResourceBinding, reinterpret_cast<IObject**>(ppShaderResourceBinding));
     }
 
+    /// Called by the SRB destructor. If the method returns true, the signature has taken over
+    /// the SRB data and will pass it on to a new SRB. Otherwise, the data must be destroyed.
+    ///
+    /// The pool holds at most m_Desc.SRBRecyclePoolSize data objects.
+    bool RecycleSRBData(SRBDataType* pData, bool StaticResourcesInitialized)
+    {
+        VERIFY_EXPR(pData != nullptr);
+
+        if (this->m_Desc.SRBRecyclePoolSize == 0)
+            return false;
+
+        // Static resources copied into the SRB cache can't be reset through the variables.
+        if (StaticResourcesInitialized && m_StaticResShaderStages != SHADER_TYPE_UNKNOWN)
+            return false;
+
+        {
+            std::lock_guard<std::mutex> Guard{m_SRBRecyclePoolMtx};
+            if (m_SRBRecyclePool.size() + m_NumPendingRecycledSRBs >= this->m_Desc.SRBRecyclePoolSize)
+                return false;
+            ++m_NumPendingRecycledSRBs;
+        }
+
+        // Release all resources right away rather than keeping them alive in the pool.
+        pData->ResetVariables();
+
+        // Backends that need to wait for the GPU before the data can be reused
+        // (see PipelineResourceSignatureVkImpl) define their own EnqueueRecycledSRBData().
+        static_cast<PipelineResourceSignatureImplType*>(this)->EnqueueRecycledSRBData(pData);
+        return true;
+    }
+
+    /// Takes the data of a destroyed SRB from the recycle pool.
+    /// Returns null if the pool is empty.
+    SRBDataType* TakeRecycledSRBData()
+    {
+        std::lock_guard<std::mutex> Guard{m_SRBRecyclePoolMtx};
+        if (m_SRBRecyclePool.empty())
+            return nullptr;
+
+        SRBDataType* pData = m_SRBRecyclePool.back();
+        m_SRBRecyclePool.pop_back();
+        return pData;
+    }
+
+    /// Adds the SRB data to the recycle pool.
+    /// The slot in the pool must have been reserved by RecycleSRBData().
+    void AddSRBDataToRecyclePool(SRBDataType* pData)
+    {
+        std::lock_guard<std::mutex> Guard{m_SRBRecyclePoolMtx};
+        VERIFY_EXPR(m_NumPendingRecycledSRBs > 0);
+        --m_NumPendingRecycledSRBs;
+        m_SRBRecyclePool.push_back(pData);
+    }
+
+    /// Adds the SRB data to the recycle pool of the signature when destroyed.
+    /// Backends use it with the device release queues to defer the reuse of the data
+    /// until the GPU has finished executing the commands that reference it.
+    class DeferredSRBDataRecycler
+    {
+    public:
+        DeferredSRBDataRecycler(PipelineResourceSignatureImplType* pSignature, SRBDataType* pData) noexcept :
+            m_pSignature{pSignature},
+            m_pData{pData}
+        {}
+
+        // clang-format off
+        DeferredSRBDataRecycler           (const DeferredSRBDataRecycler&)  = delete;
+        DeferredSRBDataRecycler& operator=(const DeferredSRBDataRecycler&)  = delete;
+        DeferredSRBDataRecycler& operator=(      DeferredSRBDataRecycler&&) = delete;
+        // clang-format on
+
+        DeferredSRBDataRecycler(DeferredSRBDataRecycler&& Other) noexcept :
+            m_pSignature{std::move(Other.m_pSignature)},
+            m_pData{Other.m_pData}
+        {
+            Other.m_pData = nullptr;
+        }
+
+        ~DeferredSRBDataRecycler()
+        {
+            // Releasing the reference to the signature may destroy it along with the pool
+            if (m_pSignature)
+                m_pSignature->AddSRBDataToRecyclePool(m_pData);
+        }
+
+    private:
+        RefCntAutoPtr<PipelineResourceSignatureImplType> m_pSignature;
+        SRBDataType*                                     m_pData;
+    };
+
     /// Implementation of IPipelineResourceSignature::InitializeStaticSRBResources.
     virtual void DILIGENT_CALL_TYPE InitializeStaticSRBResources(IShaderResourceBinding* pSRB) const override final
     {
@@ -677,11 +789,16 @@ public:
 
     /// Finds a resource with the given name in the specified shader stage and returns its
     /// index in m_Desc.Resources[], or InvalidPipelineResourceIndex if the resource is not found.
-    Uint32 FindResource(SHADER_TYPE ShaderStage, const char* ResourceName) const
+    Uint32 FindResource(SHADER_TYPE ShaderStage, const HashMapStringKey& ResourceName) const
     {
-        return Diligent::FindResource(this->m_Desc.Resources, this->m_Desc.NumResources, ShaderStage, ResourceName);
+        static_assert(ResourceNameTable::InvalidIndex == InvalidPipelineResourceIndex, "Invalid index mismatch");
+        VERIFY_EXPR(ResourceName.GetStr() != nullptr && ResourceName.GetStr()[0] != '\0');
+        return m_ResourceNames.Find(ResourceName, ShaderStage);
     }
 
+    /// Returns the table that maps resource names to indices in m_Desc.Resources[].
+    const ResourceNameTable& GetResourceNameTable() const { return m_ResourceNames; }
+
     /// Finds an immutable with the given name in the specified shader stage and returns its
     /// index in m_Desc.ImmutableSamplers[], or InvalidImmutableSamplerIndex if the sampler is not found.
     Uint32 FindImmutableSampler(SHADER_TYPE ShaderStage, const char* ResourceName) const
@@ -824,6 +941,7 @@ protected:
         m_pRawMemory = decltype(m_pRawMemory){Allocator.ReleaseOwnership(), STDDeleterRawMem<void>{RawAllocator}};
 
         CopyPipelineResourceSignatureDesc(Allocator, Desc, this->m_Desc, m_ResourceOffsets);
+        m_ResourceNames.Initialize(this->m_Desc.Resources, this->m_Desc.NumResources);
 
 #ifdef DILIGENT_DEBUG
         VERIFY_EXPR(m_ResourceOffsets[SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES] == this->m_Desc.NumResources);
@@ -971,10 +1089,23 @@ protected:
     }
 
 protected:
+    // Default implementation that makes the SRB data immediately available for reuse.
+    void EnqueueRecycledSRBData(SRBDataType* pData)
+    {
+        AddSRBDataToRecyclePool(pData);
+    }
+
     void Destruct()
     {
         VERIFY(!m_IsDestructed, "This object has already been destructed");
 
+        // Deferred recyclers hold a reference to the signature, so there may be none at this point.
+        VERIFY(m_NumPendingRecycledSRBs == 0, "There is SRB data pending recycling. This is a bug.");
+        // Pooled data uses the signature's memory allocators, so destroy it first.
+        for (SRBDataType* pData : m_SRBRecyclePool)
+            pData->Destroy(*static_cast<PipelineResourceSignatureImplType*>(this));
+        m_SRBRecyclePool.clear();
+
         this->m_Desc.Resources             = nullptr;
         this->m_Desc.ImmutableSamplers     = nullptr;
         this->m_Desc.CombinedSamplerSuffix = nullptr;
@@ -1013,6 +1144,7 @@ protected:
                 m_pImmutableSamplers[i].~RefCntAutoPtr<SamplerImplType>();
         }
 
+        m_ResourceNames.Clear();
         m_pRawMemory.reset();
 
 #if DILIGENT_DEBUG
@@ -1081,6 +1213,9 @@ protected:
 
     size_t m_Hash = 0;
 
+    // Maps resource names to indices in m_Desc.Resources[].
+    ResourceNameTable m_ResourceNames;
+
     // Resource offsets (e.g. index of the first resource), for each variable type.
     std::array<Uint16, SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES + 1> m_ResourceOffsets = {};
 
@@ -1100,6 +1235,12 @@ protected:
     // Allocator for shader resource binding object instances.
     SRBMemoryAllocator m_SRBMemAllocator;
 
+    // Data of destroyed SRBs that is reused by new SRBs.
+    std::mutex                m_SRBRecyclePoolMtx;
+    std::vector<SRBDataType*> m_SRBRecyclePool;
+    // The number of data objects that have reserved a slot in the pool, but have not been added to it yet.
+    size_t m_NumPendingRecycledSRBs = 0;
+
 #ifdef DILIGENT_DEBUG
     bool m_IsDestructed = false;
 #endif
@@ -48,6 +48,8 @@
 #include "RefCntAutoPtr.hpp"
 #include "AsyncInitializer.hpp"
 #include "GraphicsTypesX.hpp"
+#include "StageTimings.hpp"
+#include "ResourceNameTable.hpp"
 
 namespace Diligent
 {
@@ -131,6 +133,16 @@ ShaderResourceVariableDesc FindPipelineResourceLayoutVariable(
     SHADER_TYPE                       ShaderStage,
     const char*                       CombinedSamplerSuffix);
 
+/// Same as FindPipelineResourceLayoutVariable(LayoutDesc, Name, ShaderStage, CombinedSamplerSuffix), but
+/// uses the table of variable names built once for LayoutDesc.Variables. This should be used when
+/// looking up many resources in the same layout.
+ShaderResourceVariableDesc FindPipelineResourceLayoutVariable(
+    const PipelineResourceLayoutDesc& LayoutDesc,
+    const ResourceNameTable&          LayoutVarNames,
+    const char*                       Name,
+    SHADER_TYPE                       ShaderStage,
+    const char*                       CombinedSamplerSuffix);
+
 
 /// Hash map key that identifies shader resource by its name and shader stages
 struct ShaderResourceHashKey : public HashMapStringKey
@@ -907,6 +919,7 @@ protected:
 #endif
                     try
                     {
+                        ScopedStageTimer Timer{STATE_CREATION_STAGE_PIPELINE_CREATION};
                         pThisImpl->InitializePipeline(CreateInfo);
                         pThisImpl->m_Status.store(PIPELINE_STATE_STATUS_READY);
                     }
@@ -923,6 +936,7 @@ protected:
         {
             try
             {
+                ScopedStageTimer Timer{STATE_CREATION_STAGE_PIPELINE_CREATION};
                 pThisImpl->InitializePipeline(CreateInfo);
                 m_Status.store(PIPELINE_STATE_STATUS_READY);
             }
@@ -1112,13 +1126,15 @@ protected:
                                                       Uint32                                     SignCount)
     {
         VERIFY_EXPR(Name != nullptr && Name[0] != '\0');
+        // Hash the name once for all signatures
+        const HashMapStringKey NameKey{Name};
         for (Uint32 sign = 0; sign < SignCount; ++sign)
         {
             const PipelineResourceSignatureImplType* const pSignature = pSignatures[sign];
             if (pSignature == nullptr)
                 continue;
 
-            const Uint32 ResIndex = pSignature->FindResource(Stage, Name);
+            const Uint32 ResIndex = pSignature->FindResource(Stage, NameKey);
             if (ResIndex != ResourceAttribution::InvalidResourceIndex)
                 return ResourceAttribution{pSignature, sign, ResIndex};
             else
@@ -1137,21 +1153,44 @@ protected:
         return GetResourceAttribution(Name, Stage, pThis->m_Signatures, pThis->m_SignatureCount);
     }
 
-    template <typename... ExtraArgsType>
+    /// Initializes the implicit resource signature. Signatures without static resources are
+    /// retrieved from the device registry, so that identical signatures are shared between pipelines.
     void InitDefaultSignature(const PipelineResourceSignatureDesc& SignDesc,
-                              const ExtraArgsType&... ExtraArgs)
+                              SHADER_TYPE                          ShaderStages,
+                              bool                                 bIsDeviceInternal)
     {
         VERIFY_EXPR(m_SignatureCount == 1 && m_UsingImplicitSignature);
 
-        RefCntAutoPtr<PipelineResourceSignatureImplType> pImplicitSignature;
-        this->GetDevice()->CreatePipelineResourceSignature(SignDesc, pImplicitSignature.template DblPtr<IPipelineResourceSignature>(), ExtraArgs...);
+        RenderDeviceImplType* const pDevice = this->GetDevice();
+
+        const auto CreateSignature = [&]() {
+            RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+            pDevice->CreatePipelineResourceSignature(SignDesc, &pSignature, ShaderStages, bIsDeviceInternal);
+            return pSignature;
+        };
+
+        RefCntAutoPtr<IPipelineResourceSignature> pImplicitSignature;
+        if (IsShareableImplicitSignatureDesc(SignDesc))
+        {
+            const ImplicitSignatureKey Key{CalculateImplicitSignatureDescHash(SignDesc), ShaderStages, bIsDeviceInternal};
+            pImplicitSignature = pDevice->GetImplicitSignatureRegistry().Get(Key, CreateSignature);
+            if (pImplicitSignature && !ImplicitSignatureDescMatches(pImplicitSignature->GetDesc(), SignDesc))
+            {
+                // Hash collision - use a separate signature
+                pImplicitSignature = CreateSignature();
+            }
+        }
+        else
+        {
+            pImplicitSignature = CreateSignature();
+        }
 
         if (!pImplicitSignature)
             LOG_ERROR_AND_THROW("Failed to create implicit resource signature for pipeline state '", this->m_Desc.Name, "'.");
 
         VERIFY_EXPR(pImplicitSignature->GetDesc().BindingIndex == 0);
         VERIFY(!m_Signatures[0], "Signature 0 has already been initialized.");
-        m_Signatures[0] = std::move(pImplicitSignature);
+        m_Signatures[0] = ClassPtrCast<PipelineResourceSignatureImplType>(pImplicitSignature.RawPtr());
     }
 
     static PSO_CREATE_INTERNAL_FLAGS GetInternalCreateFlags(const PipelineStateCreateInfo& CreateInfo)
@@ -35,6 +35,9 @@
 #include <vector>
 #include <unordered_set>
 #include <mutex>
+#include <array>
+#include <algorithm>
+#include <string>
 
 #include "RenderDevice.h"
 #include "DeviceObjectBase.hpp"
@@ -52,6 +55,8 @@
 #include "IndexWrapper.hpp"
 #include "ThreadPool.hpp"
 #include "SpinLock.hpp"
+#include "StageTimings.hpp"
+#include "DataBlobImpl.hpp"
 
 namespace Diligent
 {
@@ -84,6 +89,32 @@ COMPONENT_TYPE CheckSparseTextureFormatSupport(TEXTURE_FORMAT                  T
                                                RESOURCE_DIMENSION              Dimension,
                                                Uint32                          SampleCount,
                                                const SparseResourceProperties& SparseRes) noexcept;
+
+/// Key of the implicit pipeline resource signature registry.
+
+/// The key only identifies the signature by the hash of its description, so the
+/// description of the signature retrieved from the registry must be compared with
+/// the requested one to resolve hash collisions.
+struct ImplicitSignatureKey
+{
+    size_t      DescHash         = 0;
+    SHADER_TYPE ShaderStages     = SHADER_TYPE_UNKNOWN;
+    bool        IsDeviceInternal = false;
+
+    bool operator==(const ImplicitSignatureKey& Rhs) const noexcept
+    {
+        return DescHash == Rhs.DescHash && ShaderStages == Rhs.ShaderStages && IsDeviceInternal == Rhs.IsDeviceInternal;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const ImplicitSignatureKey& Key) const noexcept
+        {
+            return ComputeHash(Key.DescHash, Uint32{Key.ShaderStages}, Key.IsDeviceInternal);
+        }
+    };
+};
+
 /// Base implementation of a render device
 
 /// \tparam EngineImplTraits - Engine implementation type traits.
@@ -242,14 +273,15 @@ public:
         pResourceMapping->QueryInterface(IID_ResourceMapping, reinterpret_cast<IObject**>(ppMapping));
         if (ResMappingCI.pEntries != nullptr)
         {
+#ifdef DILIGENT_DEVELOPMENT
             for (Uint32 i = 0; i < ResMappingCI.NumEntries; ++i)
             {
                 const ResourceMappingEntry& Entry = ResMappingCI.pEntries[i];
-                if (Entry.Name != nullptr && Entry.pObject != nullptr)
-                    (*ppMapping)->AddResourceArray(Entry.Name, Entry.ArrayIndex, &Entry.pObject, 1, true);
-                else
+                if (Entry.Name == nullptr || Entry.pObject == nullptr)
                     DEV_ERROR("Name and pObject must not be null. Note that starting with API253010, the number of entries is defined through the NumEntries member.");
             }
+#endif
+            pResourceMapping->AddResources(ResMappingCI.pEntries, ResMappingCI.NumEntries, true);
         }
     }
 
@@ -358,6 +390,87 @@ public:
         return m_pShaderCompilationThreadPool;
     }
 
+    using ImplicitSignatureRegistryType = ObjectsRegistry<ImplicitSignatureKey, RefCntAutoPtr<IPipelineResourceSignature>, ImplicitSignatureKey::Hasher>;
+
+    /// Returns the registry of implicit pipeline resource signatures that are shared between pipeline states.
+    ImplicitSignatureRegistryType& GetImplicitSignatureRegistry()
+    {
+        return m_ImplicitSignatureRegistry;
+    }
+
+    /// Implementation of IRenderDevice::EnableStateCreationTimings().
+    virtual void DILIGENT_CALL_TYPE EnableStateCreationTimings(Bool Enable, Bool RecordTrace) override final
+    {
+        StageTimings::Get().Enable(Enable, RecordTrace);
+    }
+
+    /// Implementation of IRenderDevice::GetStateCreationStageStats().
+    virtual void DILIGENT_CALL_TYPE GetStateCreationStageStats(STATE_CREATION_STAGE Stage, StateCreationStageStats& Stats) const override final
+    {
+        static_assert(STATE_CREATION_STAGE_COUNT <= StageTimings::MaxStages, "Too many state creation stages");
+        static_assert(STATE_CREATION_STAGE_HISTOGRAM_SIZE == StageTimings::NumHistogramBins, "Histogram size mismatch");
+
+        Stats = {};
+        if (Stage >= STATE_CREATION_STAGE_COUNT)
+        {
+            DEV_ERROR("Invalid state creation stage (", Uint32{Stage}, ")");
+            return;
+        }
+
+        const StageTimings::StageStats SrcStats = StageTimings::Get().GetStats(Stage);
+
+        Stats.Count     = SrcStats.Count;
+        Stats.TotalTime = static_cast<double>(SrcStats.TotalNs) * 1e-9;
+        Stats.MinTime   = static_cast<double>(SrcStats.MinNs) * 1e-9;
+        Stats.MaxTime   = static_cast<double>(SrcStats.MaxNs) * 1e-9;
+        for (Uint32 i = 0; i < STATE_CREATION_STAGE_HISTOGRAM_SIZE; ++i)
+            Stats.Histogram[i] = SrcStats.Histogram[i];
+    }
+
+    /// Implementation of IRenderDevice::WriteStateCreationTrace().
+    virtual void DILIGENT_CALL_TYPE WriteStateCreationTrace(IDataBlob** ppTrace) const override final
+    {
+        DEV_CHECK_ERR(ppTrace != nullptr, "ppTrace must not be null");
+        DEV_CHECK_ERR(*ppTrace == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+        std::array<const char*, STATE_CREATION_STAGE_COUNT> StageNames{};
+        for (Uint32 i = 0; i < STATE_CREATION_STAGE_COUNT; ++i)
+            StageNames[i] = GetStateCreationStageString(static_cast<STATE_CREATION_STAGE>(i));
+
+        const std::string Trace = StageTimings::Get().GetChromeTrace(StageNames.data(), STATE_CREATION_STAGE_COUNT);
+
+        RefCntAutoPtr<DataBlobImpl> pTrace = DataBlobImpl::Create(Trace.size(), Trace.data());
+        *ppTrace                           = pTrace.Detach();
+    }
+
+    /// Implementation of IRenderDevice::ResetStateCreationTimings().
+    virtual void DILIGENT_CALL_TYPE ResetStateCreationTimings() override final
+    {
+        StageTimings::Get().Reset();
+    }
+
+    /// Implementation of IRenderDevice::GetStateCreationTimestamp().
+    virtual Uint64 DILIGENT_CALL_TYPE GetStateCreationTimestamp() const override final
+    {
+        const StageTimings& Timings = StageTimings::Get();
+        // Zero is reserved for disabled timings
+        return Timings.IsEnabled() ? std::max(Timings.GetTimestamp(), Uint64{1}) : 0;
+    }
+
+    /// Implementation of IRenderDevice::RecordStateCreationStage().
+    virtual void DILIGENT_CALL_TYPE RecordStateCreationStage(STATE_CREATION_STAGE Stage, Uint64 StartTime, Uint64 EndTime) override final
+    {
+        if (Stage >= STATE_CREATION_STAGE_COUNT)
+        {
+            DEV_ERROR("Invalid state creation stage (", Uint32{Stage}, ")");
+            return;
+        }
+        if (StartTime == 0 || EndTime == 0)
+            return;
+
+        StageTimings::Get().Record(Stage, StartTime, EndTime);
+    }
+
     Uint32 AllocateDynamicBufferId()
     {
         Threading::SpinLockGuard Guard{m_RecycledDynamicBufferIdsLock};
@@ -688,7 +801,8 @@ protected:
     // All state object registries hold raw pointers.
     // This is safe because every object unregisters itself
     // when it is deleted.
-    ObjectsRegistry<SamplerDesc, RefCntAutoPtr<ISampler>>                       m_SamplersRegistry; ///< Sampler state registry
+    ObjectsRegistry<SamplerDesc, RefCntAutoPtr<ISampler>>                       m_SamplersRegistry;          ///< Sampler state registry
+    ImplicitSignatureRegistryType                                               m_ImplicitSignatureRegistry; ///< Implicit resource signature registry
     std::vector<TextureFormatInfoExt, STDAllocatorRawMem<TextureFormatInfoExt>> m_TextureFormatsInfo;
     std::vector<bool, STDAllocatorRawMem<bool>>                                 m_TexFmtInfoInitFlags;
 
@@ -30,7 +30,9 @@
 /// \file
 /// Declaration of the Diligent::ResourceMappingImpl class
 
-#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "ResourceMapping.h"
 #include "ObjectBase.hpp"
@@ -44,21 +46,30 @@ namespace Diligent
 class FixedBlockMemoryAllocator;
 
 /// Implementation of the resource mapping
+
+/// Resources are kept in immutable snapshots sorted by the name hash and the array index.
+/// Readers hold a reference to the snapshot that was current when they started and do not
+/// wait while writers build a new one. Taking the reference is a short critical section:
+/// std::atomic_load() of a shared_ptr may be implemented with a lock.
+/// Writers are serialized, build a modified copy of the current snapshot in a single pass
+/// and publish it with an atomic store, so every modification costs O(N) in the number of
+/// resources. Use AddResources() to add many resources with a single copy.
+/// A replaced snapshot is released as soon as the last reader that references it is done.
 class ResourceMappingImpl : public ObjectBase<IResourceMapping>
 {
 public:
     typedef ObjectBase<IResourceMapping> TObjectBase;
 
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0x6c1ba3f2, 0x8e47, 0x4d0b, {0xa1, 0x5e, 0x92, 0x3c, 0x07, 0xd4, 0x6b, 0x18}};
+
     /// \param pRefCounters - reference counters object that controls the lifetime of this resource mapping
-    /// \param RawMemAllocator - raw memory allocator that is used by the m_HashTable member
-    ResourceMappingImpl(IReferenceCounters* pRefCounters, IMemoryAllocator& RawMemAllocator) :
-        TObjectBase{pRefCounters},
-        m_HashTable{STD_ALLOCATOR_RAW_MEM(HashTableElem, RawMemAllocator, "Allocator for unordered_map<ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>")}
-    {}
+    /// \param RawMemAllocator - raw memory allocator that is used to allocate the resource snapshots
+    ResourceMappingImpl(IReferenceCounters* pRefCounters, IMemoryAllocator& RawMemAllocator);
 
     ~ResourceMappingImpl();
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ResourceMapping, TObjectBase)
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_ResourceMapping, IID_InternalImpl, TObjectBase)
 
     /// Implementation of IResourceMapping::AddResource()
     virtual void DILIGENT_CALL_TYPE AddResource(const Char*    Name,
@@ -72,6 +83,11 @@ public:
                                                      Uint32                NumElements,
                                                      bool                  bIsUnique) override final;
 
+    /// Implementation of IResourceMapping::AddResources()
+    virtual void DILIGENT_CALL_TYPE AddResources(const ResourceMappingEntry* pEntries,
+                                                 Uint32                      NumEntries,
+                                                 bool                        bIsUnique) override final;
+
     /// Implementation of IResourceMapping::RemoveResourceByName()
     virtual void DILIGENT_CALL_TYPE RemoveResourceByName(const Char* Name, Uint32 ArrayIndex) override final;
 
@@ -83,54 +99,113 @@ public:
     virtual size_t DILIGENT_CALL_TYPE GetSize() override final;
 
 private:
-    struct ResMappingHashKey : public HashMapStringKey
+    // Elements of an array share the name. The name is released together with the last
+    // entry that references it.
+    using NamePtr = std::shared_ptr<const String>;
+
+    struct ResourceEntry
     {
-        using TBase = HashMapStringKey;
+        size_t                       NameHash   = 0;
+        Uint32                       ArrayIndex = 0;
+        NamePtr                      Name;
+        RefCntAutoPtr<IDeviceObject> pObject;
 
-        ResMappingHashKey(const Char* Str, bool bMakeCopy, Uint32 ArrInd) noexcept :
-            HashMapStringKey{Str, bMakeCopy},
-            ArrayIndex{ArrInd}
+        bool operator<(const ResourceEntry& RHS) const noexcept
         {
-            Ownership_Hash = (ComputeHash(GetHash(), ArrInd) & HashMask) | (Ownership_Hash & StrOwnershipMask);
+            return NameHash != RHS.NameHash ? NameHash < RHS.NameHash : ArrayIndex < RHS.ArrayIndex;
         }
+    };
+
+    using EntryArrayType = std::vector<ResourceEntry, STDAllocatorRawMem<ResourceEntry>>;
 
-        ResMappingHashKey(ResMappingHashKey&& rhs) noexcept :
-            HashMapStringKey{std::move(rhs)},
-            ArrayIndex{rhs.ArrayIndex}
+    struct Snapshot
+    {
+        explicit Snapshot(IMemoryAllocator& RawMemAllocator) :
+            Entries{STD_ALLOCATOR_RAW_MEM(ResourceEntry, RawMemAllocator, "Allocator for vector<ResourceEntry>")}
         {}
 
+        EntryArrayType Entries;
+    };
+    // Must only be accessed with std::atomic_load() and std::atomic_store()
+    using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
+    // Returns the first entry in [Begin, End) with the given name and array index, or End.
+    static const ResourceEntry* FindEntry(const ResourceEntry* Begin,
+                                          const ResourceEntry* End,
+                                          size_t               NameHash,
+                                          const Char*          Name,
+                                          Uint32               ArrayIndex) noexcept;
+
+public:
+    /// Pins the current snapshot of the mapping. Modifications made after the
+    /// reader has been created are not visible to it.
+    class SnapshotReader
+    {
+    public:
+        explicit SnapshotReader(const ResourceMappingImpl& Mapping) noexcept;
+
         // clang-format off
-        ResMappingHashKey             ( const ResMappingHashKey& ) = delete;
-        ResMappingHashKey& operator = ( const ResMappingHashKey& ) = delete;
-        ResMappingHashKey& operator = ( ResMappingHashKey&& )      = delete;
+        SnapshotReader           (const SnapshotReader&) = delete;
+        SnapshotReader           (SnapshotReader&&)      = delete;
+        SnapshotReader& operator=(const SnapshotReader&) = delete;
+        SnapshotReader& operator=(SnapshotReader&&)      = delete;
         // clang-format on
 
-        bool operator==(const ResMappingHashKey& RHS) const noexcept
+        IDeviceObject* GetResource(const HashMapStringKey& Name, Uint32 ArrayIndex) const noexcept;
+
+        size_t GetSize() const noexcept { return m_pSnapshot->Entries.size(); }
+
+        /// Looks up resources in the order of their name hashes. Every lookup only searches
+        /// the part of the snapshot that follows the previous one, so resolving many
+        /// names sorted by hash takes a single pass over the snapshot.
+        class SortedLookup
         {
-            if (ArrayIndex != RHS.ArrayIndex)
-            {
-                // We must check array index first because TBase::operator==()
-                // expects that if the hashes are different, the strings must be
-                // different too. This will not be the case for different array
-                // elements of the same variable.
-                return false;
-            }
-
-            return static_cast<const TBase&>(*this) == static_cast<const TBase&>(RHS);
-        }
+        public:
+            explicit SortedLookup(const SnapshotReader& Reader) noexcept :
+                m_pCurr{Reader.m_pSnapshot->Entries.data()},
+                m_pEnd{Reader.m_pSnapshot->Entries.data() + Reader.m_pSnapshot->Entries.size()}
+            {}
+
+            /// Name hashes must be non-decreasing between calls.
+            IDeviceObject* GetResource(size_t NameHash, const Char* Name, Uint32 ArrayIndex) noexcept;
+
+        private:
+            const ResourceEntry*       m_pCurr;
+            const ResourceEntry* const m_pEnd;
+#ifdef DILIGENT_DEBUG
+            size_t m_DbgLastHash = 0;
+#endif
+        };
+
+    private:
+        const SnapshotPtr m_pSnapshot;
+    };
 
-        const Uint32 ArrayIndex;
+private:
+    // Calls Modifier(CurrEntries, NewEntries) that fills NewEntries with the modified copy of
+    // CurrEntries and returns false if there are no changes.
+    template <typename ModifierType>
+    void Modify(ModifierType&& Modifier);
+
+    struct NewEntry
+    {
+        size_t         NameHash   = 0;
+        Uint32         ArrayIndex = 0;
+        const Char*    Name       = nullptr;
+        IDeviceObject* pObject    = nullptr;
     };
+    using NewEntryArrayType = std::vector<NewEntry, STDAllocatorRawMem<NewEntry>>;
+
+    // Merges the new entries into the current snapshot. If several entries have the same
+    // name and array index, the last one wins.
+    void AddEntries(NewEntryArrayType& NewEntries, bool bIsUnique);
+
+    IMemoryAllocator& m_RawMemAllocator;
 
-    Threading::SpinLock m_Lock;
+    SnapshotPtr m_pSnapshot;
 
-    using HashTableElem = std::pair<const ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>;
-    std::unordered_map<ResMappingHashKey,
-                       RefCntAutoPtr<IDeviceObject>,
-                       ResMappingHashKey::Hasher,
-                       std::equal_to<ResMappingHashKey>,
-                       STDAllocatorRawMem<HashTableElem>>
-        m_HashTable;
+    // Serializes writers
+    std::mutex m_WriteMtx;
 };
 
 } // namespace Diligent
@@ -0,0 +1,154 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ResourceNameTable class
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+#include "Shader.h"
+#include "HashUtils.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// Hashed table that maps resource names to indices in an array of items that have
+/// Name and ShaderStages members (e.g. PipelineResourceDesc or ShaderResourceVariableDesc).
+
+/// The table is built once and replaces the linear strcmp scans over the item array.
+/// Entries are sorted by the name hash and then by the item index, so that lookups return
+/// the same item as the linear scan would, i.e. the one with the smallest index.
+/// The table does not copy the names, so the items must outlive it.
+class ResourceNameTable
+{
+public:
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    ResourceNameTable() noexcept {}
+
+    template <typename ItemType>
+    ResourceNameTable(const ItemType* Items, Uint32 NumItems)
+    {
+        Initialize(Items, NumItems);
+    }
+
+    template <typename ItemType>
+    void Initialize(const ItemType* Items, Uint32 NumItems)
+    {
+        m_Entries.clear();
+        m_Entries.reserve(NumItems);
+        for (Uint32 i = 0; i < NumItems; ++i)
+        {
+            const ItemType& Item = Items[i];
+            VERIFY_EXPR(Item.Name != nullptr);
+            m_Entries.emplace_back(HashMapStringKey{Item.Name}.GetHash(), Item.Name, Item.ShaderStages, i);
+        }
+        std::sort(m_Entries.begin(), m_Entries.end());
+    }
+
+    void Clear()
+    {
+        m_Entries.clear();
+        m_Entries.shrink_to_fit();
+    }
+
+    /// Returns the index of the first item with the given name for which Predicate(Index) returns true,
+    /// or InvalidIndex if there is no such item.
+
+    /// The hash of the name is computed once when the key is constructed, so the same key
+    /// can be used to look up the name in multiple tables without rehashing it.
+    template <typename PredicateType>
+    Uint32 FindIf(const HashMapStringKey& Name, PredicateType&& Predicate) const
+    {
+        return FindEntry(Name, [&Predicate](const Entry& E) { return Predicate(E.Index); });
+    }
+
+    /// Returns the index of the first item with the given name that is defined in any of
+    /// the specified shader stages, or InvalidIndex if there is no such item.
+    Uint32 Find(const HashMapStringKey& Name, SHADER_TYPE ShaderStages) const
+    {
+        return FindEntry(Name, [ShaderStages](const Entry& E) { return (E.ShaderStages & ShaderStages) != 0; });
+    }
+
+    /// Calls Handler(Hash, Name, Index) for every item in the order of the name hashes.
+    template <typename HandlerType>
+    void ProcessSorted(HandlerType&& Handler) const
+    {
+        for (const Entry& E : m_Entries)
+            Handler(E.Hash, E.Name, E.Index);
+    }
+
+    bool IsEmpty() const { return m_Entries.empty(); }
+
+private:
+    struct Entry
+    {
+        size_t      Hash;
+        const char* Name;
+        SHADER_TYPE ShaderStages;
+        Uint32      Index;
+
+        Entry(size_t _Hash, const char* _Name, SHADER_TYPE _ShaderStages, Uint32 _Index) noexcept :
+            Hash{_Hash},
+            Name{_Name},
+            ShaderStages{_ShaderStages},
+            Index{_Index}
+        {}
+
+        bool operator<(const Entry& rhs) const
+        {
+            return Hash != rhs.Hash ? Hash < rhs.Hash : Index < rhs.Index;
+        }
+    };
+
+    template <typename PredicateType>
+    Uint32 FindEntry(const HashMapStringKey& Name, PredicateType&& Predicate) const
+    {
+        const size_t Hash = Name.GetHash();
+        const char*  Str  = Name.GetStr();
+
+        auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), Hash,
+                                   [](const Entry& E, size_t H) { return E.Hash < H; });
+        for (; it != m_Entries.end() && it->Hash == Hash; ++it)
+        {
+            // Compare pointers first: names that come from the same description are not compared as strings
+            if ((it->Name == Str || strcmp(it->Name, Str) == 0) && Predicate(*it))
+                return it->Index;
+        }
+        return InvalidIndex;
+    }
+
+private:
+    std::vector<Entry> m_Entries;
+};
+
+} // namespace Diligent
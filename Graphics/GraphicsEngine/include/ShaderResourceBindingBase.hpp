@@ -32,6 +32,7 @@
 
 #include <array>
 #include <functional>
+#include <algorithm>
 
 #include "PrivateConstants.h"
 #include "ShaderResourceBinding.h"
@@ -48,6 +49,115 @@
 namespace Diligent
 {
 
+/// Shader resource cache and shader variable managers of a shader resource binding object.
+
+/// The data is allocated separately from the SRB object, so that the pipeline resource signature
+/// can pass it on to a new SRB when the SRB object is destroyed (see PipelineResourceSignatureDesc::SRBRecyclePoolSize).
+template <typename EngineImplTraits>
+struct ShaderResourceBindingData
+{
+    using ResourceSignatureType         = typename EngineImplTraits::PipelineResourceSignatureImplType;
+    using ShaderResourceCacheImplType   = typename EngineImplTraits::ShaderResourceCacheImplType;
+    using ShaderVariableManagerImplType = typename EngineImplTraits::ShaderVariableManagerImplType;
+
+    explicit ShaderResourceBindingData(Uint32 _NumShaders) noexcept :
+        NumShaders{_NumShaders}
+    {}
+
+    const Uint32 NumShaders;
+
+    ShaderResourceCacheImplType    ResourceCache{ResourceCacheContentType::SRB};
+    ShaderVariableManagerImplType* pShaderVarMgrs = nullptr; // [NumShaders]
+
+    static ShaderResourceBindingData* Create(ResourceSignatureType& PRS, IObject& Owner) noexcept(false)
+    {
+        const Uint32 NumShaders = PRS.GetNumActiveShaderStages();
+
+        FixedLinearAllocator MemPool{GetRawAllocator()};
+        MemPool.AddSpace<ShaderResourceBindingData>();
+        MemPool.AddSpace<ShaderVariableManagerImplType>(NumShaders);
+        MemPool.Reserve();
+        static_assert(std::is_nothrow_constructible<ShaderVariableManagerImplType, IObject&, ShaderResourceCacheImplType&>::value,
+                      "Constructor of ShaderVariableManagerImplType must be noexcept, so we can safely construct all managers");
+        ShaderResourceBindingData* pData = MemPool.Construct<ShaderResourceBindingData>(NumShaders);
+        pData->pShaderVarMgrs            = MemPool.ConstructArray<ShaderVariableManagerImplType>(NumShaders, std::ref(Owner), std::ref(pData->ResourceCache));
+
+        // The memory is now owned by the data object and will be freed by Destroy().
+        void* Ptr = MemPool.ReleaseOwnership();
+        VERIFY_EXPR(Ptr == pData);
+        (void)Ptr;
+
+        try
+        {
+            PRS.InitSRBResourceCache(pData->ResourceCache);
+
+            SRBMemoryAllocator& SRBMemAllocator = PRS.GetSRBMemoryAllocator();
+            for (Uint32 s = 0; s < NumShaders; ++s)
+            {
+                IMemoryAllocator& VarDataAllocator = SRBMemAllocator.GetShaderVariableDataAllocator(s);
+
+                // Initialize vars manager to reference mutable and dynamic variables
+                // Note that the cache has space for all variable types
+                const SHADER_RESOURCE_VARIABLE_TYPE VarTypes[] = {SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC};
+                pData->pShaderVarMgrs[s].Initialize(PRS, VarDataAllocator, VarTypes, _countof(VarTypes), PRS.GetActiveShaderStageType(s));
+            }
+        }
+        catch (...)
+        {
+            pData->Destroy(PRS);
+            throw;
+        }
+
+        return pData;
+    }
+
+    void Destroy(ResourceSignatureType& PRS)
+    {
+        SRBMemoryAllocator& SRBMemAllocator = PRS.GetSRBMemoryAllocator();
+        for (Uint32 s = 0; s < NumShaders; ++s)
+        {
+            IMemoryAllocator& VarDataAllocator = SRBMemAllocator.GetShaderVariableDataAllocator(s);
+            pShaderVarMgrs[s].Destroy(VarDataAllocator);
+            pShaderVarMgrs[s].~ShaderVariableManagerImplType();
+        }
+        this->~ShaderResourceBindingData();
+        GetRawAllocator().Free(this);
+    }
+
+    void SetOwner(IObject& Owner)
+    {
+        for (Uint32 s = 0; s < NumShaders; ++s)
+            pShaderVarMgrs[s].SetOwner(Owner);
+    }
+
+    // Binds null to every element of every mutable and dynamic variable
+    void ResetVariables()
+    {
+        static constexpr Uint32 MaxNullObjects              = 16;
+        IDeviceObject* const    NullObjects[MaxNullObjects] = {};
+
+        for (Uint32 s = 0; s < NumShaders; ++s)
+        {
+            ShaderVariableManagerImplType& Mgr = pShaderVarMgrs[s];
+
+            const Uint32 NumVars = Mgr.GetVariableCount();
+            for (Uint32 v = 0; v < NumVars; ++v)
+            {
+                IShaderResourceVariable* pVar = Mgr.GetVariable(v);
+                VERIFY_EXPR(pVar != nullptr);
+
+                ShaderResourceDesc ResDesc;
+                pVar->GetResourceDesc(ResDesc);
+                for (Uint32 Elem = 0; Elem < ResDesc.ArraySize; Elem += MaxNullObjects)
+                {
+                    const Uint32 NumElems = std::min(ResDesc.ArraySize - Elem, MaxNullObjects);
+                    pVar->SetArray(NullObjects, Elem, NumElems, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+                }
+            }
+        }
+    }
+};
+
 /// Template class implementing base functionality of the shader resource binding
 
 /// \tparam EngineImplTraits - Engine implementation type traits.
@@ -67,6 +177,8 @@ public:
     // The type of the shader resource variable manager (ShaderVariableManagerD3D12Impl, ShaderVariableManagerVkImpl, etc.)
     using ShaderVariableManagerImplType = typename EngineImplTraits::ShaderVariableManagerImplType;
 
+    using SRBDataType = ShaderResourceBindingData<EngineImplTraits>;
+
     using TObjectBase = ObjectBase<BaseInterface>;
 
     /// \param pRefCounters - Reference counters object that controls the lifetime of this SRB.
@@ -74,67 +186,29 @@ public:
     ShaderResourceBindingBase(IReferenceCounters* pRefCounters, ResourceSignatureType* pPRS) :
         TObjectBase{pRefCounters},
         m_pPRS{pPRS},
-        m_ShaderResourceCache{ResourceCacheContentType::SRB}
+        m_pData{AcquireData(*pPRS, *this)},
+        m_ShaderResourceCache{m_pData->ResourceCache},
+        m_pShaderVarMgrs{m_pData->pShaderVarMgrs}
     {
-        try
-        {
-            m_ActiveShaderStageIndex.fill(-1);
-
-            const Uint32        NumShaders   = GetNumShaders();
-            const PIPELINE_TYPE PipelineType = GetPipelineType();
-            for (Uint32 s = 0; s < NumShaders; ++s)
-            {
-                const SHADER_TYPE ShaderType = pPRS->GetActiveShaderStageType(s);
-                const Int32       ShaderInd  = GetShaderTypePipelineIndex(ShaderType, PipelineType);
-
-                m_ActiveShaderStageIndex[ShaderInd] = static_cast<Int8>(s);
-            }
-
-
-            FixedLinearAllocator MemPool{GetRawAllocator()};
-            MemPool.AddSpace<ShaderVariableManagerImplType>(NumShaders);
-            MemPool.Reserve();
-            static_assert(std::is_nothrow_constructible<ShaderVariableManagerImplType, decltype(*this), ShaderResourceCacheImplType&>::value,
-                          "Constructor of ShaderVariableManagerImplType must be noexcept, so we can safely construct all managers");
-            m_pShaderVarMgrs = MemPool.ConstructArray<ShaderVariableManagerImplType>(NumShaders, std::ref(*this), std::ref(m_ShaderResourceCache));
-
-            // The memory is now owned by ShaderResourceBindingBase and will be freed by Destruct().
-            void* Ptr = MemPool.ReleaseOwnership();
-            VERIFY_EXPR(Ptr == m_pShaderVarMgrs);
-            (void)Ptr;
-
-            // It is important to construct all objects before initializing them because if an exception is thrown,
-            // Destruct() will call destructors for all non-null objects.
-
-            pPRS->InitSRBResourceCache(m_ShaderResourceCache);
-
-            SRBMemoryAllocator& SRBMemAllocator = pPRS->GetSRBMemoryAllocator();
-            for (Uint32 s = 0; s < NumShaders; ++s)
-            {
-                const SHADER_TYPE ShaderType = pPRS->GetActiveShaderStageType(s);
-                const Int32       ShaderInd  = GetShaderTypePipelineIndex(ShaderType, pPRS->GetPipelineType());
-                const int         MgrInd     = m_ActiveShaderStageIndex[ShaderInd];
-                VERIFY_EXPR(MgrInd >= 0 && MgrInd < static_cast<int>(NumShaders));
+        m_ActiveShaderStageIndex.fill(-1);
 
-                IMemoryAllocator& VarDataAllocator = SRBMemAllocator.GetShaderVariableDataAllocator(s);
-
-                // Initialize vars manager to reference mutable and dynamic variables
-                // Note that the cache has space for all variable types
-                const SHADER_RESOURCE_VARIABLE_TYPE VarTypes[] = {SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC};
-                m_pShaderVarMgrs[MgrInd].Initialize(*pPRS, VarDataAllocator, VarTypes, _countof(VarTypes), ShaderType);
-            }
-        }
-        catch (...)
+        const Uint32        NumShaders   = GetNumShaders();
+        const PIPELINE_TYPE PipelineType = GetPipelineType();
+        for (Uint32 s = 0; s < NumShaders; ++s)
         {
-            // We must release objects manually as destructor will not be called.
-            Destruct();
-            throw;
+            const SHADER_TYPE ShaderType = pPRS->GetActiveShaderStageType(s);
+            const Int32       ShaderInd  = GetShaderTypePipelineIndex(ShaderType, PipelineType);
+
+            m_ActiveShaderStageIndex[ShaderInd] = static_cast<Int8>(s);
         }
     }
 
     ~ShaderResourceBindingBase()
     {
-        Destruct();
+        // Weak references to this object have expired at this point, so the data
+        // can be safely handed over to a new SRB.
+        if (!m_pPRS->RecycleSRBData(m_pData, m_bStaticResourcesInitialized))
+            m_pData->Destroy(*m_pPRS);
     }
 
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ShaderResourceBinding, TObjectBase)
@@ -266,23 +340,24 @@ public:
         return StaleVarTypes;
     }
 
+    /// Implementation of IShaderResourceBinding::ResetAllVariables().
+    virtual void DILIGENT_CALL_TYPE ResetAllVariables() override final
+    {
+        m_pData->ResetVariables();
+    }
+
     ShaderResourceCacheImplType&       GetResourceCache() { return m_ShaderResourceCache; }
     const ShaderResourceCacheImplType& GetResourceCache() const { return m_ShaderResourceCache; }
 
 private:
-    void Destruct()
+    static SRBDataType* AcquireData(ResourceSignatureType& PRS, IObject& Owner)
     {
-        if (m_pShaderVarMgrs != nullptr)
+        if (SRBDataType* pData = PRS.TakeRecycledSRBData())
         {
-            SRBMemoryAllocator& SRBMemAllocator = GetSignature()->GetSRBMemoryAllocator();
-            for (Uint32 s = 0; s < GetNumShaders(); ++s)
-            {
-                IMemoryAllocator& VarDataAllocator = SRBMemAllocator.GetShaderVariableDataAllocator(s);
-                m_pShaderVarMgrs[s].Destroy(VarDataAllocator);
-                m_pShaderVarMgrs[s].~ShaderVariableManagerImplType();
-            }
-            GetRawAllocator().Free(m_pShaderVarMgrs);
+            pData->SetOwner(Owner);
+            return pData;
         }
+        return SRBDataType::Create(PRS, Owner);
     }
 
     template <typename HandlerType>
@@ -312,13 +387,15 @@ protected:
     /// memory for shader resource cache.
     RefCntAutoPtr<ResourceSignatureType> m_pPRS;
 
+    SRBDataType* const m_pData;
+
     // Index of the active shader stage that has resources, for every shader
     // type in the pipeline (given by GetShaderTypePipelineIndex(ShaderType, m_PipelineType)).
     std::array<Int8, MAX_SHADERS_IN_PIPELINE> m_ActiveShaderStageIndex = {-1, -1, -1, -1, -1, -1};
     static_assert(MAX_SHADERS_IN_PIPELINE == 6, "Please update the initializer list above");
 
-    ShaderResourceCacheImplType    m_ShaderResourceCache;
-    ShaderVariableManagerImplType* m_pShaderVarMgrs = nullptr; // [GetNumShaders()]
+    ShaderResourceCacheImplType&         m_ShaderResourceCache;
+    ShaderVariableManagerImplType* const m_pShaderVarMgrs; // [GetNumShaders()]
 
     bool m_bStaticResourcesInitialized = false;
 };
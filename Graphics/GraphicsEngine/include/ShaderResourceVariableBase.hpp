@@ -31,6 +31,7 @@
 /// Implementation of the Diligent::ShaderBase template class
 
 #include <vector>
+#include <algorithm>
 
 #include "ShaderResourceVariable.h"
 #include "PipelineState.h"
@@ -39,6 +40,8 @@
 #include "ShaderResourceCacheCommon.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "EngineMemory.h"
+#include "ResourceNameTable.hpp"
+#include "ResourceMappingImpl.hpp"
 
 namespace Diligent
 {
@@ -81,6 +84,18 @@ inline SHADER_RESOURCE_VARIABLE_TYPE GetShaderVariableType(SHADER_TYPE
     return GetShaderVariableType(ShaderStage, Name, LayoutDesc.DefaultVariableType, LayoutDesc.Variables, LayoutDesc.NumVariables);
 }
 
+/// Same as GetShaderVariableType(ShaderStage, Name, LayoutDesc), but uses the table of variable
+/// names built once for LayoutDesc.Variables instead of comparing the name with every variable.
+inline SHADER_RESOURCE_VARIABLE_TYPE GetShaderVariableType(SHADER_TYPE                       ShaderStage,
+                                                           const HashMapStringKey&           Name,
+                                                           const PipelineResourceLayoutDesc& LayoutDesc,
+                                                           const ResourceNameTable&          LayoutVarNames)
+{
+    const Uint32 VarIndex = LayoutVarNames.Find(Name, ShaderStage);
+    VERIFY_EXPR(VarIndex == ResourceNameTable::InvalidIndex || VarIndex < LayoutDesc.NumVariables);
+    return VarIndex != ResourceNameTable::InvalidIndex ? LayoutDesc.Variables[VarIndex].Type : LayoutDesc.DefaultVariableType;
+}
+
 inline SHADER_RESOURCE_VARIABLE_TYPE GetShaderVariableType(SHADER_TYPE                       ShaderStage,
                                                            const String&                     Name,
                                                            SHADER_RESOURCE_VARIABLE_TYPE     DefaultVariableType,
@@ -733,6 +748,17 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
     }
 
     void BindResources(IResourceMapping* pResourceMapping, BIND_SHADER_RESOURCES_FLAGS Flags)
+    {
+        const PipelineResourceDesc& ResDesc = static_cast<ThisImplType*>(this)->GetDesc();
+        BindResources(Flags,
+                      [pResourceMapping, &ResDesc](Uint32 ArrInd) {
+                          return pResourceMapping->GetResource(ResDesc.Name, ArrInd);
+                      });
+    }
+
+    // Binds the resources returned by GetResource(ArrayIndex), which is called for array elements in ascending order.
+    template <typename ResourceGetterType>
+    void BindResources(BIND_SHADER_RESOURCES_FLAGS Flags, ResourceGetterType&& GetResource)
     {
         ThisImplType* const         pThis   = static_cast<ThisImplType*>(this);
         const PipelineResourceDesc& ResDesc = pThis->GetDesc();
@@ -745,7 +771,7 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
             if ((Flags & BIND_SHADER_RESOURCES_KEEP_EXISTING) != 0 && pThis->Get(ArrInd) != nullptr)
                 continue;
 
-            if (IDeviceObject* pObj = pResourceMapping->GetResource(ResDesc.Name, ArrInd))
+            if (IDeviceObject* pObj = GetResource(ArrInd))
             {
                 const SET_SHADER_RESOURCE_FLAGS SetResFlags = (Flags & BIND_SHADER_RESOURCES_ALLOW_OVERWRITE) != 0 ?
                     SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE :
@@ -805,6 +831,8 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
 
     const PipelineResourceDesc& GetDesc() const { return m_ParentManager.GetResourceDesc(m_ResIndex); }
 
+    Uint32 GetResIndex() const { return m_ResIndex; }
+
 protected:
     // Variable manager that owns this variable
     VarManagerType& m_ParentManager;
@@ -823,7 +851,7 @@ protected:
 
     ShaderVariableManagerBase(IObject&                 Owner,
                               ShaderResourceCacheType& ResourceCache) noexcept :
-        m_Owner{Owner},
+        m_pOwner{&Owner},
         m_ResourceCache{ResourceCache}
     {}
 
@@ -868,10 +896,39 @@ protected:
         if ((Flags & BIND_SHADER_RESOURCES_UPDATE_ALL) == 0)
             Flags |= BIND_SHADER_RESOURCES_UPDATE_ALL;
 
-        for (Uint32 v = 0; v < static_cast<ThisImplType*>(this)->m_NumVariables; ++v)
+        const Uint32 NumVariables = static_cast<ThisImplType*>(this)->m_NumVariables;
+        if (NumVariables == 0)
+            return;
+
+        RefCntAutoPtr<ResourceMappingImpl> pMappingImpl{pResourceMapping, ResourceMappingImpl::IID_InternalImpl};
+        if (!pMappingImpl || m_pSignature == nullptr)
         {
-            m_pVariables[v].BindResources(pResourceMapping, Flags);
+            for (Uint32 v = 0; v < NumVariables; ++v)
+            {
+                m_pVariables[v].BindResources(pResourceMapping, Flags);
+            }
+            return;
         }
+
+        // Resolve all variables in one pass over a single snapshot of the mapping: both the signature
+        // name table and the mapping are sorted by the name hash. Resource names are interned,
+        // so the names are compared by pointer.
+        ResourceMappingImpl::SnapshotReader               Reader{*pMappingImpl};
+        ResourceMappingImpl::SnapshotReader::SortedLookup Lookup{Reader};
+
+        VariableType* const pVarsEnd = m_pVariables + NumVariables;
+        m_pSignature->GetResourceNameTable().ProcessSorted(
+            [&](size_t NameHash, const Char* Name, Uint32 ResIndex) {
+                VariableType* pVar = std::lower_bound(m_pVariables, pVarsEnd, ResIndex,
+                                                      [](const VariableType& Var, Uint32 Idx) { return Var.GetResIndex() < Idx; });
+                if (pVar == pVarsEnd || pVar->GetResIndex() != ResIndex)
+                    return;
+
+                pVar->BindResources(Flags,
+                                    [&](Uint32 ArrInd) {
+                                        return Lookup.GetResource(NameHash, Name, ArrInd);
+                                    });
+            });
     }
 
     void CheckResources(IResourceMapping*                    pResourceMapping,
@@ -893,7 +950,62 @@ protected:
 
 
 protected:
-    IObject& m_Owner;
+    // Finds the variable with the given name using the name table of the signature.
+    // Variables must be sorted by the resource index, which is the case when they are
+    // created in the order of PipelineResourceSignatureBase::ProcessResources().
+    VariableType* FindVariable(const Char* Name) const
+    {
+        const Uint32 NumVariables = static_cast<const ThisImplType*>(this)->m_NumVariables;
+        if (Name == nullptr || NumVariables == 0)
+            return nullptr;
+
+        // For a few variables, comparing the names is faster than hashing the name
+        constexpr Uint32 MaxVariablesForLinearSearch = 8;
+        if (NumVariables <= MaxVariablesForLinearSearch)
+        {
+            for (Uint32 v = 0; v < NumVariables; ++v)
+            {
+                if (strcmp(m_pVariables[v].GetDesc().Name, Name) == 0)
+                    return &m_pVariables[v];
+            }
+            return nullptr;
+        }
+
+        return FindVariableInNameTable(Name);
+    }
+
+private:
+    VariableType* FindVariableInNameTable(const HashMapStringKey& Name) const
+    {
+        const Uint32 NumVariables = static_cast<const ThisImplType*>(this)->m_NumVariables;
+        VERIFY_EXPR(m_pSignature != nullptr);
+#ifdef DILIGENT_DEBUG
+        for (Uint32 v = 1; v < NumVariables; ++v)
+            VERIFY(m_pVariables[v - 1].GetResIndex() < m_pVariables[v].GetResIndex(), "Variables are not sorted by the resource index");
+#endif
+
+        VariableType* const pVarsEnd = m_pVariables + NumVariables;
+        VariableType*       pVar     = nullptr;
+        // The signature may contain resources with the same name in other shader stages,
+        // so look for the first one that has a variable in this manager.
+        m_pSignature->GetResourceNameTable().FindIf(
+            Name,
+            [&](Uint32 ResIndex) {
+                VariableType* it = std::lower_bound(m_pVariables, pVarsEnd, ResIndex,
+                                                    [](const VariableType& Var, Uint32 Idx) { return Var.GetResIndex() < Idx; });
+                if (it != pVarsEnd && it->GetResIndex() == ResIndex)
+                {
+                    pVar = it;
+                    return true;
+                }
+                return false;
+            });
+        return pVar;
+    }
+
+protected:
+    // The owner changes when the SRB data is reused by another SRB (see ShaderResourceBindingData)
+    IObject* m_pOwner;
 
     // Variable manager is owned by either Pipeline Resource Signature (in which case m_ResourceCache references
     // static resource cache owned by the same signature object), or by SRB object (in which case
@@ -0,0 +1,78 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Defines Diligent::ScopedStateCreationStageTimer class
+
+#include "RenderDevice.h"
+
+namespace Diligent
+{
+
+/// Records the duration of the scope as the given state creation stage in the timings of the render device.
+
+/// ScopedStageTimer records to the collector of the module it is compiled into. This timer
+/// goes through IRenderDevice instead, so that the stages of the components that live in other
+/// modules (e.g. the render state cache) are recorded by the device that reports them.
+/// The stage can be changed before the timer goes out of scope.
+class ScopedStateCreationStageTimer
+{
+public:
+    ScopedStateCreationStageTimer(IRenderDevice* pDevice, STATE_CREATION_STAGE Stage) noexcept :
+        m_pDevice{pDevice},
+        m_Stage{Stage},
+        m_StartTime{pDevice != nullptr ? pDevice->GetStateCreationTimestamp() : 0}
+    {
+    }
+
+    ~ScopedStateCreationStageTimer()
+    {
+        if (m_StartTime != 0)
+            m_pDevice->RecordStateCreationStage(m_Stage, m_StartTime, m_pDevice->GetStateCreationTimestamp());
+    }
+
+    void SetStage(STATE_CREATION_STAGE Stage) noexcept
+    {
+        m_Stage = Stage;
+    }
+
+    // clang-format off
+    ScopedStateCreationStageTimer           (const ScopedStateCreationStageTimer&) = delete;
+    ScopedStateCreationStageTimer& operator=(const ScopedStateCreationStageTimer&) = delete;
+    ScopedStateCreationStageTimer           (ScopedStateCreationStageTimer&&)      = delete;
+    ScopedStateCreationStageTimer& operator=(ScopedStateCreationStageTimer&&)      = delete;
+    // clang-format on
+
+private:
+    IRenderDevice* const m_pDevice;
+    STATE_CREATION_STAGE m_Stage;
+    const Uint64         m_StartTime;
+};
+
+} // namespace Diligent
@@ -62,6 +62,9 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 /// Bit shift for the the shading X-axis rate.
 #define DILIGENT_SHADING_RATE_X_SHIFT 2
 
+/// The number of bins in the state creation stage duration histogram.
+#define DILIGENT_STATE_CREATION_STAGE_HISTOGRAM_SIZE 24
+
 static DILIGENT_CONSTEXPR Uint32 MAX_BUFFER_SLOTS        = DILIGENT_MAX_BUFFER_SLOTS;
 static DILIGENT_CONSTEXPR Uint32 MAX_RENDER_TARGETS      = DILIGENT_MAX_RENDER_TARGETS;
 static DILIGENT_CONSTEXPR Uint32 MAX_VIEWPORTS           = DILIGENT_MAX_VIEWPORTS;
@@ -72,4 +75,6 @@ static DILIGENT_CONSTEXPR Uint8  DEFAULT_QUEUE_ID        = DILIGENT_DEFAULT_QUEU
 static DILIGENT_CONSTEXPR Uint32 MAX_SHADING_RATES       = DILIGENT_MAX_SHADING_RATES;
 static DILIGENT_CONSTEXPR Uint32 SHADING_RATE_X_SHIFT    = DILIGENT_SHADING_RATE_X_SHIFT;
 
+static DILIGENT_CONSTEXPR Uint32 STATE_CREATION_STAGE_HISTOGRAM_SIZE = DILIGENT_STATE_CREATION_STAGE_HISTOGRAM_SIZE;
+
 DILIGENT_END_NAMESPACE // namespace Diligent
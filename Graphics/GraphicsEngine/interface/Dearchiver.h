@@ -178,6 +178,47 @@ struct PipelineStateUnpackInfo
 typedef struct PipelineStateUnpackInfo PipelineStateUnpackInfo;
 
 
+/// Pipeline state batch unpack parameters
+struct PipelineStateBatchUnpackInfo
+{
+    /// A pointer to the array of NumPipelines pipeline state unpack infos.
+    const PipelineStateUnpackInfo* pUnpackInfos DEFAULT_INITIALIZER(nullptr);
+
+    /// The number of pipeline states to unpack.
+    Uint32 NumPipelines DEFAULT_INITIALIZER(0);
+
+    /// An optional thread pool that will be used to unpack the pipelines in parallel.
+    /// If null, all pipelines are unpacked by the calling thread.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
+
+    /// Whether to create the pipelines with the Diligent::PSO_CREATE_FLAG_ASYNCHRONOUS flag.
+
+    /// When this flag is set, the method returns as soon as all pipelines have been deserialized,
+    /// and the application should use IPipelineState::GetStatus() to check if a pipeline is ready.
+    Bool Asynchronous DEFAULT_INITIALIZER(True);
+};
+typedef struct PipelineStateBatchUnpackInfo PipelineStateBatchUnpackInfo;
+
+
+/// Pipeline state prefetch parameters
+struct PipelineStatePrefetchInfo
+{
+    struct IRenderDevice* pDevice DEFAULT_INITIALIZER(nullptr);
+
+    /// A pointer to the array of NumNames pipeline state names.
+    /// Pipelines of all types with matching names are prefetched.
+    const Char* const* ppNames DEFAULT_INITIALIZER(nullptr);
+
+    /// The number of pipeline state names.
+    Uint32 NumNames DEFAULT_INITIALIZER(0);
+
+    /// An optional thread pool that will be used to create the shaders in parallel.
+    /// If null, all shaders are created by the calling thread.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct PipelineStatePrefetchInfo PipelineStatePrefetchInfo;
+
+
 /// Render pass unpack parameters
 struct RenderPassUnpackInfo
 {
@@ -272,6 +313,37 @@ DILIGENT_BEGIN_INTERFACE(IDearchiver, IObject)
                                              const PipelineStateUnpackInfo REF UnpackInfo,
                                              IPipelineState**                  ppPSO) PURE;
 
+    /// Unpacks multiple pipeline state objects from the device object archive.
+
+    /// \param [in]  UnpackInfo - Batch unpack info, see Diligent::PipelineStateBatchUnpackInfo.
+    /// \param [out] ppPSOs     - Pointer to the array of UnpackInfo.NumPipelines elements where
+    ///                           pointers to the unpacked pipeline state objects will be stored.
+    ///                           The function calls AddRef() for every pipeline, so that each
+    ///                           PSO will have one reference. If a pipeline could not be unpacked,
+    ///                           the corresponding element is set to null.
+    ///
+    /// \remarks   Resource signatures, render passes and shaders that are shared between the pipelines
+    ///            are unpacked only once. If UnpackInfo.pThreadPool is not null, the pipelines are
+    ///            deserialized in parallel by the thread pool and the calling thread.
+    ///
+    /// \note   This method is thread-safe.
+    VIRTUAL void METHOD(UnpackPipelineStates)(THIS_
+                                              const PipelineStateBatchUnpackInfo REF UnpackInfo,
+                                              IPipelineState**                       ppPSOs) PURE;
+
+    /// Creates the shaders used by the pipeline states ahead of time.
+
+    /// \param [in] PrefetchInfo - Prefetch info, see Diligent::PipelineStatePrefetchInfo.
+    ///
+    /// \return     The number of names for which at least one pipeline was found in the archive.
+    ///
+    /// \remarks   Prefetched shaders are kept in the dearchiver shader cache, so that the subsequent
+    ///            UnpackPipelineState() and UnpackPipelineStates() calls do not need to create them.
+    ///
+    /// \note   This method is thread-safe.
+    VIRTUAL Uint32 METHOD(Prefetch)(THIS_
+                                    const PipelineStatePrefetchInfo REF PrefetchInfo) PURE;
+
     /// Unpacks resource signature from the device object archive.
 
     /// \param [in]  UnpackInfo  - Resource signature unpack info, see Diligent::ResourceSignatureUnpackInfo.
@@ -329,6 +401,8 @@ DILIGENT_END_INTERFACE
 #    define IDearchiver_LoadArchive(This, ...)             CALL_IFACE_METHOD(Dearchiver, LoadArchive,             This, __VA_ARGS__)
 #    define IDearchiver_UnpackShader(This, ...)            CALL_IFACE_METHOD(Dearchiver, UnpackShader,            This, __VA_ARGS__)
 #    define IDearchiver_UnpackPipelineState(This, ...)     CALL_IFACE_METHOD(Dearchiver, UnpackPipelineState,     This, __VA_ARGS__)
+#    define IDearchiver_UnpackPipelineStates(This, ...)    CALL_IFACE_METHOD(Dearchiver, UnpackPipelineStates,    This, __VA_ARGS__)
+#    define IDearchiver_Prefetch(This, ...)                CALL_IFACE_METHOD(Dearchiver, Prefetch,                This, __VA_ARGS__)
 #    define IDearchiver_UnpackResourceSignature(This, ...) CALL_IFACE_METHOD(Dearchiver, UnpackResourceSignature, This, __VA_ARGS__)
 #    define IDearchiver_UnpackRenderPass(This, ...)        CALL_IFACE_METHOD(Dearchiver, UnpackRenderPass,        This, __VA_ARGS__)
 #    define IDearchiver_Store(This, ...)                   CALL_IFACE_METHOD(Dearchiver, Store,                   This, __VA_ARGS__)
@@ -1614,6 +1614,7 @@ enum RENDER_DEVICE_TYPE
     RENDER_DEVICE_TYPE_VULKAN,         ///< Vulkan device
     RENDER_DEVICE_TYPE_METAL,          ///< Metal device
     RENDER_DEVICE_TYPE_WEBGPU,         ///< WebGPU device
+    RENDER_DEVICE_TYPE_NULL,           ///< Null (headless) device
     RENDER_DEVICE_TYPE_COUNT           ///< The total number of device types
 };
 
@@ -2544,6 +2545,10 @@ struct RenderDeviceInfo
     {
         return Type == RENDER_DEVICE_TYPE_WEBGPU;
     }
+    constexpr bool IsNullDevice() const
+    {
+        return Type == RENDER_DEVICE_TYPE_NULL;
+    }
 
     // for backward compatibility
     const NDCAttribs& GetNDCAttribs()const
@@ -387,6 +387,20 @@ struct PipelineResourceSignatureDesc DILIGENT_DERIVE(DeviceObjectAttribs)
     /// the shader resource binding object instances.
     Uint32 SRBAllocationGranularity DEFAULT_INITIALIZER(1);
 
+    /// The maximum number of destroyed shader resource binding objects whose internal data
+    /// the signature keeps for reuse.
+
+    /// When an SRB is destroyed, its resource cache and variables are reset as if by
+    /// IShaderResourceBinding::ResetAllVariables() and are reused by the next call to
+    /// IPipelineResourceSignature::CreateShaderResourceBinding(), which is considerably faster
+    /// than initializing them from scratch. Applications that create many transient SRBs
+    /// every frame should set this value to the typical number of such SRBs.
+    /// The data of SRBs with initialized static resources is not reused, unless the signature
+    /// has no static resources.
+    ///
+    /// The default value (0) disables the reuse.
+    Uint32 SRBRecyclePoolSize DEFAULT_INITIALIZER(0);
+
 #if DILIGENT_CPP_INTERFACE
 
     /// Tests if two pipeline resource signature descriptions are equal.
@@ -410,7 +424,7 @@ struct PipelineResourceSignatureDesc DILIGENT_DERIVE(DeviceObjectAttribs)
         if (UseCombinedTextureSamplers && !SafeStrEqual(CombinedSamplerSuffix, Rhs.CombinedSamplerSuffix))
             return false;
 
-        // ignore SRBAllocationGranularity
+        // ignore SRBAllocationGranularity and SRBRecyclePoolSize
 
         for (Uint32 r = 0; r < NumResources; ++r)
         {
@@ -61,6 +61,73 @@
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
 
+// clang-format off
+
+/// Stages of shader and pipeline state creation that are timed when
+/// state creation timings are enabled (see IRenderDevice::EnableStateCreationTimings).
+DILIGENT_TYPED_ENUM(STATE_CREATION_STAGE, Uint32)
+{
+    /// Shader source preprocessing: reading the source, building the preamble
+    /// and converting HLSL to GLSL.
+    STATE_CREATION_STAGE_SHADER_PREPROCESSING = 0,
+
+    /// Shader compilation by glslang, DXC, FXC or the driver.
+    STATE_CREATION_STAGE_SHADER_COMPILATION,
+
+    /// SPIR-V legalization and optimization.
+    STATE_CREATION_STAGE_SPIRV_OPTIMIZATION,
+
+    /// Shader resource reflection.
+    STATE_CREATION_STAGE_SHADER_REFLECTION,
+
+    /// Shader bytecode patching, e.g. resource binding remapping.
+    STATE_CREATION_STAGE_SHADER_PATCHING,
+
+    /// Backend pipeline initialization, including the driver pipeline creation.
+    STATE_CREATION_STAGE_PIPELINE_CREATION,
+
+    /// Creation of serialized pipeline states by the archiver.
+    STATE_CREATION_STAGE_ARCHIVER_PIPELINE_CREATION,
+
+    /// Serialization of the archive data.
+    STATE_CREATION_STAGE_ARCHIVE_SERIALIZATION,
+
+    /// Render state cache requests that were satisfied from the cache.
+    STATE_CREATION_STAGE_RENDER_STATE_CACHE_HIT,
+
+    /// Render state cache requests that created a new object.
+    STATE_CREATION_STAGE_RENDER_STATE_CACHE_MISS,
+
+    /// The number of stages.
+    STATE_CREATION_STAGE_COUNT
+};
+
+/// Timing statistics of a state creation stage, see IRenderDevice::GetStateCreationStageStats.
+struct StateCreationStageStats
+{
+    /// The number of times the stage was executed.
+    Uint64 Count DEFAULT_INITIALIZER(0);
+
+    /// The total time spent in the stage, in seconds.
+    double TotalTime DEFAULT_INITIALIZER(0);
+
+    /// The minimum stage duration, in seconds.
+    double MinTime DEFAULT_INITIALIZER(0);
+
+    /// The maximum stage duration, in seconds.
+    double MaxTime DEFAULT_INITIALIZER(0);
+
+    /// Duration histogram.
+
+    /// Bin i counts the durations in the range [2^i, 2^(i+1)) microseconds.
+    /// The first bin also counts all durations below one microsecond, and the last
+    /// bin counts all durations that do not fit into other bins.
+    Uint64 Histogram[DILIGENT_STATE_CREATION_STAGE_HISTOGRAM_SIZE] DEFAULT_INITIALIZER({});
+};
+typedef struct StateCreationStageStats StateCreationStageStats;
+
+// clang-format on
+
 // {F0E9B607-AE33-4B2B-B1AF-A8B2C3104022}
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDevice =
     {0xf0e9b607, 0xae33, 0x4b2b, {0xb1, 0xaf, 0xa8, 0xb2, 0xc3, 0x10, 0x40, 0x22}};
@@ -426,6 +493,62 @@ DILIGENT_BEGIN_INTERFACE(IRenderDevice, IObject)
     /// so an application must not call Release().
     VIRTUAL IThreadPool* METHOD(GetShaderCompilationThreadPool)(THIS) CONST PURE;
 
+
+    /// Enables or disables the shader and pipeline state creation timings.
+
+    /// \param [in] Enable      - Whether to enable the timings.
+    /// \param [in] RecordTrace - Whether to also record individual events that can be
+    ///                           written with WriteStateCreationTrace().
+    ///
+    /// Timings are disabled by default. When enabled, every creation stage listed in
+    /// Diligent::STATE_CREATION_STAGE is timed and aggregated into per-stage statistics.
+    ///
+    /// \note   Every device reports the timings collected by the module that implements it.
+    ///         Components that live in other modules, such as the render state cache, record
+    ///         their stages through RecordStateCreationStage(). The stages executed by the
+    ///         archiver are reported by the serialization device.
+    VIRTUAL void METHOD(EnableStateCreationTimings)(THIS_
+                                                    Bool Enable,
+                                                    Bool RecordTrace DEFAULT_VALUE(False)) PURE;
+
+    /// Returns the timing statistics of the state creation stage.
+
+    /// \param [in]  Stage - State creation stage, see Diligent::STATE_CREATION_STAGE.
+    /// \param [out] Stats - Stage statistics, see Diligent::StateCreationStageStats.
+    VIRTUAL void METHOD(GetStateCreationStageStats)(THIS_
+                                                    STATE_CREATION_STAGE          Stage,
+                                                    StateCreationStageStats REF Stats) CONST PURE;
+
+    /// Writes the recorded state creation events in Chrome trace event JSON format.
+
+    /// \param [out] ppTrace - Address of the memory location where a pointer to the
+    ///                        data blob with the JSON text will be written.
+    ///
+    /// The trace can be loaded into chrome://tracing or https://ui.perfetto.dev.
+    /// Events are only recorded if the timings were enabled with RecordTrace set to true.
+    VIRTUAL void METHOD(WriteStateCreationTrace)(THIS_
+                                                 IDataBlob** ppTrace) CONST PURE;
+
+    /// Clears all state creation statistics and recorded events.
+    VIRTUAL void METHOD(ResetStateCreationTimings)(THIS) PURE;
+
+    /// Returns the current time of the state creation timings clock, in nanoseconds,
+    /// or zero if the timings are disabled.
+    VIRTUAL Uint64 METHOD(GetStateCreationTimestamp)(THIS) CONST PURE;
+
+    /// Records a state creation stage that was executed outside of the device.
+
+    /// \param [in] Stage     - State creation stage, see Diligent::STATE_CREATION_STAGE.
+    /// \param [in] StartTime - Stage start time returned by GetStateCreationTimestamp().
+    /// \param [in] EndTime   - Stage end time returned by GetStateCreationTimestamp().
+    ///
+    /// The stage is ignored if either time is zero, i.e. if the timings were disabled
+    /// when the stage started or ended.
+    VIRTUAL void METHOD(RecordStateCreationStage)(THIS_
+                                                  STATE_CREATION_STAGE Stage,
+                                                  Uint64               StartTime,
+                                                  Uint64               EndTime) PURE;
+
 #if DILIGENT_CPP_INTERFACE
     /// Overloaded alias for CreateGraphicsPipelineState.
     void CreatePipelineState(const GraphicsPipelineStateCreateInfo& CI, IPipelineState** ppPipelineState)
@@ -483,6 +606,12 @@ DILIGENT_END_INTERFACE
 #    define IRenderDevice_ReleaseStaleResources(This, ...)           CALL_IFACE_METHOD(RenderDevice, ReleaseStaleResources,           This, __VA_ARGS__)
 #    define IRenderDevice_IdleGPU(This)                              CALL_IFACE_METHOD(RenderDevice, IdleGPU,                         This)
 #    define IRenderDevice_GetEngineFactory(This)                     CALL_IFACE_METHOD(RenderDevice, GetEngineFactory,                This)
+#    define IRenderDevice_EnableStateCreationTimings(This, ...)      CALL_IFACE_METHOD(RenderDevice, EnableStateCreationTimings,      This, __VA_ARGS__)
+#    define IRenderDevice_GetStateCreationStageStats(This, ...)      CALL_IFACE_METHOD(RenderDevice, GetStateCreationStageStats,      This, __VA_ARGS__)
+#    define IRenderDevice_WriteStateCreationTrace(This, ...)         CALL_IFACE_METHOD(RenderDevice, WriteStateCreationTrace,         This, __VA_ARGS__)
+#    define IRenderDevice_ResetStateCreationTimings(This)            CALL_IFACE_METHOD(RenderDevice, ResetStateCreationTimings,       This)
+#    define IRenderDevice_GetStateCreationTimestamp(This)            CALL_IFACE_METHOD(RenderDevice, GetStateCreationTimestamp,       This)
+#    define IRenderDevice_RecordStateCreationStage(This, ...)        CALL_IFACE_METHOD(RenderDevice, RecordStateCreationStage,        This, __VA_ARGS__)
 #    define IRenderDevice_GetShaderCompilationThreadPool(This)       CALL_IFACE_METHOD(RenderDevice, GetShaderCompilationThreadPool,  This)
 // clang-format on
 
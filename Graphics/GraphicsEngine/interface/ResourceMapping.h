@@ -118,6 +118,10 @@ DILIGENT_BEGIN_INTERFACE(IResourceMapping, IObject)
     ///
     /// \remarks Resource mapping increases the reference counter for referenced objects. So an
     ///          object will not be released as long as it is in the resource mapping.
+    ///
+    ///          Every modification makes a new copy of the mapping, so its cost is linear
+    ///          in the number of resources in the mapping. Use AddResources() to add many
+    ///          resources at once.
     VIRTUAL void METHOD(AddResource)(THIS_
                                      const Char*    Name,
                                      IDeviceObject* pObject,
@@ -144,6 +148,23 @@ DILIGENT_BEGIN_INTERFACE(IResourceMapping, IObject)
                                           Bool                  bIsUnique) PURE;
 
 
+    /// Adds multiple resources to the mapping.
+
+    /// \param [in] pEntries   - Pointer to the array of resource mapping entries.
+    /// \param [in] NumEntries - The number of entries in pEntries array.
+    /// \param [in] bIsUnique  - Flag indicating if a resource with the same name
+    ///                          is allowed to be found in the mapping. In the latter
+    ///                          case, the new resource replaces the existing one.
+    ///
+    /// \remarks The result is the same as adding the entries one by one in the order they
+    ///          appear in the array, but the mapping is only copied once.
+    ///          Entries with null or empty names are ignored.
+    VIRTUAL void METHOD(AddResources)(THIS_
+                                      const ResourceMappingEntry* pEntries,
+                                      Uint32                      NumEntries,
+                                      Bool                        bIsUnique) PURE;
+
+
     /// Removes a resource from the mapping using its literal name.
 
     /// \param [in] Name - Name of the resource to remove.
@@ -180,6 +201,7 @@ DILIGENT_END_INTERFACE
 
 #    define IResourceMapping_AddResource(This, ...)          CALL_IFACE_METHOD(ResourceMapping, AddResource,          This, __VA_ARGS__)
 #    define IResourceMapping_AddResourceArray(This, ...)     CALL_IFACE_METHOD(ResourceMapping, AddResourceArray,     This, __VA_ARGS__)
+#    define IResourceMapping_AddResources(This, ...)         CALL_IFACE_METHOD(ResourceMapping, AddResources,         This, __VA_ARGS__)
 #    define IResourceMapping_RemoveResourceByName(This, ...) CALL_IFACE_METHOD(ResourceMapping, RemoveResourceByName, This, __VA_ARGS__)
 #    define IResourceMapping_GetResource(This, ...)          CALL_IFACE_METHOD(ResourceMapping, GetResource,          This, __VA_ARGS__)
 #    define IResourceMapping_GetSize(This)                   CALL_IFACE_METHOD(ResourceMapping, GetSize,              This)
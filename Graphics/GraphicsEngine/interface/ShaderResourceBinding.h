@@ -154,6 +154,19 @@ DILIGENT_BEGIN_INTERFACE(IShaderResourceBinding, IObject)
 
     /// Returns true if static resources have been initialized in this SRB.
     VIRTUAL Bool METHOD(StaticResourcesInitialized)(THIS) CONST PURE;
+
+    /// Resets all mutable and dynamic variables in this SRB to null.
+
+    /// The method releases all resources bound to the mutable and dynamic variables
+    /// of all shader stages, which leaves the SRB in the same state as a newly created one
+    /// (static resources, if initialized, are not affected). This is equivalent to
+    /// binding null to every array element of every variable with the
+    /// Diligent::SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE flag.
+    ///
+    /// \note  The method only updates the SRB's resource cache. It does not modify descriptors
+    ///        that may be in use by the GPU, but the application is responsible for binding
+    ///        all resources again before the SRB is committed.
+    VIRTUAL void METHOD(ResetAllVariables)(THIS) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -170,6 +183,7 @@ DILIGENT_END_INTERFACE
 #    define IShaderResourceBinding_GetVariableCount(This, ...)        CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableCount,             This, __VA_ARGS__)
 #    define IShaderResourceBinding_GetVariableByIndex(This, ...)      CALL_IFACE_METHOD(ShaderResourceBinding, GetVariableByIndex,           This, __VA_ARGS__)
 #    define IShaderResourceBinding_StaticResourcesInitialized(This)   CALL_IFACE_METHOD(ShaderResourceBinding, StaticResourcesInitialized,   This)
+#    define IShaderResourceBinding_ResetAllVariables(This)            CALL_IFACE_METHOD(ShaderResourceBinding, ResetAllVariables,            This)
 
 // clang-format on
 
@@ -25,8 +25,12 @@
  */
 
 #include "DearchiverBase.hpp"
+
+#include <atomic>
+
 #include "PipelineStateBase.hpp"
 #include "PSOSerializer.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -91,6 +95,36 @@ bool VerifShaderUnpackInfo(const ShaderUnpackInfo& DeArchiveInfo, IShader** ppSh
     return true;
 }
 
+bool VerifyPipelineStateBatchUnpackInfo(const PipelineStateBatchUnpackInfo& UnpackInfo, IPipelineState** ppPSOs)
+{
+#define CHECK_BATCH_UNPACK_PARAM(Expr, ...) CHECK_UNPACK_PARAMATER(Expr, "Invalid PSO batch unpack parameter: ", ##__VA_ARGS__)
+    CHECK_BATCH_UNPACK_PARAM(ppPSOs != nullptr || UnpackInfo.NumPipelines == 0, "ppPSOs must not be null");
+    CHECK_BATCH_UNPACK_PARAM(UnpackInfo.pUnpackInfos != nullptr || UnpackInfo.NumPipelines == 0, "pUnpackInfos must not be null");
+    for (Uint32 i = 0; i < UnpackInfo.NumPipelines; ++i)
+    {
+        const PipelineStateUnpackInfo& PSOUnpackInfo = UnpackInfo.pUnpackInfos[i];
+        CHECK_BATCH_UNPACK_PARAM(PSOUnpackInfo.Name != nullptr, "pUnpackInfos[", i, "].Name must not be null");
+        CHECK_BATCH_UNPACK_PARAM(PSOUnpackInfo.pDevice != nullptr, "pUnpackInfos[", i, "].pDevice must not be null");
+    }
+#undef CHECK_BATCH_UNPACK_PARAM
+
+    return true;
+}
+
+bool VerifyPipelineStatePrefetchInfo(const PipelineStatePrefetchInfo& PrefetchInfo)
+{
+#define CHECK_PREFETCH_PARAM(Expr, ...) CHECK_UNPACK_PARAMATER(Expr, "Invalid PSO prefetch parameter: ", ##__VA_ARGS__)
+    CHECK_PREFETCH_PARAM(PrefetchInfo.pDevice != nullptr, "pDevice must not be null");
+    CHECK_PREFETCH_PARAM(PrefetchInfo.ppNames != nullptr || PrefetchInfo.NumNames == 0, "ppNames must not be null");
+    for (Uint32 i = 0; i < PrefetchInfo.NumNames; ++i)
+    {
+        CHECK_PREFETCH_PARAM(PrefetchInfo.ppNames[i] != nullptr && PrefetchInfo.ppNames[i][0] != '\0', "ppNames[", i, "] must not be null or empty");
+    }
+#undef CHECK_PREFETCH_PARAM
+
+    return true;
+}
+
 } // namespace
 
 
@@ -145,40 +179,20 @@ struct DearchiverBase::RPData
 };
 
 
-template <typename ResType>
-bool DearchiverBase::NamedResourceCache<ResType>::Get(ResourceType Type, const char* Name, ResType** ppResource)
+RefCntAutoPtr<IShader> DearchiverBase::ShaderCacheData::Get(Uint32 Idx)
 {
-    VERIFY_EXPR(Name != nullptr && Name[0] != '\0');
-    VERIFY_EXPR(ppResource != nullptr && *ppResource == nullptr);
-    *ppResource = nullptr;
-
-    std::unique_lock<std::mutex> Lock{m_Mtx};
-
-    auto it = m_Map.find(NamedResourceKey{Type, Name});
-    if (it == m_Map.end())
-        return false;
-
-    auto Ptr = it->second.Lock();
-    if (!Ptr)
-        return false;
-
-    *ppResource = Ptr.Detach();
-    return true;
+    std::shared_lock<std::shared_mutex> ReadLock{Mtx};
+    return Idx < Shaders.size() ? Shaders[Idx] : RefCntAutoPtr<IShader>{};
 }
 
-template <typename ResType>
-void DearchiverBase::NamedResourceCache<ResType>::Set(ResourceType Type, const char* Name, ResType* pResource)
+void DearchiverBase::ShaderCacheData::Set(Uint32 Idx, IShader* pShader)
 {
-    VERIFY_EXPR(Name != nullptr && Name[0] != '\0');
-    VERIFY_EXPR(pResource != nullptr);
-
-    std::unique_lock<std::mutex> Lock{m_Mtx};
-    m_Map.emplace(NamedResourceKey{Type, Name, /*CopyName = */ true}, pResource);
+    std::unique_lock<std::shared_mutex> WriteLock{Mtx};
+    if (Idx >= Shaders.size())
+        Shaders.resize(size_t{Idx} + 1);
+    Shaders[Idx] = pShader;
 }
 
-// Instantiation is required by UnpackResourceSignatureImpl
-template class DearchiverBase::NamedResourceCache<IPipelineResourceSignature>;
-
 
 bool DearchiverBase::PRSData::Deserialize(const char* Name, Serializer<SerializerMode::Read>& Ser)
 {
@@ -438,16 +452,17 @@ bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
 
         const Uint32 Idx = ShaderIndices.pIndices[i];
 
-        {
-            std::unique_lock<std::mutex> ReadLock{ShaderCache.Mtx};
-            if (Idx < ShaderCache.Shaders.size())
-            {
-                // Try to get cached shader
-                pShader = ShaderCache.Shaders[Idx];
-                if (pShader)
-                    continue;
-            }
-        }
+        // Try to get cached shader
+        pShader = ShaderCache.Get(Idx);
+        if (pShader)
+            continue;
+
+        std::lock_guard<std::mutex> CreateGuard{ShaderCache.GetCreateMutex(Idx)};
+
+        // The shader may have been created by another thread while we were waiting for the lock
+        pShader = ShaderCache.Get(Idx);
+        if (pShader)
+            continue;
 
         const SerializedData& SerializedShader = pObjArchive->GetSerializedShader(DevType, Idx);
         if (!SerializedShader)
@@ -473,13 +488,7 @@ bool DearchiverBase::UnpackPSOShaders(ArchiveData&             Archive,
                 return false;
         }
 
-        // Add to the cache
-        {
-            std::unique_lock<std::mutex> WriteLock{ShaderCache.Mtx};
-            if (Idx >= ShaderCache.Shaders.size())
-                ShaderCache.Shaders.resize(size_t{Idx} + 1);
-            ShaderCache.Shaders[Idx] = pShader;
-        }
+        ShaderCache.Set(Idx, pShader);
     }
 
     return true;
@@ -589,63 +598,88 @@ static bool ModifyPipelineStateCreateInfo(PSOCreateInfoType&             CreateI
     return true;
 }
 
+template <typename CreateInfoType>
+bool DearchiverBase::LoadPSOCommonData(ArchiveData&             Archive,
+                                       PSOData<CreateInfoType>& PSO,
+                                       const char*              Name,
+                                       IRenderDevice*           pDevice)
+{
+    if (!Archive.pObjArchive->LoadResourceCommonData(PSO.ArchiveResType, Name, PSO))
+        return false;
+
+#ifdef DILIGENT_DEVELOPMENT
+    if (pDevice->GetDeviceInfo().IsD3DDevice())
+    {
+        // We always have reflection information in Direct3D shaders, so always
+        // load it in development build to allow the engine verify bindings.
+        PSO.InternalCI.Flags &= ~PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION;
+    }
+#endif
+
+    return true;
+}
+
 template <typename CreateInfoType>
 void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& UnpackInfo,
+                                             PSO_CREATE_FLAGS               CreateFlags,
                                              IPipelineState**               ppPSO)
 {
     VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
 
-    constexpr auto ResType = PSOData<CreateInfoType>::ArchiveResType;
-
+    RefCntAutoPtr<IPipelineState> pPSO;
     // Do not cache modified PSOs
     if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
     {
         // Since PSO names must be unique (for each PSO type), we use a single cache for all
         // loaded archives.
-        if (m_Cache.PSO.Get(ResType, UnpackInfo.Name, ppPSO))
-            return;
+        pPSO = m_Cache.PSO.GetOrCreate(PSOData<CreateInfoType>::ArchiveResType, UnpackInfo.Name,
+                                       [&]() {
+                                           return CreatePipelineState<CreateInfoType>(UnpackInfo, CreateFlags);
+                                       });
     }
+    else
+    {
+        pPSO = CreatePipelineState<CreateInfoType>(UnpackInfo, CreateFlags);
+    }
+
+    *ppPSO = pPSO.Detach();
+}
 
+template <typename CreateInfoType>
+RefCntAutoPtr<IPipelineState> DearchiverBase::CreatePipelineState(const PipelineStateUnpackInfo& UnpackInfo,
+                                                                  PSO_CREATE_FLAGS               CreateFlags)
+{
     // Find the archive that contains this PSO
-    ArchiveData* pArchiveData = FindArchive(ResType, UnpackInfo.Name);
+    ArchiveData* pArchiveData = FindArchive(PSOData<CreateInfoType>::ArchiveResType, UnpackInfo.Name);
     if (pArchiveData == nullptr)
-        return;
+        return {};
 
     PSOData<CreateInfoType> PSO{GetRawAllocator()};
-    if (!pArchiveData->pObjArchive->LoadResourceCommonData(ResType, UnpackInfo.Name, PSO))
-        return;
-
-#ifdef DILIGENT_DEVELOPMENT
-    if (UnpackInfo.pDevice->GetDeviceInfo().IsD3DDevice())
-    {
-        // We always have reflection information in Direct3D shaders, so always
-        // load it in development build to allow the engine verify bindings.
-        PSO.InternalCI.Flags &= ~PSO_CREATE_INTERNAL_FLAG_NO_SHADER_REFLECTION;
-    }
-#endif
+    if (!LoadPSOCommonData(*pArchiveData, PSO, UnpackInfo.Name, UnpackInfo.pDevice))
+        return {};
 
     if (!UnpackPSORenderPass(PSO, UnpackInfo.pDevice))
-        return;
+        return {};
 
     if (!UnpackPSOSignatures(PSO, UnpackInfo.pDevice))
-        return;
+        return {};
 
     if (!UnpackPSOShaders(*pArchiveData, PSO, UnpackInfo.pDevice))
-        return;
+        return {};
 
     PSO.AssignShaders();
 
     PSO.CreateInfo.PSODesc.SRBAllocationGranularity = UnpackInfo.SRBAllocationGranularity;
     PSO.CreateInfo.PSODesc.ImmediateContextMask     = UnpackInfo.ImmediateContextMask;
     PSO.CreateInfo.pPSOCache                        = UnpackInfo.pCache;
+    PSO.CreateInfo.Flags |= CreateFlags;
 
     if (!ModifyPipelineStateCreateInfo(PSO.CreateInfo, UnpackInfo))
-        return;
+        return {};
 
-    PSO.CreatePipeline(UnpackInfo.pDevice, ppPSO);
-
-    if (UnpackInfo.ModifyPipelineStateCreateInfo == nullptr)
-        m_Cache.PSO.Set(ResType, UnpackInfo.Name, *ppPSO);
+    RefCntAutoPtr<IPipelineState> pPSO;
+    PSO.CreatePipeline(UnpackInfo.pDevice, &pPSO);
+    return pPSO;
 }
 
 bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVersion, bool MakeCopy)
@@ -671,15 +705,16 @@ bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVe
     const auto& ArchiveResources = pObjArchive->GetNamedResources();
     for (const auto& it : ArchiveResources)
     {
-        const ResourceType ResType      = it.first.GetType();
-        const char*        ResName      = it.first.GetName();
-        constexpr bool     MakeNameCopy = true;
+        const ResourceType ResType = it.first.GetType();
+        const char*        ResName = it.first.GetName();
 
-        const auto it_inserted = m_ResNameToArchiveIdx.emplace(NamedResourceKey{ResType, ResName, MakeNameCopy}, ArchiveIdx);
+        // Names of resources in all loaded archives share the interned copy
+        const StringAtom NameAtom    = m_ResNameAtoms.Intern(ResName);
+        const auto       it_inserted = m_ResNameToArchiveIdx.emplace(NamedResourceKey{ResType, NameAtom}, ArchiveIdx);
         if (!it_inserted.second)
         {
             const auto& OtherArchiveResources = m_Archives[it_inserted.first->second].pObjArchive->GetNamedResources();
-            const auto  it_other              = OtherArchiveResources.find(NamedResourceKey{ResType, ResName});
+            const auto  it_other              = OtherArchiveResources.find(NamedResourceKey{ResType, NameAtom});
 
             const bool IsDuplicate =
                 (it_other != OtherArchiveResources.end()) &&
@@ -696,30 +731,27 @@ bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVe
     return true;
 }
 
-void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO)
+void DearchiverBase::UnpackPipelineStateInternal(const PipelineStateUnpackInfo& UnpackInfo,
+                                                 PSO_CREATE_FLAGS               CreateFlags,
+                                                 IPipelineState**               ppPSO)
 {
-    if (!VerifyPipelineStateUnpackInfo(UnpackInfo, ppPSO))
-        return;
-
-    *ppPSO = nullptr;
-
     switch (UnpackInfo.PipelineType)
     {
         case PIPELINE_TYPE_GRAPHICS:
         case PIPELINE_TYPE_MESH:
-            UnpackPipelineStateImpl<GraphicsPipelineStateCreateInfo>(UnpackInfo, ppPSO);
+            UnpackPipelineStateImpl<GraphicsPipelineStateCreateInfo>(UnpackInfo, CreateFlags, ppPSO);
             break;
 
         case PIPELINE_TYPE_COMPUTE:
-            UnpackPipelineStateImpl<ComputePipelineStateCreateInfo>(UnpackInfo, ppPSO);
+            UnpackPipelineStateImpl<ComputePipelineStateCreateInfo>(UnpackInfo, CreateFlags, ppPSO);
             break;
 
         case PIPELINE_TYPE_RAY_TRACING:
-            UnpackPipelineStateImpl<RayTracingPipelineStateCreateInfo>(UnpackInfo, ppPSO);
+            UnpackPipelineStateImpl<RayTracingPipelineStateCreateInfo>(UnpackInfo, CreateFlags, ppPSO);
             break;
 
         case PIPELINE_TYPE_TILE:
-            UnpackPipelineStateImpl<TilePipelineStateCreateInfo>(UnpackInfo, ppPSO);
+            UnpackPipelineStateImpl<TilePipelineStateCreateInfo>(UnpackInfo, CreateFlags, ppPSO);
             break;
 
         case PIPELINE_TYPE_INVALID:
@@ -729,6 +761,73 @@ void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackIn
     }
 }
 
+void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO)
+{
+    if (!VerifyPipelineStateUnpackInfo(UnpackInfo, ppPSO))
+        return;
+
+    *ppPSO = nullptr;
+
+    UnpackPipelineStateInternal(UnpackInfo, PSO_CREATE_FLAG_NONE, ppPSO);
+}
+
+void DearchiverBase::UnpackPipelineStates(const PipelineStateBatchUnpackInfo& UnpackInfo, IPipelineState** ppPSOs)
+{
+    if (!VerifyPipelineStateBatchUnpackInfo(UnpackInfo, ppPSOs))
+        return;
+
+    for (Uint32 i = 0; i < UnpackInfo.NumPipelines; ++i)
+        ppPSOs[i] = nullptr;
+
+    // Signatures, render passes and shaders are looked up in the shared caches, so every
+    // object used by multiple pipelines in the batch is normally only unpacked once.
+    // With the asynchronous flag, pipeline creation does not block the worker threads,
+    // and the thread pool only has to deserialize the pipelines and create the shaders.
+    const PSO_CREATE_FLAGS CreateFlags = UnpackInfo.Asynchronous ? PSO_CREATE_FLAG_ASYNCHRONOUS : PSO_CREATE_FLAG_NONE;
+    ParallelFor(UnpackInfo.pThreadPool, UnpackInfo.NumPipelines,
+                [&](Uint32 Idx) {
+                    UnpackPipelineStateInternal(UnpackInfo.pUnpackInfos[Idx], CreateFlags, &ppPSOs[Idx]);
+                });
+}
+
+template <typename CreateInfoType>
+bool DearchiverBase::PrefetchPSOShaders(const char* Name, IRenderDevice* pDevice)
+{
+    ArchiveData* pArchiveData = FindArchive(PSOData<CreateInfoType>::ArchiveResType, Name);
+    if (pArchiveData == nullptr)
+        return false;
+
+    PSOData<CreateInfoType> PSO{GetRawAllocator()};
+    if (!LoadPSOCommonData(*pArchiveData, PSO, Name, pDevice))
+        return false;
+
+    // Shaders are added to the archive shader cache
+    return UnpackPSOShaders(*pArchiveData, PSO, pDevice);
+}
+
+Uint32 DearchiverBase::Prefetch(const PipelineStatePrefetchInfo& PrefetchInfo)
+{
+    if (!VerifyPipelineStatePrefetchInfo(PrefetchInfo))
+        return 0;
+
+    std::atomic<Uint32> NumPrefetched{0};
+    ParallelFor(PrefetchInfo.pThreadPool, PrefetchInfo.NumNames,
+                [&](Uint32 Idx) {
+                    const char*    Name    = PrefetchInfo.ppNames[Idx];
+                    IRenderDevice* pDevice = PrefetchInfo.pDevice;
+
+                    // PSO names are only unique for each pipeline type, so check all types
+                    bool Found = PrefetchPSOShaders<GraphicsPipelineStateCreateInfo>(Name, pDevice);
+                    Found      = PrefetchPSOShaders<ComputePipelineStateCreateInfo>(Name, pDevice) || Found;
+                    Found      = PrefetchPSOShaders<RayTracingPipelineStateCreateInfo>(Name, pDevice) || Found;
+                    Found      = PrefetchPSOShaders<TilePipelineStateCreateInfo>(Name, pDevice) || Found;
+                    if (Found)
+                        NumPrefetched.fetch_add(1);
+                });
+
+    return NumPrefetched.load();
+}
+
 static bool ModifyShaderDesc(ShaderDesc&             Desc,
                              const ShaderUnpackInfo& UnpackInfo)
 {
@@ -828,34 +927,43 @@ void DearchiverBase::UnpackRenderPass(const RenderPassUnpackInfo& UnpackInfo, IR
     *ppRP = nullptr;
 
     VERIFY_EXPR(UnpackInfo.pDevice != nullptr);
+
+    RefCntAutoPtr<IRenderPass> pRP;
     // Do not cache modified render passes.
     if (UnpackInfo.ModifyRenderPassDesc == nullptr)
     {
         // Since render pass names must be unique, we use a single cache for all
         // loaded archives.
-        if (m_Cache.RenderPass.Get(RPData::ArchiveResType, UnpackInfo.Name, ppRP))
-            return;
+        pRP = m_Cache.RenderPass.GetOrCreate(RPData::ArchiveResType, UnpackInfo.Name,
+                                             [&]() {
+                                                 return CreateRenderPass(UnpackInfo);
+                                             });
+    }
+    else
+    {
+        pRP = CreateRenderPass(UnpackInfo);
     }
 
+    *ppRP = pRP.Detach();
+}
+
+RefCntAutoPtr<IRenderPass> DearchiverBase::CreateRenderPass(const RenderPassUnpackInfo& UnpackInfo)
+{
     // Find the archive that contains this render pass.
     ArchiveData* pArchiveData = FindArchive(RPData::ArchiveResType, UnpackInfo.Name);
     if (pArchiveData == nullptr)
-        return;
-
-    const auto& pObjArchive = pArchiveData->pObjArchive;
-    VERIFY_EXPR(pObjArchive);
+        return {};
 
     RPData RP{GetRawAllocator()};
     if (!pArchiveData->pObjArchive->LoadResourceCommonData(RPData::ArchiveResType, UnpackInfo.Name, RP))
-        return;
+        return {};
 
     if (UnpackInfo.ModifyRenderPassDesc != nullptr)
         UnpackInfo.ModifyRenderPassDesc(RP.Desc, UnpackInfo.pUserData);
 
-    UnpackInfo.pDevice->CreateRenderPass(RP.Desc, ppRP);
-
-    if (UnpackInfo.ModifyRenderPassDesc == nullptr)
-        m_Cache.RenderPass.Set(RPData::ArchiveResType, UnpackInfo.Name, *ppRP);
+    RefCntAutoPtr<IRenderPass> pRP;
+    UnpackInfo.pDevice->CreateRenderPass(RP.Desc, &pRP);
+    return pRP;
 }
 
 bool DearchiverBase::Store(IDataBlob** ppArchive) const
@@ -39,7 +39,7 @@ namespace Diligent
 
 DeviceObjectArchive::DeviceType RenderDeviceTypeToArchiveDeviceType(RENDER_DEVICE_TYPE Type)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Did you add a new render device type? Please handle it here.");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Did you add a new render device type? Please handle it here.");
     switch (Type)
     {
             // clang-format off
@@ -236,55 +236,56 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
     return true;
 }
 
-void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
+template <SerializerMode Mode>
+void DeviceObjectArchive::SerializeImpl(Serializer<Mode>& Ser) const
 {
-    if (ppDataBlob == nullptr)
-    {
-        DEV_ERROR("Pointer to the data blob object must not be null");
-        return;
-    }
-    DEV_CHECK_ERR(*ppDataBlob == nullptr, "Data blob object must be null");
+    const ArchiveSerializer<Mode> ArchiveSer{Ser};
 
-    auto SerializeThis = [this](auto& Ser) {
-        constexpr auto SerMode    = std::remove_reference<decltype(Ser)>::type::GetMode();
-        const auto     ArchiveSer = ArchiveSerializer<SerMode>{Ser};
+    ArchiveHeader Header;
+    Header.ContentVersion = m_ContentVersion;
 
-        ArchiveHeader Header;
-        Header.ContentVersion = m_ContentVersion;
+    auto res = ArchiveSer.SerializeHeader(Header);
+    VERIFY(res, "Failed to serialize header");
 
-        auto res = ArchiveSer.SerializeHeader(Header);
-        VERIFY(res, "Failed to serialize header");
+    Uint32 NumResources = StaticCast<Uint32>(m_NamedResources.size());
+    res                 = Ser(NumResources);
+    VERIFY(res, "Failed to serialize the number of resources");
 
-        Uint32 NumResources = StaticCast<Uint32>(m_NamedResources.size());
-        res                 = Ser(NumResources);
-        VERIFY(res, "Failed to serialize the number of resources");
+    for (const auto& res_it : m_NamedResources)
+    {
+        const char*        Name    = res_it.first.GetName();
+        const ResourceType ResType = res_it.first.GetType();
 
-        for (const auto& res_it : m_NamedResources)
-        {
-            const char*        Name    = res_it.first.GetName();
-            const ResourceType ResType = res_it.first.GetType();
+        res = Ser(ResType, Name);
+        VERIFY(res, "Failed to serialize resource type and name");
 
-            res = Ser(ResType, Name);
-            VERIFY(res, "Failed to serialize resource type and name");
+        res = ArchiveSer.SerializeResourceData(res_it.second);
+        VERIFY(res, "Failed to serialize resource data");
+    }
 
-            res = ArchiveSer.SerializeResourceData(res_it.second);
-            VERIFY(res, "Failed to serialize resource data");
-        }
+    for (const std::vector<SerializedData>& Shaders : m_DeviceShaders)
+    {
+        res = ArchiveSer.SerializeShaders(Shaders);
+        VERIFY(res, "Failed to serialize shaders");
+    }
+}
 
-        for (const std::vector<SerializedData>& Shaders : m_DeviceShaders)
-        {
-            res = ArchiveSer.SerializeShaders(Shaders);
-            VERIFY(res, "Failed to serialize shaders");
-        }
-    };
+void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
+{
+    if (ppDataBlob == nullptr)
+    {
+        DEV_ERROR("Pointer to the data blob object must not be null");
+        return;
+    }
+    DEV_CHECK_ERR(*ppDataBlob == nullptr, "Data blob object must be null");
 
     Serializer<SerializerMode::Measure> Measurer;
-    SerializeThis(Measurer);
+    SerializeImpl(Measurer);
 
     RefCntAutoPtr<DataBlobImpl> pDataBlob = DataBlobImpl::Create(Measurer.GetSize());
 
     Serializer<SerializerMode::Write> Writer{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
-    SerializeThis(Writer);
+    SerializeImpl(Writer);
     VERIFY_EXPR(Writer.IsEnded());
 
     *ppDataBlob = pDataBlob.Detach();
@@ -664,13 +665,23 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
     }
 }
 
-void DeviceObjectArchive::Serialize(IFileStream* pStream) const
+bool DeviceObjectArchive::Serialize(IFileStream* pStream) const
 {
-    DEV_CHECK_ERR(pStream != nullptr, "File stream must not be null");
-    RefCntAutoPtr<IDataBlob> pDataBlob;
-    Serialize(&pDataBlob);
-    VERIFY_EXPR(pDataBlob);
-    pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
+    if (pStream == nullptr)
+    {
+        DEV_ERROR("File stream must not be null");
+        return false;
+    }
+
+    // Serialize the archive in a single pass: every filled chunk is written to the stream
+    // and its memory is reused, so the archive is never fully kept in memory.
+    SerializedDataChunks Chunks{GetRawAllocator(), SerializedDataChunks::DefaultChunkSize, pStream};
+    {
+        Serializer<SerializerMode::Write> Writer{Chunks};
+        SerializeImpl(Writer);
+    }
+
+    return Chunks.IsStreamValid();
 }
 
 } // namespace Diligent
@@ -68,6 +68,7 @@ bool PRSSerializer<Mode>::SerializeDesc(
         return false;
     // skip Name
     // skip SRBAllocationGranularity
+    // skip SRBRecyclePoolSize
 
     if (!Ser.SerializeArray(Allocator, Desc.Resources, Desc.NumResources,
                             [](Serializer<Mode>&                Ser,
@@ -428,6 +428,80 @@ size_t CalculatePipelineResourceSignatureDescHash(const PipelineResourceSignatur
     return Hash;
 }
 
+bool IsShareableImplicitSignatureDesc(const PipelineResourceSignatureDesc& Desc) noexcept
+{
+    for (Uint32 i = 0; i < Desc.NumResources; ++i)
+    {
+        if (Desc.Resources[i].VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+            return false;
+    }
+    return true;
+}
+
+// Processes resources in the order they are stored in the signature (see CopyPipelineResourceSignatureDesc)
+template <typename HandlerType>
+static bool ProcessResourcesInSignatureOrder(const PipelineResourceSignatureDesc& Desc, HandlerType&& Handler)
+{
+    Uint32 ResIdx = 0;
+    for (Uint32 VarType = 0; VarType < SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES; ++VarType)
+    {
+        for (Uint32 i = 0; i < Desc.NumResources; ++i)
+        {
+            const PipelineResourceDesc& Res = Desc.Resources[i];
+            if (Res.VarType == VarType && !Handler(ResIdx++, Res))
+                return false;
+        }
+    }
+    VERIFY_EXPR(ResIdx == Desc.NumResources);
+    return true;
+}
+
+size_t CalculateImplicitSignatureDescHash(const PipelineResourceSignatureDesc& Desc) noexcept
+{
+    size_t Hash = ComputeHash(Desc.NumResources, Desc.NumImmutableSamplers, Desc.BindingIndex, Desc.UseCombinedTextureSamplers, Desc.SRBAllocationGranularity);
+
+    // NB: std::hash of the descriptions hashes string pointers, so we hash strings explicitly
+    ProcessResourcesInSignatureOrder(Desc, [&Hash](Uint32, const PipelineResourceDesc& Res) {
+        HashCombine(Hash, CStringHash<Char>{}(Res.Name), Uint32{Res.ShaderStages}, Res.ArraySize, Uint32{Res.ResourceType}, Uint32{Res.VarType}, Uint32{Res.Flags});
+        return true;
+    });
+
+    for (Uint32 i = 0; i < Desc.NumImmutableSamplers; ++i)
+    {
+        const ImmutableSamplerDesc& Sam = Desc.ImmutableSamplers[i];
+        HashCombine(Hash, CStringHash<Char>{}(Sam.SamplerOrTextureName), Uint32{Sam.ShaderStages}, Sam.Desc);
+    }
+
+    if (Desc.UseCombinedTextureSamplers)
+        HashCombine(Hash, CStringHash<Char>{}(Desc.CombinedSamplerSuffix));
+
+    return Hash;
+}
+
+bool ImplicitSignatureDescMatches(const PipelineResourceSignatureDesc& SignDesc,
+                                  const PipelineResourceSignatureDesc& Desc) noexcept
+{
+    if (SignDesc.NumResources != Desc.NumResources ||
+        SignDesc.NumImmutableSamplers != Desc.NumImmutableSamplers ||
+        SignDesc.BindingIndex != Desc.BindingIndex ||
+        SignDesc.UseCombinedTextureSamplers != Desc.UseCombinedTextureSamplers ||
+        SignDesc.SRBAllocationGranularity != Desc.SRBAllocationGranularity)
+        return false;
+
+    if (Desc.UseCombinedTextureSamplers && !SafeStrEqual(SignDesc.CombinedSamplerSuffix, Desc.CombinedSamplerSuffix))
+        return false;
+
+    for (Uint32 s = 0; s < Desc.NumImmutableSamplers; ++s)
+    {
+        if (!(SignDesc.ImmutableSamplers[s] == Desc.ImmutableSamplers[s]))
+            return false;
+    }
+
+    return ProcessResourcesInSignatureOrder(Desc, [&SignDesc](Uint32 ResIdx, const PipelineResourceDesc& Res) {
+        return SignDesc.Resources[ResIdx] == Res;
+    });
+}
+
 void ReserveSpaceForPipelineResourceSignatureDesc(FixedLinearAllocator& Allocator, const PipelineResourceSignatureDesc& Desc)
 {
     Allocator.AddSpace<PipelineResourceDesc>(Desc.NumResources);
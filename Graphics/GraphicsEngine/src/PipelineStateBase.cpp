@@ -934,6 +934,42 @@ ShaderResourceVariableDesc FindPipelineResourceLayoutVariable(
     return {ShaderStage, Name, LayoutDesc.DefaultVariableType};
 }
 
+ShaderResourceVariableDesc FindPipelineResourceLayoutVariable(
+    const PipelineResourceLayoutDesc& LayoutDesc,
+    const ResourceNameTable&          LayoutVarNames,
+    const char*                       Name,
+    SHADER_TYPE                       ShaderStage,
+    const char*                       CombinedSamplerSuffix)
+{
+    Uint32 VarIndex = ResourceNameTable::InvalidIndex;
+    if (CombinedSamplerSuffix == nullptr)
+    {
+        VarIndex = LayoutVarNames.Find(Name, ShaderStage);
+    }
+    else
+    {
+        // The variable name is the sampler name without the suffix
+        const size_t NameLen = strlen(Name);
+        const size_t SuffLen = strlen(CombinedSamplerSuffix);
+        if (NameLen > SuffLen && strcmp(Name + NameLen - SuffLen, CombinedSamplerSuffix) == 0)
+        {
+            const std::string VarName{Name, NameLen - SuffLen};
+            VarIndex = LayoutVarNames.Find(VarName.c_str(), ShaderStage);
+        }
+    }
+
+    if (VarIndex != ResourceNameTable::InvalidIndex)
+    {
+        VERIFY_EXPR(VarIndex < LayoutDesc.NumVariables);
+        return LayoutDesc.Variables[VarIndex];
+    }
+
+    // Use default properties
+    if (ShaderStage & LayoutDesc.DefaultVariableMergeStages)
+        ShaderStage = LayoutDesc.DefaultVariableMergeStages;
+    return {ShaderStage, Name, LayoutDesc.DefaultVariableType};
+}
+
 
 template <>
 void ValidatePSOCreateInfo<GraphicsPipelineStateCreateInfo>(const IRenderDevice*                   pDevice,
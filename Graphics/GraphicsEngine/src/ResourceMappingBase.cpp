@@ -26,41 +26,152 @@
  */
 
 #include "ResourceMappingImpl.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
 #include "DeviceObjectBase.hpp"
 
 namespace Diligent
 {
 
-ResourceMappingImpl::~ResourceMappingImpl()
+ResourceMappingImpl::ResourceMappingImpl(IReferenceCounters* pRefCounters, IMemoryAllocator& RawMemAllocator) :
+    TObjectBase{pRefCounters},
+    m_RawMemAllocator{RawMemAllocator},
+    m_pSnapshot{std::allocate_shared<Snapshot>(STD_ALLOCATOR_RAW_MEM(Snapshot, RawMemAllocator, "Allocator for ResourceMappingImpl::Snapshot"), RawMemAllocator)}
 {
 }
 
-void ResourceMappingImpl::AddResourceArray(const Char* Name, Uint32 StartIndex, IDeviceObject* const* ppObjects, Uint32 NumElements, bool bIsUnique)
+ResourceMappingImpl::~ResourceMappingImpl() = default;
+
+const ResourceMappingImpl::ResourceEntry* ResourceMappingImpl::FindEntry(const ResourceEntry* Begin,
+                                                                         const ResourceEntry* End,
+                                                                         size_t               NameHash,
+                                                                         const Char*          Name,
+                                                                         Uint32               ArrayIndex) noexcept
 {
-    if (Name == nullptr || *Name == 0)
+    auto it = std::lower_bound(Begin, End, std::make_pair(NameHash, ArrayIndex),
+                               [](const ResourceEntry& Entry, const std::pair<size_t, Uint32>& Key) {
+                                   return Entry.NameHash != Key.first ? Entry.NameHash < Key.first : Entry.ArrayIndex < Key.second;
+                               });
+    for (; it != End && it->NameHash == NameHash && it->ArrayIndex == ArrayIndex; ++it)
+    {
+        if (strcmp(it->Name->c_str(), Name) == 0)
+            return it;
+    }
+    return End;
+}
+
+template <typename ModifierType>
+void ResourceMappingImpl::Modify(ModifierType&& Modifier)
+{
+    std::lock_guard<std::mutex> Lock{m_WriteMtx};
+
+    const SnapshotPtr pCurrSnapshot = std::atomic_load(&m_pSnapshot);
+
+    std::shared_ptr<Snapshot> pNewSnapshot = std::allocate_shared<Snapshot>(STD_ALLOCATOR_RAW_MEM(Snapshot, m_RawMemAllocator, "Allocator for ResourceMappingImpl::Snapshot"), m_RawMemAllocator);
+    if (!Modifier(pCurrSnapshot->Entries, pNewSnapshot->Entries))
         return;
 
-    Threading::SpinLockGuard Guard{m_Lock};
-    for (Uint32 Elem = 0; Elem < NumElements; ++Elem)
-    {
-        IDeviceObject* pObject = ppObjects[Elem];
+    // The replaced snapshot is released by the last reader that references it
+    std::atomic_store(&m_pSnapshot, SnapshotPtr{std::move(pNewSnapshot)});
+}
 
-        // Try to construct new element in place
-        auto Elems = m_HashTable.emplace(ResMappingHashKey{Name, true /*Make copy*/, StartIndex + Elem}, pObject);
-        // If there is already element with the same name, replace it
-        if (!Elems.second && Elems.first->second != pObject)
+void ResourceMappingImpl::AddEntries(NewEntryArrayType& NewEntries, bool bIsUnique)
+{
+    if (NewEntries.empty())
+        return;
+
+    const auto KeyLess = [](size_t Hash0, Uint32 Index0, size_t Hash1, Uint32 Index1) {
+        return Hash0 != Hash1 ? Hash0 < Hash1 : Index0 < Index1;
+    };
+    // The sort must be stable so that the entries with the same name are applied in the original order
+    std::stable_sort(NewEntries.begin(), NewEntries.end(),
+                     [&](const NewEntry& lhs, const NewEntry& rhs) {
+                         return KeyLess(lhs.NameHash, lhs.ArrayIndex, rhs.NameHash, rhs.ArrayIndex);
+                     });
+
+    Modify([&](const EntryArrayType& CurrEntries, EntryArrayType& Entries) {
+        Entries.reserve(CurrEntries.size() + NewEntries.size());
+
+        bool    Modified = false;
+        NamePtr pLastName;
+
+        auto curr_it = CurrEntries.begin();
+        auto new_it  = NewEntries.begin();
+        while (new_it != NewEntries.end())
         {
-            if (bIsUnique)
+            // Copy all current entries that precede the next new entry
+            while (curr_it != CurrEntries.end() && KeyLess(curr_it->NameHash, curr_it->ArrayIndex, new_it->NameHash, new_it->ArrayIndex))
+                Entries.push_back(*curr_it++);
+
+            // All entries with the same name hash and array index form a group that is searched by name
+            const size_t GroupStart = Entries.size();
+            for (; curr_it != CurrEntries.end() && curr_it->NameHash == new_it->NameHash && curr_it->ArrayIndex == new_it->ArrayIndex; ++curr_it)
+                Entries.push_back(*curr_it);
+
+            const size_t Hash  = new_it->NameHash;
+            const Uint32 Index = new_it->ArrayIndex;
+            for (; new_it != NewEntries.end() && new_it->NameHash == Hash && new_it->ArrayIndex == Index; ++new_it)
             {
-                UNEXPECTED("Resource with the same name already exists");
-                LOG_WARNING_MESSAGE(
-                    "Resource with name ", Name,
-                    " marked is unique, but already present in the hash.\n"
-                    "New resource will be used\n.");
+                auto it = std::find_if(Entries.begin() + GroupStart, Entries.end(),
+                                       [&](const ResourceEntry& Entry) { return strcmp(Entry.Name->c_str(), new_it->Name) == 0; });
+                if (it != Entries.end())
+                {
+                    // If there is already element with the same name, replace it
+                    if (it->pObject != new_it->pObject)
+                    {
+                        if (bIsUnique)
+                        {
+                            UNEXPECTED("Resource with the same name already exists");
+                            LOG_WARNING_MESSAGE(
+                                "Resource with name ", new_it->Name,
+                                " marked is unique, but already present in the hash.\n"
+                                "New resource will be used\n.");
+                        }
+                        it->pObject = new_it->pObject;
+                        Modified    = true;
+                    }
+                    continue;
+                }
+
+                // Array elements are sorted next to each other, so they share the name
+                if (!pLastName || strcmp(pLastName->c_str(), new_it->Name) != 0)
+                    pLastName = std::allocate_shared<String>(STD_ALLOCATOR_RAW_MEM(String, m_RawMemAllocator, "Allocator for ResourceMappingImpl resource name"), new_it->Name);
+
+                ResourceEntry Entry;
+                Entry.NameHash   = new_it->NameHash;
+                Entry.ArrayIndex = new_it->ArrayIndex;
+                Entry.Name       = pLastName;
+                Entry.pObject    = new_it->pObject;
+                Entries.emplace_back(std::move(Entry));
+                Modified = true;
             }
-            Elems.first->second = pObject;
         }
+        Entries.insert(Entries.end(), curr_it, CurrEntries.end());
+
+        return Modified;
+    });
+}
+
+void ResourceMappingImpl::AddResourceArray(const Char* Name, Uint32 StartIndex, IDeviceObject* const* ppObjects, Uint32 NumElements, bool bIsUnique)
+{
+    if (Name == nullptr || *Name == 0)
+        return;
+
+    const size_t NameHash = HashMapStringKey{Name}.GetHash();
+
+    NewEntryArrayType NewEntries(NumElements, NewEntry{}, STD_ALLOCATOR_RAW_MEM(NewEntry, m_RawMemAllocator, "Allocator for vector<NewEntry>"));
+    for (Uint32 Elem = 0; Elem < NumElements; ++Elem)
+    {
+        NewEntry& Entry  = NewEntries[Elem];
+        Entry.NameHash   = NameHash;
+        Entry.ArrayIndex = StartIndex + Elem;
+        Entry.Name       = Name;
+        Entry.pObject    = ppObjects[Elem];
     }
+    AddEntries(NewEntries, bIsUnique);
 }
 
 void ResourceMappingImpl::AddResource(const Char* Name, IDeviceObject* pObject, bool bIsUnique)
@@ -68,15 +179,47 @@ void ResourceMappingImpl::AddResource(const Char* Name, IDeviceObject* pObject,
     AddResourceArray(Name, 0, &pObject, 1, bIsUnique);
 }
 
+void ResourceMappingImpl::AddResources(const ResourceMappingEntry* pEntries, Uint32 NumEntries, bool bIsUnique)
+{
+    if (pEntries == nullptr || NumEntries == 0)
+        return;
+
+    NewEntryArrayType NewEntries(STD_ALLOCATOR_RAW_MEM(NewEntry, m_RawMemAllocator, "Allocator for vector<NewEntry>"));
+    NewEntries.reserve(NumEntries);
+    for (Uint32 i = 0; i < NumEntries; ++i)
+    {
+        const ResourceMappingEntry& Src = pEntries[i];
+        if (Src.Name == nullptr || *Src.Name == 0)
+            continue;
+
+        NewEntry Entry;
+        Entry.NameHash   = HashMapStringKey{Src.Name}.GetHash();
+        Entry.ArrayIndex = Src.ArrayIndex;
+        Entry.Name       = Src.Name;
+        Entry.pObject    = Src.pObject;
+        NewEntries.push_back(Entry);
+    }
+    AddEntries(NewEntries, bIsUnique);
+}
+
 void ResourceMappingImpl::RemoveResourceByName(const Char* Name, Uint32 ArrayIndex)
 {
     if (*Name == 0)
         return;
 
-    Threading::SpinLockGuard Guard{m_Lock};
-    // Remove object with the given name
-    // Name will be implicitly converted to HashMapStringKey without making a copy
-    m_HashTable.erase(ResMappingHashKey{Name, false, ArrayIndex});
+    const HashMapStringKey Key{Name};
+    Modify([&](const EntryArrayType& CurrEntries, EntryArrayType& NewEntries) {
+        const ResourceEntry* pBegin = CurrEntries.data();
+        const ResourceEntry* pEnd   = pBegin + CurrEntries.size();
+        const ResourceEntry* pEntry = FindEntry(pBegin, pEnd, Key.GetHash(), Name, ArrayIndex);
+        if (pEntry == pEnd)
+            return false;
+
+        NewEntries.reserve(CurrEntries.size() - 1);
+        NewEntries.insert(NewEntries.end(), pBegin, pEntry);
+        NewEntries.insert(NewEntries.end(), pEntry + 1, pEnd);
+        return true;
+    });
 }
 
 IDeviceObject* ResourceMappingImpl::GetResource(const Char* Name, Uint32 ArrayIndex)
@@ -87,16 +230,43 @@ IDeviceObject* ResourceMappingImpl::GetResource(const Char* Name, Uint32 ArrayIn
         return nullptr;
     }
 
-    Threading::SpinLockGuard Guard{m_Lock};
-
-    // Find an object with the requested name
-    auto It = m_HashTable.find(ResMappingHashKey{Name, false, ArrayIndex});
-    return It != m_HashTable.end() ? It->second.RawPtr() : nullptr;
+    SnapshotReader Reader{*this};
+    return Reader.GetResource(Name, ArrayIndex);
 }
 
 size_t ResourceMappingImpl::GetSize()
 {
-    return m_HashTable.size();
+    SnapshotReader Reader{*this};
+    return Reader.GetSize();
+}
+
+ResourceMappingImpl::SnapshotReader::SnapshotReader(const ResourceMappingImpl& Mapping) noexcept :
+    m_pSnapshot{std::atomic_load(&Mapping.m_pSnapshot)}
+{
+}
+
+IDeviceObject* ResourceMappingImpl::SnapshotReader::GetResource(const HashMapStringKey& Name, Uint32 ArrayIndex) const noexcept
+{
+    const ResourceEntry* pBegin = m_pSnapshot->Entries.data();
+    const ResourceEntry* pEnd   = pBegin + m_pSnapshot->Entries.size();
+    const ResourceEntry* pEntry = FindEntry(pBegin, pEnd, Name.GetHash(), Name.GetStr(), ArrayIndex);
+    return pEntry != pEnd ? pEntry->pObject.RawPtr() : nullptr;
+}
+
+IDeviceObject* ResourceMappingImpl::SnapshotReader::SortedLookup::GetResource(size_t NameHash, const Char* Name, Uint32 ArrayIndex) noexcept
+{
+#ifdef DILIGENT_DEBUG
+    VERIFY(NameHash >= m_DbgLastHash, "Name hashes must be non-decreasing");
+    m_DbgLastHash = NameHash;
+#endif
+
+    // Move to the first entry with this hash. The cursor is not advanced past the entries with the
+    // same hash, so that all array elements and all names with the same hash can be found.
+    m_pCurr = std::lower_bound(m_pCurr, m_pEnd, NameHash,
+                               [](const ResourceEntry& Entry, size_t Hash) { return Entry.NameHash < Hash; });
+
+    const ResourceEntry* pEntry = FindEntry(m_pCurr, m_pEnd, NameHash, Name, ArrayIndex);
+    return pEntry != m_pEnd ? pEntry->pObject.RawPtr() : nullptr;
 }
 
 } // namespace Diligent
@@ -199,7 +199,8 @@ public:
     IShaderResourceVariable* GetVariable(const Char* Name) const;
     IShaderResourceVariable* GetVariable(Uint32 Index) const;
 
-    IObject& GetOwner() { return m_Owner; }
+    IObject& GetOwner() { return *m_pOwner; }
+    void     SetOwner(IObject& Owner) { m_pOwner = &Owner; }
 
     Uint32 GetVariableCount() const;
 
@@ -140,6 +140,10 @@ public:
 
     void InitSRBResourceCache(ShaderResourceCacheD3D12& ResourceCache);
 
+    // SRBs copy descriptors directly into their shader-visible descriptor heap allocations,
+    // so the data of a destroyed SRB may only be reused when the GPU is done with the descriptors.
+    void EnqueueRecycledSRBData(SRBDataType* pData);
+
     void CopyStaticResources(ShaderResourceCacheD3D12& ResourceCache) const;
     // Make the base class method visible
     using TPipelineResourceSignatureBase::CopyStaticResources;
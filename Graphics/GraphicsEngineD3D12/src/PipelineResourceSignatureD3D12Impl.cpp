@@ -372,6 +372,12 @@ PipelineResourceSignatureD3D12Impl::~PipelineResourceSignatureD3D12Impl()
     Destruct();
 }
 
+void PipelineResourceSignatureD3D12Impl::EnqueueRecycledSRBData(SRBDataType* pData)
+{
+    // An SRB may be used by any immediate context
+    GetDevice()->SafeReleaseDeviceObject(DeferredSRBDataRecycler{this, pData}, ~0ull);
+}
+
 void PipelineResourceSignatureD3D12Impl::InitSRBResourceCache(ShaderResourceCacheD3D12& ResourceCache)
 {
     ResourceCache.Initialize(m_SRBMemAllocator.GetResourceCacheDataAllocator(0), m_pDevice, m_RootParams);
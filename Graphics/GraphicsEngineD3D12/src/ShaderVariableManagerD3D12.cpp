@@ -135,13 +135,7 @@ const ShaderVariableManagerD3D12::ResourceAttribs& ShaderVariableManagerD3D12::G
 
 ShaderVariableD3D12Impl* ShaderVariableManagerD3D12::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableD3D12Impl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return FindVariable(Name);
 }
 
 
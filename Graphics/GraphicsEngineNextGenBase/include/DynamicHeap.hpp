@@ -30,6 +30,7 @@
 /// \file
 /// Defines dynamic heap utilities
 
+#include <algorithm>
 #include <mutex>
 #include <deque>
 #include <vector>
@@ -122,51 +123,69 @@ public:
         DEV_CHECK_ERR(m_MasterBlockCounter == 0, m_MasterBlockCounter, " master block(s) have not been returned to the manager");
     }
 
+    // Releases the blocks used by a context during the frame. All blocks are wrapped into a single
+    // stale object, so the release queue and the manager are locked once per batch rather than
+    // once per block.
     template <typename RenderDeviceImplType>
     void ReleaseMasterBlocks(std::vector<MasterBlock>& Blocks, RenderDeviceImplType& Device, Uint64 CmdQueueMask)
     {
-        struct StaleMasterBlock
+        if (Blocks.empty())
+            return;
+
+        struct StaleMasterBlocks
         {
-            MasterBlock                  Block;
+            std::vector<MasterBlock>     Blocks;
             MasterBlockListBasedManager* Mgr;
 
             // clang-format off
-            StaleMasterBlock(MasterBlock&& _Block, MasterBlockListBasedManager* _Mgr)noexcept :
-                Block {std::move(_Block)},
-                Mgr   {_Mgr             }
+            StaleMasterBlocks(std::vector<MasterBlock>&& _Blocks, MasterBlockListBasedManager* _Mgr)noexcept :
+                Blocks{std::move(_Blocks)},
+                Mgr   {_Mgr              }
             {
             }
 
-            StaleMasterBlock            (const StaleMasterBlock&)  = delete;
-            StaleMasterBlock& operator= (const StaleMasterBlock&)  = delete;
-            StaleMasterBlock& operator= (      StaleMasterBlock&&) = delete;
+            StaleMasterBlocks            (const StaleMasterBlocks&)  = delete;
+            StaleMasterBlocks& operator= (const StaleMasterBlocks&)  = delete;
+            StaleMasterBlocks& operator= (      StaleMasterBlocks&&) = delete;
 
-            StaleMasterBlock(StaleMasterBlock&& rhs)noexcept :
-                Block {std::move(rhs.Block)},
-                Mgr   {rhs.Mgr             }
+            StaleMasterBlocks(StaleMasterBlocks&& rhs)noexcept :
+                Blocks{std::move(rhs.Blocks)},
+                Mgr   {rhs.Mgr              }
             {
-                rhs.Block = MasterBlock{};
-                rhs.Mgr   = nullptr;
+                rhs.Blocks.clear();
+                rhs.Mgr = nullptr;
             }
             // clang-format on
 
-            ~StaleMasterBlock()
+            ~StaleMasterBlocks()
             {
                 if (Mgr != nullptr)
-                {
-                    std::lock_guard<std::mutex> Lock{Mgr->m_AllocationsMgrMtx};
-#ifdef DILIGENT_DEVELOPMENT
-                    --Mgr->m_MasterBlockCounter;
-#endif
-                    Mgr->m_AllocationsMgr.Free(std::move(Block));
-                }
+                    Mgr->FreeMasterBlocks(Blocks);
             }
         };
+#ifdef DILIGENT_DEVELOPMENT
+        for (const MasterBlock& Block : Blocks)
+            DEV_CHECK_ERR(Block.IsValid(), "Attempting to release invalid master block");
+#endif
+        Device.SafeReleaseDeviceObject(StaleMasterBlocks{std::move(Blocks), this}, CmdQueueMask);
+        Blocks.clear();
+    }
+
+    // Immediately returns the blocks to the manager. The blocks must not be in use by the GPU.
+    void FreeMasterBlocks(std::vector<MasterBlock>& Blocks)
+    {
+        if (Blocks.empty())
+            return;
+
+        std::lock_guard<std::mutex> Lock{m_AllocationsMgrMtx};
         for (MasterBlock& Block : Blocks)
         {
-            DEV_CHECK_ERR(Block.IsValid(), "Attempting to release invalid master block");
-            Device.SafeReleaseDeviceObject(StaleMasterBlock{std::move(Block), this}, CmdQueueMask);
+#ifdef DILIGENT_DEVELOPMENT
+            --m_MasterBlockCounter;
+#endif
+            m_AllocationsMgr.Free(std::move(Block));
         }
+        Blocks.clear();
     }
 
     // clang-format off
@@ -195,6 +214,26 @@ protected:
         return NewBlock;
     }
 
+    // Allocates up to NumBlocks blocks of the same size under a single lock and appends them to Blocks.
+    // Returns the number of allocated blocks, which is less than NumBlocks if the manager runs out of space.
+    Uint32 AllocateMasterBlocks(OffsetType SizeInBytes, OffsetType Alignment, Uint32 NumBlocks, std::vector<MasterBlock>& Blocks)
+    {
+        std::lock_guard<std::mutex> Lock{m_AllocationsMgrMtx};
+
+        Uint32 NumAllocated = 0;
+        for (; NumAllocated < NumBlocks; ++NumAllocated)
+        {
+            MasterBlock NewBlock = m_AllocationsMgr.Allocate(SizeInBytes, Alignment);
+            if (!NewBlock.IsValid())
+                break;
+            Blocks.emplace_back(std::move(NewBlock));
+        }
+#ifdef DILIGENT_DEVELOPMENT
+        m_MasterBlockCounter += static_cast<Int32>(NumAllocated);
+#endif
+        return NumAllocated;
+    }
+
 private:
     std::mutex                     m_AllocationsMgrMtx;
     VariableSizeAllocationsManager m_AllocationsMgr;
@@ -204,6 +243,91 @@ private:
 #endif
 };
 
+
+// Per-context cache of fixed-size master blocks. The cache requests blocks from the manager
+// in batches of BatchSize, so the manager mutex is locked once per batch instead of once per
+// block. Blocks that were used during the frame are released by the owner through
+// MasterBlockListBasedManager::ReleaseMasterBlocks(); blocks remaining in the cache have never
+// been used by the GPU and are kept for the next frame. The cache never holds more than BatchSize
+// blocks. The owner calls EndFrame() at the end of every frame: if no blocks were taken from the
+// cache during the frame, the owner is idle and the cached blocks are returned to the manager,
+// so that idle contexts do not hold space other contexts may need.
+// The cache is not thread-safe: every context must use its own instance.
+//
+// ManagerType must provide AllocateMasterBlocks() and FreeMasterBlocks() with the same
+// semantics as MasterBlockListBasedManager.
+template <typename ManagerType>
+class MasterBlockCache
+{
+public:
+    using OffsetType  = typename ManagerType::OffsetType;
+    using MasterBlock = typename ManagerType::MasterBlock;
+
+    MasterBlockCache(ManagerType& Mgr, OffsetType BlockSize, OffsetType BlockAlignment, Uint32 BatchSize) :
+        m_Mgr{Mgr},
+        m_BlockSize{BlockSize},
+        m_BlockAlignment{BlockAlignment},
+        m_BatchSize{std::max(BatchSize, 1u)}
+    {
+        m_Blocks.reserve(m_BatchSize);
+    }
+
+    // clang-format off
+    MasterBlockCache            (const MasterBlockCache&)  = delete;
+    MasterBlockCache            (      MasterBlockCache&&) = delete;
+    MasterBlockCache& operator= (const MasterBlockCache&)  = delete;
+    MasterBlockCache& operator= (      MasterBlockCache&&) = delete;
+    // clang-format on
+
+    ~MasterBlockCache()
+    {
+        Flush();
+    }
+
+    // Returns all cached blocks to the manager
+    void Flush()
+    {
+        m_Mgr.FreeMasterBlocks(m_Blocks);
+    }
+
+    // Keeps the cached blocks for the next frame unless the cache was not used during this frame
+    void EndFrame()
+    {
+        if (m_NumAllocationsInFrame == 0)
+            Flush();
+        m_NumAllocationsInFrame = 0;
+    }
+
+    // Returns a block of BlockSize bytes aligned by BlockAlignment, or an invalid block if the manager is out of space
+    MasterBlock Allocate()
+    {
+        if (m_Blocks.empty())
+        {
+            m_Mgr.AllocateMasterBlocks(m_BlockSize, m_BlockAlignment, m_BatchSize, m_Blocks);
+            if (m_Blocks.empty())
+                return MasterBlock{};
+
+            // Hand out blocks in address order
+            std::reverse(m_Blocks.begin(), m_Blocks.end());
+        }
+
+        MasterBlock Block = std::move(m_Blocks.back());
+        m_Blocks.pop_back();
+        ++m_NumAllocationsInFrame;
+        return Block;
+    }
+
+    size_t GetCachedBlockCount() const { return m_Blocks.size(); }
+
+private:
+    ManagerType&             m_Mgr;
+    const OffsetType         m_BlockSize;
+    const OffsetType         m_BlockAlignment;
+    const Uint32             m_BatchSize;
+    std::vector<MasterBlock> m_Blocks;
+    Uint32                   m_NumAllocationsInFrame = 0;
+};
+
 } // namespace DynamicHeap
 
 } // namespace Diligent
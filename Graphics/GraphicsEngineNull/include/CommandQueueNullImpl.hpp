@@ -0,0 +1,72 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::CommandQueueNullImpl class
+
+#include <atomic>
+
+#include "EngineNullImplTraits.hpp"
+#include "ObjectBase.hpp"
+
+namespace Diligent
+{
+
+/// Implementation of the Diligent::ICommandQueueNull interface.
+
+/// There is no GPU timeline: every submitted command buffer is complete
+/// as soon as it has been submitted.
+class CommandQueueNullImpl final : public ObjectBase<ICommandQueueNull>
+{
+public:
+    using TBase = ObjectBase<ICommandQueueNull>;
+
+    CommandQueueNullImpl(IReferenceCounters* pRefCounters) :
+        TBase{pRefCounters}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_CommandQueueNull, TBase)
+
+    /// Implementation of ICommandQueue::GetNextFenceValue().
+    virtual Uint64 DILIGENT_CALL_TYPE GetNextFenceValue() const override final { return m_NextFenceValue.load(); }
+
+    /// Implementation of ICommandQueue::GetCompletedFenceValue().
+    virtual Uint64 DILIGENT_CALL_TYPE GetCompletedFenceValue() override final { return m_NextFenceValue.load() - 1; }
+
+    /// Implementation of ICommandQueue::WaitForIdle().
+    virtual Uint64 DILIGENT_CALL_TYPE WaitForIdle() override final { return m_NextFenceValue.load() - 1; }
+
+    /// Implementation of ICommandQueueNull::Submit().
+    virtual Uint64 DILIGENT_CALL_TYPE Submit() override final { return m_NextFenceValue.fetch_add(1); }
+
+private:
+    // A value that will be associated with the next submitted command buffer
+    std::atomic<Uint64> m_NextFenceValue{1};
+};
+
+} // namespace Diligent
@@ -0,0 +1,349 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::DeviceContextNullImpl class
+
+#include <array>
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "DeviceContextNextGenBase.hpp"
+#include "BufferNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "FramebufferNullImpl.hpp"
+#include "RenderPassNullImpl.hpp"
+
+namespace Diligent
+{
+
+/// Device context implementation in Null backend.
+
+/// The context runs the same validation, state caching, resource binding and state
+/// tracking as other backends, but instead of recording GPU commands it only counts them.
+/// Data transfer operations (buffer and texture updates, copies and mapping) are executed
+/// immediately on the CPU copies of the resources.
+class DeviceContextNullImpl final : public DeviceContextNextGenBase<EngineNullImplTraits>
+{
+public:
+    using TDeviceContextBase = DeviceContextNextGenBase<EngineNullImplTraits>;
+
+    DeviceContextNullImpl(IReferenceCounters*      pRefCounters,
+                          RenderDeviceNullImpl*    pDevice,
+                          const DeviceContextDesc& Desc);
+    ~DeviceContextNullImpl();
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DeviceContext, TDeviceContextBase)
+
+    /// Implementation of IDeviceContext::Begin() in Null backend.
+    void DILIGENT_CALL_TYPE Begin(Uint32 ImmediateContextId) override final;
+
+    /// Implementation of IDeviceContext::SetPipelineState() in Null backend.
+    void DILIGENT_CALL_TYPE SetPipelineState(IPipelineState* pPipelineState) override final;
+
+    /// Implementation of IDeviceContext::TransitionShaderResources() in Null backend.
+    void DILIGENT_CALL_TYPE TransitionShaderResources(IShaderResourceBinding* pShaderResourceBinding) override final;
+
+    /// Implementation of IDeviceContext::CommitShaderResources() in Null backend.
+    void DILIGENT_CALL_TYPE CommitShaderResources(IShaderResourceBinding*        pShaderResourceBinding,
+                                                  RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::SetStencilRef() in Null backend.
+    void DILIGENT_CALL_TYPE SetStencilRef(Uint32 StencilRef) override final;
+
+    /// Implementation of IDeviceContext::SetBlendFactors() in Null backend.
+    void DILIGENT_CALL_TYPE SetBlendFactors(const float* pBlendFactors = nullptr) override final;
+
+    /// Implementation of IDeviceContext::SetVertexBuffers() in Null backend.
+    void DILIGENT_CALL_TYPE SetVertexBuffers(Uint32                         StartSlot,
+                                             Uint32                         NumBuffersSet,
+                                             IBuffer* const*                ppBuffers,
+                                             const Uint64*                  pOffsets,
+                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                             SET_VERTEX_BUFFERS_FLAGS       Flags) override final;
+
+    /// Implementation of IDeviceContext::InvalidateState() in Null backend.
+    void DILIGENT_CALL_TYPE InvalidateState() override final;
+
+    /// Implementation of IDeviceContext::SetIndexBuffer() in Null backend.
+    void DILIGENT_CALL_TYPE SetIndexBuffer(IBuffer*                       pIndexBuffer,
+                                           Uint64                         ByteOffset,
+                                           RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::SetViewports() in Null backend.
+    void DILIGENT_CALL_TYPE SetViewports(Uint32          NumViewports,
+                                         const Viewport* pViewports,
+                                         Uint32          RTWidth,
+                                         Uint32          RTHeight) override final;
+
+    /// Implementation of IDeviceContext::SetScissorRects() in Null backend.
+    void DILIGENT_CALL_TYPE SetScissorRects(Uint32      NumRects,
+                                            const Rect* pRects,
+                                            Uint32      RTWidth,
+                                            Uint32      RTHeight) override final;
+
+    /// Implementation of IDeviceContext::SetRenderTargetsExt() in Null backend.
+    void DILIGENT_CALL_TYPE SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::BeginRenderPass() in Null backend.
+    void DILIGENT_CALL_TYPE BeginRenderPass(const BeginRenderPassAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::NextSubpass() in Null backend.
+    void DILIGENT_CALL_TYPE NextSubpass() override final;
+
+    /// Implementation of IDeviceContext::EndRenderPass() in Null backend.
+    void DILIGENT_CALL_TYPE EndRenderPass() override final;
+
+    /// Implementation of IDeviceContext::Draw() in Null backend.
+    void DILIGENT_CALL_TYPE Draw(const DrawAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DrawIndexed() in Null backend.
+    void DILIGENT_CALL_TYPE DrawIndexed(const DrawIndexedAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DrawIndirect() in Null backend.
+    void DILIGENT_CALL_TYPE DrawIndirect(const DrawIndirectAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DrawIndexedIndirect() in Null backend.
+    void DILIGENT_CALL_TYPE DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DrawMesh() in Null backend.
+    void DILIGENT_CALL_TYPE DrawMesh(const DrawMeshAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DrawMeshIndirect() in Null backend.
+    void DILIGENT_CALL_TYPE DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::MultiDraw() in Null backend.
+    void DILIGENT_CALL_TYPE MultiDraw(const MultiDrawAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::MultiDrawIndexed() in Null backend.
+    void DILIGENT_CALL_TYPE MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DispatchCompute() in Null backend.
+    void DILIGENT_CALL_TYPE DispatchCompute(const DispatchComputeAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::DispatchComputeIndirect() in Null backend.
+    void DILIGENT_CALL_TYPE DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::ClearDepthStencil() in Null backend.
+    void DILIGENT_CALL_TYPE ClearDepthStencil(ITextureView*                  pView,
+                                              CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                              float                          fDepth,
+                                              Uint8                          Stencil,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::ClearRenderTarget() in Null backend.
+    void DILIGENT_CALL_TYPE ClearRenderTarget(ITextureView*                  pView,
+                                              const void*                    RGBA,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::UpdateBuffer() in Null backend.
+    void DILIGENT_CALL_TYPE UpdateBuffer(IBuffer*                       pBuffer,
+                                         Uint64                         Offset,
+                                         Uint64                         Size,
+                                         const void*                    pData,
+                                         RESOURCE_STATE_TRANSITION_MODE StateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::CopyBuffer() in Null backend.
+    void DILIGENT_CALL_TYPE CopyBuffer(IBuffer*                       pSrcBuffer,
+                                       Uint64                         SrcOffset,
+                                       RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                       IBuffer*                       pDstBuffer,
+                                       Uint64                         DstOffset,
+                                       Uint64                         Size,
+                                       RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::MapBuffer() in Null backend.
+    void DILIGENT_CALL_TYPE MapBuffer(IBuffer*  pBuffer,
+                                      MAP_TYPE  MapType,
+                                      MAP_FLAGS MapFlags,
+                                      PVoid&    pMappedData) override final;
+
+    /// Implementation of IDeviceContext::UnmapBuffer() in Null backend.
+    void DILIGENT_CALL_TYPE UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType) override final;
+
+    /// Implementation of IDeviceContext::UpdateTexture() in Null backend.
+    void DILIGENT_CALL_TYPE UpdateTexture(ITexture*                      pTexture,
+                                          Uint32                         MipLevel,
+                                          Uint32                         Slice,
+                                          const Box&                     DstBox,
+                                          const TextureSubResData&       SubresData,
+                                          RESOURCE_STATE_TRANSITION_MODE SrcBufferStateTransitionMode,
+                                          RESOURCE_STATE_TRANSITION_MODE TextureStateTransitionMode) override final;
+
+    /// Implementation of IDeviceContext::CopyTexture() in Null backend.
+    void DILIGENT_CALL_TYPE CopyTexture(const CopyTextureAttribs& CopyAttribs) override final;
+
+    /// Implementation of IDeviceContext::MapTextureSubresource() in Null backend.
+    void DILIGENT_CALL_TYPE MapTextureSubresource(ITexture*                 pTexture,
+                                                  Uint32                    MipLevel,
+                                                  Uint32                    ArraySlice,
+                                                  MAP_TYPE                  MapType,
+                                                  MAP_FLAGS                 MapFlags,
+                                                  const Box*                pMapRegion,
+                                                  MappedTextureSubresource& MappedData) override final;
+
+    /// Implementation of IDeviceContext::UnmapTextureSubresource() in Null backend.
+    void DILIGENT_CALL_TYPE UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice) override final;
+
+    /// Implementation of IDeviceContext::FinishCommandList() in Null backend.
+    void DILIGENT_CALL_TYPE FinishCommandList(ICommandList** ppCommandList) override final;
+
+    /// Implementation of IDeviceContext::ExecuteCommandLists() in Null backend.
+    void DILIGENT_CALL_TYPE ExecuteCommandLists(Uint32               NumCommandLists,
+                                                ICommandList* const* ppCommandLists) override final;
+
+    /// Implementation of IDeviceContext::EnqueueSignal() in Null backend.
+    void DILIGENT_CALL_TYPE EnqueueSignal(IFence* pFence, Uint64 Value) override final;
+
+    /// Implementation of IDeviceContext::DeviceWaitForFence() in Null backend.
+    void DILIGENT_CALL_TYPE DeviceWaitForFence(IFence* pFence, Uint64 Value) override final;
+
+    /// Implementation of IDeviceContext::WaitForIdle() in Null backend.
+    void DILIGENT_CALL_TYPE WaitForIdle() override final;
+
+    /// Implementation of IDeviceContext::BeginQuery() in Null backend.
+    void DILIGENT_CALL_TYPE BeginQuery(IQuery* pQuery) override final;
+
+    /// Implementation of IDeviceContext::EndQuery() in Null backend.
+    void DILIGENT_CALL_TYPE EndQuery(IQuery* pQuery) override final;
+
+    /// Implementation of IDeviceContext::Flush() in Null backend.
+    void DILIGENT_CALL_TYPE Flush() override final;
+
+    /// Implementation of IDeviceContext::BuildBLAS() in Null backend.
+    void DILIGENT_CALL_TYPE BuildBLAS(const BuildBLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::BuildTLAS() in Null backend.
+    void DILIGENT_CALL_TYPE BuildTLAS(const BuildTLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::CopyBLAS() in Null backend.
+    void DILIGENT_CALL_TYPE CopyBLAS(const CopyBLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::CopyTLAS() in Null backend.
+    void DILIGENT_CALL_TYPE CopyTLAS(const CopyTLASAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::WriteBLASCompactedSize() in Null backend.
+    void DILIGENT_CALL_TYPE WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::WriteTLASCompactedSize() in Null backend.
+    void DILIGENT_CALL_TYPE WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::TraceRays() in Null backend.
+    void DILIGENT_CALL_TYPE TraceRays(const TraceRaysAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::TraceRaysIndirect() in Null backend.
+    void DILIGENT_CALL_TYPE TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::UpdateSBT() in Null backend.
+    void DILIGENT_CALL_TYPE UpdateSBT(IShaderBindingTable* pSBT, const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs) override final;
+
+    /// Implementation of IDeviceContext::BeginDebugGroup() in Null backend.
+    void DILIGENT_CALL_TYPE BeginDebugGroup(const Char* Name, const float* pColor) override final;
+
+    /// Implementation of IDeviceContext::EndDebugGroup() in Null backend.
+    void DILIGENT_CALL_TYPE EndDebugGroup() override final;
+
+    /// Implementation of IDeviceContext::InsertDebugLabel() in Null backend.
+    void DILIGENT_CALL_TYPE InsertDebugLabel(const Char* Label, const float* pColor) override final;
+
+    /// Implementation of IDeviceContext::SetShadingRate() in Null backend.
+    void DILIGENT_CALL_TYPE SetShadingRate(SHADING_RATE          BaseRate,
+                                           SHADING_RATE_COMBINER PrimitiveCombiner,
+                                           SHADING_RATE_COMBINER TextureCombiner) override final;
+
+    /// Implementation of IDeviceContext::BindSparseResourceMemory() in Null backend.
+    void DILIGENT_CALL_TYPE BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContext::GenerateMips() in Null backend.
+    void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView) override final;
+
+    /// Implementation of IDeviceContext::FinishFrame() in Null backend.
+    void DILIGENT_CALL_TYPE FinishFrame() override final;
+
+    /// Implementation of IDeviceContext::TransitionResourceStates() in Null backend.
+    void DILIGENT_CALL_TYPE TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers) override final;
+
+    /// Implementation of IDeviceContext::ResolveTextureSubresource() in Null backend.
+    void DILIGENT_CALL_TYPE ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                      ITexture*                               pDstTexture,
+                                                      const ResolveTextureSubresourceAttribs& ResolveAttribs) override final;
+
+    void TransitionOrVerifyBufferState(BufferNullImpl&                Buffer,
+                                       RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                       RESOURCE_STATE                 RequiredState,
+                                       const char*                    OperationName);
+
+    void TransitionOrVerifyTextureState(TextureNullImpl&               Texture,
+                                        RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                        RESOURCE_STATE                 RequiredState,
+                                        const char*                    OperationName);
+
+    /// Returns the number of commands recorded since the last flush or FinishCommandList()
+    Uint32 GetNumCommandsInCtx() const { return m_NumCommands; }
+
+private:
+    void Flush(Uint32               NumCommandLists,
+               ICommandList* const* ppCommandLists);
+
+    void TransitionResourceState(IDeviceObject& Resource, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateState);
+
+    void TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE StateTransitionMode);
+
+    void PrepareForDraw(DRAW_FLAGS Flags);
+    void PrepareForIndexedDraw(DRAW_FLAGS Flags);
+    void PrepareForDispatchCompute();
+    void PrepareIndirectAttribsBuffer(IBuffer* pAttribsBuffer, RESOURCE_STATE_TRANSITION_MODE TransitionMode, const char* OpName);
+
+    using ResourceBindInfo = CommittedShaderResources;
+
+    ResourceBindInfo& GetBindInfo(PIPELINE_TYPE Type);
+
+    void CommitBindings(ResourceBindInfo& BindInfo, DRAW_FLAGS Flags);
+
+#ifdef DILIGENT_DEVELOPMENT
+    void DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo);
+#endif
+
+private:
+    // Number of commands recorded since the last flush
+    Uint32 m_NumCommands = 0;
+
+    static constexpr Uint32 NUM_PIPELINE_BIND_POINTS = 2;
+
+    std::array<ResourceBindInfo, NUM_PIPELINE_BIND_POINTS> m_BindInfo;
+
+    FixedBlockMemoryAllocator m_CmdListAllocator;
+
+    std::vector<std::pair<Uint64, RefCntAutoPtr<FenceNullImpl>>> m_SignalFences;
+};
+
+} // namespace Diligent
@@ -0,0 +1,95 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineStateNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "PipelineStateBase.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "ShaderNullImpl.hpp"
+
+namespace Diligent
+{
+
+/// Pipeline state object implementation in Null backend.
+
+/// Graphics and compute pipelines are supported. Since Null shaders carry no reflection,
+/// the implicit resource signature only contains the immutable samplers of the resource
+/// layout; pipelines that use resources should be created with explicit signatures.
+class PipelineStateNullImpl final : public PipelineStateBase<EngineNullImplTraits>
+{
+public:
+    using TPipelineStateBase = PipelineStateBase<EngineNullImplTraits>;
+
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0xc1ab7acd, 0x22f9, 0x4c3d, {0xa8, 0x24, 0x4e, 0x8f, 0xd3, 0x3b, 0xf1, 0x71}};
+
+    PipelineStateNullImpl(IReferenceCounters*                    pRefCounters,
+                          RenderDeviceNullImpl*                  pDevice,
+                          const GraphicsPipelineStateCreateInfo& CreateInfo);
+
+    PipelineStateNullImpl(IReferenceCounters*                   pRefCounters,
+                          RenderDeviceNullImpl*                 pDevice,
+                          const ComputePipelineStateCreateInfo& CreateInfo);
+
+    ~PipelineStateNullImpl() override;
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_InternalImpl, TPipelineStateBase)
+
+    void Destruct();
+
+    struct ShaderStageInfo
+    {
+        const SHADER_TYPE     Type;
+        ShaderNullImpl* const pShader;
+
+        ShaderStageInfo(ShaderNullImpl* _pShader) :
+            Type{_pShader->GetDesc().ShaderType},
+            pShader{_pShader}
+        {}
+
+        friend SHADER_TYPE GetShaderStageType(const ShaderStageInfo& Stage) { return Stage.Type; }
+
+        friend std::vector<const ShaderNullImpl*> GetStageShaders(const ShaderStageInfo& Stage) { return {Stage.pShader}; }
+    };
+    using TShaderStages = std::vector<ShaderStageInfo>;
+
+private:
+    friend TPipelineStateBase; // TPipelineStateBase::Construct needs access to InitializePipeline
+
+    template <typename PSOCreateInfoType>
+    void InitInternalObjects(const PSOCreateInfoType& CreateInfo);
+
+    void InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo);
+    void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
+};
+
+} // namespace Diligent
@@ -0,0 +1,126 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::ShaderResourceCacheNull class
+
+#include <memory>
+
+#include "ShaderResourceCacheCommon.hpp"
+#include "PipelineResourceAttribsNull.hpp"
+#include "STDAllocator.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+struct IMemoryAllocator;
+class DeviceContextNullImpl;
+
+/// Shader resource cache of the Null backend.
+
+/// The cache is a single flat array of resources. Resources are only recorded
+/// so that binding costs and state validation match other backends; nothing is ever
+/// written to a descriptor.
+class ShaderResourceCacheNull : public ShaderResourceCacheBase
+{
+public:
+    explicit ShaderResourceCacheNull(ResourceCacheContentType ContentType) noexcept :
+        m_ContentType{ContentType}
+    {}
+
+    // clang-format off
+    ShaderResourceCacheNull           (const ShaderResourceCacheNull&)  = delete;
+    ShaderResourceCacheNull& operator=(const ShaderResourceCacheNull&)  = delete;
+    ShaderResourceCacheNull           (      ShaderResourceCacheNull&&) = delete;
+    ShaderResourceCacheNull& operator=(      ShaderResourceCacheNull&&) = delete;
+    // clang-format on
+
+    ~ShaderResourceCacheNull();
+
+    static size_t GetRequiredMemorySize(Uint32 NumResources);
+
+    void Initialize(IMemoryAllocator& MemAllocator, Uint32 NumResources);
+    void InitializeResources(Uint32 Offset, Uint32 ArraySize, SHADER_RESOURCE_TYPE Type);
+
+    struct Resource
+    {
+        // clang-format off
+/* 0 */ SHADER_RESOURCE_TYPE         Type                = SHADER_RESOURCE_TYPE_UNKNOWN;
+/* 1 */ bool                         IsDynamicBuffer     = false;
+/*2-3*/ // Unused
+/* 4 */ Uint32                       BufferDynamicOffset = 0;
+/* 8 */ RefCntAutoPtr<IDeviceObject> pObject;
+
+        // For constant buffers only
+/*16 */ Uint64                       BufferBaseOffset = 0;
+/*24 */ Uint64                       BufferRangeSize  = 0;
+        // clang-format on
+
+        explicit operator bool() const { return pObject != nullptr; }
+    };
+
+    const Resource& GetResource(Uint32 CacheOffset) const
+    {
+        VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+        return m_pResources[CacheOffset];
+    }
+
+    const Resource& SetResource(Uint32                       CacheOffset,
+                                RefCntAutoPtr<IDeviceObject> pObject,
+                                Uint64                       BufferBaseOffset = 0,
+                                Uint64                       BufferRangeSize  = 0);
+
+    const Resource& ResetResource(Uint32 CacheOffset)
+    {
+        return SetResource(CacheOffset, {});
+    }
+
+    void SetDynamicBufferOffset(Uint32 CacheOffset, Uint32 DynamicBufferOffset);
+
+    Uint32 GetNumResources() const { return m_NumResources; }
+    bool   HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
+
+    ResourceCacheContentType GetContentType() const { return m_ContentType; }
+
+    template <bool VerifyOnly>
+    void TransitionResources(DeviceContextNullImpl* pCtxNullImpl);
+
+private:
+    std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
+
+    Resource* m_pResources   = nullptr;
+    Uint32    m_NumResources = 0;
+
+    // The number of buffers created with USAGE_DYNAMIC that are bound in the cache
+    Uint32 m_NumDynamicBuffers = 0;
+
+    const ResourceCacheContentType m_ContentType;
+};
+
+} // namespace Diligent
@@ -0,0 +1,79 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::TextureNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "TextureBase.hpp"
+#include "TextureViewNullImpl.hpp" // Required by TextureBase
+
+namespace Diligent
+{
+
+/// Texture implementation in Null backend.
+
+/// All subresources are stored in a single system-memory block using the
+/// staging texture layout (see GetStagingTextureLocationOffset()).
+class TextureNullImpl final : public TextureBase<EngineNullImplTraits>
+{
+public:
+    using TTextureBase = TextureBase<EngineNullImplTraits>;
+
+    /// Alignment of each subresource in the texture memory
+    static constexpr Uint32 SubresourceAlignment = 16;
+
+    TextureNullImpl(IReferenceCounters*        pRefCounters,
+                    FixedBlockMemoryAllocator& TexViewObjAllocator,
+                    RenderDeviceNullImpl*      pDevice,
+                    const TextureDesc&         Desc,
+                    const TextureData*         pInitData,
+                    bool                       bIsDeviceInternal);
+
+    /// Implementation of ITexture::GetNativeHandle() in Null backend.
+    Uint64 DILIGENT_CALL_TYPE GetNativeHandle() override final;
+
+    /// Returns the layout of the given subresource region in texture memory.
+    MappedTextureSubresource GetRegion(Uint32 MipLevel, Uint32 Slice, const Box& Region);
+
+    /// Copies the data to the given subresource region.
+    void WriteRegion(Uint32 MipLevel, Uint32 Slice, const Box& Region, const void* pSrcData, Uint64 SrcStride, Uint64 SrcDepthStride);
+
+    /// Fills the given subresource with zeroes.
+    void ClearSubresource(Uint32 MipLevel, Uint32 Slice);
+
+private:
+    void CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView) override;
+
+private:
+    std::vector<Uint8> m_Data;
+};
+
+} // namespace Diligent
@@ -0,0 +1,74 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ICommandQueueNull interface
+
+#include "../../GraphicsEngine/interface/CommandQueue.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {F6AF4348-0756-473E-A3BA-DFDA7D014F84}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_CommandQueueNull =
+    {0xf6af4348, 0x756, 0x473e, {0xa3, 0xba, 0xdf, 0xda, 0x7d, 0x1, 0x4f, 0x84}};
+
+#define DILIGENT_INTERFACE_NAME ICommandQueueNull
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define ICommandQueueNullInclusiveMethods \
+    ICommandQueueInclusiveMethods;        \
+    ICommandQueueNullMethods CommandQueueNull
+
+// clang-format off
+
+/// Command queue interface of the Null backend
+DILIGENT_BEGIN_INTERFACE(ICommandQueueNull, ICommandQueue)
+{
+    /// Submits an (empty) command buffer to the command queue.
+
+    /// Null command queue has no GPU timeline: the submitted work is complete
+    /// as soon as this method returns.
+    ///
+    /// \return Fence value associated with the submitted command buffer
+    VIRTUAL Uint64 METHOD(Submit)(THIS) PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define ICommandQueueNull_Submit(This) CALL_IFACE_METHOD(CommandQueueNull, Submit, This)
+
+// clang-format on
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
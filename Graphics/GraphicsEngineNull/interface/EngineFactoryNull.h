@@ -0,0 +1,139 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of functions that initialize the Null (headless) engine implementation
+
+#include "../../GraphicsEngine/interface/EngineFactory.h"
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+
+#if PLATFORM_LINUX || PLATFORM_MACOS || (PLATFORM_WIN32 && !defined(_MSC_VER))
+// https://gcc.gnu.org/wiki/Visibility
+#    define API_QUALIFIER __attribute__((visibility("default")))
+#elif PLATFORM_WIN32
+#    define API_QUALIFIER
+#else
+#    error Unsupported platform
+#endif
+
+#if DILIGENT_NULL_SHARED && PLATFORM_WIN32 && defined(_MSC_VER)
+#    include "../../GraphicsEngine/interface/LoadEngineDll.h"
+#    define DILIGENT_NULL_EXPLICIT_LOAD 1
+#endif
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+// {03588C10-C25D-4390-B560-A0A230B5DCA8}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_EngineFactoryNull =
+    {0x03588c10, 0xc25d, 0x4390, {0xb5, 0x60, 0xa0, 0xa2, 0x30, 0xb5, 0xdc, 0xa8}};
+
+#define DILIGENT_INTERFACE_NAME IEngineFactoryNull
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IEngineFactoryNullInclusiveMethods \
+    IEngineFactoryInclusiveMethods;        \
+    IEngineFactoryNullMethods EngineFactoryNull
+
+// clang-format off
+
+/// Engine factory for the Null rendering backend.
+
+/// The Null backend does not talk to any GPU or graphics API. It runs the complete
+/// engine-side object model (validation, state tracking, resource binding, resource
+/// lifetime management) and discards the resulting commands. It is intended for
+/// measuring the CPU-side overhead of the engine and for headless testing.
+DILIGENT_BEGIN_INTERFACE(IEngineFactoryNull, IEngineFactory)
+{
+    /// Creates a render device and device contexts for the Null engine implementation.
+
+    /// \param [in] EngineCI    - Engine creation info.
+    /// \param [out] ppDevice   - Address of the memory location where pointer to
+    ///                           the created device will be written.
+    /// \param [out] ppContexts - Address of the memory location where pointers to
+    ///                           the contexts will be written. Immediate contexts go first
+    ///                           (EngineCI.NumImmediateContexts, at least one). If EngineCI.NumDeferredContexts > 0,
+    ///                           pointers to deferred contexts are written afterwards.
+    VIRTUAL void METHOD(CreateDeviceAndContextsNull)(THIS_
+                                                     const EngineCreateInfo REF EngineCI,
+                                                     IRenderDevice**            ppDevice,
+                                                     IDeviceContext**           ppContexts) PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define IEngineFactoryNull_CreateDeviceAndContextsNull(This, ...) CALL_IFACE_METHOD(EngineFactoryNull, CreateDeviceAndContextsNull, This, __VA_ARGS__)
+
+// clang-format on
+
+#endif
+
+
+typedef struct IEngineFactoryNull* (*GetEngineFactoryNullType)();
+
+#if DILIGENT_NULL_EXPLICIT_LOAD
+
+inline GetEngineFactoryNullType DILIGENT_GLOBAL_FUNCTION(LoadGraphicsEngineNull)()
+{
+    static GetEngineFactoryNullType GetFactoryFunc = NULL;
+    if (GetFactoryFunc == NULL)
+    {
+        GetFactoryFunc = (GetEngineFactoryNullType)LoadEngineDll("GraphicsEngineNull", "GetEngineFactoryNull");
+    }
+    return GetFactoryFunc;
+}
+
+#else
+
+API_QUALIFIER
+struct IEngineFactoryNull* DILIGENT_GLOBAL_FUNCTION(GetEngineFactoryNull)();
+
+#endif
+
+/// Loads the graphics engine Null implementation DLL if necessary and returns the engine factory.
+inline struct IEngineFactoryNull* DILIGENT_GLOBAL_FUNCTION(LoadAndGetEngineFactoryNull)()
+{
+    GetEngineFactoryNullType GetFactoryFunc = NULL;
+#if DILIGENT_NULL_EXPLICIT_LOAD
+    GetFactoryFunc = DILIGENT_GLOBAL_FUNCTION(LoadGraphicsEngineNull)();
+    if (GetFactoryFunc == NULL)
+    {
+        return NULL;
+    }
+#else
+    GetFactoryFunc = DILIGENT_GLOBAL_FUNCTION(GetEngineFactoryNull);
+#endif
+    return GetFactoryFunc();
+}
+
+DILIGENT_END_NAMESPACE // namespace Diligent
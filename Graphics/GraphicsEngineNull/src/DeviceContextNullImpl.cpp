@@ -0,0 +1,945 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "DeviceContextNullImpl.hpp"
+
+#include <cstring>
+
+#include "RenderDeviceNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "CommandListNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+DeviceContextNullImpl::DeviceContextNullImpl(IReferenceCounters*      pRefCounters,
+                                             RenderDeviceNullImpl*    pDevice,
+                                             const DeviceContextDesc& Desc) :
+    // clang-format off
+    TDeviceContextBase
+    {
+        pRefCounters,
+        pDevice,
+        Desc
+    },
+    m_CmdListAllocator{GetRawAllocator(), sizeof(CommandListNullImpl), 64}
+// clang-format on
+{
+}
+
+DeviceContextNullImpl::~DeviceContextNullImpl()
+{
+    if (m_NumCommands != 0)
+    {
+        if (IsDeferred())
+            LOG_ERROR_MESSAGE("There are outstanding commands in deferred context #", GetContextId(),
+                              " being destroyed, which indicates that FinishCommandList() has not been called.");
+        else
+            LOG_ERROR_MESSAGE("There are outstanding commands in the immediate context being destroyed, "
+                              "which indicates that Flush() has not been called.");
+    }
+}
+
+void DeviceContextNullImpl::Begin(Uint32 ImmediateContextId)
+{
+    DEV_CHECK_ERR(ImmediateContextId < m_pDevice->GetCommandQueueCount(), "ImmediateContextId is out of range");
+    // All queues in Null backend are graphics queues
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+}
+
+DeviceContextNullImpl::ResourceBindInfo& DeviceContextNullImpl::GetBindInfo(PIPELINE_TYPE Type)
+{
+    // Graphics and mesh pipelines share the same bind point, same as in other backends
+    return m_BindInfo[Type == PIPELINE_TYPE_COMPUTE ? 1 : 0];
+}
+
+void DeviceContextNullImpl::SetPipelineState(IPipelineState* pPipelineState)
+{
+    if (!TDeviceContextBase::SetPipelineState(pPipelineState, PipelineStateNullImpl::IID_InternalImpl))
+        return;
+
+    const PipelineStateDesc& PSODesc = m_pPipelineState->GetDesc();
+    ++m_NumCommands;
+
+    ResourceBindInfo& BindInfo              = GetBindInfo(PSODesc.PipelineType);
+    Uint32            DvpCompatibleSRBCount = 0;
+    PrepareCommittedResources(BindInfo, DvpCompatibleSRBCount);
+    // Commit all SRBs when PSO changes
+    BindInfo.StaleSRBMask |= BindInfo.ActiveSRBMask;
+}
+
+void DeviceContextNullImpl::TransitionShaderResources(IShaderResourceBinding* pShaderResourceBinding)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Shader resource transitions are not allowed in deferred contexts");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass.");
+    DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "Shader resource binding must not be null");
+
+    ShaderResourceBindingNullImpl* pResBindingNullImpl = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+    ShaderResourceCacheNull&       ResourceCache       = pResBindingNullImpl->GetResourceCache();
+
+    ResourceCache.TransitionResources<false>(this);
+}
+
+void DeviceContextNullImpl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    DeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
+
+    ShaderResourceBindingNullImpl* pResBindingNullImpl = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+    ShaderResourceCacheNull&       ResourceCache       = pResBindingNullImpl->GetResourceCache();
+    if (ResourceCache.GetNumResources() == 0)
+        return;
+
+    if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        ResourceCache.TransitionResources<false>(this);
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        ResourceCache.TransitionResources<true>(this);
+    }
+#endif
+
+    const Uint32 SRBIndex = pResBindingNullImpl->GetBindingIndex();
+    GetBindInfo(pResBindingNullImpl->GetPipelineType()).Set(SRBIndex, pResBindingNullImpl);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetStencilRef(Uint32 StencilRef)
+{
+    if (TDeviceContextBase::SetStencilRef(StencilRef, 0))
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetBlendFactors(const float* pBlendFactors)
+{
+    if (TDeviceContextBase::SetBlendFactors(pBlendFactors, 0))
+        ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetVertexBuffers(Uint32                         StartSlot,
+                                             Uint32                         NumBuffersSet,
+                                             IBuffer* const*                ppBuffers,
+                                             const Uint64*                  pOffsets,
+                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                             SET_VERTEX_BUFFERS_FLAGS       Flags)
+{
+    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+    for (Uint32 Buff = 0; Buff < m_NumVertexStreams; ++Buff)
+    {
+        if (BufferNullImpl* pBufferNull = m_VertexStreams[Buff].pBuffer)
+        {
+            TransitionOrVerifyBufferState(*pBufferNull, StateTransitionMode, RESOURCE_STATE_VERTEX_BUFFER,
+                                          "Setting vertex buffers (DeviceContextNullImpl::SetVertexBuffers)");
+        }
+    }
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::InvalidateState()
+{
+    if (m_NumCommands != 0)
+        LOG_WARNING_MESSAGE("Invalidating context that has outstanding commands in it. Call Flush() to submit commands for execution");
+
+    TDeviceContextBase::InvalidateState();
+    m_BindInfo = {};
+}
+
+void DeviceContextNullImpl::SetIndexBuffer(IBuffer* pIndexBuffer, Uint64 ByteOffset, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+    if (m_pIndexBuffer)
+    {
+        TransitionOrVerifyBufferState(*m_pIndexBuffer, StateTransitionMode, RESOURCE_STATE_INDEX_BUFFER,
+                                      "Binding buffer as index buffer (DeviceContextNullImpl::SetIndexBuffer)");
+    }
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    if (m_pBoundDepthStencil)
+    {
+        const bool           bReadOnly = m_pBoundDepthStencil->GetDesc().ViewType == TEXTURE_VIEW_READ_ONLY_DEPTH_STENCIL;
+        const RESOURCE_STATE NewState  = bReadOnly ? RESOURCE_STATE_DEPTH_READ : RESOURCE_STATE_DEPTH_WRITE;
+        TransitionOrVerifyTextureState(*m_pBoundDepthStencil->GetTexture<TextureNullImpl>(), StateTransitionMode, NewState,
+                                       "Binding depth-stencil buffer (DeviceContextNullImpl::TransitionRenderTargets)");
+    }
+
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets; ++rt)
+    {
+        if (TextureViewNullImpl* pRTVNull = m_pBoundRenderTargets[rt])
+        {
+            TransitionOrVerifyTextureState(*pRTVNull->GetTexture<TextureNullImpl>(), StateTransitionMode, RESOURCE_STATE_RENDER_TARGET,
+                                           "Binding render targets (DeviceContextNullImpl::TransitionRenderTargets)");
+        }
+    }
+}
+
+void DeviceContextNullImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Calling SetRenderTargets inside active render pass is invalid. End the render pass first");
+
+    if (TDeviceContextBase::SetRenderTargets(Attribs))
+    {
+        // Set the viewport to match the render target size
+        SetViewports(1, nullptr, 0, 0);
+        ++m_NumCommands;
+    }
+
+    TransitionRenderTargets(Attribs.StateTransitionMode);
+}
+
+void DeviceContextNullImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    TDeviceContextBase::BeginRenderPass(Attribs);
+
+    VERIFY_EXPR(m_pActiveRenderPass != nullptr);
+    VERIFY_EXPR(m_pBoundFramebuffer != nullptr);
+
+    // Set the viewport to match the framebuffer size
+    SetViewports(1, nullptr, 0, 0);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::NextSubpass()
+{
+    TDeviceContextBase::NextSubpass();
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::EndRenderPass()
+{
+    TDeviceContextBase::EndRenderPass();
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::CommitBindings(ResourceBindInfo& BindInfo, DRAW_FLAGS Flags)
+{
+    // There are no descriptor sets to bind in Null backend, so committing the
+    // resources only amounts to marking the SRBs as up-to-date.
+    if (const Uint32 CommitMask = BindInfo.GetCommitMask((Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT) != 0))
+    {
+        BindInfo.StaleSRBMask &= static_cast<ResourceBindInfo::SRBMaskType>(~CommitMask);
+        ++m_NumCommands;
+    }
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources(BindInfo);
+#endif
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void DeviceContextNullImpl::DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo)
+{
+    if (BindInfo.ResourcesValidated)
+        return;
+
+    DvpVerifySRBCompatibility(BindInfo);
+
+    BindInfo.ResourcesValidated = true;
+}
+#endif
+
+void DeviceContextNullImpl::PrepareForDraw(DRAW_FLAGS Flags)
+{
+#ifdef DILIGENT_DEVELOPMENT
+    DvpVerifyRenderTargets();
+
+    if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
+    {
+        for (Uint32 slot = 0; slot < m_NumVertexStreams; ++slot)
+        {
+            if (BufferNullImpl* pBufferNull = m_VertexStreams[slot].pBuffer)
+            {
+                DvpVerifyBufferState(*pBufferNull, RESOURCE_STATE_VERTEX_BUFFER, "Using vertex buffers (DeviceContextNullImpl::Draw)");
+            }
+        }
+    }
+#endif
+
+    CommitBindings(GetBindInfo(PIPELINE_TYPE_GRAPHICS), Flags);
+}
+
+void DeviceContextNullImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags)
+{
+    PrepareForDraw(Flags);
+
+#ifdef DILIGENT_DEVELOPMENT
+    if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
+    {
+        DvpVerifyBufferState(*m_pIndexBuffer, RESOURCE_STATE_INDEX_BUFFER, "Indexed draw call (DeviceContextNullImpl::DrawIndexed)");
+    }
+#endif
+}
+
+void DeviceContextNullImpl::PrepareForDispatchCompute()
+{
+    CommitBindings(GetBindInfo(PIPELINE_TYPE_COMPUTE), DRAW_FLAG_NONE);
+}
+
+void DeviceContextNullImpl::PrepareIndirectAttribsBuffer(IBuffer*                       pAttribsBuffer,
+                                                         RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                         const char*                    OpName)
+{
+    DEV_CHECK_ERR(pAttribsBuffer, "Indirect draw attribs buffer must not be null");
+    TransitionOrVerifyBufferState(*ClassPtrCast<BufferNullImpl>(pAttribsBuffer), TransitionMode, RESOURCE_STATE_INDIRECT_ARGUMENT, OpName);
+}
+
+void DeviceContextNullImpl::Draw(const DrawAttribs& Attribs)
+{
+    TDeviceContextBase::Draw(Attribs, 0);
+
+    PrepareForDraw(Attribs.Flags);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndexed(Attribs, 0);
+
+    PrepareForIndexedDraw(Attribs.Flags);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndirect(Attribs, 0);
+
+    PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Indirect draw (DeviceContextNullImpl::DrawIndirect)");
+    if (Attribs.pCounterBuffer != nullptr)
+        PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Count buffer (DeviceContextNullImpl::DrawIndirect)");
+
+    PrepareForDraw(Attribs.Flags);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
+
+    PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Indirect draw (DeviceContextNullImpl::DrawIndexedIndirect)");
+    if (Attribs.pCounterBuffer != nullptr)
+        PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Count buffer (DeviceContextNullImpl::DrawIndexedIndirect)");
+
+    PrepareForIndexedDraw(Attribs.Flags);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawMesh(const DrawMeshAttribs& Attribs)
+{
+    TDeviceContextBase::DrawMesh(Attribs, 0);
+
+    PrepareForDraw(Attribs.Flags);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawMeshIndirect(Attribs, 0);
+
+    PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Indirect draw (DeviceContextNullImpl::DrawMeshIndirect)");
+    if (Attribs.pCounterBuffer != nullptr)
+        PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Counter buffer (DeviceContextNullImpl::DrawMeshIndirect)");
+
+    PrepareForDraw(Attribs.Flags);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    TDeviceContextBase::MultiDraw(Attribs, 0);
+
+    PrepareForDraw(Attribs.Flags);
+    m_NumCommands += Attribs.DrawCount;
+}
+
+void DeviceContextNullImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
+
+    PrepareForIndexedDraw(Attribs.Flags);
+    m_NumCommands += Attribs.DrawCount;
+}
+
+void DeviceContextNullImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
+{
+    TDeviceContextBase::DispatchCompute(Attribs, 0);
+
+    PrepareForDispatchCompute();
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
+
+    PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Indirect dispatch (DeviceContextNullImpl::DispatchComputeIndirect)");
+    PrepareForDispatchCompute();
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::ClearDepthStencil(ITextureView*                  pView,
+                                              CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                              float                          fDepth,
+                                              Uint8                          Stencil,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearDepthStencil(pView);
+
+    TextureViewNullImpl* pViewNull = ClassPtrCast<TextureViewNullImpl>(pView);
+    if (pViewNull != m_pBoundDepthStencil)
+    {
+        // Clearing a depth buffer that is not bound as attachment requires the copy destination state
+        TransitionOrVerifyTextureState(*pViewNull->GetTexture<TextureNullImpl>(), StateTransitionMode, RESOURCE_STATE_COPY_DEST,
+                                       "Clearing depth-stencil buffer outside of render pass (DeviceContextNullImpl::ClearDepthStencil)");
+    }
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::ClearRenderTarget(ITextureView* pView, const void* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearRenderTarget(pView);
+
+    TextureViewNullImpl* pViewNull = ClassPtrCast<TextureViewNullImpl>(pView);
+
+    bool IsBound = false;
+    for (Uint32 rt = 0; rt < m_NumBoundRenderTargets && !IsBound; ++rt)
+        IsBound = m_pBoundRenderTargets[rt] == pViewNull;
+
+    if (!IsBound)
+    {
+        TransitionOrVerifyTextureState(*pViewNull->GetTexture<TextureNullImpl>(), StateTransitionMode, RESOURCE_STATE_COPY_DEST,
+                                       "Clearing render target outside of render pass (DeviceContextNullImpl::ClearRenderTarget)");
+    }
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::UpdateBuffer(IBuffer*                       pBuffer,
+                                         Uint64                         Offset,
+                                         Uint64                         Size,
+                                         const void*                    pData,
+                                         RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::UpdateBuffer(pBuffer, Offset, Size, pData, StateTransitionMode);
+
+    BufferNullImpl* pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    TransitionOrVerifyBufferState(*pBufferNull, StateTransitionMode, RESOURCE_STATE_COPY_DEST, "Updating buffer (DeviceContextNullImpl::UpdateBuffer)");
+
+    memcpy(pBufferNull->GetData() + Offset, pData, StaticCast<size_t>(Size));
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
+                                       Uint64                         SrcOffset,
+                                       RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                       IBuffer*                       pDstBuffer,
+                                       Uint64                         DstOffset,
+                                       Uint64                         Size,
+                                       RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
+
+    BufferNullImpl* pSrcBufferNull = ClassPtrCast<BufferNullImpl>(pSrcBuffer);
+    BufferNullImpl* pDstBufferNull = ClassPtrCast<BufferNullImpl>(pDstBuffer);
+    TransitionOrVerifyBufferState(*pSrcBufferNull, SrcBufferTransitionMode, RESOURCE_STATE_COPY_SOURCE, "Using resource as copy source (DeviceContextNullImpl::CopyBuffer)");
+    TransitionOrVerifyBufferState(*pDstBufferNull, DstBufferTransitionMode, RESOURCE_STATE_COPY_DEST, "Using resource as copy destination (DeviceContextNullImpl::CopyBuffer)");
+
+    // Source and destination may be the same buffer
+    memmove(pDstBufferNull->GetData() + DstOffset, pSrcBufferNull->GetData() + SrcOffset, StaticCast<size_t>(Size));
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAGS MapFlags, PVoid& pMappedData)
+{
+    TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
+
+    // All buffer contents live in system memory, so the data is always immediately available.
+    pMappedData = ClassPtrCast<BufferNullImpl>(pBuffer)->GetData();
+}
+
+void DeviceContextNullImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
+{
+    TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
+}
+
+void DeviceContextNullImpl::UpdateTexture(ITexture*                      pTexture,
+                                          Uint32                         MipLevel,
+                                          Uint32                         Slice,
+                                          const Box&                     DstBox,
+                                          const TextureSubResData&       SubresData,
+                                          RESOURCE_STATE_TRANSITION_MODE SrcBufferStateTransitionMode,
+                                          RESOURCE_STATE_TRANSITION_MODE TextureStateTransitionMode)
+{
+    TDeviceContextBase::UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresData, SrcBufferStateTransitionMode, TextureStateTransitionMode);
+
+    TextureNullImpl* pTexNull = ClassPtrCast<TextureNullImpl>(pTexture);
+    TransitionOrVerifyTextureState(*pTexNull, TextureStateTransitionMode, RESOURCE_STATE_COPY_DEST, "Updating texture (DeviceContextNullImpl::UpdateTexture)");
+
+    const void* pSrcData = SubresData.pData;
+    if (SubresData.pSrcBuffer != nullptr)
+    {
+        BufferNullImpl* pSrcBufferNull = ClassPtrCast<BufferNullImpl>(SubresData.pSrcBuffer);
+        TransitionOrVerifyBufferState(*pSrcBufferNull, SrcBufferStateTransitionMode, RESOURCE_STATE_COPY_SOURCE, "Using buffer as copy source (DeviceContextNullImpl::UpdateTexture)");
+        pSrcData = pSrcBufferNull->GetData() + SubresData.SrcOffset;
+    }
+
+    pTexNull->WriteRegion(MipLevel, Slice, DstBox, pSrcData, SubresData.Stride, SubresData.DepthStride);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
+{
+    TDeviceContextBase::CopyTexture(CopyAttribs);
+
+    TextureNullImpl* pSrcTexNull = ClassPtrCast<TextureNullImpl>(CopyAttribs.pSrcTexture);
+    TextureNullImpl* pDstTexNull = ClassPtrCast<TextureNullImpl>(CopyAttribs.pDstTexture);
+
+    // We must unbind the textures from framebuffer because we will transition their states.
+    UnbindTextureFromFramebuffer(pSrcTexNull, true);
+    UnbindTextureFromFramebuffer(pDstTexNull, true);
+
+    const TextureDesc& SrcTexDesc = pSrcTexNull->GetDesc();
+    const TextureDesc& DstTexDesc = pDstTexNull->GetDesc();
+    if (SrcTexDesc.Usage == USAGE_STAGING)
+        DEV_CHECK_ERR(pSrcTexNull->GetState() == RESOURCE_STATE_COPY_SOURCE, "Source staging texture must permanently be in RESOURCE_STATE_COPY_SOURCE state");
+    else
+        TransitionOrVerifyTextureState(*pSrcTexNull, CopyAttribs.SrcTextureTransitionMode, RESOURCE_STATE_COPY_SOURCE, "Using texture as copy source (DeviceContextNullImpl::CopyTexture)");
+
+    if (DstTexDesc.Usage == USAGE_STAGING)
+        DEV_CHECK_ERR(pDstTexNull->GetState() == RESOURCE_STATE_COPY_DEST, "Destination staging texture must permanently be in RESOURCE_STATE_COPY_DEST state");
+    else
+        TransitionOrVerifyTextureState(*pDstTexNull, CopyAttribs.DstTextureTransitionMode, RESOURCE_STATE_COPY_DEST, "Using texture as copy destination (DeviceContextNullImpl::CopyTexture)");
+
+    Box SrcBox;
+    if (CopyAttribs.pSrcBox != nullptr)
+    {
+        SrcBox = *CopyAttribs.pSrcBox;
+    }
+    else
+    {
+        const MipLevelProperties MipProps = GetMipLevelProperties(SrcTexDesc, CopyAttribs.SrcMipLevel);
+
+        SrcBox.MaxX = MipProps.LogicalWidth;
+        SrcBox.MaxY = MipProps.LogicalHeight;
+        SrcBox.MaxZ = MipProps.Depth;
+    }
+
+    Box DstBox;
+    DstBox.MinX = CopyAttribs.DstX;
+    DstBox.MinY = CopyAttribs.DstY;
+    DstBox.MinZ = CopyAttribs.DstZ;
+    DstBox.MaxX = DstBox.MinX + SrcBox.Width();
+    DstBox.MaxY = DstBox.MinY + std::max(SrcBox.Height(), 1u);
+    DstBox.MaxZ = DstBox.MinZ + std::max(SrcBox.Depth(), 1u);
+
+    // All textures use the same memory layout, so the copy is a plain strided memory copy
+    const MappedTextureSubresource SrcRegion = pSrcTexNull->GetRegion(CopyAttribs.SrcMipLevel, CopyAttribs.SrcSlice, SrcBox);
+    pDstTexNull->WriteRegion(CopyAttribs.DstMipLevel, CopyAttribs.DstSlice, DstBox, SrcRegion.pData, SrcRegion.Stride, SrcRegion.DepthStride);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::MapTextureSubresource(ITexture*                 pTexture,
+                                                  Uint32                    MipLevel,
+                                                  Uint32                    ArraySlice,
+                                                  MAP_TYPE                  MapType,
+                                                  MAP_FLAGS                 MapFlags,
+                                                  const Box*                pMapRegion,
+                                                  MappedTextureSubresource& MappedData)
+{
+    TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
+
+    TextureNullImpl* pTexNull = ClassPtrCast<TextureNullImpl>(pTexture);
+
+    Box FullMipBox;
+    if (pMapRegion == nullptr)
+    {
+        const MipLevelProperties MipProps = GetMipLevelProperties(pTexNull->GetDesc(), MipLevel);
+
+        FullMipBox.MaxX = MipProps.LogicalWidth;
+        FullMipBox.MaxY = MipProps.LogicalHeight;
+        FullMipBox.MaxZ = MipProps.Depth;
+        pMapRegion      = &FullMipBox;
+    }
+
+    MappedData = pTexNull->GetRegion(MipLevel, ArraySlice, *pMapRegion);
+}
+
+void DeviceContextNullImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
+{
+    TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
+}
+
+void DeviceContextNullImpl::FinishCommandList(ICommandList** ppCommandList)
+{
+    DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+
+    CommandListNullImpl* pCmdListNull{NEW_RC_OBJ(m_CmdListAllocator, "CommandListNullImpl instance", CommandListNullImpl)(m_pDevice, this, m_NumCommands)};
+    pCmdListNull->QueryInterface(IID_CommandList, ppCommandList);
+
+    m_NumCommands    = 0;
+    m_pPipelineState = nullptr;
+
+    InvalidateState();
+
+    TDeviceContextBase::FinishCommandList();
+}
+
+void DeviceContextNullImpl::ExecuteCommandLists(Uint32               NumCommandLists,
+                                                ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
+
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    Flush(NumCommandLists, ppCommandLists);
+
+    InvalidateState();
+}
+
+void DeviceContextNullImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
+    m_SignalFences.emplace_back(Value, ClassPtrCast<FenceNullImpl>(pFence));
+}
+
+void DeviceContextNullImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::DeviceWaitForFence(pFence, Value, 0);
+
+    // There is no GPU timeline, so the wait is satisfied only if the fence has already been signaled.
+    FenceNullImpl* pFenceNull = ClassPtrCast<FenceNullImpl>(pFence);
+    pFenceNull->DvpDeviceWait(Value);
+    DEV_CHECK_ERR(pFenceNull->GetCompletedValue() >= Value, "Waiting for fence '", pFenceNull->GetDesc().Name, "' value ", Value,
+                  " that has not been signaled. This will deadlock on a real device.");
+}
+
+void DeviceContextNullImpl::WaitForIdle()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate contexts can be idled");
+    Flush();
+    m_pDevice->IdleCommandQueue(GetCommandQueueId(), true);
+}
+
+void DeviceContextNullImpl::BeginQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::BeginQuery(pQuery, 0);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::EndQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::EndQuery(pQuery, 0);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::Flush()
+{
+    Flush(0, nullptr);
+}
+
+void DeviceContextNullImpl::Flush(Uint32               NumCommandLists,
+                                  ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts.");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Flushing device context inside an active render pass.");
+
+    std::vector<RefCntAutoPtr<IDeviceContext>> DeferredCtxs;
+    DeferredCtxs.reserve(NumCommandLists);
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        CommandListNullImpl* pCmdListNull = ClassPtrCast<CommandListNullImpl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(pCmdListNull != nullptr, "Command list must not be null");
+        DEV_CHECK_ERR(pCmdListNull->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListNull->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
+        DeferredCtxs.emplace_back();
+        pCmdListNull->Close(DeferredCtxs.back());
+        VERIFY_EXPR(DeferredCtxs.back() != nullptr);
+    }
+
+    // Submit even if there are no commands to release stale resources.
+    // The queue completes the submission immediately.
+    const Uint64 SubmittedFenceValue = m_pDevice->SubmitCommandBuffer(GetCommandQueueId(), true).FenceValue;
+
+    for (auto& val_fence : m_SignalFences)
+    {
+        val_fence.second->DvpSignal(val_fence.first);
+        val_fence.second->OnSubmitted(val_fence.first);
+    }
+    m_SignalFences.clear();
+
+    for (RefCntAutoPtr<IDeviceContext>& pDeferredCtx : DeferredCtxs)
+    {
+        // Set the bit in the deferred context cmd queue mask corresponding to cmd queue of this context
+        pDeferredCtx.RawPtr<DeviceContextNullImpl>()->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
+    }
+    (void)SubmittedFenceValue;
+
+    m_NumCommands       = 0;
+    m_BindInfo          = {};
+    m_pPipelineState    = nullptr;
+    m_pActiveRenderPass = nullptr;
+    m_pBoundFramebuffer = nullptr;
+}
+
+void DeviceContextNullImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildBLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildTLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::CopyBLAS(const CopyBLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyBLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::CopyTLAS(const CopyTLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyTLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteBLASCompactedSize is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteTLASCompactedSize is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::TraceRays(const TraceRaysAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRays is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRaysIndirect is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::UpdateSBT(IShaderBindingTable* pSBT, const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs)
+{
+    UNSUPPORTED("UpdateSBT is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BeginDebugGroup(const Char* Name, const float* pColor)
+{
+    TDeviceContextBase::BeginDebugGroup(Name, pColor, 0);
+}
+
+void DeviceContextNullImpl::EndDebugGroup()
+{
+    TDeviceContextBase::EndDebugGroup(0);
+}
+
+void DeviceContextNullImpl::InsertDebugLabel(const Char* Label, const float* pColor)
+{
+    TDeviceContextBase::InsertDebugLabel(Label, pColor, 0);
+}
+
+void DeviceContextNullImpl::SetShadingRate(SHADING_RATE BaseRate, SHADING_RATE_COMBINER PrimitiveCombiner, SHADING_RATE_COMBINER TextureCombiner)
+{
+    UNSUPPORTED("SetShadingRate is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs)
+{
+    UNSUPPORTED("BindSparseResourceMemory is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::GenerateMips(ITextureView* pTexView)
+{
+    TDeviceContextBase::GenerateMips(pTexView);
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::FinishFrame()
+{
+    if (GetNumCommandsInCtx() != 0)
+    {
+        if (IsDeferred())
+        {
+            LOG_ERROR_MESSAGE("There are outstanding commands in deferred device context #", GetContextId(),
+                              " when finishing the frame. This is an error and may cause unpredicted behaviour."
+                              " Close all deferred contexts and execute them before finishing the frame.");
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("There are outstanding commands in the immediate device context when finishing the frame."
+                              " This is an error and may cause unpredicted behaviour. Call Flush() to submit all commands"
+                              " for execution before finishing the frame.");
+        }
+    }
+
+    if (m_pActiveRenderPass != nullptr)
+    {
+        LOG_ERROR_MESSAGE("Finishing frame inside an active render pass.");
+    }
+
+    EndFrame();
+}
+
+void DeviceContextNullImpl::TransitionResourceState(IDeviceObject& Resource, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateState)
+{
+    auto Transition = [&](auto& Res, const char* ResType) {
+        if (OldState == RESOURCE_STATE_UNKNOWN)
+        {
+            if (!Res.IsInKnownState())
+            {
+                LOG_ERROR_MESSAGE("Failed to transition the state of ", ResType, " '", Res.GetDesc().Name,
+                                  "' because the state is unknown and is not explicitly specified");
+                return;
+            }
+        }
+        else if (Res.IsInKnownState() && Res.GetState() != OldState)
+        {
+            LOG_ERROR_MESSAGE("The state ", GetResourceStateString(Res.GetState()), " of ", ResType, " '",
+                              Res.GetDesc().Name, "' does not match the old state ", GetResourceStateString(OldState),
+                              " specified by the barrier");
+        }
+
+        if (UpdateState)
+            Res.SetState(NewState);
+    };
+
+    if (RefCntAutoPtr<ITexture> pTexture{&Resource, IID_Texture})
+    {
+        Transition(*pTexture.RawPtr<TextureNullImpl>(), "texture");
+    }
+    else if (RefCntAutoPtr<IBuffer> pBuffer{&Resource, IID_Buffer})
+    {
+        Transition(*pBuffer.RawPtr<BufferNullImpl>(), "buffer");
+    }
+    else
+    {
+        UNEXPECTED("unsupported resource type");
+    }
+    ++m_NumCommands;
+}
+
+void DeviceContextNullImpl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
+{
+    VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+
+    for (Uint32 i = 0; i < BarrierCount; ++i)
+    {
+        const StateTransitionDesc& Barrier = pResourceBarriers[i];
+#ifdef DILIGENT_DEVELOPMENT
+        DvpVerifyStateTransitionDesc(Barrier);
+#endif
+        if (Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN)
+        {
+            // Skip begin-split barriers
+            VERIFY((Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) == 0, "Resource state can't be updated in begin-split barrier");
+            continue;
+        }
+        if (Barrier.Flags & STATE_TRANSITION_FLAG_ALIASING)
+            continue;
+
+        TransitionResourceState(*Barrier.pResource, Barrier.OldState, Barrier.NewState, (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) != 0);
+    }
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyBufferState(BufferNullImpl&                Buffer,
+                                                          RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                          RESOURCE_STATE                 RequiredState,
+                                                          const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+        if (Buffer.IsInKnownState() && !Buffer.CheckState(RequiredState))
+        {
+            Buffer.SetState(RequiredState);
+            ++m_NumCommands;
+        }
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyBufferState(Buffer, RequiredState, OperationName);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::TransitionOrVerifyTextureState(TextureNullImpl&               Texture,
+                                                           RESOURCE_STATE_TRANSITION_MODE TransitionMode,
+                                                           RESOURCE_STATE                 RequiredState,
+                                                           const char*                    OperationName)
+{
+    if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
+    {
+        VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+        if (Texture.IsInKnownState() && !Texture.CheckState(RequiredState))
+        {
+            Texture.SetState(RequiredState);
+            ++m_NumCommands;
+        }
+    }
+#ifdef DILIGENT_DEVELOPMENT
+    else if (TransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
+    {
+        DvpVerifyTextureState(Texture, RequiredState, OperationName);
+    }
+#endif
+}
+
+void DeviceContextNullImpl::ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                      ITexture*                               pDstTexture,
+                                                      const ResolveTextureSubresourceAttribs& ResolveAttribs)
+{
+    TDeviceContextBase::ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
+
+    TextureNullImpl* pSrcTexNull = ClassPtrCast<TextureNullImpl>(pSrcTexture);
+    TextureNullImpl* pDstTexNull = ClassPtrCast<TextureNullImpl>(pDstTexture);
+    TransitionOrVerifyTextureState(*pSrcTexNull, ResolveAttribs.SrcTextureTransitionMode, RESOURCE_STATE_RESOLVE_SOURCE, "Resolving multi-sampled texture (DeviceContextNullImpl::ResolveTextureSubresource)");
+    TransitionOrVerifyTextureState(*pDstTexNull, ResolveAttribs.DstTextureTransitionMode, RESOURCE_STATE_RESOLVE_DEST, "Resolving multi-sampled texture (DeviceContextNullImpl::ResolveTextureSubresource)");
+    ++m_NumCommands;
+}
+
+} // namespace Diligent
@@ -0,0 +1,288 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+PipelineResourceSignatureNullImpl::PipelineResourceSignatureNullImpl(IReferenceCounters*                  pRefCounters,
+                                                                     RenderDeviceNullImpl*                pDevice,
+                                                                     const PipelineResourceSignatureDesc& Desc,
+                                                                     SHADER_TYPE                          ShaderStages,
+                                                                     bool                                 bIsDeviceInternal) :
+    TPipelineResourceSignatureBase{pRefCounters, pDevice, Desc, ShaderStages, bIsDeviceInternal}
+{
+    try
+    {
+        Initialize(
+            GetRawAllocator(), DecoupleCombinedSamplers(Desc), /*CreateImmutableSamplers = */ true,
+            [this]() //
+            {
+                AllocateCacheSlots(/*IsSerialized*/ false);
+            },
+            [this]() //
+            {
+                return ShaderResourceCacheNull::GetRequiredMemorySize(m_SRBCacheSize);
+            });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+PipelineResourceSignatureNullImpl::PipelineResourceSignatureNullImpl(IReferenceCounters*                              pRefCounters,
+                                                                     RenderDeviceNullImpl*                            pDevice,
+                                                                     const PipelineResourceSignatureDesc&             Desc,
+                                                                     const PipelineResourceSignatureInternalDataNull& InternalData) :
+    TPipelineResourceSignatureBase{pRefCounters, pDevice, Desc, InternalData}
+{
+    try
+    {
+        Deserialize(
+            GetRawAllocator(), DecoupleCombinedSamplers(Desc), InternalData, /*CreateImmutableSamplers = */ true,
+            [this]() //
+            {
+                AllocateCacheSlots(/*IsSerialized*/ true);
+            },
+            [this]() //
+            {
+                return ShaderResourceCacheNull::GetRequiredMemorySize(m_SRBCacheSize);
+            });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+PipelineResourceSignatureNullImpl::~PipelineResourceSignatureNullImpl()
+{
+    Destruct();
+}
+
+void PipelineResourceSignatureNullImpl::AllocateCacheSlots(const bool IsSerialized)
+{
+    // Cache layout:
+    //
+    //      SRB cache:    | Immutable samplers | Resources in m_Desc.Resources order |
+    //      static cache: | Static resources (excluding immutable samplers)          |
+
+    // Index of the immutable sampler for every sampler in m_Desc.Resources, or InvalidImmutableSamplerIndex.
+    std::vector<Uint32> ResourceToImmutableSamplerInd(m_Desc.NumResources, InvalidImmutableSamplerIndex);
+
+    // The total number of static resources in all stages accounting for array sizes.
+    Uint32 StaticResourceCount = 0;
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER)
+        {
+            const Uint32 SrcImmutableSamplerInd = FindImmutableSampler(ResDesc.ShaderStages, ResDesc.Name);
+            if (SrcImmutableSamplerInd != InvalidImmutableSamplerIndex)
+            {
+                ResourceToImmutableSamplerInd[i] = SrcImmutableSamplerInd;
+                // One immutable sampler may be used by different arrays in different shader stages - use the maximum array size
+                ImmutableSamplerAttribsNull& DstImtblSampAttribs = m_pImmutableSamplerAttribs[SrcImmutableSamplerInd];
+                DstImtblSampAttribs.ArraySize                    = std::max(DstImtblSampAttribs.ArraySize, ResDesc.ArraySize);
+                continue;
+            }
+        }
+
+        if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
+            StaticResourceCount += ResDesc.ArraySize;
+    }
+
+    VERIFY_EXPR(StaticResourceCount == 0 || m_pStaticResCache != nullptr);
+    if (m_pStaticResCache != nullptr)
+        m_pStaticResCache->Initialize(GetRawAllocator(), StaticResourceCount);
+
+    // Allocate slots for immutable samplers first
+    m_SRBCacheSize = 0;
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+    {
+        ImmutableSamplerAttribsNull& ImtblSampAttribs = m_pImmutableSamplerAttribs[i];
+        if (!IsSerialized)
+            ImtblSampAttribs.CacheOffset = m_SRBCacheSize;
+        else
+            DEV_CHECK_ERR(ImtblSampAttribs.CacheOffset == m_SRBCacheSize, "Deserialized immutable sampler cache offset is invalid");
+        m_SRBCacheSize += ImtblSampAttribs.ArraySize;
+    }
+
+    // Current offset in the static resource cache
+    Uint32 StaticCacheOffset = 0;
+
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        VERIFY(i == 0 || ResDesc.VarType >= m_Desc.Resources[i - 1].VarType, "Resources must be sorted by variable type");
+
+        Uint32 AssignedSamplerInd     = ResourceAttribs::InvalidSamplerInd;
+        Uint32 SrcImmutableSamplerInd = ResourceToImmutableSamplerInd[i];
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_TEXTURE_SRV)
+        {
+            AssignedSamplerInd = FindAssignedSampler(ResDesc, ResourceAttribs::InvalidSamplerInd);
+            if (AssignedSamplerInd != ResourceAttribs::InvalidSamplerInd)
+                SrcImmutableSamplerInd = ResourceToImmutableSamplerInd[AssignedSamplerInd];
+        }
+
+        const bool IsImmutableSampler = (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && SrcImmutableSamplerInd != InvalidImmutableSamplerIndex);
+
+        Uint32 SRBCacheOffset = ~0u;
+        if (IsImmutableSampler)
+        {
+            // Note that the same immutable sampler may be assigned to multiple sampler resources in different shader stages
+            SRBCacheOffset = m_pImmutableSamplerAttribs[SrcImmutableSamplerInd].CacheOffset;
+        }
+        else
+        {
+            SRBCacheOffset = m_SRBCacheSize;
+            m_SRBCacheSize += ResDesc.ArraySize;
+        }
+
+        const Uint32 ResStaticCacheOffset = (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC && !IsImmutableSampler) ? StaticCacheOffset : ~0u;
+
+        ResourceAttribs* const pAttribs = m_pResourceAttribs + i;
+        if (!IsSerialized)
+        {
+            new (pAttribs) ResourceAttribs{
+                AssignedSamplerInd,
+                ResDesc.ArraySize,
+                SrcImmutableSamplerInd != InvalidImmutableSamplerIndex,
+                SRBCacheOffset,
+                ResStaticCacheOffset,
+            };
+        }
+        else
+        {
+            DEV_CHECK_ERR(pAttribs->SamplerInd == AssignedSamplerInd,
+                          "Deserialized sampler index (", pAttribs->SamplerInd, ") is invalid: ", AssignedSamplerInd, " is expected.");
+            DEV_CHECK_ERR(pAttribs->ArraySize == ResDesc.ArraySize,
+                          "Deserialized array size (", pAttribs->ArraySize, ") is invalid: ", ResDesc.ArraySize, " is expected.");
+            DEV_CHECK_ERR(pAttribs->IsImmutableSamplerAssigned() == (SrcImmutableSamplerInd != InvalidImmutableSamplerIndex), "Deserialized immutable sampler flag is invalid");
+            DEV_CHECK_ERR(pAttribs->SRBCacheOffset == SRBCacheOffset,
+                          "Deserialized SRB cache offset (", pAttribs->SRBCacheOffset, ") is invalid: ", SRBCacheOffset, " is expected.");
+            DEV_CHECK_ERR(pAttribs->StaticCacheOffset == ResStaticCacheOffset, "Deserialized static cache offset is invalid.");
+        }
+
+        if (ResStaticCacheOffset != ~0u)
+        {
+            m_pStaticResCache->InitializeResources(StaticCacheOffset, ResDesc.ArraySize, ResDesc.ResourceType);
+            StaticCacheOffset += ResDesc.ArraySize;
+        }
+    }
+
+    VERIFY_EXPR(StaticCacheOffset == StaticResourceCount);
+}
+
+void PipelineResourceSignatureNullImpl::InitSRBResourceCache(ShaderResourceCacheNull& ResourceCache)
+{
+    IMemoryAllocator& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
+    ResourceCache.Initialize(CacheMemAllocator, m_SRBCacheSize);
+
+    const Uint32                   TotalResources = GetTotalResourceCount();
+    const ResourceCacheContentType CacheType      = ResourceCache.GetContentType();
+    for (Uint32 r = 0; r < TotalResources; ++r)
+    {
+        const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
+        const ResourceAttribs&      Attr    = GetResourceAttribs(r);
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+        {
+            // Skip immutable samplers
+            continue;
+        }
+
+        ResourceCache.InitializeResources(Attr.CacheOffset(CacheType), ResDesc.ArraySize, ResDesc.ResourceType);
+    }
+
+    // Initialize immutable samplers
+    for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+    {
+        const ImmutableSamplerAttribsNull& ImtblSampAttr = m_pImmutableSamplerAttribs[i];
+        VERIFY_EXPR(ImtblSampAttr.IsAllocated());
+        ResourceCache.InitializeResources(ImtblSampAttr.CacheOffset, ImtblSampAttr.ArraySize, SHADER_RESOURCE_TYPE_SAMPLER);
+
+        if (const RefCntAutoPtr<SamplerNullImpl>& pSampler = m_pImmutableSamplers[i])
+        {
+            for (Uint32 elem = 0; elem < ImtblSampAttr.ArraySize; ++elem)
+                ResourceCache.SetResource(ImtblSampAttr.CacheOffset + elem, pSampler);
+        }
+    }
+}
+
+void PipelineResourceSignatureNullImpl::CopyStaticResources(ShaderResourceCacheNull& DstResourceCache) const
+{
+    if (m_pStaticResCache == nullptr)
+        return;
+
+    // SrcResourceCache contains only static resources.
+    // In case of SRB, DstResourceCache contains static, mutable and dynamic resources.
+    // In case of Signature, DstResourceCache contains only static resources.
+    const ShaderResourceCacheNull&  SrcResourceCache = *m_pStaticResCache;
+    const std::pair<Uint32, Uint32> ResIdxRange      = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    const ResourceCacheContentType  SrcCacheType     = SrcResourceCache.GetContentType();
+    const ResourceCacheContentType  DstCacheType     = DstResourceCache.GetContentType();
+
+    for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
+    {
+        const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
+        const ResourceAttribs&      Attr    = GetResourceAttribs(r);
+        VERIFY_EXPR(ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+        {
+            // Skip immutable samplers as they are initialized in InitSRBResourceCache()
+            continue;
+        }
+
+        for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+        {
+            const ShaderResourceCacheNull::Resource& SrcCachedRes = SrcResourceCache.GetResource(Attr.CacheOffset(SrcCacheType) + ArrInd);
+            if (!SrcCachedRes)
+            {
+                if (DstCacheType == ResourceCacheContentType::SRB)
+                    LOG_ERROR_MESSAGE("No resource is assigned to static shader variable '", GetShaderResourcePrintName(ResDesc, ArrInd), "' in pipeline resource signature '", m_Desc.Name, "'.");
+                continue;
+            }
+
+            const Uint32                             DstCacheOffset = Attr.CacheOffset(DstCacheType) + ArrInd;
+            const ShaderResourceCacheNull::Resource& DstCachedRes   = const_cast<const ShaderResourceCacheNull&>(DstResourceCache).GetResource(DstCacheOffset);
+            if (DstCachedRes.pObject != SrcCachedRes.pObject)
+            {
+                DEV_CHECK_ERR(DstCachedRes.pObject == nullptr, "Static resource has already been initialized, and the new resource does not match previously assigned resource");
+                DstResourceCache.SetResource(DstCacheOffset, SrcCachedRes.pObject, SrcCachedRes.BufferBaseOffset, SrcCachedRes.BufferRangeSize);
+            }
+        }
+    }
+}
+
+} // namespace Diligent
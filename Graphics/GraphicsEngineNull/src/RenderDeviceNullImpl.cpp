@@ -0,0 +1,296 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "SamplerNullImpl.hpp"
+#include "ShaderNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "RenderPassNullImpl.hpp"
+#include "FramebufferNullImpl.hpp"
+
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+RenderDeviceNullImpl::RenderDeviceNullImpl(IReferenceCounters*        pRefCounters,
+                                           IMemoryAllocator&          RawMemAllocator,
+                                           IEngineFactory*            pEngineFactory,
+                                           const EngineCreateInfo&    EngineCI,
+                                           const GraphicsAdapterInfo& AdapterInfo,
+                                           size_t                     CommandQueueCount,
+                                           ICommandQueueNull**        pCmdQueues) :
+    // clang-format off
+    TRenderDeviceBase
+    {
+        pRefCounters,
+        RawMemAllocator,
+        pEngineFactory,
+        CommandQueueCount,
+        pCmdQueues,
+        EngineCI,
+        AdapterInfo
+    }
+// clang-format on
+{
+    m_DeviceInfo.Type       = RENDER_DEVICE_TYPE_NULL;
+    m_DeviceInfo.APIVersion = Version{1, 0};
+    m_DeviceInfo.Features   = EnableDeviceFeatures(AdapterInfo.Features, EngineCI.Features);
+
+    m_DeviceInfo.MaxShaderVersion.HLSL   = {6, 7};
+    m_DeviceInfo.MaxShaderVersion.GLSL   = {4, 6};
+    m_DeviceInfo.MaxShaderVersion.GLESSL = {3, 2};
+    m_DeviceInfo.MaxShaderVersion.MSL    = {2, 3};
+
+    m_DeviceInfo.NDC = NDCAttribs{0.0f, 1.0f, -0.5f};
+
+    // Every format is supported; the exact capabilities are filled in by TestTextureFormat()
+    for (Uint32 fmt = 1; fmt < m_TextureFormatsInfo.size(); ++fmt)
+        m_TextureFormatsInfo[fmt].Supported = true;
+
+    InitShaderCompilationThreadPool(EngineCI.pAsyncShaderCompilationThreadPool, EngineCI.NumAsyncShaderCompilationThreads);
+}
+
+RenderDeviceNullImpl::~RenderDeviceNullImpl()
+{
+    // Wait for the GPU to complete all its operations
+    IdleGPU();
+
+    ReleaseStaleResources(true);
+}
+
+void RenderDeviceNullImpl::CreateBuffer(const BufferDesc& BuffDesc,
+                                        const BufferData* pBuffData,
+                                        IBuffer**         ppBuffer)
+{
+    CreateBufferImpl(ppBuffer, BuffDesc, pBuffData, false);
+}
+
+void RenderDeviceNullImpl::CreateTexture(const TextureDesc& TexDesc,
+                                         const TextureData* pData,
+                                         ITexture**         ppTexture)
+{
+    CreateTextureImpl(ppTexture, TexDesc, pData, false);
+}
+
+void RenderDeviceNullImpl::CreateSampler(const SamplerDesc& SamplerDesc,
+                                         ISampler**         ppSampler)
+{
+    CreateSamplerImpl(ppSampler, SamplerDesc);
+}
+
+void RenderDeviceNullImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
+                                        IShader**               ppShader,
+                                        IDataBlob**             ppCompilerOutput)
+{
+    if (ppCompilerOutput != nullptr)
+        *ppCompilerOutput = nullptr;
+
+    const ShaderNullImpl::CreateInfo NullShaderCI{
+        GetDeviceInfo(),
+        GetAdapterInfo(),
+    };
+    CreateShaderImpl(ppShader, ShaderCI, NullShaderCI);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature)
+{
+    CreatePipelineResourceSignature(Desc, ppSignature, SHADER_TYPE_UNKNOWN, false);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature,
+                                                           SHADER_TYPE                          ShaderStages,
+                                                           bool                                 IsDeviceInternal)
+{
+    CreatePipelineResourceSignatureImpl(ppSignature, Desc, ShaderStages, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc&             Desc,
+                                                           const PipelineResourceSignatureInternalDataNull& InternalData,
+                                                           IPipelineResourceSignature**                     ppSignature)
+{
+    CreatePipelineResourceSignatureImpl(ppSignature, Desc, InternalData);
+}
+
+void RenderDeviceNullImpl::CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                                                       IPipelineState**                       ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateComputePipelineState(const ComputePipelineStateCreateInfo& PSOCreateInfo,
+                                                      IPipelineState**                      ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo,
+                                                         IPipelineState**                         ppPipelineState)
+{
+    UNSUPPORTED("Ray tracing is not supported in Null backend");
+    *ppPipelineState = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateFence(const FenceDesc& Desc,
+                                       IFence**         ppFence)
+{
+    CreateFenceImpl(ppFence, Desc);
+}
+
+void RenderDeviceNullImpl::CreateQuery(const QueryDesc& Desc,
+                                       IQuery**         ppQuery)
+{
+    CreateQueryImpl(ppQuery, Desc);
+}
+
+void RenderDeviceNullImpl::CreateRenderPass(const RenderPassDesc& Desc,
+                                            IRenderPass**         ppRenderPass)
+{
+    CreateRenderPassImpl(ppRenderPass, Desc);
+}
+
+void RenderDeviceNullImpl::CreateFramebuffer(const FramebufferDesc& Desc,
+                                             IFramebuffer**         ppFramebuffer)
+{
+    CreateFramebufferImpl(ppFramebuffer, Desc);
+}
+
+void RenderDeviceNullImpl::CreateBLAS(const BottomLevelASDesc& Desc,
+                                      IBottomLevelAS**         ppBLAS)
+{
+    UNSUPPORTED("CreateBLAS is not supported in Null backend");
+    *ppBLAS = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateTLAS(const TopLevelASDesc& Desc,
+                                      ITopLevelAS**         ppTLAS)
+{
+    UNSUPPORTED("CreateTLAS is not supported in Null backend");
+    *ppTLAS = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateSBT(const ShaderBindingTableDesc& Desc,
+                                     IShaderBindingTable**         ppSBT)
+{
+    UNSUPPORTED("CreateSBT is not supported in Null backend");
+    *ppSBT = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
+                                              IDeviceMemory**               ppMemory)
+{
+    UNSUPPORTED("CreateDeviceMemory is not supported in Null backend");
+    *ppMemory = nullptr;
+}
+
+void RenderDeviceNullImpl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
+                                                    IPipelineStateCache**               ppPSOCache)
+{
+    DEV_CHECK_ERR(ppPSOCache != nullptr, "ppPSOCache must not be null");
+    if (ppPSOCache != nullptr)
+        *ppPSOCache = nullptr;
+
+    LOG_ERROR_MESSAGE("Pipeline state caches are not supported in Null backend");
+}
+
+void RenderDeviceNullImpl::CreateDeferredContext(IDeviceContext** ppContext)
+{
+    CreateDeferredContextImpl(ppContext);
+}
+
+SparseTextureFormatInfo RenderDeviceNullImpl::GetSparseTextureFormatInfo(TEXTURE_FORMAT     TexFormat,
+                                                                         RESOURCE_DIMENSION Dimension,
+                                                                         Uint32             SampleCount) const
+{
+    UNSUPPORTED("GetSparseTextureFormatInfo is not supported in Null backend");
+    return {};
+}
+
+void RenderDeviceNullImpl::IdleGPU()
+{
+    IdleAllCommandQueues(true);
+    ReleaseStaleResources();
+}
+
+void RenderDeviceNullImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
+{
+    // Submit empty command buffer to the queue. This will effectively signal the fence and
+    // discard all resources
+    TRenderDeviceBase::SubmitCommandBuffer(CmdQueueIndex, true);
+}
+
+void RenderDeviceNullImpl::ReleaseStaleResources(bool ForceRelease)
+{
+    PurgeReleaseQueues(ForceRelease);
+}
+
+void RenderDeviceNullImpl::TestTextureFormat(TEXTURE_FORMAT TexFormat)
+{
+    TextureFormatInfoExt& TexFormatInfo = m_TextureFormatsInfo[TexFormat];
+    VERIFY(TexFormatInfo.Supported, "Texture format is not supported");
+
+    TexFormatInfo.Dimensions = RESOURCE_DIMENSION_SUPPORT_BUFFER |
+        RESOURCE_DIMENSION_SUPPORT_TEX_1D |
+        RESOURCE_DIMENSION_SUPPORT_TEX_1D_ARRAY |
+        RESOURCE_DIMENSION_SUPPORT_TEX_2D |
+        RESOURCE_DIMENSION_SUPPORT_TEX_2D_ARRAY |
+        RESOURCE_DIMENSION_SUPPORT_TEX_3D |
+        RESOURCE_DIMENSION_SUPPORT_TEX_CUBE |
+        RESOURCE_DIMENSION_SUPPORT_TEX_CUBE_ARRAY;
+
+    switch (TexFormatInfo.ComponentType)
+    {
+        case COMPONENT_TYPE_DEPTH:
+        case COMPONENT_TYPE_DEPTH_STENCIL:
+            TexFormatInfo.BindFlags    = BIND_DEPTH_STENCIL | BIND_SHADER_RESOURCE;
+            TexFormatInfo.SampleCounts = SAMPLE_COUNT_1 | SAMPLE_COUNT_2 | SAMPLE_COUNT_4 | SAMPLE_COUNT_8;
+            break;
+
+        case COMPONENT_TYPE_COMPRESSED:
+            TexFormatInfo.BindFlags    = BIND_SHADER_RESOURCE;
+            TexFormatInfo.SampleCounts = SAMPLE_COUNT_1;
+            break;
+
+        default:
+            TexFormatInfo.BindFlags    = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET | BIND_UNORDERED_ACCESS;
+            TexFormatInfo.SampleCounts = SAMPLE_COUNT_1 | SAMPLE_COUNT_2 | SAMPLE_COUNT_4 | SAMPLE_COUNT_8;
+    }
+}
+
+} // namespace Diligent
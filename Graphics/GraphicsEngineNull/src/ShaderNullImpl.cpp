@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+constexpr INTERFACE_ID ShaderNullImpl::IID_InternalImpl;
+
+ShaderNullImpl::ShaderNullImpl(IReferenceCounters*     pRefCounters,
+                               RenderDeviceNullImpl*   pDeviceNull,
+                               const ShaderCreateInfo& ShaderCI,
+                               const CreateInfo&       NullShaderCI,
+                               bool                    IsDeviceInternal) :
+    // clang-format off
+    TShaderBase
+    {
+        pRefCounters,
+        pDeviceNull,
+        ShaderCI.Desc,
+        NullShaderCI.DeviceInfo,
+        NullShaderCI.AdapterInfo,
+        IsDeviceInternal
+    }
+// clang-format on
+{
+    const Uint8* pData    = nullptr;
+    size_t       DataSize = 0;
+    if (ShaderCI.ByteCode != nullptr)
+    {
+        pData    = static_cast<const Uint8*>(ShaderCI.ByteCode);
+        DataSize = ShaderCI.ByteCodeSize;
+    }
+    else if (ShaderCI.Source != nullptr)
+    {
+        pData    = reinterpret_cast<const Uint8*>(ShaderCI.Source);
+        DataSize = ShaderCI.SourceLength != 0 ? ShaderCI.SourceLength : strlen(ShaderCI.Source);
+    }
+    m_Bytecode.assign(pData, pData + DataSize);
+
+    m_Status.store(SHADER_STATUS_READY);
+}
+
+void ShaderNullImpl::GetResourceDesc(Uint32 Index, ShaderResourceDesc& ResourceDesc) const
+{
+    DEV_ERROR("Resource index ", Index, " is out of range: shaders in Null backend have no resources");
+    ResourceDesc = {};
+}
+
+const ShaderCodeBufferDesc* ShaderNullImpl::GetConstantBufferDesc(Uint32 Index) const
+{
+    DEV_ERROR("Constant buffer index ", Index, " is out of range: shaders in Null backend have no resources");
+    return nullptr;
+}
+
+void ShaderNullImpl::GetBytecode(const void** ppBytecode, Uint64& Size) const
+{
+    *ppBytecode = !m_Bytecode.empty() ? m_Bytecode.data() : nullptr;
+    Size        = m_Bytecode.size();
+}
+
+} // namespace Diligent
@@ -0,0 +1,187 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderResourceCacheNull.hpp"
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+
+namespace Diligent
+{
+
+size_t ShaderResourceCacheNull::GetRequiredMemorySize(Uint32 NumResources)
+{
+    return NumResources * sizeof(Resource);
+}
+
+ShaderResourceCacheNull::~ShaderResourceCacheNull()
+{
+    for (Uint32 res = 0; res < m_NumResources; ++res)
+        m_pResources[res].~Resource();
+}
+
+void ShaderResourceCacheNull::Initialize(IMemoryAllocator& MemAllocator, Uint32 NumResources)
+{
+    VERIFY(!m_pMemory, "Memory has already been allocated");
+
+    m_NumResources = NumResources;
+    if (NumResources == 0)
+        return;
+
+    m_pMemory = decltype(m_pMemory){
+        ALLOCATE_RAW(MemAllocator, "Memory for shader resource cache data", GetRequiredMemorySize(NumResources)),
+        STDDeleter<void, IMemoryAllocator>(MemAllocator),
+    };
+
+    m_pResources = reinterpret_cast<Resource*>(m_pMemory.get());
+    for (Uint32 res = 0; res < NumResources; ++res)
+        new (m_pResources + res) Resource{};
+}
+
+void ShaderResourceCacheNull::InitializeResources(Uint32 Offset, Uint32 ArraySize, SHADER_RESOURCE_TYPE Type)
+{
+    VERIFY(Offset + ArraySize <= m_NumResources, "Resource range [", Offset, ", ", Offset + ArraySize, ") is out of bounds");
+    for (Uint32 elem = 0; elem < ArraySize; ++elem)
+        m_pResources[Offset + elem].Type = Type;
+}
+
+static bool IsDynamicBuffer(SHADER_RESOURCE_TYPE Type, const IDeviceObject* pObject)
+{
+    if (pObject == nullptr)
+        return false;
+
+    const BufferNullImpl* pBuffer = nullptr;
+    switch (Type)
+    {
+        case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+            pBuffer = ClassPtrCast<const BufferNullImpl>(pObject);
+            break;
+
+        case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+        case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+            pBuffer = ClassPtrCast<const BufferViewNullImpl>(pObject)->GetBuffer<const BufferNullImpl>();
+            break;
+
+        default:
+            break;
+    }
+
+    return pBuffer != nullptr && pBuffer->GetDesc().Usage == USAGE_DYNAMIC;
+}
+
+const ShaderResourceCacheNull::Resource& ShaderResourceCacheNull::SetResource(Uint32                       CacheOffset,
+                                                                              RefCntAutoPtr<IDeviceObject> pObject,
+                                                                              Uint64                       BufferBaseOffset,
+                                                                              Uint64                       BufferRangeSize)
+{
+    VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+    Resource& DstRes = m_pResources[CacheOffset];
+
+    if (DstRes.IsDynamicBuffer)
+    {
+        VERIFY(m_NumDynamicBuffers > 0, "Dynamic buffers counter must be greater than zero when there is at least one dynamic buffer bound in the resource cache");
+        --m_NumDynamicBuffers;
+    }
+
+    DstRes.IsDynamicBuffer     = IsDynamicBuffer(DstRes.Type, pObject);
+    DstRes.BufferDynamicOffset = 0;
+    DstRes.BufferBaseOffset    = BufferBaseOffset;
+    DstRes.BufferRangeSize     = BufferRangeSize;
+    if (DstRes.Type == SHADER_RESOURCE_TYPE_CONSTANT_BUFFER && pObject && DstRes.BufferRangeSize == 0)
+        DstRes.BufferRangeSize = pObject.ConstPtr<BufferNullImpl>()->GetDesc().Size - BufferBaseOffset;
+    DstRes.pObject = std::move(pObject);
+
+    if (DstRes.IsDynamicBuffer)
+        ++m_NumDynamicBuffers;
+
+    UpdateRevision();
+
+    return DstRes;
+}
+
+void ShaderResourceCacheNull::SetDynamicBufferOffset(Uint32 CacheOffset, Uint32 DynamicBufferOffset)
+{
+    VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+    m_pResources[CacheOffset].BufferDynamicOffset = DynamicBufferOffset;
+
+    UpdateRevision();
+}
+
+template <bool VerifyOnly>
+void ShaderResourceCacheNull::TransitionResources(DeviceContextNullImpl* pCtxNullImpl)
+{
+    for (Uint32 res = 0; res < m_NumResources; ++res)
+    {
+        const Resource& Res = m_pResources[res];
+        if (!Res)
+            continue;
+
+        constexpr RESOURCE_STATE_TRANSITION_MODE TransitionMode = VerifyOnly ? RESOURCE_STATE_TRANSITION_MODE_VERIFY : RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+
+        static_assert(SHADER_RESOURCE_TYPE_LAST == SHADER_RESOURCE_TYPE_ACCEL_STRUCT, "Please update the switch below to handle the new shader resource type");
+        switch (Res.Type)
+        {
+            case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:
+                pCtxNullImpl->TransitionOrVerifyBufferState(*Res.pObject.RawPtr<BufferNullImpl>(), TransitionMode, RESOURCE_STATE_CONSTANT_BUFFER,
+                                                            "Committing shader resources (DeviceContextNullImpl::CommitShaderResources)");
+                break;
+
+            case SHADER_RESOURCE_TYPE_BUFFER_SRV:
+            case SHADER_RESOURCE_TYPE_BUFFER_UAV:
+                pCtxNullImpl->TransitionOrVerifyBufferState(*Res.pObject.RawPtr<BufferViewNullImpl>()->GetBuffer<BufferNullImpl>(), TransitionMode,
+                                                            Res.Type == SHADER_RESOURCE_TYPE_BUFFER_SRV ? RESOURCE_STATE_SHADER_RESOURCE : RESOURCE_STATE_UNORDERED_ACCESS,
+                                                            "Committing shader resources (DeviceContextNullImpl::CommitShaderResources)");
+                break;
+
+            case SHADER_RESOURCE_TYPE_TEXTURE_SRV:
+            case SHADER_RESOURCE_TYPE_TEXTURE_UAV:
+                pCtxNullImpl->TransitionOrVerifyTextureState(*Res.pObject.RawPtr<TextureViewNullImpl>()->GetTexture<TextureNullImpl>(), TransitionMode,
+                                                             Res.Type == SHADER_RESOURCE_TYPE_TEXTURE_SRV ? RESOURCE_STATE_SHADER_RESOURCE : RESOURCE_STATE_UNORDERED_ACCESS,
+                                                             "Committing shader resources (DeviceContextNullImpl::CommitShaderResources)");
+                break;
+
+            case SHADER_RESOURCE_TYPE_SAMPLER:
+                // Nothing to do with samplers
+                break;
+
+            case SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT:
+                // Input attachments are transitioned by the render pass
+                break;
+
+            default:
+                UNEXPECTED("Unexpected resource type");
+        }
+    }
+}
+
+template void ShaderResourceCacheNull::TransitionResources<false>(DeviceContextNullImpl* pCtxNullImpl);
+template void ShaderResourceCacheNull::TransitionResources<true>(DeviceContextNullImpl* pCtxNullImpl);
+
+} // namespace Diligent
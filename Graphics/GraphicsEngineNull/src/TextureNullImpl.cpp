@@ -0,0 +1,174 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "TextureNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+TextureNullImpl::TextureNullImpl(IReferenceCounters*        pRefCounters,
+                                 FixedBlockMemoryAllocator& TexViewObjAllocator,
+                                 RenderDeviceNullImpl*      pDevice,
+                                 const TextureDesc&         Desc,
+                                 const TextureData*         pInitData,
+                                 bool                       bIsDeviceInternal) :
+    // clang-format off
+    TTextureBase
+    {
+        pRefCounters,
+        TexViewObjAllocator,
+        pDevice,
+        Desc,
+        bIsDeviceInternal
+    }
+// clang-format on
+{
+    if (m_Desc.Usage == USAGE_IMMUTABLE && (pInitData == nullptr || pInitData->pSubResources == nullptr))
+        LOG_ERROR_AND_THROW("Immutable textures must be initialized with data at creation time: pInitData can't be null");
+
+    if (m_Desc.Usage == USAGE_SPARSE)
+        LOG_ERROR_AND_THROW("Sparse resources are not supported in Null backend");
+
+    m_Data.resize(StaticCast<size_t>(GetStagingTextureDataSize(m_Desc, SubresourceAlignment)));
+
+    if (pInitData != nullptr && pInitData->pSubResources != nullptr)
+    {
+        const Uint32 ExpectedSubresources = m_Desc.MipLevels * m_Desc.GetArraySize();
+        if (pInitData->NumSubresources != ExpectedSubresources)
+            LOG_ERROR_AND_THROW("Incorrect number of subresources in init data. ", ExpectedSubresources, " expected, while ", pInitData->NumSubresources, " provided");
+
+        Uint32 SubRes = 0;
+        for (Uint32 Slice = 0; Slice < m_Desc.GetArraySize(); ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip, ++SubRes)
+            {
+                const TextureSubResData& SubResData = pInitData->pSubResources[SubRes];
+                if (SubResData.pData == nullptr)
+                    continue;
+
+                const MipLevelProperties MipProps = GetMipLevelProperties(m_Desc, Mip);
+                const Box                Region{0, MipProps.LogicalWidth, 0, MipProps.LogicalHeight, 0, MipProps.Depth};
+                WriteRegion(Mip, Slice, Region, SubResData.pData, SubResData.Stride, SubResData.DepthStride);
+            }
+        }
+    }
+
+    if (m_Desc.Usage == USAGE_STAGING)
+        SetState((m_Desc.CPUAccessFlags & CPU_ACCESS_READ) ? RESOURCE_STATE_COPY_DEST : RESOURCE_STATE_COPY_SOURCE);
+    else
+        SetState(RESOURCE_STATE_UNDEFINED);
+}
+
+Uint64 TextureNullImpl::GetNativeHandle()
+{
+    return BitCast<Uint64>(m_Data.data());
+}
+
+MappedTextureSubresource TextureNullImpl::GetRegion(Uint32 MipLevel, Uint32 Slice, const Box& Region)
+{
+    const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(m_Desc.Format);
+    const MipLevelProperties    MipProps   = GetMipLevelProperties(m_Desc, MipLevel);
+
+    const Uint64 SubresOffset = GetStagingTextureSubresourceOffset(m_Desc, Slice, MipLevel, SubresourceAlignment);
+    const Uint64 Offset =
+        SubresOffset +
+        Region.MinZ * MipProps.DepthSliceSize +
+        (Region.MinY / FmtAttribs.BlockHeight) * MipProps.RowSize +
+        (Region.MinX / FmtAttribs.BlockWidth) * Uint64{FmtAttribs.GetElementSize()};
+    VERIFY_EXPR(Offset < m_Data.size());
+
+    return MappedTextureSubresource{m_Data.data() + Offset, MipProps.RowSize, MipProps.DepthSliceSize};
+}
+
+void TextureNullImpl::WriteRegion(Uint32 MipLevel, Uint32 Slice, const Box& Region, const void* pSrcData, Uint64 SrcStride, Uint64 SrcDepthStride)
+{
+    VERIFY_EXPR(pSrcData != nullptr);
+
+    const TextureFormatAttribs&    FmtAttribs = GetTextureFormatAttribs(m_Desc.Format);
+    const MappedTextureSubresource Dst        = GetRegion(MipLevel, Slice, Region);
+
+    const Uint64 RowSize = Uint64{(Region.Width() + FmtAttribs.BlockWidth - 1u) / FmtAttribs.BlockWidth} * FmtAttribs.GetElementSize();
+    const Uint32 NumRows = (Region.Height() + FmtAttribs.BlockHeight - 1u) / FmtAttribs.BlockHeight;
+    if (SrcStride == 0)
+        SrcStride = RowSize;
+    if (SrcDepthStride == 0)
+        SrcDepthStride = SrcStride * NumRows;
+
+    for (Uint32 z = 0; z < Region.Depth(); ++z)
+    {
+        for (Uint32 row = 0; row < NumRows; ++row)
+        {
+            const Uint8* pSrcRow = static_cast<const Uint8*>(pSrcData) + z * SrcDepthStride + row * SrcStride;
+            Uint8*       pDstRow = static_cast<Uint8*>(Dst.pData) + z * Dst.DepthStride + row * Dst.Stride;
+            memcpy(pDstRow, pSrcRow, StaticCast<size_t>(RowSize));
+        }
+    }
+}
+
+void TextureNullImpl::ClearSubresource(Uint32 MipLevel, Uint32 Slice)
+{
+    const Uint64 Offset = GetStagingTextureSubresourceOffset(m_Desc, Slice, MipLevel, SubresourceAlignment);
+    memset(m_Data.data() + Offset, 0, StaticCast<size_t>(GetMipLevelProperties(m_Desc, MipLevel).MipSize));
+}
+
+void TextureNullImpl::CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView)
+{
+    VERIFY(ppView != nullptr, "View pointer address is null");
+    if (!ppView) return;
+    VERIFY(*ppView == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+    *ppView = nullptr;
+
+    try
+    {
+        FixedBlockMemoryAllocator& TexViewAllocator = m_pDevice->GetTexViewObjAllocator();
+        VERIFY(&TexViewAllocator == &m_dbgTexViewObjAllocator, "Texture view allocator does not match allocator provided during texture initialization");
+
+        TextureViewDesc UpdatedViewDesc = ViewDesc;
+        ValidatedAndCorrectTextureViewDesc(m_Desc, UpdatedViewDesc);
+
+        TextureViewNullImpl* pViewNull = NEW_RC_OBJ(TexViewAllocator, "TextureViewNullImpl instance", TextureViewNullImpl, bIsDefaultView ? this : nullptr)(
+            GetDevice(), UpdatedViewDesc, this, bIsDefaultView, m_bIsDeviceInternal);
+        VERIFY(pViewNull->GetDesc().ViewType == ViewDesc.ViewType, "Incorrect view type");
+
+        if (bIsDefaultView)
+            *ppView = pViewNull;
+        else
+            pViewNull->QueryInterface(IID_TextureView, ppView);
+    }
+    catch (const std::runtime_error&)
+    {
+        const char* ViewTypeName = GetTexViewTypeLiteralName(ViewDesc.ViewType);
+        LOG_ERROR("Failed to create view \"", ViewDesc.Name ? ViewDesc.Name : "", "\" (", ViewTypeName, ") for texture \"", m_Desc.Name ? m_Desc.Name : "", "\"");
+    }
+}
+
+} // namespace Diligent
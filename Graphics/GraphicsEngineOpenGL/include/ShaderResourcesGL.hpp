@@ -366,13 +366,17 @@ public:
     {
         const Uint32 AllowedTypeBits = GetAllowedTypeBits(AllowedVarTypes, NumAllowedTypes);
 
+        ResourceNameTable LayoutVarNames;
+        if (pResourceLayout != nullptr)
+            LayoutVarNames.Initialize(pResourceLayout->Variables, pResourceLayout->NumVariables);
+
         auto CheckResourceType = [&](const char* Name) //
         {
             if (pResourceLayout == nullptr)
                 return true;
             else
             {
-                SHADER_RESOURCE_VARIABLE_TYPE VarType = GetShaderVariableType(m_ShaderStages, Name, *pResourceLayout);
+                SHADER_RESOURCE_VARIABLE_TYPE VarType = GetShaderVariableType(m_ShaderStages, Name, *pResourceLayout, LayoutVarNames);
                 return IsAllowedType(VarType, AllowedTypeBits);
             }
         };
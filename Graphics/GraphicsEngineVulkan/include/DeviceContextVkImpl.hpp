@@ -538,6 +538,12 @@ private:
             // Note that this is not the actual number of dynamic buffers in the resource cache.
             Uint32 DynamicOffsetCount = 0;
 
+            // Dynamic descriptor set written by the last commit and the resource cache content version
+            // it was written from. The set is reused when the same cache contents are committed again
+            // before the dynamic descriptor pools are released at the end of the frame.
+            VkDescriptorSet vkLastDynamicSet           = VK_NULL_HANDLE;
+            Uint64          LastDynamicSetCacheVersion = 0;
+
 #ifdef DILIGENT_DEVELOPMENT
             // The descriptor set base index that was used in the last BindDescriptorSets() call
             Uint32 LastBoundBaseInd = ~0u;
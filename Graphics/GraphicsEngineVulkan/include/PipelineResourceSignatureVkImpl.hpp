@@ -125,6 +125,10 @@ public:
 
     void InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache);
 
+    // SRBs write resources directly into their descriptor sets, so the data of a destroyed SRB may
+    // only be reused when the GPU is done with the descriptor sets.
+    void EnqueueRecycledSRBData(SRBDataType* pData);
+
     // Copies static resources from the static resource cache to the destination cache
     void CopyStaticResources(ShaderResourceCacheVk& ResourceCache) const;
     // Make the base class method visible
@@ -177,6 +181,11 @@ private:
     void Destruct();
 
     void CreateSetLayouts(bool IsSerialized);
+    void CreateDynamicSetUpdateTemplate();
+
+    // Returns the index of the set whose descriptor data is kept in SRB resource caches
+    // for the update template, or ~0u if no set needs it.
+    Uint32 GetDescriptorDataSetIndex() const;
 
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
@@ -184,6 +193,10 @@ private:
 private:
     std::array<VulkanUtilities::DescriptorSetLayoutWrapper, DESCRIPTOR_SET_ID_NUM_SETS> m_VkDescrSetLayouts;
 
+    // Descriptor update template that writes the entire dynamic descriptor set from the resource cache.
+    // Null if the device does not support templates or the signature has no dynamic resources.
+    VulkanUtilities::DescrUpdateTemplateWrapper m_DynamicSetUpdateTemplate;
+
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
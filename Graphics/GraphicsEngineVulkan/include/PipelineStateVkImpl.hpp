@@ -112,7 +112,8 @@ public:
         bool                                                 bStripReflection,
         const char*                                          PipelineName,
         TShaderResources*                                    pShaderResources     = nullptr,
-        TResourceAttibutions*                                pResourceAttibutions = nullptr) noexcept(false);
+        TResourceAttibutions*                                pResourceAttibutions = nullptr,
+        IThreadPool*                                         pThreadPool          = nullptr) noexcept(false);
 
     static PipelineResourceSignatureDescWrapper GetDefaultResourceSignatureDesc(
         const TShaderStages&              ShaderStages,
@@ -52,6 +52,11 @@
 //
 // Descriptor set for static and mutable resources is assigned during cache initialization
 // Descriptor set for dynamic resources is assigned at every draw call
+//
+// Resources are followed by the array of Vulkan descriptor data (image/buffer infos, texel buffer views,
+// acceleration structures), one element per resource. The data is written when the resource is bound
+// and is laid out so that an entire set can be written by a single descriptor update template call
+// without touching the resource objects.
 
 #include <vector>
 #include <memory>
@@ -68,7 +73,7 @@ namespace Diligent
 
 class DeviceContextVkImpl;
 
-// sizeof(ShaderResourceCacheVk) == 24 (x64, msvc, Release)
+// sizeof(ShaderResourceCacheVk) == 32 (x64, msvc, Release)
 class ShaderResourceCacheVk : public ShaderResourceCacheBase
 {
 public:
@@ -88,9 +93,11 @@ public:
 
     ~ShaderResourceCacheVk();
 
-    static size_t GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes);
+    // DescriptorDataSet is the index of the set that keeps the descriptor data for
+    // the update template (see DescriptorData), or ~0u if no set needs it.
+    static size_t GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes, Uint32 DescriptorDataSet = ~0u);
 
-    void InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes);
+    void InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes, Uint32 DescriptorDataSet = ~0u);
     void InitializeResources(Uint32 Set, Uint32 Offset, Uint32 ArraySize, DescriptorType Type, bool HasImmutableSampler);
 
     // sizeof(Resource) == 32 (x64, msvc, Release)
@@ -140,14 +147,26 @@ public:
         explicit operator bool() const { return !IsNull(); }
     };
 
-    // sizeof(DescriptorSet) == 48 (x64, msvc, Release)
+    // Vulkan descriptor data of a single resource in the format expected by vkUpdateDescriptorSetWithTemplate.
+    // Only the dynamic set of an SRB cache keeps it, and only when the set is written with a template.
+    // sizeof(DescriptorData) == 24 (x64, msvc, Release)
+    union DescriptorData
+    {
+        VkDescriptorImageInfo      ImageInfo;
+        VkDescriptorBufferInfo     BufferInfo;
+        VkBufferView               TexelBufferView;
+        VkAccelerationStructureKHR AccelStruct;
+    };
+
+    // sizeof(DescriptorSet) == 56 (x64, msvc, Release)
     class DescriptorSet
     {
     public:
         // clang-format off
-        DescriptorSet(Uint32 NumResources, Resource *pResources) :
-            m_NumResources  {NumResources},
-            m_pResources    {pResources  }
+        DescriptorSet(Uint32 NumResources, Resource *pResources, DescriptorData* pDescriptorData) :
+            m_NumResources   {NumResources   },
+            m_pResources     {pResources     },
+            m_pDescriptorData{pDescriptorData}
         {}
 
         DescriptorSet             (const DescriptorSet&) = delete;
@@ -164,6 +183,16 @@ public:
 
         Uint32 GetSize() const { return m_NumResources; }
 
+        // Returns the pointer to the descriptor data of all resources in the set,
+        // or null if the set does not keep descriptor data
+        const DescriptorData* GetDescriptorData() const { return m_pDescriptorData; }
+
+        bool HasDescriptorData() const { return m_pDescriptorData != nullptr; }
+
+        // Returns true if all resources that require a descriptor write are bound, i.e. descriptor data
+        // of every resource except for immutable separate samplers is valid.
+        bool AllDescriptorsValid() const { return m_NumNullDescriptors == 0; }
+
         VkDescriptorSet GetVkDescriptorSet() const
         {
             return m_DescriptorSetAllocation.GetVkDescriptorSet();
@@ -171,10 +200,13 @@ public:
 
     private:
         // clang-format off
-/* 0 */ const Uint32            m_NumResources = 0;
-/* 8 */ Resource* const         m_pResources   = nullptr;
-/*16 */ DescriptorSetAllocation m_DescriptorSetAllocation;
-/*48 */ // End of structure
+/* 0 */ const Uint32            m_NumResources       = 0;
+        // The number of null resources that require a descriptor write
+/* 4 */ Uint32                  m_NumNullDescriptors = 0;
+/* 8 */ Resource* const         m_pResources         = nullptr;
+/*16 */ DescriptorData* const   m_pDescriptorData    = nullptr;
+/*24 */ DescriptorSetAllocation m_DescriptorSetAllocation;
+/*56 */ // End of structure
         // clang-format on
 
     private:
@@ -184,6 +216,12 @@ public:
             VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
             return m_pResources[CacheOffset];
         }
+        DescriptorData& GetDescriptorData(Uint32 CacheOffset)
+        {
+            VERIFY(m_pDescriptorData != nullptr, "This set does not keep descriptor data");
+            VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+            return m_pDescriptorData[CacheOffset];
+        }
     };
 
     const DescriptorSet& GetDescriptorSet(Uint32 Index) const
@@ -251,6 +289,10 @@ public:
 
     ResourceCacheContentType GetContentType() const { return static_cast<ResourceCacheContentType>(m_ContentType); }
 
+    // Returns the version of the cache contents. The version is unique across all caches and
+    // changes every time a resource in the cache is modified.
+    Uint64 GetContentVersion() const { return m_ContentVersion; }
+
 #ifdef DILIGENT_DEBUG
     // For debug purposes only
     void DbgVerifyResourceInitialization() const;
@@ -282,6 +324,8 @@ private:
 
     std::unique_ptr<void, STDDeleter<void, IMemoryAllocator>> m_pMemory;
 
+    Uint64 m_ContentVersion = 0;
+
     Uint16 m_NumSets = 0;
 
     // Total actual number of dynamic buffers (that were created with USAGE_DYNAMIC) bound in the resource cache
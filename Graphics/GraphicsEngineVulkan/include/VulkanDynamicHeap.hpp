@@ -151,6 +151,10 @@ public:
     static constexpr const Uint32 MasterBlockAlignment = 1024;
     MasterBlock                   AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment);
 
+    // Allocates up to NumBlocks blocks under a single lock. If no space is available, falls back to
+    // AllocateMasterBlock() that waits for the GPU to release some blocks.
+    Uint32 AllocateMasterBlocks(OffsetType SizeInBytes, OffsetType Alignment, Uint32 NumBlocks, std::vector<MasterBlock>& Blocks);
+
 private:
     RenderDeviceVkImpl&                  m_DeviceVk;
     VulkanUtilities::BufferWrapper       m_VkBuffer;
@@ -195,6 +199,7 @@ public:
     VulkanDynamicHeap(VulkanDynamicMemoryManager& DynamicMemMgr, std::string HeapName, Uint32 PageSize) :
         m_GlobalDynamicMemMgr{DynamicMemMgr},
         m_HeapName           {std::move(HeapName)},
+        m_MasterBlockCache   {DynamicMemMgr, PageSize, VulkanDynamicMemoryManager::MasterBlockAlignment, MasterBlockBatchSize},
         m_MasterBlockSize    (PageSize)
     {}
 
@@ -220,6 +225,9 @@ public:
 
     static constexpr OffsetType InvalidOffset = static_cast<OffsetType>(-1);
 
+    // The number of pages the heap requests from the global dynamic memory manager at once
+    static constexpr Uint32 MasterBlockBatchSize = 4;
+
     size_t GetAllocatedMasterBlockCount() const { return m_MasterBlocks.size(); }
 
 private:
@@ -228,6 +236,9 @@ private:
 
     std::vector<MasterBlock> m_MasterBlocks;
 
+    // Pages are taken from the global manager in batches to reduce contention between contexts
+    DynamicHeap::MasterBlockCache<VulkanDynamicMemoryManager> m_MasterBlockCache;
+
     OffsetType   m_CurrOffset = InvalidOffset;
     const Uint32 m_MasterBlockSize;
     Uint32       m_AvailableSize = 0;
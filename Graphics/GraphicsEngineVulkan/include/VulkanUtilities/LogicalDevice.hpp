@@ -59,7 +59,8 @@ enum class VulkanHandleTypeId : uint32_t
     Event,
     QueryPool,
     AccelerationStructureKHR,
-    PipelineCache
+    PipelineCache,
+    DescriptorUpdateTemplate
 };
 
 template <typename VulkanObjectType, VulkanHandleTypeId>
@@ -85,6 +86,7 @@ using SemaphoreWrapper           = DEFINE_VULKAN_OBJECT_WRAPPER(Semaphore);
 using QueryPoolWrapper           = DEFINE_VULKAN_OBJECT_WRAPPER(QueryPool);
 using AccelStructWrapper         = DEFINE_VULKAN_OBJECT_WRAPPER(AccelerationStructureKHR);
 using PipelineCacheWrapper       = DEFINE_VULKAN_OBJECT_WRAPPER(PipelineCache);
+using DescrUpdateTemplateWrapper = DEFINE_VULKAN_OBJECT_WRAPPER(DescriptorUpdateTemplate);
 #undef DEFINE_VULKAN_OBJECT_WRAPPER
 
 class LogicalDevice : public std::enable_shared_from_this<LogicalDevice>
@@ -162,6 +164,8 @@ public:
 
     PipelineCacheWrapper CreatePipelineCache(const VkPipelineCacheCreateInfo &CI, const char* DebugName = "") const;
 
+    DescrUpdateTemplateWrapper CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfo& TemplateCI, const char* DebugName = "") const;
+
     void ReleaseVulkanObject(CommandPoolWrapper&&  CmdPool) const;
     void ReleaseVulkanObject(BufferWrapper&&       Buffer) const;
     void ReleaseVulkanObject(BufferViewWrapper&&   BufferView) const;
@@ -181,6 +185,7 @@ public:
     void ReleaseVulkanObject(QueryPoolWrapper&&     QueryPool) const;
     void ReleaseVulkanObject(AccelStructWrapper&&   AccelStruct) const;
     void ReleaseVulkanObject(PipelineCacheWrapper&& PSOCache) const;
+    void ReleaseVulkanObject(DescrUpdateTemplateWrapper&& DescrUpdateTemplate) const;
 
     void FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const;
     void FreeCommandBuffer(VkCommandPool Pool, VkCommandBuffer CmdBuffer) const;
@@ -215,6 +220,10 @@ public:
                               uint32_t                    descriptorCopyCount,
                               const VkCopyDescriptorSet*  pDescriptorCopies) const;
 
+    void UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                         VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                         const void*                pData) const;
+
     VkResult ResetCommandPool(VkCommandPool           vkCmdPool,
                               VkCommandPoolResetFlags flags = 0) const;
 
@@ -74,6 +74,7 @@ public:
         bool Spirv14              = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
         bool Spirv15              = false; // DXC shaders with ray tracing requires Vulkan 1.2 with SPIRV 1.5
         bool SubgroupOps          = false; // Requires Vulkan 1.1
+        bool DescrUpdateTemplate  = false; // Requires Vulkan 1.1
         bool HasPortabilitySubset = false;
         bool RenderPass2          = false;
         bool DrawIndirectCount    = false;
@@ -582,24 +582,29 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         VERIFY_EXPR(DSIndex == pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
         VERIFY_EXPR(const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(DSIndex).GetVkDescriptorSet() == VK_NULL_HANDLE);
 
-        const VkDescriptorSetLayout vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
+        const Uint64 CacheVersion = ResourceCache.GetContentVersion();
+        if (SetInfo.vkLastDynamicSet == VK_NULL_HANDLE || SetInfo.LastDynamicSetCacheVersion != CacheVersion)
+        {
+            const VkDescriptorSetLayout vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
 
-        VkDescriptorSet vkDynamicDescrSet   = VK_NULL_HANDLE;
-        const char*     DynamicDescrSetName = "Dynamic Descriptor Set";
+            const char* DynamicDescrSetName = "Dynamic Descriptor Set";
 #ifdef DILIGENT_DEVELOPMENT
-        String _DynamicDescrSetName{DynamicDescrSetName};
-        _DynamicDescrSetName.append(" (");
-        _DynamicDescrSetName.append(pSignature->GetDesc().Name);
-        _DynamicDescrSetName += ')';
-        DynamicDescrSetName = _DynamicDescrSetName.c_str();
+            String _DynamicDescrSetName{DynamicDescrSetName};
+            _DynamicDescrSetName.append(" (");
+            _DynamicDescrSetName.append(pSignature->GetDesc().Name);
+            _DynamicDescrSetName += ')';
+            DynamicDescrSetName = _DynamicDescrSetName.c_str();
 #endif
-        // Allocate vulkan descriptor set for dynamic resources
-        vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
+            // Allocate vulkan descriptor set for dynamic resources
+            SetInfo.vkLastDynamicSet           = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
+            SetInfo.LastDynamicSetCacheVersion = CacheVersion;
 
-        // Write all dynamic resource descriptors
-        pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
+            // Write all dynamic resource descriptors
+            pSignature->CommitDynamicResources(ResourceCache, SetInfo.vkLastDynamicSet);
+        }
+        // Otherwise none of the resources in the cache have changed since the set was written
 
-        SetInfo.vkSets[DSIndex] = vkDynamicDescrSet;
+        SetInfo.vkSets[DSIndex] = SetInfo.vkLastDynamicSet;
         ++DSIndex;
     }
 
@@ -1424,6 +1429,16 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(QueueMask);
 
+    // Dynamic descriptor sets allocated during this frame can't be reused anymore
+    for (ResourceBindInfo& BindInfo : m_BindInfo)
+    {
+        for (ResourceBindInfo::DescriptorSetInfo& SetInfo : BindInfo.SetInfo)
+        {
+            SetInfo.vkLastDynamicSet           = VK_NULL_HANDLE;
+            SetInfo.LastDynamicSetCacheVersion = 0;
+        }
+    }
+
     EndFrame();
 }
 
@@ -1129,6 +1129,9 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 EnabledExtFeats.SubgroupOps = true;
             }
 
+            // Core Vulkan 1.1 functionality that does not need to be explicitly enabled
+            EnabledExtFeats.DescrUpdateTemplate = DeviceExtFeatures.DescrUpdateTemplate;
+
             if (EnabledFeatures.InstanceDataStepRate != DEVICE_FEATURE_STATE_DISABLED)
             {
                 VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME));
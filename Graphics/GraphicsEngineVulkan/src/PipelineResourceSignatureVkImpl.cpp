@@ -156,7 +156,7 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
             },
             [this]() //
             {
-                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data());
+                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), GetDescriptorDataSetIndex());
             });
     }
     catch (...)
@@ -473,9 +473,56 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        if (HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC) && LogicalDevice.GetEnabledExtFeatures().DescrUpdateTemplate)
+            CreateDynamicSetUpdateTemplate();
     }
 }
 
+void PipelineResourceSignatureVkImpl::CreateDynamicSetUpdateTemplate()
+{
+    // Every dynamic resource is described by a single template entry that reads the descriptor data
+    // of all array elements directly from the resource cache (see ShaderResourceCacheVk::DescriptorData).
+    constexpr ResourceCacheContentType CacheType      = ResourceCacheContentType::SRB;
+    const std::pair<Uint32, Uint32>    DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    std::vector<VkDescriptorUpdateTemplateEntry> Entries;
+    Entries.reserve(DynResIdxRange.second - DynResIdxRange.first);
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const PipelineResourceAttribsType& Attr      = GetResourceAttribs(ResIdx);
+        const DescriptorType               DescrType = Attr.GetDescriptorType();
+        VERIFY_EXPR(Attr.DescrSet == GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>());
+
+        // Immutable samplers are permanently bound into the set layout and must not be written
+        if (DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue;
+
+        VkDescriptorUpdateTemplateEntry Entry;
+        Entry.dstBinding      = Attr.BindingIndex;
+        Entry.dstArrayElement = 0;
+        Entry.descriptorCount = Attr.ArraySize;
+        Entry.descriptorType  = DescriptorTypeToVkDescriptorType(DescrType);
+        Entry.offset          = size_t{Attr.CacheOffset(CacheType)} * sizeof(ShaderResourceCacheVk::DescriptorData);
+        Entry.stride          = sizeof(ShaderResourceCacheVk::DescriptorData);
+        Entries.push_back(Entry);
+    }
+
+    if (Entries.empty())
+        return;
+
+    VkDescriptorUpdateTemplateCreateInfo TemplateCI{};
+    TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    TemplateCI.pNext                      = nullptr;
+    TemplateCI.flags                      = 0;
+    TemplateCI.descriptorUpdateEntryCount = StaticCast<uint32_t>(Entries.size());
+    TemplateCI.pDescriptorUpdateEntries   = Entries.data();
+    TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    TemplateCI.descriptorSetLayout        = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+
+    m_DynamicSetUpdateTemplate = GetDevice()->GetLogicalDevice().CreateDescriptorUpdateTemplate(TemplateCI, m_Desc.Name);
+}
+
 PipelineResourceSignatureVkImpl::~PipelineResourceSignatureVkImpl()
 {
     Destruct();
@@ -489,9 +536,18 @@ void PipelineResourceSignatureVkImpl::Destruct()
             GetDevice()->SafeReleaseDeviceObject(std::move(Layout), ~0ull);
     }
 
+    if (m_DynamicSetUpdateTemplate)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_DynamicSetUpdateTemplate), ~0ull);
+
     TPipelineResourceSignatureBase::Destruct();
 }
 
+void PipelineResourceSignatureVkImpl::EnqueueRecycledSRBData(SRBDataType* pData)
+{
+    // An SRB may be used by any immediate context
+    GetDevice()->SafeReleaseDeviceObject(DeferredSRBDataRecycler{this, pData}, ~0ull);
+}
+
 void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache)
 {
     const Uint32 NumSets = GetNumDescriptorSets();
@@ -501,7 +557,7 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
 #endif
 
     IMemoryAllocator& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
-    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data());
+    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data(), GetDescriptorDataSetIndex());
 
     const Uint32                   TotalResources = GetTotalResourceCount();
     const ResourceCacheContentType CacheType      = ResourceCache.GetContentType();
@@ -608,6 +664,13 @@ Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSi
     return HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? 1 : 0;
 }
 
+Uint32 PipelineResourceSignatureVkImpl::GetDescriptorDataSetIndex() const
+{
+    // Static and mutable descriptors are written to the set right away, and dynamic descriptors
+    // only need to be kept when they are written with the update template.
+    return m_DynamicSetUpdateTemplate != VK_NULL_HANDLE ? GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>() : ~0u;
+}
+
 void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
                                                              VkDescriptorSet              vkDynamicDescriptorSet) const
 {
@@ -615,6 +678,19 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
+    const Uint32                                DynamicSetIdx = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
+    const ShaderResourceCacheVk::DescriptorSet& SetResources  = ResourceCache.GetDescriptorSet(DynamicSetIdx);
+    const VulkanUtilities::LogicalDevice&       LogicalDevice = GetDevice()->GetLogicalDevice();
+
+    // The template writes every descriptor in the set, so it can only be used when all resources are bound.
+    // Otherwise, fall back to the batched writes below that skip null resources.
+    if (m_DynamicSetUpdateTemplate && SetResources.AllDescriptorsValid())
+    {
+        VERIFY_EXPR(SetResources.HasDescriptorData());
+        LogicalDevice.UpdateDescriptorSetWithTemplate(vkDynamicDescriptorSet, m_DynamicSetUpdateTemplate, SetResources.GetDescriptorData());
+        return;
+    }
+
 #ifdef DILIGENT_DEBUG
     static constexpr size_t ImgUpdateBatchSize          = 4;
     static constexpr size_t BuffUpdateBatchSize         = 2;
@@ -642,10 +718,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     auto AccelStructIt   = DescrAccelStructArr.begin();
     auto WriteDescrSetIt = WriteDescrSetArr.begin();
 
-    const Uint32                                DynamicSetIdx  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
-    const ShaderResourceCacheVk::DescriptorSet& SetResources   = ResourceCache.GetDescriptorSet(DynamicSetIdx);
-    const VulkanUtilities::LogicalDevice&       LogicalDevice  = GetDevice()->GetLogicalDevice();
-    const std::pair<Uint32, Uint32>             DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    const std::pair<Uint32, Uint32> DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
 
     constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
 
@@ -961,7 +1034,7 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
             },
             [this]() //
             {
-                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data());
+                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), GetDescriptorDataSetIndex());
             });
     }
     catch (...)
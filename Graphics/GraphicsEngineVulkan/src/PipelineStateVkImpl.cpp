@@ -42,6 +42,8 @@
 #include "VulkanTypeConversions.hpp"
 #include "EngineMemory.h"
 #include "StringTools.hpp"
+#include "StageTimings.hpp"
+#include "ThreadPool.hpp"
 
 #if !DILIGENT_NO_HLSL
 #    include "SPIRVTools.hpp"
@@ -595,6 +597,7 @@ PipelineResourceSignatureDescWrapper PipelineStateVkImpl::GetDefaultResourceSign
     Uint32                            SRBAllocationGranularity) noexcept(false)
 {
     PipelineResourceSignatureDescWrapper SignDesc{PSOName, ResourceLayout, SRBAllocationGranularity};
+    const ResourceNameTable              LayoutVarNames{ResourceLayout.Variables, ResourceLayout.NumVariables};
 
     std::unordered_map<ShaderResourceHashKey, const SPIRVShaderResourceAttribs&, ShaderResourceHashKey::Hasher> UniqueResources;
     for (const ShaderStageInfo& Stage : ShaderStages)
@@ -620,7 +623,7 @@ PipelineResourceSignatureDescWrapper PipelineStateVkImpl::GetDefaultResourceSign
                         ShaderResources.GetCombinedSamplerSuffix() :
                         nullptr;
 
-                    const ShaderResourceVariableDesc VarDesc = FindPipelineResourceLayoutVariable(ResourceLayout, Attribs.Name, Stage.Type, SamplerSuffix);
+                    const ShaderResourceVariableDesc VarDesc = FindPipelineResourceLayoutVariable(ResourceLayout, LayoutVarNames, Attribs.Name, Stage.Type, SamplerSuffix);
                     // Note that Attribs.Name != VarDesc.Name for combined samplers
                     const auto it_assigned = UniqueResources.emplace(ShaderResourceHashKey{VarDesc.ShaderStages, Attribs.Name}, Attribs);
                     if (it_assigned.second)
@@ -661,126 +664,150 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
     bool                                                 bStripReflection,
     const char*                                          PipelineName,
     TShaderResources*                                    pDvpShaderResources,
-    TResourceAttibutions*                                pDvpResourceAttibutions) noexcept(false)
+    TResourceAttibutions*                                pDvpResourceAttibutions,
+    IThreadPool*                                         pThreadPool) noexcept(false)
 {
+    // Note that reflection stripping is also timed as SPIR-V optimization
+    ScopedStageTimer Timer{STATE_CREATION_STAGE_SHADER_PATCHING};
+
     if (PipelineName == nullptr)
         PipelineName = "<null>";
 
-    // Verify that pipeline layout is compatible with shader resources and
-    // remap resource bindings.
+    // Shaders are processed in parallel, and the results are merged in the original order
+    struct ShaderInfo
+    {
+        SHADER_TYPE            Type    = SHADER_TYPE_UNKNOWN;
+        const ShaderVkImpl*    pShader = nullptr;
+        std::vector<uint32_t>* pSPIRV  = nullptr;
+        TResourceAttibutions   ResourceAttibutions;
+    };
+    std::vector<ShaderInfo> Shaders;
     for (size_t s = 0; s < ShaderStages.size(); ++s)
     {
-        const std::vector<const ShaderVkImpl*>& Shaders    = ShaderStages[s].Shaders;
-        std::vector<std::vector<uint32_t>>&     SPIRVs     = ShaderStages[s].SPIRVs;
-        const SHADER_TYPE                       ShaderType = ShaderStages[s].Type;
-
-        VERIFY_EXPR(Shaders.size() == SPIRVs.size());
-
-        for (size_t i = 0; i < Shaders.size(); ++i)
+        VERIFY_EXPR(ShaderStages[s].Shaders.size() == ShaderStages[s].SPIRVs.size());
+        for (size_t i = 0; i < ShaderStages[s].Shaders.size(); ++i)
         {
-            const ShaderVkImpl*    pShader = Shaders[i];
-            std::vector<uint32_t>& SPIRV   = SPIRVs[i];
-
-            const auto& pShaderResources = pShader->GetShaderResources();
-            VERIFY_EXPR(pShaderResources);
+            Shaders.emplace_back();
+            ShaderInfo& Info = Shaders.back();
+            Info.Type        = ShaderStages[s].Type;
+            Info.pShader     = ShaderStages[s].Shaders[i];
+            Info.pSPIRV      = &ShaderStages[s].SPIRVs[i];
 
             if (pDvpShaderResources)
-                pDvpShaderResources->emplace_back(pShaderResources);
+                pDvpShaderResources->emplace_back(Info.pShader->GetShaderResources());
+        }
+    }
 
-            pShaderResources->ProcessResources(
-                [&](const SPIRVShaderResourceAttribs& SPIRVAttribs, Uint32) //
+    // Verify that pipeline layout is compatible with shader resources and
+    // remap resource bindings.
+    ParallelFor(pThreadPool, static_cast<Uint32>(Shaders.size()), [&](Uint32 i) {
+        ShaderInfo&            Info       = Shaders[i];
+        const ShaderVkImpl*    pShader    = Info.pShader;
+        const SHADER_TYPE      ShaderType = Info.Type;
+        std::vector<uint32_t>& SPIRV      = *Info.pSPIRV;
+
+        const auto& pShaderResources = pShader->GetShaderResources();
+        VERIFY_EXPR(pShaderResources);
+
+        pShaderResources->ProcessResources(
+            [&](const SPIRVShaderResourceAttribs& SPIRVAttribs, Uint32) //
+            {
+                const ResourceAttribution ResAttribution = GetResourceAttribution(SPIRVAttribs.Name, ShaderType, pSignatures, SignatureCount);
+                if (!ResAttribution)
                 {
-                    const ResourceAttribution ResAttribution = GetResourceAttribution(SPIRVAttribs.Name, ShaderType, pSignatures, SignatureCount);
-                    if (!ResAttribution)
-                    {
-                        LOG_ERROR_AND_THROW("Shader '", pShader->GetDesc().Name, "' contains resource '", SPIRVAttribs.Name,
-                                            "' that is not present in any pipeline resource signature used to create pipeline state '",
-                                            PipelineName, "'.");
-                    }
+                    LOG_ERROR_AND_THROW("Shader '", pShader->GetDesc().Name, "' contains resource '", SPIRVAttribs.Name,
+                                        "' that is not present in any pipeline resource signature used to create pipeline state '",
+                                        PipelineName, "'.");
+                }
 
-                    const PipelineResourceSignatureDesc& SignDesc = ResAttribution.pSignature->GetDesc();
-                    const SHADER_RESOURCE_TYPE           ResType  = SPIRVShaderResourceAttribs::GetShaderResourceType(SPIRVAttribs.Type);
-                    const PIPELINE_RESOURCE_FLAGS        Flags    = SPIRVShaderResourceAttribs::GetPipelineResourceFlags(SPIRVAttribs.Type);
+                const PipelineResourceSignatureDesc& SignDesc = ResAttribution.pSignature->GetDesc();
+                const SHADER_RESOURCE_TYPE           ResType  = SPIRVShaderResourceAttribs::GetShaderResourceType(SPIRVAttribs.Type);
+                const PIPELINE_RESOURCE_FLAGS        Flags    = SPIRVShaderResourceAttribs::GetPipelineResourceFlags(SPIRVAttribs.Type);
 
-                    Uint32 ResourceBinding = ~0u;
-                    Uint32 DescriptorSet   = ~0u;
-                    if (ResAttribution.ResourceIndex != ResourceAttribution::InvalidResourceIndex)
-                    {
-                        const PipelineResourceDesc& ResDesc = ResAttribution.pSignature->GetResourceDesc(ResAttribution.ResourceIndex);
-                        ValidatePipelineResourceCompatibility(ResDesc, ResType, Flags, SPIRVAttribs.ArraySize,
-                                                              pShader->GetDesc().Name, SignDesc.Name);
+                Uint32 ResourceBinding = ~0u;
+                Uint32 DescriptorSet   = ~0u;
+                if (ResAttribution.ResourceIndex != ResourceAttribution::InvalidResourceIndex)
+                {
+                    const PipelineResourceDesc& ResDesc = ResAttribution.pSignature->GetResourceDesc(ResAttribution.ResourceIndex);
+                    ValidatePipelineResourceCompatibility(ResDesc, ResType, Flags, SPIRVAttribs.ArraySize,
+                                                          pShader->GetDesc().Name, SignDesc.Name);
 
-                        const PipelineResourceSignatureVkImpl::ResourceAttribs& ResAttribs{ResAttribution.pSignature->GetResourceAttribs(ResAttribution.ResourceIndex)};
-                        ResourceBinding = ResAttribs.BindingIndex;
-                        DescriptorSet   = ResAttribs.DescrSet;
-                    }
-                    else if (ResAttribution.ImmutableSamplerIndex != ResourceAttribution::InvalidResourceIndex)
-                    {
-                        if (ResType != SHADER_RESOURCE_TYPE_SAMPLER)
-                        {
-                            LOG_ERROR_AND_THROW("Shader '", pShader->GetDesc().Name, "' contains resource with name '", SPIRVAttribs.Name,
-                                                "' and type '", GetShaderResourceTypeLiteralName(ResType),
-                                                "' that is not compatible with immutable sampler defined in pipeline resource signature '",
-                                                SignDesc.Name, "'.");
-                        }
-                        const ImmutableSamplerAttribsVk& SamAttribs{ResAttribution.pSignature->GetImmutableSamplerAttribs(ResAttribution.ImmutableSamplerIndex)};
-                        ResourceBinding = SamAttribs.BindingIndex;
-                        DescriptorSet   = SamAttribs.DescrSet;
-                    }
-                    else
+                    const PipelineResourceSignatureVkImpl::ResourceAttribs& ResAttribs{ResAttribution.pSignature->GetResourceAttribs(ResAttribution.ResourceIndex)};
+                    ResourceBinding = ResAttribs.BindingIndex;
+                    DescriptorSet   = ResAttribs.DescrSet;
+                }
+                else if (ResAttribution.ImmutableSamplerIndex != ResourceAttribution::InvalidResourceIndex)
+                {
+                    if (ResType != SHADER_RESOURCE_TYPE_SAMPLER)
                     {
-                        UNEXPECTED("Either immutable sampler or resource index should be valid");
+                        LOG_ERROR_AND_THROW("Shader '", pShader->GetDesc().Name, "' contains resource with name '", SPIRVAttribs.Name,
+                                            "' and type '", GetShaderResourceTypeLiteralName(ResType),
+                                            "' that is not compatible with immutable sampler defined in pipeline resource signature '",
+                                            SignDesc.Name, "'.");
                     }
+                    const ImmutableSamplerAttribsVk& SamAttribs{ResAttribution.pSignature->GetImmutableSamplerAttribs(ResAttribution.ImmutableSamplerIndex)};
+                    ResourceBinding = SamAttribs.BindingIndex;
+                    DescriptorSet   = SamAttribs.DescrSet;
+                }
+                else
+                {
+                    UNEXPECTED("Either immutable sampler or resource index should be valid");
+                }
 
-                    VERIFY_EXPR(ResourceBinding != ~0u && DescriptorSet != ~0u);
-                    DescriptorSet += BindIndexToDescSetIndex[SignDesc.BindingIndex];
-                    if (bVerifyOnly)
+                VERIFY_EXPR(ResourceBinding != ~0u && DescriptorSet != ~0u);
+                DescriptorSet += BindIndexToDescSetIndex[SignDesc.BindingIndex];
+                if (bVerifyOnly)
+                {
+                    const Uint32 SpvBinding  = SPIRV[SPIRVAttribs.BindingDecorationOffset];
+                    const Uint32 SpvDescrSet = SPIRV[SPIRVAttribs.DescriptorSetDecorationOffset];
+                    if (SpvBinding != ResourceBinding)
                     {
-                        const Uint32 SpvBinding  = SPIRV[SPIRVAttribs.BindingDecorationOffset];
-                        const Uint32 SpvDescrSet = SPIRV[SPIRVAttribs.DescriptorSetDecorationOffset];
-                        if (SpvBinding != ResourceBinding)
-                        {
-                            LOG_ERROR_AND_THROW("Shader '", pShader->GetDesc().Name, "' maps resource '", SPIRVAttribs.Name,
-                                                "' to binding ", SpvBinding, ", but the same resource in pipeline resource signature '",
-                                                SignDesc.Name, "' is mapped to binding ", ResourceBinding, '.');
-                        }
-                        if (SpvDescrSet != DescriptorSet)
-                        {
-                            LOG_ERROR_AND_THROW("Shader '", pShader->GetDesc().Name, "' maps resource '", SPIRVAttribs.Name,
-                                                "' to descriptor set ", SpvDescrSet, ", but the same resource in pipeline resource signature '",
-                                                SignDesc.Name, "' is mapped to set ", DescriptorSet, '.');
-                        }
+                        LOG_ERROR_AND_THROW("Shader '", pShader->GetDesc().Name, "' maps resource '", SPIRVAttribs.Name,
+                                            "' to binding ", SpvBinding, ", but the same resource in pipeline resource signature '",
+                                            SignDesc.Name, "' is mapped to binding ", ResourceBinding, '.');
                     }
-                    else
+                    if (SpvDescrSet != DescriptorSet)
                     {
-                        SPIRV[SPIRVAttribs.BindingDecorationOffset]       = ResourceBinding;
-                        SPIRV[SPIRVAttribs.DescriptorSetDecorationOffset] = DescriptorSet;
+                        LOG_ERROR_AND_THROW("Shader '", pShader->GetDesc().Name, "' maps resource '", SPIRVAttribs.Name,
+                                            "' to descriptor set ", SpvDescrSet, ", but the same resource in pipeline resource signature '",
+                                            SignDesc.Name, "' is mapped to set ", DescriptorSet, '.');
                     }
+                }
+                else
+                {
+                    SPIRV[SPIRVAttribs.BindingDecorationOffset]       = ResourceBinding;
+                    SPIRV[SPIRVAttribs.DescriptorSetDecorationOffset] = DescriptorSet;
+                }
 
-                    if (pDvpResourceAttibutions)
-                        pDvpResourceAttibutions->emplace_back(ResAttribution);
-                });
+                if (pDvpResourceAttibutions)
+                    Info.ResourceAttibutions.emplace_back(ResAttribution);
+            });
 
-            if (bStripReflection)
-            {
+        if (bStripReflection)
+        {
 #if !DILIGENT_NO_HLSL
-                // We have to strip reflection instructions to fix the following validation error:
-                //     SPIR-V module not valid: DecorateStringGOOGLE requires one of the following extensions: SPV_GOOGLE_decorate_string
-                // Optimizer also performs validation and may catch problems with the byte code.
-                // NB: SPIRV offsets become INVALID after this operation.
-                SPIRV_OPTIMIZATION_FLAGS OptimizationFlags = SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION;
-                if (pShaderResources->IsHLSLSource())
-                {
-                    OptimizationFlags |= SPIRV_OPTIMIZATION_FLAG_LEGALIZATION;
-                }
-                std::vector<uint32_t> StrippedSPIRV = OptimizeSPIRV(SPIRV, SPV_ENV_MAX, OptimizationFlags);
-                if (!StrippedSPIRV.empty())
-                    SPIRV = std::move(StrippedSPIRV);
-                else
-                    LOG_ERROR("Failed to strip reflection information from shader '", pShader->GetDesc().Name, "'. This may indicate a problem with the byte code.");
-#endif
+            // We have to strip reflection instructions to fix the following validation error:
+            //     SPIR-V module not valid: DecorateStringGOOGLE requires one of the following extensions: SPV_GOOGLE_decorate_string
+            // Optimizer also performs validation and may catch problems with the byte code.
+            // NB: SPIRV offsets become INVALID after this operation.
+            SPIRV_OPTIMIZATION_FLAGS OptimizationFlags = SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION;
+            if (pShaderResources->IsHLSLSource())
+            {
+                OptimizationFlags |= SPIRV_OPTIMIZATION_FLAG_LEGALIZATION;
             }
+            std::vector<uint32_t> StrippedSPIRV = OptimizeSPIRV(SPIRV, SPV_ENV_MAX, OptimizationFlags);
+            if (!StrippedSPIRV.empty())
+                SPIRV = std::move(StrippedSPIRV);
+            else
+                LOG_ERROR("Failed to strip reflection information from shader '", pShader->GetDesc().Name, "'. This may indicate a problem with the byte code.");
+#endif
         }
+    });
+
+    if (pDvpResourceAttibutions)
+    {
+        for (ShaderInfo& Info : Shaders)
+            pDvpResourceAttibutions->insert(pDvpResourceAttibutions->end(), Info.ResourceAttibutions.begin(), Info.ResourceAttibutions.end());
     }
 }
 
@@ -818,11 +845,11 @@ void PipelineStateVkImpl::InitPipelineLayout(const PipelineStateCreateInfo& Crea
                                      true,           // bStripReflection
                                      m_Desc.Name,
 #ifdef DILIGENT_DEVELOPMENT
-                                     &m_ShaderResources, &m_ResourceAttibutions
+                                     &m_ShaderResources, &m_ResourceAttibutions,
 #else
-                                     nullptr, nullptr
+                                     nullptr, nullptr,
 #endif
-        );
+                                     GetDevice()->GetShaderCompilationThreadPool());
     }
 }
 
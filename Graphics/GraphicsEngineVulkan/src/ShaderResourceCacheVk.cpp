@@ -29,6 +29,9 @@
 
 #include "ShaderResourceCacheVk.hpp"
 
+#include <atomic>
+#include <cstring>
+
 #include "DeviceContextVkImpl.hpp"
 #include "BufferViewVkImpl.hpp"
 #include "TextureViewVkImpl.hpp"
@@ -41,16 +44,27 @@
 namespace Diligent
 {
 
-size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes)
+namespace
+{
+
+// Cache content versions are unique across all caches, so that a version alone
+// identifies the contents of a particular cache.
+std::atomic<Uint64> g_NextCacheContentVersion{1};
+
+} // namespace
+
+size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes, Uint32 DescriptorDataSet)
 {
     Uint32 TotalResources = 0;
     for (Uint32 t = 0; t < NumSets; ++t)
         TotalResources += SetSizes[t];
     size_t MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * sizeof(Resource);
+    if (DescriptorDataSet < NumSets)
+        MemorySize += SetSizes[DescriptorDataSet] * sizeof(DescriptorData);
     return MemorySize;
 }
 
-void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes)
+void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes, Uint32 DescriptorDataSet)
 {
     VERIFY(!m_pMemory, "Memory has already been allocated");
 
@@ -59,10 +73,11 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
     //  m_pMemory
     //  |
     //  V
-    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  ||
+    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  |  Data[0]  |  ...  |  Data[k-1]  ||
     //
     //
     //  Ns = m_NumSets
+    //  k  = SetSizes[DescriptorDataSet], or 0 if no set keeps descriptor data
 
     m_NumSets = static_cast<Uint16>(NumSets);
     VERIFY(m_NumSets == NumSets, "NumSets (", NumSets, ") exceed maximum representable value");
@@ -74,8 +89,11 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
         m_TotalResources += SetSizes[t];
     }
 
-    const size_t MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource);
-    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes));
+    VERIFY(DescriptorDataSet < NumSets || DescriptorDataSet == ~0u, "Descriptor data set index (", DescriptorDataSet, ") is out of range");
+    const Uint32 NumDescriptorData = DescriptorDataSet < NumSets ? SetSizes[DescriptorDataSet] : 0;
+
+    const size_t MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource) + NumDescriptorData * sizeof(DescriptorData);
+    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes, DescriptorDataSet));
 #ifdef DILIGENT_DEBUG
     m_DbgInitializedResources.resize(m_NumSets);
 #endif
@@ -86,18 +104,21 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
             STDDeleter<void, IMemoryAllocator>(MemAllocator) //
         };
 
-        DescriptorSet* pSets       = reinterpret_cast<DescriptorSet*>(m_pMemory.get());
-        Resource*      pCurrResPtr = reinterpret_cast<Resource*>(pSets + m_NumSets);
+        DescriptorSet*  pSets       = reinterpret_cast<DescriptorSet*>(m_pMemory.get());
+        Resource*       pCurrResPtr = reinterpret_cast<Resource*>(pSets + m_NumSets);
+        DescriptorData* pDataPtr    = reinterpret_cast<DescriptorData*>(pCurrResPtr + m_TotalResources);
         for (Uint32 t = 0; t < NumSets; ++t)
         {
-            new (&GetDescriptorSet(t)) DescriptorSet{SetSizes[t], SetSizes[t] > 0 ? pCurrResPtr : nullptr};
+            new (&GetDescriptorSet(t)) DescriptorSet{SetSizes[t], SetSizes[t] > 0 ? pCurrResPtr : nullptr, t == DescriptorDataSet ? pDataPtr : nullptr};
             pCurrResPtr += SetSizes[t];
 #ifdef DILIGENT_DEBUG
             m_DbgInitializedResources[t].resize(SetSizes[t]);
 #endif
         }
-        VERIFY_EXPR((char*)pCurrResPtr == (char*)m_pMemory.get() + MemorySize);
+        VERIFY_EXPR((char*)(pDataPtr + NumDescriptorData) == (char*)m_pMemory.get() + MemorySize);
     }
+
+    m_ContentVersion = g_NextCacheContentVersion.fetch_add(1);
 }
 
 void ShaderResourceCacheVk::InitializeResources(Uint32 Set, Uint32 Offset, Uint32 ArraySize, DescriptorType Type, bool HasImmutableSampler)
@@ -106,10 +127,16 @@ void ShaderResourceCacheVk::InitializeResources(Uint32 Set, Uint32 Offset, Uint3
     for (Uint32 res = 0; res < ArraySize; ++res)
     {
         new (&DescrSet.GetResource(Offset + res)) Resource{Type, HasImmutableSampler};
+        if (DescrSet.HasDescriptorData())
+            std::memset(&DescrSet.GetDescriptorData(Offset + res), 0, sizeof(DescriptorData));
 #ifdef DILIGENT_DEBUG
         m_DbgInitializedResources[Set][size_t{Offset} + res] = true;
 #endif
     }
+
+    // Immutable separate samplers are never written to the descriptor set
+    if (Type != DescriptorType::Sampler || !HasImmutableSampler)
+        DescrSet.m_NumNullDescriptors += ArraySize;
 }
 
 inline bool IsDynamicDescriptorType(DescriptorType DescrType)
@@ -303,6 +330,8 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
         --m_NumDynamicBuffers;
     }
 
+    const bool WasNull = DstRes.IsNull();
+
     static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
     switch (DstRes.Type)
     {
@@ -328,10 +357,28 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
         ++m_NumDynamicBuffers;
     }
 
-    VkDescriptorSet vkSet = DescrSet.GetVkDescriptorSet();
-    if (vkSet != VK_NULL_HANDLE && DstRes.pObject)
+    if (DstRes.Type != DescriptorType::Sampler || !DstRes.HasImmutableSampler)
     {
-        VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to a non-null set");
+        if (WasNull && !DstRes.IsNull())
+        {
+            VERIFY(DescrSet.m_NumNullDescriptors > 0, "Null descriptor counter must be greater than zero when a null resource is being replaced");
+            --DescrSet.m_NumNullDescriptors;
+        }
+        else if (!WasNull && DstRes.IsNull())
+        {
+            ++DescrSet.m_NumNullDescriptors;
+        }
+    }
+
+    // Static and mutable descriptors are written to the set right away.
+    // Dynamic descriptors are written when the resources are committed, so only their data
+    // is stored here if the set keeps it for the update template.
+    const VkDescriptorSet vkSet = DescrSet.GetVkDescriptorSet();
+    if (DstRes.pObject && GetContentType() == ResourceCacheContentType::SRB && (vkSet != VK_NULL_HANDLE || DescrSet.HasDescriptorData()))
+    {
+        // Do not zero-initialize!
+        DescriptorData  TmpData;
+        DescriptorData& DstData = DescrSet.HasDescriptorData() ? DescrSet.GetDescriptorData(CacheOffset) : TmpData;
 
         VkWriteDescriptorSet WriteDescrSet;
         WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -348,58 +395,53 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
         WriteDescrSet.pTexelBufferView = nullptr;
 
         // Do not zero-initialize!
-        union
-        {
-            VkDescriptorImageInfo                        vkDescrImageInfo;
-            VkDescriptorBufferInfo                       vkDescrBufferInfo;
-            VkBufferView                                 vkDescrBufferView;
-            VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
-        };
+        VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
 
         static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
         switch (DstRes.Type)
         {
             case DescriptorType::Sampler:
-                vkDescrImageInfo         = DstRes.GetSamplerDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
+                DstData.ImageInfo        = DstRes.GetSamplerDescriptorWriteInfo();
+                WriteDescrSet.pImageInfo = &DstData.ImageInfo;
                 break;
 
             case DescriptorType::CombinedImageSampler:
             case DescriptorType::SeparateImage:
             case DescriptorType::StorageImage:
-                vkDescrImageInfo         = DstRes.GetImageDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
+                DstData.ImageInfo        = DstRes.GetImageDescriptorWriteInfo();
+                WriteDescrSet.pImageInfo = &DstData.ImageInfo;
                 break;
 
             case DescriptorType::UniformTexelBuffer:
             case DescriptorType::StorageTexelBuffer:
             case DescriptorType::StorageTexelBuffer_ReadOnly:
-                vkDescrBufferView              = DstRes.GetBufferViewWriteInfo();
-                WriteDescrSet.pTexelBufferView = &vkDescrBufferView;
+                DstData.TexelBufferView        = DstRes.GetBufferViewWriteInfo();
+                WriteDescrSet.pTexelBufferView = &DstData.TexelBufferView;
                 break;
 
             case DescriptorType::UniformBuffer:
             case DescriptorType::UniformBufferDynamic:
-                vkDescrBufferInfo         = DstRes.GetUniformBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
+                DstData.BufferInfo        = DstRes.GetUniformBufferDescriptorWriteInfo();
+                WriteDescrSet.pBufferInfo = &DstData.BufferInfo;
                 break;
 
             case DescriptorType::StorageBuffer:
             case DescriptorType::StorageBuffer_ReadOnly:
             case DescriptorType::StorageBufferDynamic:
             case DescriptorType::StorageBufferDynamic_ReadOnly:
-                vkDescrBufferInfo         = DstRes.GetStorageBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
+                DstData.BufferInfo        = DstRes.GetStorageBufferDescriptorWriteInfo();
+                WriteDescrSet.pBufferInfo = &DstData.BufferInfo;
                 break;
 
             case DescriptorType::InputAttachment:
             case DescriptorType::InputAttachment_General:
-                vkDescrImageInfo         = DstRes.GetInputAttachmentDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
+                DstData.ImageInfo        = DstRes.GetInputAttachmentDescriptorWriteInfo();
+                WriteDescrSet.pImageInfo = &DstData.ImageInfo;
                 break;
 
             case DescriptorType::AccelerationStructure:
                 vkDescrAccelStructInfo = DstRes.GetAccelerationStructureWriteInfo();
+                DstData.AccelStruct    = *vkDescrAccelStructInfo.pAccelerationStructures;
                 WriteDescrSet.pNext    = &vkDescrAccelStructInfo;
                 break;
 
@@ -407,10 +449,15 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
                 UNEXPECTED("Unexpected descriptor type");
         }
 
-        pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
+        if (vkSet != VK_NULL_HANDLE)
+        {
+            VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to a non-null set");
+            pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
+        }
     }
 
     UpdateRevision();
+    m_ContentVersion = g_NextCacheContentVersion.fetch_add(1);
 
     return DstRes;
 }
@@ -116,13 +116,7 @@ void ShaderVariableManagerVk::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableVkImpl* ShaderVariableManagerVk::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableVkImpl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return FindVariable(Name);
 }
 
 
@@ -219,6 +219,26 @@ VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMast
     return Block;
 }
 
+Uint32 VulkanDynamicMemoryManager::AllocateMasterBlocks(OffsetType SizeInBytes, OffsetType Alignment, Uint32 NumBlocks, std::vector<MasterBlock>& Blocks)
+{
+    if (Alignment == 0)
+        Alignment = MasterBlockAlignment;
+
+    Uint32 NumAllocated = SizeInBytes <= GetSize() ? TBase::AllocateMasterBlocks(SizeInBytes, Alignment, NumBlocks, Blocks) : 0;
+    if (NumAllocated == 0)
+    {
+        // Out of space: take the slow path that waits for the GPU and reports the errors
+        MasterBlock Block = AllocateMasterBlock(SizeInBytes, Alignment);
+        if (!Block.IsValid())
+            return 0;
+        Blocks.emplace_back(std::move(Block));
+        return 1;
+    }
+
+    m_TotalPeakSize = std::max(m_TotalPeakSize, GetUsedSize());
+    return NumAllocated;
+}
+
 
 VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 Alignment)
 {
@@ -244,7 +264,7 @@ VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 A
     {
         if (m_CurrOffset == InvalidOffset || SizeInBytes + (AlignUp(m_CurrOffset, size_t{Alignment}) - m_CurrOffset) > m_AvailableSize)
         {
-            MasterBlock Block = m_GlobalDynamicMemMgr.AllocateMasterBlock(m_MasterBlockSize, 0);
+            MasterBlock Block = m_MasterBlockCache.Allocate();
             if (Block.IsValid())
             {
                 m_CurrOffset = Block.UnalignedOffset;
@@ -288,6 +308,9 @@ void VulkanDynamicHeap::ReleaseMasterBlocks(RenderDeviceVkImpl& DeviceVkImpl, Ui
 {
     m_GlobalDynamicMemMgr.ReleaseMasterBlocks(m_MasterBlocks, DeviceVkImpl, CmdQueueMask);
     m_MasterBlocks.clear();
+    // Cached pages have not been used by the GPU. They are kept for the next frame
+    // and are only returned to the manager once the heap goes idle.
+    m_MasterBlockCache.EndFrame();
 
     m_CurrOffset    = InvalidOffset;
     m_AvailableSize = 0;
@@ -438,6 +438,13 @@ PipelineCacheWrapper LogicalDevice::CreatePipelineCache(const VkPipelineCacheCre
     return CreateVulkanObject<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(vkCreatePipelineCache, CI, DebugName, "pipeline cache");
 }
 
+DescrUpdateTemplateWrapper LogicalDevice::CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfo& TemplateCI, const char* DebugName) const
+{
+    VERIFY_EXPR(TemplateCI.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO);
+    VERIFY(m_EnabledExtFeatures.DescrUpdateTemplate, "Descriptor update templates are not supported by this device");
+    return CreateVulkanObject<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(vkCreateDescriptorUpdateTemplate, TemplateCI, DebugName, "descriptor update template");
+}
+
 void LogicalDevice::ReleaseVulkanObject(CommandPoolWrapper&& CmdPool) const
 {
     vkDestroyCommandPool(m_VkDevice, CmdPool.m_VkObject, m_VkAllocator);
@@ -556,6 +563,12 @@ void LogicalDevice::ReleaseVulkanObject(PipelineCacheWrapper&& PipeCache) const
     PipeCache.m_VkObject = VK_NULL_HANDLE;
 }
 
+void LogicalDevice::ReleaseVulkanObject(DescrUpdateTemplateWrapper&& DescrUpdateTemplate) const
+{
+    vkDestroyDescriptorUpdateTemplate(m_VkDevice, DescrUpdateTemplate.m_VkObject, m_VkAllocator);
+    DescrUpdateTemplate.m_VkObject = VK_NULL_HANDLE;
+}
+
 void LogicalDevice::FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const
 {
     VERIFY_EXPR(Pool != VK_NULL_HANDLE && Set != VK_NULL_HANDLE);
@@ -698,6 +711,14 @@ void LogicalDevice::UpdateDescriptorSets(uint32_t                    descriptorW
     vkUpdateDescriptorSets(m_VkDevice, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 }
 
+void LogicalDevice::UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                                    VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                    const void*                pData) const
+{
+    VERIFY_EXPR(m_EnabledExtFeatures.DescrUpdateTemplate);
+    vkUpdateDescriptorSetWithTemplate(m_VkDevice, descriptorSet, descriptorUpdateTemplate, pData);
+}
+
 VkResult LogicalDevice::ResetCommandPool(VkCommandPool           vkCmdPool,
                                          VkCommandPoolResetFlags flags) const
 {
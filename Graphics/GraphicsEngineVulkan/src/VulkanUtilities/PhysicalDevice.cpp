@@ -226,6 +226,10 @@ PhysicalDevice::PhysicalDevice(const CreateInfo& CI) :
             m_ExtProperties.Subgroup.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
         }
 
+        // Descriptor update templates are part of Vulkan 1.1 core.
+        if (m_vkVersion >= VK_API_VERSION_1_1)
+            m_ExtFeatures.DescrUpdateTemplate = true;
+
         if (IsExtensionSupported(VK_EXT_VERTEX_ATTRIBUTE_DIVISOR_EXTENSION_NAME))
         {
             *NextFeat = &m_ExtFeatures.VertexAttributeDivisor;
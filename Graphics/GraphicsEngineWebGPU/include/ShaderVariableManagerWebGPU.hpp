@@ -82,7 +82,8 @@ public:
 
     Uint32 GetVariableCount() const { return m_NumVariables; }
 
-    IObject& GetOwner() { return m_Owner; }
+    IObject& GetOwner() { return *m_pOwner; }
+    void     SetOwner(IObject& Owner) { m_pOwner = &Owner; }
 
 private:
     friend TBase;
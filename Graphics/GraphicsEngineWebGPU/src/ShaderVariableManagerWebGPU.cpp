@@ -117,13 +117,7 @@ void ShaderVariableManagerWebGPU::Destroy(IMemoryAllocator& Allocator)
 
 ShaderVariableWebGPUImpl* ShaderVariableManagerWebGPU::GetVariable(const Char* Name) const
 {
-    for (Uint32 v = 0; v < m_NumVariables; ++v)
-    {
-        ShaderVariableWebGPUImpl& Var = m_pVariables[v];
-        if (strcmp(Var.GetDesc().Name, Name) == 0)
-            return &Var;
-    }
-    return nullptr;
+    return FindVariable(Name);
 }
 
 ShaderVariableWebGPUImpl* ShaderVariableManagerWebGPU::GetVariable(Uint32 Index) const
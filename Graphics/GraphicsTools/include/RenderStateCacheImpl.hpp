@@ -30,7 +30,13 @@
 /// Definition of the Diligent::RenderStateCacheImpl class
 
 #include <unordered_map>
+#include <unordered_set>
 #include <mutex>
+#include <shared_mutex>
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <string>
 
 #include "RenderStateCache.h"
 #include "SerializationDevice.h"
@@ -38,6 +44,7 @@
 #include "UniqueIdentifier.hpp"
 #include "ObjectBase.hpp"
 #include "XXH128Hasher.hpp"
+#include "RenderStateCacheStorage.hpp"
 
 namespace Diligent
 {
@@ -52,13 +59,15 @@ public:
     RenderStateCacheImpl(IReferenceCounters*               pRefCounters,
                          const RenderStateCacheCreateInfo& CreateInfo);
 
+    ~RenderStateCacheImpl();
+
     IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_RenderStateCache, TBase);
 
     virtual bool DILIGENT_CALL_TYPE Load(const IDataBlob* pArchive,
                                          Uint32           ContentVersion,
                                          bool             MakeCopy) override final
     {
-        return m_pDearchiver->LoadArchive(pArchive, ContentVersion, MakeCopy);
+        return LoadArchive(pArchive, ContentVersion, MakeCopy);
     }
 
     virtual bool DILIGENT_CALL_TYPE CreateShader(const ShaderCreateInfo& ShaderCI,
@@ -96,6 +105,21 @@ public:
 
     virtual Bool DILIGENT_CALL_TYPE WriteToStream(Uint32 ContentVersion, IFileStream* pStream) override final;
 
+    virtual Bool DILIGENT_CALL_TYPE AppendToStorage(Uint32 ContentVersion) override final;
+
+    virtual Uint32 DILIGENT_CALL_TYPE RefreshFromStorage(Uint32 ContentVersion) override final;
+
+    virtual void DILIGENT_CALL_TYPE SetFrameIndex(Uint32 FrameIndex) override final
+    {
+        m_FrameIndex.store(FrameIndex);
+    }
+
+    virtual Bool DILIGENT_CALL_TYPE WriteUsageLog(IDataBlob** ppLog) override final;
+
+    virtual Uint32 DILIGENT_CALL_TYPE WarmUp(const RenderStateCacheWarmUpInfo& WarmUpInfo) override final;
+
+    virtual void DILIGENT_CALL_TYPE GetWarmUpStats(RenderStateCacheWarmUpStats& Stats) const override final;
+
     virtual void DILIGENT_CALL_TYPE Reset() override final;
 
     virtual Uint32 DILIGENT_CALL_TYPE Reload(ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline, void* pUserData) override final;
@@ -134,6 +158,32 @@ private:
     bool CreatePipelineState(const CreateInfoType& PSOCreateInfo,
                              IPipelineState**      ppPipelineState);
 
+    RefCntAutoPtr<IShader>        UnpackShader(const char* HashStr, const char* Name);
+    RefCntAutoPtr<IPipelineState> UnpackPipelineState(PIPELINE_TYPE PipelineType, const char* HashStr, const char* Name);
+
+    struct UsageLogEntry
+    {
+        XXH128Hash  Hash;
+        std::string Name;
+        bool        HasName    = false;
+        Uint32      FrameIndex = 0;
+
+        // PIPELINE_TYPE_INVALID for shaders
+        PIPELINE_TYPE PipelineType = PIPELINE_TYPE_INVALID;
+    };
+    static bool ReadUsageLog(const IDataBlob* pLog, std::vector<UsageLogEntry>& Entries);
+
+    void LogUsage(const XXH128Hash& Hash, const char* Name, PIPELINE_TYPE PipelineType);
+
+    void WarmUpEntry(const UsageLogEntry& Entry);
+
+    RefCntAutoPtr<IShader>        TakeWarmedUpShader(const XXH128Hash& Hash);
+    RefCntAutoPtr<IPipelineState> TakeWarmedUpPipeline(const XXH128Hash& Hash);
+
+    void CancelWarmUp();
+
+    bool LoadArchive(const IDataBlob* pArchive, Uint32 ContentVersion, bool MakeCopy);
+
 private:
     RefCntAutoPtr<IRenderDevice>                   m_pDevice;
     const RENDER_DEVICE_TYPE                       m_DeviceType;
@@ -142,6 +192,14 @@ private:
     RefCntAutoPtr<ISerializationDevice>            m_pSerializationDevice;
     RefCntAutoPtr<IArchiver>                       m_pArchiver;
     RefCntAutoPtr<IDearchiver>                     m_pDearchiver;
+    std::unique_ptr<RenderStateCacheStorage>       m_pStorage;
+
+    // Loading an archive modifies the dearchiver's archive list, so it must not
+    // run while the warm-up tasks unpack render states.
+    std::shared_mutex m_DearchiverMtx;
+
+    // Whether the archiver contains render states that have not been written yet
+    std::atomic<bool> m_ArchiverHasData{false};
 
     std::mutex                                             m_ShadersMtx;
     std::unordered_map<XXH128Hash, RefCntWeakPtr<IShader>> m_Shaders;
@@ -156,6 +214,39 @@ private:
     std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IPipelineState>> m_ReloadablePipelines;
 
     Uint32 m_ReloadVersion = 0;
+
+    std::atomic<Uint32> m_FrameIndex{0};
+
+    std::mutex                     m_UsageLogMtx;
+    std::vector<UsageLogEntry>     m_UsageLog;
+    std::unordered_set<XXH128Hash> m_LoggedHashes;
+
+    struct WarmUpObject
+    {
+        RefCntAutoPtr<IShader>        pShader;
+        RefCntAutoPtr<IPipelineState> pPSO;
+
+        bool IsReady = false;
+    };
+    struct WarmUpTask
+    {
+        RefCntAutoPtr<IThreadPool> pThreadPool;
+        RefCntAutoPtr<IAsyncTask>  pTask;
+    };
+    std::mutex                                   m_WarmUpMtx;
+    std::unordered_map<XXH128Hash, WarmUpObject> m_WarmUpObjects;
+    std::vector<WarmUpTask>                      m_WarmUpTasks;
+    // Allows skipping the warm-up lookup when there are no warm-up objects
+    std::atomic<bool> m_HasWarmUpObjects{false};
+
+    struct
+    {
+        std::atomic<Uint32> NumScheduled{0};
+        std::atomic<Uint32> NumCreated{0};
+        std::atomic<Uint32> NumFailed{0};
+        std::atomic<Uint32> NumHits{0};
+        std::atomic<Uint32> NumLate{0};
+    } m_WarmUpStats;
 };
 
 } // namespace Diligent
@@ -114,6 +114,26 @@ struct RenderStateCacheCreateInfo
     /// shaders. If null, original source factory will be used.
     IShaderSourceInputStreamFactory* pReloadSource DEFAULT_INITIALIZER(nullptr);
 
+    /// Optional path to the shared append-only storage file.
+
+    /// If not null, the cache opens (or creates) the file and supports the
+    /// `AppendToStorage()` and `RefreshFromStorage()` methods. Multiple caches,
+    /// in the same or in different processes, may use the same file: every
+    /// `AppendToStorage()` call adds a record with the new render states only,
+    /// and `RefreshFromStorage()` loads the records appended by other caches
+    /// since the last call. Writers are serialized by an OS file lock;
+    /// readers do not take the lock.
+    const Char* StorageFilePath DEFAULT_INITIALIZER(nullptr);
+
+    /// Whether to record the usage log.
+
+    /// When enabled, the cache records the hash, the name and the frame index
+    /// (see IRenderStateCache::SetFrameIndex) of every shader and pipeline state
+    /// the first time it is requested. The log can be written with
+    /// IRenderStateCache::WriteUsageLog and replayed by IRenderStateCache::WarmUp
+    /// on the next launch.
+    bool EnableUsageLog DEFAULT_INITIALIZER(false);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr RenderStateCacheCreateInfo() noexcept
     {}
@@ -125,19 +145,62 @@ struct RenderStateCacheCreateInfo
         RENDER_STATE_CACHE_FILE_HASH_MODE _FileHashMode      = RenderStateCacheCreateInfo{}.FileHashMode,
         bool                              _EnableHotReload   = RenderStateCacheCreateInfo{}.EnableHotReload,
         bool                              _OptimizeGLShaders = RenderStateCacheCreateInfo{}.OptimizeGLShaders,
-        IShaderSourceInputStreamFactory*  _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource) noexcept :
+        IShaderSourceInputStreamFactory*  _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource,
+        const Char*                       _StorageFilePath   = RenderStateCacheCreateInfo{}.StorageFilePath,
+        bool                              _EnableUsageLog    = RenderStateCacheCreateInfo{}.EnableUsageLog) noexcept :
         pDevice{_pDevice},
         pArchiverFactory{_pArchiverFactory},
         LogLevel{_LogLevel},
         FileHashMode{_FileHashMode},
         EnableHotReload{_EnableHotReload},
         OptimizeGLShaders{_OptimizeGLShaders},
-        pReloadSource{_pReloadSource}
+        pReloadSource{_pReloadSource},
+        StorageFilePath{_StorageFilePath},
+        EnableUsageLog{_EnableUsageLog}
     {}
 #endif
 };
 typedef struct RenderStateCacheCreateInfo RenderStateCacheCreateInfo;
 
+
+/// Render state cache warm-up parameters, see IRenderStateCache::WarmUp.
+struct RenderStateCacheWarmUpInfo
+{
+    /// A pointer to the usage log written by IRenderStateCache::WriteUsageLog.
+    const IDataBlob* pUsageLog DEFAULT_INITIALIZER(nullptr);
+
+    /// An optional thread pool that will be used to create the render states
+    /// in the background. If null, all render states are created by the calling thread.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
+
+    /// Render states first requested after this frame are not warmed up.
+    Uint32 MaxFrameIndex DEFAULT_INITIALIZER(~0u);
+};
+typedef struct RenderStateCacheWarmUpInfo RenderStateCacheWarmUpInfo;
+
+
+/// Render state cache warm-up statistics, see IRenderStateCache::GetWarmUpStats.
+struct RenderStateCacheWarmUpStats
+{
+    /// The number of usage log entries scheduled for warm-up.
+    Uint32 NumScheduled DEFAULT_INITIALIZER(0);
+
+    /// The number of render states created by the warm-up.
+    Uint32 NumCreated DEFAULT_INITIALIZER(0);
+
+    /// The number of render states that could not be created by the warm-up,
+    /// for instance because they are not present in the loaded cache data.
+    Uint32 NumFailed DEFAULT_INITIALIZER(0);
+
+    /// The number of requests that were satisfied by the warmed-up render states.
+    Uint32 NumHits DEFAULT_INITIALIZER(0);
+
+    /// The number of requests for the scheduled render states that arrived
+    /// before the warm-up had created them.
+    Uint32 NumLate DEFAULT_INITIALIZER(0);
+};
+typedef struct RenderStateCacheWarmUpStats RenderStateCacheWarmUpStats;
+
 #include "../../../Primitives/interface/DefineRefMacro.h"
 
 /// Type of the callback function called by the IRenderStateCache::Reload method.
@@ -271,8 +334,95 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
                                        Uint32       ContentVersion, 
                                        IFileStream* pStream) PURE;
 
+    /// Appends new render states to the shared storage file.
+
+    /// \param [in]  ContentVersion - The version of the content to write.
+    ///
+    /// \return     true if the data was appended successfully or there were no new
+    ///             render states, and false otherwise.
+    ///
+    /// Only the render states that were added since the last call to `WriteToBlob()`,
+    /// `WriteToStream()` or `AppendToStorage()` are written, so the cost of the
+    /// method does not depend on the total size of the storage.
+    /// The cache must have been created with a non-null `StorageFilePath`.
+    ///
+    /// \remarks    If ContentVersion is `~0u` (aka `0xFFFFFFFF`), the version of the
+    ///             previously loaded content will be used, or 0 if none was loaded.
+    ///
+    /// \note       This method is not thread-safe and must not be called simultaneously
+    ///             with other methods.
+    VIRTUAL Bool METHOD(AppendToStorage)(THIS_
+                                         Uint32 ContentVersion DEFAULT_VALUE(~0u)) PURE;
+
+    /// Loads the render states appended to the shared storage file by other caches.
+
+    /// \param [in]  ContentVersion - The expected version of the content.
+    ///                               Records with a different version are skipped.
+    ///                               If default value is used (`~0u` aka `0xFFFFFFFF`),
+    ///                               the version will not be checked.
+    ///
+    /// \return     The number of storage records that were loaded.
+    ///
+    /// The first call loads all records in the file. Subsequent calls only read the records
+    /// that were committed since the previous call. Records written by this cache are skipped.
+    /// The cache must have been created with a non-null `StorageFilePath`.
+    ///
+    /// \note       This method is not thread-safe and must not be called simultaneously
+    ///             with other methods.
+    VIRTUAL Uint32 METHOD(RefreshFromStorage)(THIS_
+                                              Uint32 ContentVersion DEFAULT_VALUE(~0u)) PURE;
+
+
+    /// Sets the index of the current frame that is recorded in the usage log.
+
+    /// \param [in]  FrameIndex - The frame index.
+    ///
+    /// The application should call this method once per frame when the usage
+    /// log is enabled (see RenderStateCacheCreateInfo::EnableUsageLog).
+    VIRTUAL void METHOD(SetFrameIndex)(THIS_
+                                       Uint32 FrameIndex) PURE;
+
+    /// Writes the usage log to a memory blob.
+
+    /// \param [out]  ppLog - Address of the memory location where a pointer to the created
+    ///                       data blob will be written.
+    ///
+    /// \return     true if the log was written successfully, and false otherwise.
+    ///
+    /// The cache must have been created with `EnableUsageLog` set to true.
+    /// Render states are written in the order they were first requested.
+    VIRTUAL Bool METHOD(WriteUsageLog)(THIS_
+                                       IDataBlob** ppLog) PURE;
+
+    /// Creates the render states listed in the usage log ahead of time.
+
+    /// \param [in]  WarmUpInfo - Warm-up parameters, see Diligent::RenderStateCacheWarmUpInfo.
+    ///
+    /// \return     The number of usage log entries scheduled for warm-up.
+    ///
+    /// The render states are unpacked from the loaded cache data in the order of their first use
+    /// and are kept by the cache until the application requests them through CreateShader() or
+    /// Create*PipelineState(), or until the cache is reset. Render states that are not present
+    /// in the cache data are skipped. The cache data must be loaded before calling this method.
+    ///
+    /// If WarmUpInfo.pThreadPool is not null, the method returns immediately and the render states
+    /// are created by the thread pool. Requests that arrive before the corresponding render state is
+    /// ready are handled as usual. Use GetWarmUpStats() to see how many requests were satisfied by
+    /// the warm-up.
+    ///
+    /// \note       This method is not thread-safe and must not be called simultaneously
+    ///             with other methods.
+    VIRTUAL Uint32 METHOD(WarmUp)(THIS_
+                                  const RenderStateCacheWarmUpInfo REF WarmUpInfo) PURE;
+
+    /// Returns the warm-up statistics, see Diligent::RenderStateCacheWarmUpStats.
+    VIRTUAL void METHOD(GetWarmUpStats)(THIS_
+                                        RenderStateCacheWarmUpStats REF Stats) CONST PURE;
 
     /// Resets the cache to default state.
+
+    /// Pending warm-up tasks are cancelled, and the method waits
+    /// for the running ones to finish.
     VIRTUAL void METHOD(Reset)(THIS) PURE;
 
     /// Reloads render states in the cache.
@@ -316,6 +466,12 @@ DILIGENT_END_INTERFACE
 #    define IRenderStateCache_CreateTilePipelineState(This, ...)       CALL_IFACE_METHOD(RenderStateCache, CreateTilePipelineState,      This, __VA_ARGS__)
 #    define IRenderStateCache_WriteToBlob(This, ...)                   CALL_IFACE_METHOD(RenderStateCache, WriteToBlob,                  This, __VA_ARGS__)
 #    define IRenderStateCache_WriteToStream(This, ...)                 CALL_IFACE_METHOD(RenderStateCache, WriteToStream,                This, __VA_ARGS__)
+#    define IRenderStateCache_AppendToStorage(This, ...)               CALL_IFACE_METHOD(RenderStateCache, AppendToStorage,              This, __VA_ARGS__)
+#    define IRenderStateCache_RefreshFromStorage(This, ...)            CALL_IFACE_METHOD(RenderStateCache, RefreshFromStorage,           This, __VA_ARGS__)
+#    define IRenderStateCache_SetFrameIndex(This, ...)                 CALL_IFACE_METHOD(RenderStateCache, SetFrameIndex,                This, __VA_ARGS__)
+#    define IRenderStateCache_WriteUsageLog(This, ...)                 CALL_IFACE_METHOD(RenderStateCache, WriteUsageLog,                This, __VA_ARGS__)
+#    define IRenderStateCache_WarmUp(This, ...)                        CALL_IFACE_METHOD(RenderStateCache, WarmUp,                       This, __VA_ARGS__)
+#    define IRenderStateCache_GetWarmUpStats(This, ...)                CALL_IFACE_METHOD(RenderStateCache, GetWarmUpStats,               This, __VA_ARGS__)
 #    define IRenderStateCache_Reset(This)                              CALL_IFACE_METHOD(RenderStateCache, Reset,                        This)
 #    define IRenderStateCache_Reload(This, ...)                        CALL_IFACE_METHOD(RenderStateCache, Reload,                       This, __VA_ARGS__)
 #    define IRenderStateCache_GetContentVersion(This)                  CALL_IFACE_METHOD(RenderStateCache, GetContentVersion,            This)
@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::RenderStateCacheStorage class
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Primitives/interface/DataBlob.h"
+#include "../../../Primitives/interface/RandomAccessFileStream.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Append-only render state cache file that may be shared by multiple processes.
+
+/// The file starts with a header that holds the size of the committed data, followed by
+/// a sequence of records. Every record contains one render state archive together with its
+/// content version and checksum.
+///
+/// Writers are serialized by an exclusive file lock: a new record is written past the committed
+/// data, flushed to disk, and only then the committed size in the header is updated.
+/// Readers never take the lock: they read the committed size and map the records below it,
+/// which are never modified afterwards. Records that fail validation are ignored.
+///
+/// File locking is implemented for POSIX platforms and Win32. On other platforms,
+/// the storage can't be created.
+class RenderStateCacheStorage
+{
+public:
+    struct Record
+    {
+        /// Record data. Where memory mapping is supported, the blob references the mapped file region.
+        RefCntAutoPtr<IDataBlob> pData;
+
+        /// Content version the record was written with.
+        Uint32 ContentVersion = 0;
+
+        /// Offset of the record in the file.
+        Uint64 Offset = 0;
+    };
+
+    /// Opens the storage file, creating it if it does not exist.
+    /// Throws an exception if the file can't be opened.
+    explicit RenderStateCacheStorage(const char* FilePath) noexcept(false);
+    ~RenderStateCacheStorage();
+
+    // clang-format off
+    RenderStateCacheStorage           (const RenderStateCacheStorage&) = delete;
+    RenderStateCacheStorage& operator=(const RenderStateCacheStorage&) = delete;
+    // clang-format on
+
+    /// Appends a record to the file.
+
+    /// When the method returns, the record is visible to all readers of the file.
+    /// The record will not be returned by ReadNewRecords() of this object.
+    bool Append(const IDataBlob* pData, Uint32 ContentVersion);
+
+    /// Returns the records that were committed since the last call.
+    std::vector<Record> ReadNewRecords();
+
+    /// Makes the next ReadNewRecords() call return all records in the file,
+    /// including the ones appended by this object.
+    void Rewind();
+
+    /// Returns the size of the data committed to the file.
+    Uint64 GetCommittedSize() const;
+
+    const std::string& GetFilePath() const { return m_FilePath; }
+
+private:
+    class NativeFile;
+
+    const std::string m_FilePath;
+
+    // Lockable read-write file used by writers
+    std::unique_ptr<NativeFile> m_pFile;
+    // Read-only stream used by readers
+    RefCntAutoPtr<IRandomAccessFileStream> m_pStream;
+
+    std::mutex m_Mtx;
+    // Offset of the first record that has not been read
+    Uint64 m_ReadOffset = 0;
+    // Offsets of the records appended by this object that have not been reached by the reader
+    std::vector<Uint64> m_OwnRecords;
+};
+
+} // namespace Diligent
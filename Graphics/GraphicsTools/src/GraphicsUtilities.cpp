@@ -582,7 +582,7 @@ const char* GetWebGPUEmulatedArrayIndexSuffix(IShader* pShader)
 
 int64_t GetNativeTextureFormat(TEXTURE_FORMAT TexFormat, RENDER_DEVICE_TYPE DeviceType)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please handle the new device type below");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Please handle the new device type below");
     switch (DeviceType)
     {
 #if D3D11_SUPPORTED
@@ -624,7 +624,7 @@ int64_t GetNativeTextureFormat(TEXTURE_FORMAT TexFormat, RENDER_DEVICE_TYPE Devi
 
 TEXTURE_FORMAT GetTextureFormatFromNative(int64_t NativeFormat, RENDER_DEVICE_TYPE DeviceType)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please handle the new device type below");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Please handle the new device type below");
     switch (DeviceType)
     {
 #if D3D11_SUPPORTED
@@ -744,7 +744,7 @@ IDXCompiler* GetDeviceDXCompiler(IRenderDevice* pDevice)
     }
 
     const RENDER_DEVICE_TYPE DeviceType = pDevice->GetDeviceInfo().Type;
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Please handle the new device type below");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Please handle the new device type below");
     switch (DeviceType)
     {
 #if D3D11_SUPPORTED
@@ -778,6 +778,11 @@ IDXCompiler* GetDeviceDXCompiler(IRenderDevice* pDevice)
             return nullptr;
 #endif
 
+#if NULL_SUPPORTED
+        case RENDER_DEVICE_TYPE_NULL:
+            return nullptr;
+#endif
+
         default:
             UNSUPPORTED("Unsupported device type");
             return nullptr;
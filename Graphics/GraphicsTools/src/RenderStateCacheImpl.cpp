@@ -35,6 +35,7 @@
 #include <array>
 #include <mutex>
 #include <vector>
+#include <algorithm>
 
 #include "Archiver.h"
 #include "Dearchiver.h"
@@ -49,10 +50,30 @@
 #include "GraphicsUtilities.h"
 #include "ShaderSourceFactoryUtils.hpp"
 #include "DXCompiler.hpp"
+#include "Serializer.hpp"
+#include "DataBlobImpl.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "ThreadPool.hpp"
+#include "StateCreationStageTimer.hpp"
 
 namespace Diligent
 {
 
+#define RENDER_STATE_CACHE_LOG(Level, ...)                         \
+    do                                                             \
+    {                                                              \
+        if (m_CI.LogLevel >= Level)                                \
+        {                                                          \
+            LOG_INFO_MESSAGE("Render state cache: ", __VA_ARGS__); \
+        }                                                          \
+    } while (false)
+
+bool RenderStateCacheImpl::LoadArchive(const IDataBlob* pArchive, Uint32 ContentVersion, bool MakeCopy)
+{
+    std::unique_lock<std::shared_mutex> Lock{m_DearchiverMtx};
+    return m_pDearchiver->LoadArchive(pArchive, ContentVersion, MakeCopy);
+}
+
 Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
 {
     if (ContentVersion == ~0u)
@@ -72,17 +93,92 @@ Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob
         return false;
     }
 
-    if (!m_pDearchiver->LoadArchive(pNewData, ContentVersion))
+    if (!LoadArchive(pNewData, ContentVersion, /*MakeCopy = */ false))
     {
         LOG_ERROR_MESSAGE("Failed to add new render state data to existing archive");
         return false;
     }
 
     m_pArchiver->Reset();
+    m_ArchiverHasData.store(false);
 
     return m_pDearchiver->Store(ppBlob);
 }
 
+Bool RenderStateCacheImpl::AppendToStorage(Uint32 ContentVersion)
+{
+    if (!m_pStorage)
+    {
+        DEV_ERROR("The render state cache was created without the storage file");
+        return false;
+    }
+
+    if (ContentVersion == ~0u)
+    {
+        ContentVersion = GetContentVersion();
+        if (ContentVersion == ~0u)
+            ContentVersion = 0;
+    }
+
+    if (!m_ArchiverHasData.load())
+        return true;
+
+    // Only the new render states are serialized, so that the record
+    // size does not depend on the size of the storage file.
+    RefCntAutoPtr<IDataBlob> pNewData;
+    m_pArchiver->SerializeToBlob(ContentVersion, &pNewData);
+    if (!pNewData)
+    {
+        LOG_ERROR_MESSAGE("Failed to serialize render state data");
+        return false;
+    }
+
+    if (!m_pStorage->Append(pNewData, ContentVersion))
+        return false;
+
+    if (!LoadArchive(pNewData, ContentVersion, /*MakeCopy = */ false))
+    {
+        LOG_ERROR_MESSAGE("Failed to add new render state data to existing archive");
+        return false;
+    }
+
+    m_pArchiver->Reset();
+    m_ArchiverHasData.store(false);
+
+    return true;
+}
+
+Uint32 RenderStateCacheImpl::RefreshFromStorage(Uint32 ContentVersion)
+{
+    if (!m_pStorage)
+    {
+        DEV_ERROR("The render state cache was created without the storage file");
+        return 0;
+    }
+
+    Uint32 NumLoaded = 0;
+    for (const RenderStateCacheStorage::Record& Record : m_pStorage->ReadNewRecords())
+    {
+        if (ContentVersion != ~0u && Record.ContentVersion != ContentVersion)
+        {
+            RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Skipping storage record at offset ", Record.Offset,
+                                   ": content version (", Record.ContentVersion, ") does not match the expected version (", ContentVersion, ").");
+            continue;
+        }
+
+        // Record data is immutable, so there is no need to make a copy
+        if (LoadArchive(Record.pData, Record.ContentVersion, /*MakeCopy = */ false))
+            ++NumLoaded;
+        else
+            LOG_ERROR_MESSAGE("Failed to load render state cache storage record at offset ", Record.Offset);
+    }
+
+    if (NumLoaded > 0)
+        RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Loaded ", NumLoaded, " record(s) from the storage file.");
+
+    return NumLoaded;
+}
+
 Bool RenderStateCacheImpl::WriteToStream(Uint32 ContentVersion, IFileStream* pStream)
 {
     DEV_CHECK_ERR(pStream != nullptr, "pStream must not be null");
@@ -98,8 +194,23 @@ Bool RenderStateCacheImpl::WriteToStream(Uint32 ContentVersion, IFileStream* pSt
 
 void RenderStateCacheImpl::Reset()
 {
+    CancelWarmUp();
+    {
+        std::lock_guard<std::mutex> Guard{m_WarmUpMtx};
+        m_WarmUpObjects.clear();
+        m_HasWarmUpObjects.store(false);
+    }
+    {
+        std::lock_guard<std::mutex> Guard{m_UsageLogMtx};
+        m_UsageLog.clear();
+        m_LoggedHashes.clear();
+    }
+
     m_pDearchiver->Reset();
     m_pArchiver->Reset();
+    m_ArchiverHasData.store(false);
+    if (m_pStorage)
+        m_pStorage->Rewind();
     m_Shaders.clear();
     m_ReloadableShaders.clear();
     m_Pipelines.clear();
@@ -241,16 +352,340 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
     m_pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &m_pDearchiver);
     if (!m_pDearchiver)
         LOG_ERROR_AND_THROW("Failed to create dearchiver");
+
+    if (CreateInfo.StorageFilePath != nullptr)
+        m_pStorage = std::make_unique<RenderStateCacheStorage>(CreateInfo.StorageFilePath);
 }
 
-#define RENDER_STATE_CACHE_LOG(Level, ...)                         \
-    do                                                             \
-    {                                                              \
-        if (m_CI.LogLevel >= Level)                                \
-        {                                                          \
-            LOG_INFO_MESSAGE("Render state cache: ", __VA_ARGS__); \
-        }                                                          \
-    } while (false)
+RenderStateCacheImpl::~RenderStateCacheImpl()
+{
+    // Warm-up tasks reference the cache
+    CancelWarmUp();
+}
+
+static constexpr Uint32 UsageLogMagic   = 0x55435352; // 'RSCU'
+static constexpr Uint32 UsageLogVersion = 1;
+
+void RenderStateCacheImpl::LogUsage(const XXH128Hash& Hash, const char* Name, PIPELINE_TYPE PipelineType)
+{
+    if (!m_CI.EnableUsageLog)
+        return;
+
+    std::lock_guard<std::mutex> Guard{m_UsageLogMtx};
+    if (!m_LoggedHashes.insert(Hash).second)
+        return;
+
+    UsageLogEntry Entry;
+    Entry.Hash         = Hash;
+    Entry.HasName      = Name != nullptr;
+    Entry.Name         = Name != nullptr ? Name : "";
+    Entry.FrameIndex   = m_FrameIndex.load();
+    Entry.PipelineType = PipelineType;
+    m_UsageLog.emplace_back(std::move(Entry));
+}
+
+Bool RenderStateCacheImpl::WriteUsageLog(IDataBlob** ppLog)
+{
+    DEV_CHECK_ERR(ppLog != nullptr, "ppLog must not be null");
+    if (ppLog == nullptr)
+        return false;
+
+    if (!m_CI.EnableUsageLog)
+    {
+        DEV_ERROR("The render state cache was created with the usage log disabled");
+        return false;
+    }
+
+    SerializedDataChunks Chunks{DefaultRawMemoryAllocator::GetAllocator()};
+    {
+        std::lock_guard<std::mutex> Guard{m_UsageLogMtx};
+
+        Serializer<SerializerMode::Write> Ser{Chunks};
+
+        const Uint32 NumEntries = static_cast<Uint32>(m_UsageLog.size());
+        if (!Ser(UsageLogMagic, UsageLogVersion, NumEntries))
+            return false;
+
+        for (const UsageLogEntry& Entry : m_UsageLog)
+        {
+            const Uint8 HasName      = Entry.HasName ? 1 : 0;
+            const Uint8 PipelineType = static_cast<Uint8>(Entry.PipelineType);
+            const char* Name         = Entry.Name.c_str();
+            if (!Ser(Entry.Hash.LowPart, Entry.Hash.HighPart, Entry.FrameIndex, PipelineType, HasName, Name))
+                return false;
+        }
+    }
+
+    RefCntAutoPtr<DataBlobImpl> pLog = DataBlobImpl::Create(Chunks.GetSize());
+    if (!Chunks.CopyTo(pLog->GetDataPtr(), pLog->GetSize()))
+        return false;
+
+    *ppLog = pLog.Detach();
+    return true;
+}
+
+bool RenderStateCacheImpl::ReadUsageLog(const IDataBlob* pLog, std::vector<UsageLogEntry>& Entries)
+{
+    Serializer<SerializerMode::Read> Ser{
+        SerializedData{
+            const_cast<void*>(pLog->GetConstDataPtr()),
+            pLog->GetSize(),
+        },
+    };
+
+    Uint32 Magic      = 0;
+    Uint32 Version    = 0;
+    Uint32 NumEntries = 0;
+    if (!Ser(Magic, Version, NumEntries) || Magic != UsageLogMagic)
+    {
+        LOG_ERROR_MESSAGE("Invalid render state cache usage log");
+        return false;
+    }
+    if (Version != UsageLogVersion)
+    {
+        LOG_ERROR_MESSAGE("Unsupported render state cache usage log version: ", Version, ". Expected version: ", UsageLogVersion);
+        return false;
+    }
+
+    Entries.reserve(NumEntries);
+    for (Uint32 i = 0; i < NumEntries; ++i)
+    {
+        UsageLogEntry Entry;
+        Uint8         PipelineType = 0;
+        Uint8         HasName      = 0;
+        const char*   Name         = nullptr;
+        if (!Ser(Entry.Hash.LowPart, Entry.Hash.HighPart, Entry.FrameIndex, PipelineType, HasName, Name))
+        {
+            LOG_ERROR_MESSAGE("Failed to read render state cache usage log entry ", i);
+            return false;
+        }
+        Entry.PipelineType = static_cast<PIPELINE_TYPE>(PipelineType);
+        Entry.HasName      = HasName != 0;
+        Entry.Name         = Name != nullptr ? Name : "";
+        Entries.emplace_back(std::move(Entry));
+    }
+
+    return true;
+}
+
+void RenderStateCacheImpl::WarmUpEntry(const UsageLogEntry& Entry)
+{
+    const char*       Name    = Entry.HasName ? Entry.Name.c_str() : nullptr;
+    const std::string HashStr = MakeHashStr(Name, Entry.Hash);
+
+    RefCntAutoPtr<IShader>        pShader;
+    RefCntAutoPtr<IPipelineState> pPSO;
+    {
+        std::shared_lock<std::shared_mutex> Lock{m_DearchiverMtx};
+        if (Entry.PipelineType == PIPELINE_TYPE_INVALID)
+            pShader = UnpackShader(HashStr.c_str(), Name);
+        else
+            pPSO = UnpackPipelineState(Entry.PipelineType, HashStr.c_str(), Name);
+    }
+
+    const bool Created = pShader || pPSO;
+    (Created ? m_WarmUpStats.NumCreated : m_WarmUpStats.NumFailed).fetch_add(1);
+
+    std::lock_guard<std::mutex> Guard{m_WarmUpMtx};
+
+    auto it = m_WarmUpObjects.find(Entry.Hash);
+    if (it == m_WarmUpObjects.end())
+    {
+        // The object has already been requested by the application
+        return;
+    }
+
+    if (Created)
+    {
+        it->second.pShader = std::move(pShader);
+        it->second.pPSO    = std::move(pPSO);
+        it->second.IsReady = true;
+    }
+    else
+    {
+        m_WarmUpObjects.erase(it);
+    }
+}
+
+Uint32 RenderStateCacheImpl::WarmUp(const RenderStateCacheWarmUpInfo& WarmUpInfo)
+{
+    DEV_CHECK_ERR(WarmUpInfo.pUsageLog != nullptr, "WarmUpInfo.pUsageLog must not be null");
+    if (WarmUpInfo.pUsageLog == nullptr)
+        return 0;
+
+    std::vector<UsageLogEntry> Entries;
+    if (!ReadUsageLog(WarmUpInfo.pUsageLog, Entries))
+        return 0;
+
+    // Entries are logged in the order of first use, but the frame index
+    // is set by the application and is not guaranteed to be monotonic.
+    std::stable_sort(Entries.begin(), Entries.end(),
+                     [](const UsageLogEntry& Lhs, const UsageLogEntry& Rhs) {
+                         return Lhs.FrameIndex < Rhs.FrameIndex;
+                     });
+
+    // Skip the render states that are already in use
+    auto IsAlive = [](std::mutex& Mtx, const auto& Objects, const XXH128Hash& Hash) {
+        std::lock_guard<std::mutex> Guard{Mtx};
+
+        auto it = Objects.find(Hash);
+        return it != Objects.end() && it->second.IsValid();
+    };
+
+    std::vector<const UsageLogEntry*> ScheduledEntries;
+    {
+        std::lock_guard<std::mutex> Guard{m_WarmUpMtx};
+        for (const UsageLogEntry& Entry : Entries)
+        {
+            if (Entry.FrameIndex > WarmUpInfo.MaxFrameIndex)
+                break;
+
+            const bool InUse = Entry.PipelineType == PIPELINE_TYPE_INVALID ?
+                IsAlive(m_ShadersMtx, m_Shaders, Entry.Hash) :
+                IsAlive(m_PipelinesMtx, m_Pipelines, Entry.Hash);
+            if (InUse)
+                continue;
+
+            if (m_WarmUpObjects.emplace(Entry.Hash, WarmUpObject{}).second)
+                ScheduledEntries.push_back(&Entry);
+        }
+        if (!ScheduledEntries.empty())
+            m_HasWarmUpObjects.store(true);
+    }
+    m_WarmUpStats.NumScheduled.fetch_add(static_cast<Uint32>(ScheduledEntries.size()));
+
+    if (WarmUpInfo.pThreadPool == nullptr)
+    {
+        for (const UsageLogEntry* pEntry : ScheduledEntries)
+            WarmUpEntry(*pEntry);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> Guard{m_WarmUpMtx};
+
+        // Release finished tasks from the previous calls
+        m_WarmUpTasks.erase(std::remove_if(m_WarmUpTasks.begin(), m_WarmUpTasks.end(),
+                                           [](const WarmUpTask& Task) {
+                                               return Task.pTask->IsFinished();
+                                           }),
+                            m_WarmUpTasks.end());
+
+        // Tasks with equal priority run in the order they were enqueued, which preserves the first-use order.
+        // The tasks do not keep a strong reference to the cache; CancelWarmUp() waits for them instead.
+        for (const UsageLogEntry* pEntry : ScheduledEntries)
+        {
+            RefCntAutoPtr<IAsyncTask> pTask = EnqueueAsyncWork(WarmUpInfo.pThreadPool,
+                                                               [this, Entry = *pEntry](Uint32 ThreadId) {
+                                                                   WarmUpEntry(Entry);
+                                                                   return ASYNC_TASK_STATUS_COMPLETE;
+                                                               });
+            m_WarmUpTasks.push_back({RefCntAutoPtr<IThreadPool>{WarmUpInfo.pThreadPool}, std::move(pTask)});
+        }
+    }
+
+    RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Scheduled ", ScheduledEntries.size(), " render state(s) for warm-up.");
+
+    return static_cast<Uint32>(ScheduledEntries.size());
+}
+
+void RenderStateCacheImpl::CancelWarmUp()
+{
+    std::vector<WarmUpTask> Tasks;
+    {
+        std::lock_guard<std::mutex> Guard{m_WarmUpMtx};
+        Tasks.swap(m_WarmUpTasks);
+    }
+
+    for (WarmUpTask& Task : Tasks)
+    {
+        // Tasks that were removed from the queue will never run, so only wait for the running ones
+        Task.pTask->Cancel();
+        if (!Task.pThreadPool->RemoveTask(Task.pTask))
+            Task.pTask->WaitForCompletion();
+    }
+}
+
+void RenderStateCacheImpl::GetWarmUpStats(RenderStateCacheWarmUpStats& Stats) const
+{
+    Stats.NumScheduled = m_WarmUpStats.NumScheduled.load();
+    Stats.NumCreated   = m_WarmUpStats.NumCreated.load();
+    Stats.NumFailed    = m_WarmUpStats.NumFailed.load();
+    Stats.NumHits      = m_WarmUpStats.NumHits.load();
+    Stats.NumLate      = m_WarmUpStats.NumLate.load();
+}
+
+RefCntAutoPtr<IShader> RenderStateCacheImpl::TakeWarmedUpShader(const XXH128Hash& Hash)
+{
+    if (!m_HasWarmUpObjects.load())
+        return {};
+
+    std::lock_guard<std::mutex> Guard{m_WarmUpMtx};
+
+    auto it = m_WarmUpObjects.find(Hash);
+    if (it == m_WarmUpObjects.end())
+        return {};
+
+    // The object is handed over to the application or dropped if it is not ready:
+    // in both cases the cache's own weak-pointer maps take care of subsequent requests.
+    RefCntAutoPtr<IShader> pShader = std::move(it->second.pShader);
+    (it->second.IsReady ? m_WarmUpStats.NumHits : m_WarmUpStats.NumLate).fetch_add(1);
+    m_WarmUpObjects.erase(it);
+
+    return pShader;
+}
+
+RefCntAutoPtr<IPipelineState> RenderStateCacheImpl::TakeWarmedUpPipeline(const XXH128Hash& Hash)
+{
+    if (!m_HasWarmUpObjects.load())
+        return {};
+
+    std::lock_guard<std::mutex> Guard{m_WarmUpMtx};
+
+    auto it = m_WarmUpObjects.find(Hash);
+    if (it == m_WarmUpObjects.end())
+        return {};
+
+    RefCntAutoPtr<IPipelineState> pPSO = std::move(it->second.pPSO);
+    (it->second.IsReady ? m_WarmUpStats.NumHits : m_WarmUpStats.NumLate).fetch_add(1);
+    m_WarmUpObjects.erase(it);
+
+    return pPSO;
+}
+
+RefCntAutoPtr<IShader> RenderStateCacheImpl::UnpackShader(const char* HashStr, const char* Name)
+{
+    auto Callback = MakeCallback(
+        [Name](ShaderDesc& Desc) {
+            Desc.Name = Name;
+        });
+
+    ShaderUnpackInfo UnpackInfo;
+    UnpackInfo.Name             = HashStr;
+    UnpackInfo.pDevice          = m_pDevice;
+    UnpackInfo.ModifyShaderDesc = Callback;
+    UnpackInfo.pUserData        = Callback;
+    RefCntAutoPtr<IShader> pShader;
+    m_pDearchiver->UnpackShader(UnpackInfo, &pShader);
+    return pShader;
+}
+
+RefCntAutoPtr<IPipelineState> RenderStateCacheImpl::UnpackPipelineState(PIPELINE_TYPE PipelineType, const char* HashStr, const char* Name)
+{
+    auto Callback = MakeCallback(
+        [Name](PipelineStateCreateInfo& CI) {
+            CI.PSODesc.Name = Name;
+        });
+
+    PipelineStateUnpackInfo UnpackInfo;
+    UnpackInfo.PipelineType                  = PipelineType;
+    UnpackInfo.Name                          = HashStr;
+    UnpackInfo.pDevice                       = m_pDevice;
+    UnpackInfo.ModifyPipelineStateCreateInfo = Callback;
+    UnpackInfo.pUserData                     = Callback;
+    RefCntAutoPtr<IPipelineState> pPSO;
+    m_pDearchiver->UnpackPipelineState(UnpackInfo, &pPSO);
+    return pPSO;
+}
 
 bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
                                         IShader**               ppShader)
@@ -266,7 +701,12 @@ bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
 
     RefCntAutoPtr<IShader> pShader;
 
+    // The stage is changed to cache hit once the result is known
+    ScopedStateCreationStageTimer Timer{m_pDevice, STATE_CREATION_STAGE_RENDER_STATE_CACHE_MISS};
+
     const bool FoundInCache = CreateShaderInternal(ShaderCI, &pShader);
+    if (FoundInCache)
+        Timer.SetStage(STATE_CREATION_STAGE_RENDER_STATE_CACHE_HIT);
     if (!pShader)
         return false;
 
@@ -365,6 +805,8 @@ bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI
     Hasher.Update(IsDebug);
     const XXH128Hash Hash = Hasher.Digest();
 
+    LogUsage(Hash, ShaderCI.Desc.Name, PIPELINE_TYPE_INVALID);
+
     // First, try to check if the shader has already been requested
     {
         std::lock_guard<std::mutex> Guard{m_ShadersMtx};
@@ -413,20 +855,11 @@ bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI
 
     const std::string HashStr = MakeHashStr(ShaderCI.Desc.Name, Hash);
 
-    // Try to find the shader in the loaded archive
+    // Try to find the shader among the warmed-up objects or in the loaded archive
     {
-        auto Callback = MakeCallback(
-            [&ShaderCI](ShaderDesc& Desc) {
-                Desc.Name = ShaderCI.Desc.Name;
-            });
-
-        ShaderUnpackInfo UnpackInfo;
-        UnpackInfo.Name             = HashStr.c_str();
-        UnpackInfo.pDevice          = m_pDevice;
-        UnpackInfo.ModifyShaderDesc = Callback;
-        UnpackInfo.pUserData        = Callback;
-        RefCntAutoPtr<IShader> pShader;
-        m_pDearchiver->UnpackShader(UnpackInfo, &pShader);
+        RefCntAutoPtr<IShader> pShader = TakeWarmedUpShader(Hash);
+        if (!pShader)
+            pShader = UnpackShader(HashStr.c_str(), ShaderCI.Desc.Name);
         if (pShader)
         {
             if (pShader->GetDesc() == ShaderCI.Desc)
@@ -457,7 +890,10 @@ bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI
         if (pArchivedShader)
         {
             if (m_pArchiver->AddShader(pArchivedShader))
+            {
+                m_ArchiverHasData.store(true);
                 RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Added shader '", HashStr, "'.");
+            }
             else
                 LOG_ERROR_MESSAGE("Failed to archive shader '", HashStr, "'.");
         }
@@ -750,7 +1186,11 @@ bool RenderStateCacheImpl::CreatePipelineState(const CreateInfoType& PSOCreateIn
 
     RefCntAutoPtr<IPipelineState> pPSO;
 
+    ScopedStateCreationStageTimer Timer{m_pDevice, STATE_CREATION_STAGE_RENDER_STATE_CACHE_MISS};
+
     const bool FoundInCache = CreatePipelineStateInternal(PSOCreateInfo, &pPSO);
+    if (FoundInCache)
+        Timer.SetStage(STATE_CREATION_STAGE_RENDER_STATE_CACHE_HIT);
     if (!pPSO)
         return false;
 
@@ -813,6 +1253,8 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
     Hasher.Update(PSOCreateInfo);
     const auto Hash = Hasher.Digest();
 
+    LogUsage(Hash, PSOCreateInfo.PSODesc.Name, PSOCreateInfo.PSODesc.PipelineType);
+
     // First, try to check if the PSO has already been requested
     {
         std::lock_guard<std::mutex> Guard{m_PipelinesMtx};
@@ -836,21 +1278,11 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
     const std::string HashStr = MakeHashStr(PSOCreateInfo.PSODesc.Name, Hash);
 
     bool FoundInCache = false;
-    // Try to find PSO in the loaded archive
-    {
-        auto Callback = MakeCallback(
-            [&PSOCreateInfo](PipelineStateCreateInfo& CI) {
-                CI.PSODesc.Name = PSOCreateInfo.PSODesc.Name;
-            });
-
-        PipelineStateUnpackInfo UnpackInfo;
-        UnpackInfo.PipelineType                  = PSOCreateInfo.PSODesc.PipelineType;
-        UnpackInfo.Name                          = HashStr.c_str();
-        UnpackInfo.pDevice                       = m_pDevice;
-        UnpackInfo.ModifyPipelineStateCreateInfo = Callback;
-        UnpackInfo.pUserData                     = Callback;
-        RefCntAutoPtr<IPipelineState> pPSO;
-        m_pDearchiver->UnpackPipelineState(UnpackInfo, &pPSO);
+    // Try to find PSO among the warmed-up objects or in the loaded archive
+    {
+        RefCntAutoPtr<IPipelineState> pPSO = TakeWarmedUpPipeline(Hash);
+        if (!pPSO)
+            pPSO = UnpackPipelineState(PSOCreateInfo.PSODesc.PipelineType, HashStr.c_str(), PSOCreateInfo.PSODesc.Name);
         if (pPSO)
         {
             const PIPELINE_STATE_STATUS Status = pPSO->GetStatus();
@@ -920,7 +1352,10 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
         if (pSerializedPSO)
         {
             if (m_pArchiver->AddPipelineState(pSerializedPSO))
+            {
+                m_ArchiverHasData.store(true);
                 RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_NORMAL, "Added pipeline '", HashStr, "'.");
+            }
             else
                 LOG_ERROR_MESSAGE("Failed to archive PSO '", HashStr, "'.");
         }
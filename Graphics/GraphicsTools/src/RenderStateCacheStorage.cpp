@@ -0,0 +1,483 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "RenderStateCacheStorage.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "xxhash.h"
+
+#include "RandomAccessFileStream.hpp"
+#include "DebugUtilities.hpp"
+#include "Align.hpp"
+
+#if PLATFORM_WIN32
+#    include "StringTools.hpp"
+#    include "WinHPreface.h"
+#    include <Windows.h>
+#    include "WinHPostface.h"
+#elif PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS
+#    define RENDER_STATE_CACHE_STORAGE_POSIX 1
+#    include <cerrno>
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace Diligent
+{
+
+namespace
+{
+
+struct StorageFileHeader
+{
+    static constexpr Uint32 ExpectedMagic   = 0x43535244; // 'DRSC'
+    static constexpr Uint32 ExpectedVersion = 1;
+
+    Uint32 Magic         = ExpectedMagic;
+    Uint32 Version       = ExpectedVersion;
+    Uint64 CommittedSize = 0;
+};
+
+struct StorageRecordHeader
+{
+    static constexpr Uint32 ExpectedMagic = 0x52435352; // 'RSCR'
+
+    Uint32 Magic          = ExpectedMagic;
+    Uint32 ContentVersion = 0;
+    Uint64 DataSize       = 0;
+    Uint64 Checksum       = 0;
+    Uint64 Reserved       = 0;
+};
+
+// Space reserved for the file header
+constexpr Uint64 StorageHeaderSize = 64;
+// Records start at offsets aligned by this value so that the archive data
+// is 16-byte aligned when the file is memory-mapped.
+constexpr Uint64 StorageRecordAlignment = 16;
+
+static_assert(sizeof(StorageFileHeader) <= StorageHeaderSize, "File header does not fit into the reserved space");
+static_assert(sizeof(StorageRecordHeader) % StorageRecordAlignment == 0, "Record header size must be a multiple of the record alignment");
+
+Uint64 ComputeRecordChecksum(const void* pData, size_t Size)
+{
+    return XXH3_64bits(pData, Size);
+}
+
+} // namespace
+
+class RenderStateCacheStorage::NativeFile
+{
+public:
+    explicit NativeFile(const char* Path) noexcept
+    {
+#if PLATFORM_WIN32
+        m_hFile = CreateFileW(WidenString(Path).c_str(), GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+#elif RENDER_STATE_CACHE_STORAGE_POSIX
+        m_Fd = open(Path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+#endif
+    }
+
+    ~NativeFile()
+    {
+#if PLATFORM_WIN32
+        if (m_hFile != INVALID_HANDLE_VALUE)
+            CloseHandle(m_hFile);
+#elif RENDER_STATE_CACHE_STORAGE_POSIX
+        if (m_Fd >= 0)
+            close(m_Fd);
+#endif
+    }
+
+    // clang-format off
+    NativeFile           (const NativeFile&) = delete;
+    NativeFile& operator=(const NativeFile&) = delete;
+    // clang-format on
+
+    bool IsValid() const
+    {
+#if PLATFORM_WIN32
+        return m_hFile != INVALID_HANDLE_VALUE;
+#elif RENDER_STATE_CACHE_STORAGE_POSIX
+        return m_Fd >= 0;
+#else
+        return false;
+#endif
+    }
+
+    // Acquires the exclusive writer lock. The lock is advisory and does not block readers.
+    bool Lock()
+    {
+#if PLATFORM_WIN32
+        // Lock a byte far past the end of the file so that the lock does not interfere with reads.
+        OVERLAPPED Overlapped{};
+        Overlapped.OffsetHigh = LockOffsetHigh;
+        return LockFileEx(m_hFile, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &Overlapped) != FALSE;
+#elif RENDER_STATE_CACHE_STORAGE_POSIX
+        int Res = 0;
+        do
+        {
+            Res = flock(m_Fd, LOCK_EX);
+        } while (Res != 0 && errno == EINTR);
+        return Res == 0;
+#else
+        return false;
+#endif
+    }
+
+    void Unlock()
+    {
+#if PLATFORM_WIN32
+        OVERLAPPED Overlapped{};
+        Overlapped.OffsetHigh = LockOffsetHigh;
+        UnlockFileEx(m_hFile, 0, 1, 0, &Overlapped);
+#elif RENDER_STATE_CACHE_STORAGE_POSIX
+        flock(m_Fd, LOCK_UN);
+#endif
+    }
+
+    Uint64 GetSize() const
+    {
+#if PLATFORM_WIN32
+        LARGE_INTEGER Size{};
+        return GetFileSizeEx(m_hFile, &Size) ? static_cast<Uint64>(Size.QuadPart) : 0;
+#elif RENDER_STATE_CACHE_STORAGE_POSIX
+        struct stat Stat = {};
+        return fstat(m_Fd, &Stat) == 0 ? static_cast<Uint64>(Stat.st_size) : 0;
+#else
+        return 0;
+#endif
+    }
+
+    bool ReadAt(Uint64 Offset, void* pData, size_t Size) const
+    {
+        Uint8* pDst = static_cast<Uint8*>(pData);
+#if PLATFORM_WIN32
+        while (Size > 0)
+        {
+            OVERLAPPED Overlapped{};
+            Overlapped.Offset     = static_cast<DWORD>(Offset & 0xFFFFFFFFu);
+            Overlapped.OffsetHigh = static_cast<DWORD>(Offset >> 32u);
+            DWORD BytesRead       = 0;
+            if (!ReadFile(m_hFile, pDst, static_cast<DWORD>(std::min(Size, MaxIOSize)), &BytesRead, &Overlapped) || BytesRead == 0)
+                return false;
+            pDst += BytesRead;
+            Offset += BytesRead;
+            Size -= BytesRead;
+        }
+        return true;
+#elif RENDER_STATE_CACHE_STORAGE_POSIX
+        while (Size > 0)
+        {
+            const ssize_t BytesRead = pread(m_Fd, pDst, Size, static_cast<off_t>(Offset));
+            if (BytesRead < 0 && errno == EINTR)
+                continue;
+            if (BytesRead <= 0)
+                return false;
+            pDst += BytesRead;
+            Offset += static_cast<Uint64>(BytesRead);
+            Size -= static_cast<size_t>(BytesRead);
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool WriteAt(Uint64 Offset, const void* pData, size_t Size)
+    {
+        const Uint8* pSrc = static_cast<const Uint8*>(pData);
+#if PLATFORM_WIN32
+        while (Size > 0)
+        {
+            OVERLAPPED Overlapped{};
+            Overlapped.Offset     = static_cast<DWORD>(Offset & 0xFFFFFFFFu);
+            Overlapped.OffsetHigh = static_cast<DWORD>(Offset >> 32u);
+            DWORD BytesWritten    = 0;
+            if (!WriteFile(m_hFile, pSrc, static_cast<DWORD>(std::min(Size, MaxIOSize)), &BytesWritten, &Overlapped) || BytesWritten == 0)
+                return false;
+            pSrc += BytesWritten;
+            Offset += BytesWritten;
+            Size -= BytesWritten;
+        }
+        return true;
+#elif RENDER_STATE_CACHE_STORAGE_POSIX
+        while (Size > 0)
+        {
+            const ssize_t BytesWritten = pwrite(m_Fd, pSrc, Size, static_cast<off_t>(Offset));
+            if (BytesWritten < 0 && errno == EINTR)
+                continue;
+            if (BytesWritten <= 0)
+                return false;
+            pSrc += BytesWritten;
+            Offset += static_cast<Uint64>(BytesWritten);
+            Size -= static_cast<size_t>(BytesWritten);
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Flushes the written data to the storage device
+    bool Flush()
+    {
+#if PLATFORM_WIN32
+        return FlushFileBuffers(m_hFile) != FALSE;
+#elif PLATFORM_LINUX || PLATFORM_ANDROID
+        return fdatasync(m_Fd) == 0;
+#elif RENDER_STATE_CACHE_STORAGE_POSIX
+        return fsync(m_Fd) == 0;
+#else
+        return false;
+#endif
+    }
+
+private:
+#if PLATFORM_WIN32
+    static constexpr DWORD  LockOffsetHigh = 0x80000000u;
+    static constexpr size_t MaxIOSize      = size_t{1} << 30u;
+
+    HANDLE m_hFile = INVALID_HANDLE_VALUE;
+#elif RENDER_STATE_CACHE_STORAGE_POSIX
+    int m_Fd = -1;
+#endif
+};
+
+RenderStateCacheStorage::RenderStateCacheStorage(const char* FilePath) noexcept(false) :
+    m_FilePath{FilePath != nullptr ? FilePath : ""}
+{
+    if (m_FilePath.empty())
+        LOG_ERROR_AND_THROW("Render state cache storage file path must not be null or empty");
+
+#if !PLATFORM_WIN32 && !RENDER_STATE_CACHE_STORAGE_POSIX
+    LOG_ERROR_AND_THROW("Render state cache storage is not supported on this platform");
+#endif
+
+    m_pFile = std::make_unique<NativeFile>(m_FilePath.c_str());
+    if (!m_pFile->IsValid())
+        LOG_ERROR_AND_THROW("Failed to open render state cache storage file '", m_FilePath, "'");
+
+    m_pStream = RandomAccessFileStream::Create(m_FilePath.c_str());
+    if (!m_pStream)
+        LOG_ERROR_AND_THROW("Failed to open render state cache storage file '", m_FilePath, "' for reading");
+}
+
+RenderStateCacheStorage::~RenderStateCacheStorage()
+{
+}
+
+Uint64 RenderStateCacheStorage::GetCommittedSize() const
+{
+    StorageFileHeader Header;
+    if (!m_pStream->ReadAt(0, &Header, sizeof(Header)))
+        return 0;
+
+    if (Header.Magic != StorageFileHeader::ExpectedMagic || Header.Version != StorageFileHeader::ExpectedVersion)
+        return 0;
+
+    return Header.CommittedSize;
+}
+
+bool RenderStateCacheStorage::Append(const IDataBlob* pData, Uint32 ContentVersion)
+{
+    DEV_CHECK_ERR(pData != nullptr, "pData must not be null");
+    if (pData == nullptr)
+        return false;
+
+    StorageRecordHeader RecordHeader;
+    RecordHeader.ContentVersion = ContentVersion;
+    RecordHeader.DataSize       = pData->GetSize();
+    RecordHeader.Checksum       = ComputeRecordChecksum(pData->GetConstDataPtr(), pData->GetSize());
+
+    std::lock_guard<std::mutex> Guard{m_Mtx};
+
+    if (!m_pFile->Lock())
+    {
+        LOG_ERROR_MESSAGE("Failed to lock render state cache storage file '", m_FilePath, "'");
+        return false;
+    }
+
+    class UnlockGuard
+    {
+    public:
+        explicit UnlockGuard(NativeFile& File) :
+            m_File{File}
+        {}
+        ~UnlockGuard()
+        {
+            m_File.Unlock();
+        }
+
+    private:
+        NativeFile& m_File;
+    } AutoUnlock{*m_pFile};
+
+    StorageFileHeader FileHeader;
+    if (m_pFile->GetSize() < StorageHeaderSize)
+    {
+        // New file: initialize the header
+        FileHeader.CommittedSize = StorageHeaderSize;
+
+        Uint8 HeaderData[StorageHeaderSize] = {};
+        std::memcpy(HeaderData, &FileHeader, sizeof(FileHeader));
+        if (!m_pFile->WriteAt(0, HeaderData, sizeof(HeaderData)))
+        {
+            LOG_ERROR_MESSAGE("Failed to initialize render state cache storage file '", m_FilePath, "'");
+            return false;
+        }
+    }
+    else
+    {
+        if (!m_pFile->ReadAt(0, &FileHeader, sizeof(FileHeader)))
+        {
+            LOG_ERROR_MESSAGE("Failed to read the header of render state cache storage file '", m_FilePath, "'");
+            return false;
+        }
+        if (FileHeader.Magic != StorageFileHeader::ExpectedMagic || FileHeader.Version != StorageFileHeader::ExpectedVersion)
+        {
+            LOG_ERROR_MESSAGE("File '", m_FilePath, "' is not a render state cache storage file or its version is not supported");
+            return false;
+        }
+        if (FileHeader.CommittedSize < StorageHeaderSize || FileHeader.CommittedSize % StorageRecordAlignment != 0)
+        {
+            LOG_ERROR_MESSAGE("Render state cache storage file '", m_FilePath, "' is corrupted");
+            return false;
+        }
+    }
+
+    // Write the record past the committed data. Anything that is already there is a leftover
+    // of an incomplete append and is overwritten.
+    const Uint64 RecordOffset = FileHeader.CommittedSize;
+    const Uint64 RecordEnd    = RecordOffset + sizeof(RecordHeader) + RecordHeader.DataSize;
+    const Uint64 PaddingSize  = AlignUp(RecordEnd, StorageRecordAlignment) - RecordEnd;
+
+    constexpr Uint8 Padding[StorageRecordAlignment] = {};
+    if (!m_pFile->WriteAt(RecordOffset, &RecordHeader, sizeof(RecordHeader)) ||
+        !m_pFile->WriteAt(RecordOffset + sizeof(RecordHeader), pData->GetConstDataPtr(), static_cast<size_t>(RecordHeader.DataSize)) ||
+        !m_pFile->WriteAt(RecordEnd, Padding, static_cast<size_t>(PaddingSize)))
+    {
+        LOG_ERROR_MESSAGE("Failed to write a record to render state cache storage file '", m_FilePath, "'");
+        return false;
+    }
+
+    // The record must reach the disk before it is committed
+    if (!m_pFile->Flush())
+        LOG_WARNING_MESSAGE("Failed to flush render state cache storage file '", m_FilePath, "'");
+
+    const Uint64 NewCommittedSize = RecordEnd + PaddingSize;
+    if (!m_pFile->WriteAt(offsetof(StorageFileHeader, CommittedSize), &NewCommittedSize, sizeof(NewCommittedSize)))
+    {
+        LOG_ERROR_MESSAGE("Failed to commit a record to render state cache storage file '", m_FilePath, "'");
+        return false;
+    }
+
+    if (RecordOffset >= m_ReadOffset)
+        m_OwnRecords.push_back(RecordOffset);
+
+    return true;
+}
+
+std::vector<RenderStateCacheStorage::Record> RenderStateCacheStorage::ReadNewRecords()
+{
+    std::lock_guard<std::mutex> Guard{m_Mtx};
+
+    std::vector<Record> Records;
+
+    const Uint64 CommittedSize = GetCommittedSize();
+
+    Uint64 Offset = std::max(m_ReadOffset, StorageHeaderSize);
+    while (Offset + sizeof(StorageRecordHeader) <= CommittedSize)
+    {
+        StorageRecordHeader RecordHeader;
+        if (!m_pStream->ReadAt(static_cast<size_t>(Offset), &RecordHeader, sizeof(RecordHeader)))
+            break;
+
+        const Uint64 DataOffset = Offset + sizeof(RecordHeader);
+        if (RecordHeader.Magic != StorageRecordHeader::ExpectedMagic || DataOffset + RecordHeader.DataSize > CommittedSize)
+        {
+            LOG_WARNING_MESSAGE("Render state cache storage file '", m_FilePath, "' contains an invalid record at offset ", Offset,
+                                ". The remaining records will be ignored.");
+            break;
+        }
+
+        const Uint64 NextOffset = AlignUp(DataOffset + RecordHeader.DataSize, StorageRecordAlignment);
+
+        auto own_it = std::find(m_OwnRecords.begin(), m_OwnRecords.end(), Offset);
+        if (own_it != m_OwnRecords.end())
+        {
+            // Skip the records appended by this object
+            m_OwnRecords.erase(own_it);
+            Offset = NextOffset;
+            continue;
+        }
+
+        Record NewRecord;
+        NewRecord.ContentVersion = RecordHeader.ContentVersion;
+        NewRecord.Offset         = Offset;
+        if (RecordHeader.DataSize > 0)
+        {
+            if (!m_pStream->MapData(static_cast<size_t>(DataOffset), static_cast<size_t>(RecordHeader.DataSize), FILE_ACCESS_HINT_SEQUENTIAL, &NewRecord.pData))
+                break;
+
+            if (ComputeRecordChecksum(NewRecord.pData->GetConstDataPtr(), NewRecord.pData->GetSize()) != RecordHeader.Checksum)
+            {
+                LOG_WARNING_MESSAGE("Checksum mismatch in the record at offset ", Offset, " of render state cache storage file '", m_FilePath,
+                                    "'. The record will be ignored.");
+                Offset = NextOffset;
+                continue;
+            }
+
+            Records.emplace_back(std::move(NewRecord));
+        }
+
+        Offset = NextOffset;
+    }
+
+    m_ReadOffset = Offset;
+
+    // Records below the read offset will never be read again
+    m_OwnRecords.erase(std::remove_if(m_OwnRecords.begin(), m_OwnRecords.end(),
+                                      [this](Uint64 RecordOffset) { return RecordOffset < m_ReadOffset; }),
+                       m_OwnRecords.end());
+
+    return Records;
+}
+
+void RenderStateCacheStorage::Rewind()
+{
+    std::lock_guard<std::mutex> Guard{m_Mtx};
+    m_ReadOffset = 0;
+    m_OwnRecords.clear();
+}
+
+} // namespace Diligent
@@ -38,6 +38,8 @@
 #include "../../../ThirdParty/GPUOpenShaderUtils/DXBCChecksum.h"
 #include "DataBlobImpl.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
+#include "RenderDevice.h"
+#include "StageTimings.hpp"
 
 namespace Diligent
 {
@@ -1764,6 +1766,8 @@ RefCntAutoPtr<IDataBlob> RemapResourceBindings(const TResourceBindingMap& Resour
                                                const void*                pBytecode,
                                                size_t                     Size)
 {
+    ScopedStageTimer Timer{STATE_CREATION_STAGE_SHADER_PATCHING};
+
     if (pBytecode == nullptr)
     {
         LOG_ERROR_MESSAGE("pBytecode must not be null.");
@@ -60,6 +60,8 @@
 #include "DataBlobImpl.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "RenderDevice.h"
+#include "StageTimings.hpp"
 
 #include "HLSLUtils.hpp"
 
@@ -333,6 +335,8 @@ std::unique_ptr<IDXCompiler> CreateDXCompiler(DXCompilerTarget Target, Uint32 AP
 
 bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
 {
+    ScopedStageTimer Timer{STATE_CREATION_STAGE_SHADER_COMPILATION};
+
     try
     {
         DxcCreateInstanceProc CreateInstance = m_Library.GetDxcCreateInstance();
@@ -824,6 +828,8 @@ bool DXCompilerImpl::RemapResourceBindings(const TResourceBindingMap& ResourceMa
     // NOTE: a reference to pSrcBytecode may be kept in the returned object
 
 #if D3D12_SUPPORTED
+    ScopedStageTimer Timer{STATE_CREATION_STAGE_SHADER_PATCHING};
+
     try
     {
         DxcCreateInstanceProc CreateInstance = m_Library.GetDxcCreateInstance();
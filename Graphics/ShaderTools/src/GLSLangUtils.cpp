@@ -47,6 +47,7 @@
 #include "DataBlobImpl.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "StageTimings.hpp"
 #ifdef USE_SPIRV_TOOLS
 #    include "SPIRVTools.hpp"
 #endif
@@ -263,6 +264,8 @@ std::vector<unsigned int> CompileShaderInternal(::glslang::TShader&           Sh
                                                 ::EProfile                    shProfile,
                                                 IDataBlob**                   ppCompilerOutput)
 {
+    ScopedStageTimer Timer{STATE_CREATION_STAGE_SHADER_COMPILATION};
+
     Shader.setAutoMapBindings(true);
     Shader.setAutoMapLocations(true);
     TBuiltInResource Resources = InitResources();
@@ -449,22 +452,27 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     Shader.setEntryPoint(ShaderCI.EntryPoint);
     Shader.setEnvTargetHlslFunctionality1();
 
-    const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+    ShaderSourceFileData SourceData;
+    std::string          Preamble;
+    {
+        ScopedStageTimer Timer{STATE_CREATION_STAGE_SHADER_PREPROCESSING};
 
-    std::string Preamble;
-    if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR) != 0)
-        Preamble += "#pragma pack_matrix(row_major)\n\n";
-    Preamble.append("#define GLSLANG\n\n");
-    Preamble.append(g_HLSLDefinitions);
-    AppendShaderTypeDefinitions(Preamble, ShaderCI.Desc.ShaderType);
+        SourceData = ReadShaderSourceFile(ShaderCI);
 
-    if (ExtraDefinitions != nullptr)
-        Preamble += ExtraDefinitions;
+        if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR) != 0)
+            Preamble += "#pragma pack_matrix(row_major)\n\n";
+        Preamble.append("#define GLSLANG\n\n");
+        Preamble.append(g_HLSLDefinitions);
+        AppendShaderTypeDefinitions(Preamble, ShaderCI.Desc.ShaderType);
 
-    if (ShaderCI.Macros)
-    {
-        Preamble += '\n';
-        AppendShaderMacros(Preamble, ShaderCI.Macros);
+        if (ExtraDefinitions != nullptr)
+            Preamble += ExtraDefinitions;
+
+        if (ShaderCI.Macros)
+        {
+            Preamble += '\n';
+            AppendShaderMacros(Preamble, ShaderCI.Macros);
+        }
     }
 
     Shader.setPreamble(Preamble.c_str());
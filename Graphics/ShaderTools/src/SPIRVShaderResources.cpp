@@ -34,6 +34,7 @@
 #include "StringTools.hpp"
 #include "Align.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "StageTimings.hpp"
 
 namespace Diligent
 {
@@ -385,6 +386,8 @@ SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
                                            std::string&          EntryPoint) noexcept(false) :
     m_ShaderType{shaderDesc.ShaderType}
 {
+    ScopedStageTimer Timer{STATE_CREATION_STAGE_SHADER_REFLECTION};
+
     // https://github.com/KhronosGroup/SPIRV-Cross/wiki/Reflection-API-user-guide
     diligent_spirv_cross::Parser parser{std::move(spirv_binary)};
     parser.parse();
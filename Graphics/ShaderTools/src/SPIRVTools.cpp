@@ -26,6 +26,8 @@
 
 #include "SPIRVTools.hpp"
 #include "DebugUtilities.hpp"
+#include "RenderDevice.h"
+#include "StageTimings.hpp"
 
 #include "spirv-tools/optimizer.hpp"
 
@@ -111,6 +113,8 @@ std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_t
 {
     VERIFY_EXPR(Passes != SPIRV_OPTIMIZATION_FLAG_NONE);
 
+    ScopedStageTimer Timer{STATE_CREATION_STAGE_SPIRV_OPTIMIZATION};
+
     if (TargetEnv == SPV_ENV_MAX)
         TargetEnv = SpvTargetEnvFromSPIRV(SrcSPIRV);
 
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Primitives/interface/FlagEnum.h"
 
 namespace Diligent
 {
@@ -42,6 +43,20 @@ enum class ThreadPriority
     Highest
 };
 
+/// CPU instruction set extensions that can be detected at run time
+enum CPU_FEATURE_FLAGS : Uint32
+{
+    CPU_FEATURE_FLAG_NONE  = 0u,
+    CPU_FEATURE_FLAG_SSE2  = 1u << 0u,
+    CPU_FEATURE_FLAG_SSE41 = 1u << 1u,
+    CPU_FEATURE_FLAG_AVX   = 1u << 2u,
+    CPU_FEATURE_FLAG_AVX2  = 1u << 3u,
+    CPU_FEATURE_FLAG_FMA   = 1u << 4u,
+    CPU_FEATURE_FLAG_F16C  = 1u << 5u,
+    CPU_FEATURE_FLAG_NEON  = 1u << 6u,
+};
+DEFINE_FLAG_ENUM_OPERATORS(CPU_FEATURE_FLAGS)
+
 /// Basic platform-specific miscellaneous functions
 struct BasicPlatformMisc
 {
@@ -114,6 +129,12 @@ struct BasicPlatformMisc
     /// Sets the name of the current thread.
     static void SetCurrentThreadName(const char* Name);
 
+    /// Returns the instruction set extensions supported by the CPU and the OS.
+
+    /// The features are detected once on the first call.
+    /// AVX-based features are only reported if the OS saves the AVX state.
+    static CPU_FEATURE_FLAGS GetCPUFeatures();
+
 private:
     static void SwapBytes16(Uint16& Val)
     {
@@ -27,6 +27,14 @@
 #include "BasicPlatformMisc.hpp"
 #include "DebugUtilities.hpp"
 
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#    include <intrin.h>
+#    define DILIGENT_CPUID_MSVC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+#    include <cpuid.h>
+#    define DILIGENT_CPUID_GCC 1
+#endif
+
 namespace Diligent
 {
 
@@ -53,4 +61,98 @@ void BasicPlatformMisc::SetCurrentThreadName(const char* Name)
     LOG_WARNING_MESSAGE_ONCE("SetCurrentThreadName is not implemented on this platform.");
 }
 
+namespace
+{
+
+#if DILIGENT_CPUID_MSVC || DILIGENT_CPUID_GCC
+
+void CPUID(Uint32 Leaf, Uint32 SubLeaf, Uint32 (&Regs)[4])
+{
+#    if DILIGENT_CPUID_MSVC
+    int Info[4] = {};
+    __cpuidex(Info, static_cast<int>(Leaf), static_cast<int>(SubLeaf));
+    for (size_t i = 0; i < 4; ++i)
+        Regs[i] = static_cast<Uint32>(Info[i]);
+#    else
+    __cpuid_count(Leaf, SubLeaf, Regs[0], Regs[1], Regs[2], Regs[3]);
+#    endif
+}
+
+Uint64 GetXCR0()
+{
+#    if DILIGENT_CPUID_MSVC
+    return _xgetbv(0);
+#    else
+    // Use the raw instruction as _xgetbv() requires the -mxsave compiler option
+    Uint32 Lo = 0;
+    Uint32 Hi = 0;
+    __asm__ __volatile__("xgetbv"
+                         : "=a"(Lo), "=d"(Hi)
+                         : "c"(0));
+    return (Uint64{Hi} << 32u) | Lo;
+#    endif
+}
+
+CPU_FEATURE_FLAGS DetectCPUFeatures()
+{
+    CPU_FEATURE_FLAGS Features = CPU_FEATURE_FLAG_NONE;
+
+    Uint32 Regs[4] = {}; // EAX, EBX, ECX, EDX
+    CPUID(0, 0, Regs);
+    const Uint32 MaxLeaf = Regs[0];
+    if (MaxLeaf < 1)
+        return Features;
+
+    CPUID(1, 0, Regs);
+    const Uint32 ECX1 = Regs[2];
+    const Uint32 EDX1 = Regs[3];
+
+    if (EDX1 & (1u << 26u))
+        Features |= CPU_FEATURE_FLAG_SSE2;
+    if (ECX1 & (1u << 19u))
+        Features |= CPU_FEATURE_FLAG_SSE41;
+
+    // AVX requires the OS to save YMM registers on context switch (OSXSAVE and XCR0 bits 1 and 2)
+    const bool OSXSAVE = (ECX1 & (1u << 27u)) != 0;
+    const bool OSAVX   = OSXSAVE && (GetXCR0() & 0x6u) == 0x6u;
+    if (!OSAVX || (ECX1 & (1u << 28u)) == 0)
+        return Features;
+
+    Features |= CPU_FEATURE_FLAG_AVX;
+    if (ECX1 & (1u << 12u))
+        Features |= CPU_FEATURE_FLAG_FMA;
+    if (ECX1 & (1u << 29u))
+        Features |= CPU_FEATURE_FLAG_F16C;
+
+    if (MaxLeaf >= 7)
+    {
+        CPUID(7, 0, Regs);
+        if (Regs[1] & (1u << 5u))
+            Features |= CPU_FEATURE_FLAG_AVX2;
+    }
+
+    return Features;
+}
+
+#else
+
+CPU_FEATURE_FLAGS DetectCPUFeatures()
+{
+#    if defined(__ARM_NEON) || defined(__ARM_NEON__) || (defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM)))
+    return CPU_FEATURE_FLAG_NEON;
+#    else
+    return CPU_FEATURE_FLAG_NONE;
+#    endif
+}
+
+#endif
+
+} // namespace
+
+CPU_FEATURE_FLAGS BasicPlatformMisc::GetCPUFeatures()
+{
+    static const CPU_FEATURE_FLAGS Features = DetectCPUFeatures();
+    return Features;
+}
+
 } // namespace Diligent
@@ -0,0 +1,201 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Memory-mapped, random-access and asynchronous file I/O primitives for Linux
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Memory access pattern hint for the mapped file data, see madvise().
+enum class LinuxFileAccessHint : Uint8
+{
+    Normal,
+    Sequential,
+    Random,
+    WillNeed
+};
+
+/// Read-only memory mapping of a file region.
+class LinuxFileMapping
+{
+public:
+    LinuxFileMapping() noexcept {}
+
+    /// Maps Size bytes of the file starting at Offset. Offset does not need to be page-aligned.
+    LinuxFileMapping(int Fd, size_t Offset, size_t Size, LinuxFileAccessHint Hint) noexcept;
+
+    ~LinuxFileMapping();
+
+    // clang-format off
+    LinuxFileMapping           (const LinuxFileMapping&) = delete;
+    LinuxFileMapping& operator=(const LinuxFileMapping&) = delete;
+    // clang-format on
+
+    LinuxFileMapping(LinuxFileMapping&& Other) noexcept;
+    LinuxFileMapping& operator=(LinuxFileMapping&& Other) noexcept;
+
+    /// Applies the access hint to the region of the mapped data.
+    bool Advise(size_t Offset, size_t Size, LinuxFileAccessHint Hint) const;
+
+    const void* GetData() const { return m_pData; }
+    size_t      GetSize() const { return m_Size; }
+
+    explicit operator bool() const { return m_pData != nullptr; }
+
+private:
+    void Release();
+
+    void*       m_pMapping    = nullptr;
+    size_t      m_MappingSize = 0;
+    const void* m_pData       = nullptr;
+    size_t      m_Size        = 0;
+};
+
+
+/// Read-only file that supports thread-safe random-access reads and memory mapping.
+class LinuxNativeFile
+{
+public:
+    explicit LinuxNativeFile(const char* Path) noexcept;
+    ~LinuxNativeFile();
+
+    // clang-format off
+    LinuxNativeFile           (const LinuxNativeFile&) = delete;
+    LinuxNativeFile& operator=(const LinuxNativeFile&) = delete;
+    // clang-format on
+
+    bool IsValid() const { return m_Fd >= 0; }
+    int  GetDescriptor() const { return m_Fd; }
+
+    size_t GetSize() const;
+
+    /// Reads Size bytes at Offset using pread(). Does not modify the file position and is thread-safe.
+    bool ReadAt(size_t Offset, void* pData, size_t Size) const;
+
+    /// Maps the file region into memory. If Size is zero, maps the data up to the end of the file.
+    LinuxFileMapping Map(size_t Offset, size_t Size, LinuxFileAccessHint Hint) const;
+
+private:
+    int m_Fd = -1;
+};
+
+
+/// Asynchronous batched file read queue.
+///
+/// The reader uses io_uring when it is available and falls back to a set of worker
+/// threads that perform blocking pread() calls otherwise. Completion callbacks are
+/// invoked from the reader's internal threads.
+class LinuxAsyncFileReader
+{
+public:
+    using CallbackType = void (*)(bool Success, size_t BytesRead, void* pUserData);
+
+    struct Request
+    {
+        int          Fd        = -1;
+        size_t       Offset    = 0;
+        size_t       Size      = 0;
+        void*        pData     = nullptr;
+        CallbackType Callback  = nullptr;
+        void*        pUserData = nullptr;
+    };
+
+    struct CreateInfo
+    {
+        /// The maximum number of reads that are in flight at the same time.
+        Uint32 QueueDepth = 64;
+
+        /// The number of worker threads when io_uring is not available.
+        Uint32 NumFallbackThreads = 2;
+
+        /// Whether to try using io_uring.
+        bool UseIoUring = true;
+    };
+
+    explicit LinuxAsyncFileReader(const CreateInfo& CI) noexcept;
+    LinuxAsyncFileReader() noexcept :
+        LinuxAsyncFileReader{CreateInfo{}}
+    {}
+
+    /// Waits for all pending reads and stops the internal threads.
+    ~LinuxAsyncFileReader();
+
+    // clang-format off
+    LinuxAsyncFileReader           (const LinuxAsyncFileReader&) = delete;
+    LinuxAsyncFileReader& operator=(const LinuxAsyncFileReader&) = delete;
+    // clang-format on
+
+    /// Enqueues the read requests. The method blocks if the queue is full, unless it is
+    /// called from a completion callback, in which case the requests are deferred until
+    /// a slot is released. Requests that could not be submitted complete with Success = false.
+    void Enqueue(const Request* pRequests, size_t NumRequests);
+
+    /// Waits until all enqueued reads are complete.
+    ///
+    /// \return true if all reads that completed since the last call succeeded.
+    bool WaitForIdle();
+
+    bool IsUsingIoUring() const { return m_pRing != nullptr; }
+
+private:
+    void OnRequestComplete(const Request& Req, bool Success, size_t BytesRead);
+
+    void FallbackWorkerThread();
+
+    struct IoUring;
+    void IoUringCompletionThread();
+
+private:
+    std::unique_ptr<IoUring> m_pRing;
+
+    // Fallback queue
+    std::mutex              m_QueueMtx;
+    std::condition_variable m_QueueCV;
+    std::deque<Request>     m_Queue;
+    bool                    m_Stop = false;
+
+    std::vector<std::thread> m_Threads;
+
+    std::mutex              m_IdleMtx;
+    std::condition_variable m_IdleCV;
+    size_t                  m_NumPending = 0;
+    std::atomic<bool>       m_Failed{false};
+};
+
+} // namespace Diligent
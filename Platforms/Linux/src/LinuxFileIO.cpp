@@ -0,0 +1,666 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../interface/LinuxFileIO.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#if defined(__has_include)
+#    if __has_include(<linux/io_uring.h>)
+#        include <linux/io_uring.h>
+#        define DILIGENT_HAS_IO_URING 1
+#    endif
+#endif
+#ifndef DILIGENT_HAS_IO_URING
+#    define DILIGENT_HAS_IO_URING 0
+#endif
+
+#include "Errors.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+int AccessHintToMadvise(LinuxFileAccessHint Hint)
+{
+    switch (Hint)
+    {
+        // clang-format off
+        case LinuxFileAccessHint::Normal:     return MADV_NORMAL;
+        case LinuxFileAccessHint::Sequential: return MADV_SEQUENTIAL;
+        case LinuxFileAccessHint::Random:     return MADV_RANDOM;
+        case LinuxFileAccessHint::WillNeed:   return MADV_WILLNEED;
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected file access hint");
+            return MADV_NORMAL;
+    }
+}
+
+size_t GetPageSize()
+{
+    static const size_t PageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return PageSize;
+}
+
+// Reads up to Size bytes at Offset, retrying interrupted and partial reads.
+// Returns the number of bytes read, which is less than Size only at the end of file or on error.
+size_t PReadAll(int Fd, size_t Offset, void* pData, size_t Size, bool& Error)
+{
+    Error = false;
+
+    size_t BytesRead = 0;
+    while (BytesRead < Size)
+    {
+        const ssize_t Res = pread(Fd, static_cast<Uint8*>(pData) + BytesRead, Size - BytesRead, static_cast<off_t>(Offset + BytesRead));
+        if (Res < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            Error = true;
+            break;
+        }
+        if (Res == 0)
+            break; // End of file
+
+        BytesRead += static_cast<size_t>(Res);
+    }
+    return BytesRead;
+}
+
+} // namespace
+
+
+LinuxFileMapping::LinuxFileMapping(int Fd, size_t Offset, size_t Size, LinuxFileAccessHint Hint) noexcept
+{
+    if (Fd < 0 || Size == 0)
+        return;
+
+    // The mapping offset must be a multiple of the page size
+    const size_t PageSize  = GetPageSize();
+    const size_t MapOffset = Offset / PageSize * PageSize;
+    const size_t Delta     = Offset - MapOffset;
+
+    void* pMapping = mmap(nullptr, Size + Delta, PROT_READ, MAP_PRIVATE, Fd, static_cast<off_t>(MapOffset));
+    if (pMapping == MAP_FAILED)
+    {
+        LOG_ERROR_MESSAGE("Failed to map ", Size, " bytes of the file at offset ", Offset, ": ", strerror(errno));
+        return;
+    }
+
+    m_pMapping    = pMapping;
+    m_MappingSize = Size + Delta;
+    m_pData       = static_cast<const Uint8*>(pMapping) + Delta;
+    m_Size        = Size;
+
+    if (Hint != LinuxFileAccessHint::Normal)
+        Advise(0, Size, Hint);
+}
+
+LinuxFileMapping::~LinuxFileMapping()
+{
+    Release();
+}
+
+LinuxFileMapping::LinuxFileMapping(LinuxFileMapping&& Other) noexcept :
+    // clang-format off
+    m_pMapping   {Other.m_pMapping},
+    m_MappingSize{Other.m_MappingSize},
+    m_pData      {Other.m_pData},
+    m_Size       {Other.m_Size}
+// clang-format on
+{
+    Other.m_pMapping    = nullptr;
+    Other.m_MappingSize = 0;
+    Other.m_pData       = nullptr;
+    Other.m_Size        = 0;
+}
+
+LinuxFileMapping& LinuxFileMapping::operator=(LinuxFileMapping&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        Release();
+        std::swap(m_pMapping, Other.m_pMapping);
+        std::swap(m_MappingSize, Other.m_MappingSize);
+        std::swap(m_pData, Other.m_pData);
+        std::swap(m_Size, Other.m_Size);
+    }
+    return *this;
+}
+
+void LinuxFileMapping::Release()
+{
+    if (m_pMapping != nullptr)
+        munmap(m_pMapping, m_MappingSize);
+
+    m_pMapping    = nullptr;
+    m_MappingSize = 0;
+    m_pData       = nullptr;
+    m_Size        = 0;
+}
+
+bool LinuxFileMapping::Advise(size_t Offset, size_t Size, LinuxFileAccessHint Hint) const
+{
+    if (m_pMapping == nullptr || Offset >= m_Size)
+        return false;
+
+    Size = std::min(Size, m_Size - Offset);
+
+    // madvise() requires the address to be page-aligned
+    const size_t Start        = static_cast<const Uint8*>(m_pData) - static_cast<const Uint8*>(m_pMapping) + Offset;
+    const size_t AlignedStart = Start / GetPageSize() * GetPageSize();
+    return madvise(static_cast<Uint8*>(m_pMapping) + AlignedStart, Start + Size - AlignedStart, AccessHintToMadvise(Hint)) == 0;
+}
+
+
+LinuxNativeFile::LinuxNativeFile(const char* Path) noexcept
+{
+    if (Path == nullptr || Path[0] == '\0')
+    {
+        UNEXPECTED("Path must not be null or empty");
+        return;
+    }
+
+    do
+    {
+        m_Fd = open(Path, O_RDONLY | O_CLOEXEC);
+    } while (m_Fd < 0 && errno == EINTR);
+
+    if (m_Fd < 0)
+        LOG_ERROR_MESSAGE("Failed to open file ", Path, ": ", strerror(errno));
+}
+
+LinuxNativeFile::~LinuxNativeFile()
+{
+    if (m_Fd >= 0)
+        close(m_Fd);
+}
+
+size_t LinuxNativeFile::GetSize() const
+{
+    struct stat StatBuff = {};
+    if (m_Fd < 0 || fstat(m_Fd, &StatBuff) != 0)
+        return 0;
+
+    return static_cast<size_t>(StatBuff.st_size);
+}
+
+bool LinuxNativeFile::ReadAt(size_t Offset, void* pData, size_t Size) const
+{
+    if (m_Fd < 0)
+        return false;
+
+    bool Error = false;
+    return PReadAll(m_Fd, Offset, pData, Size, Error) == Size;
+}
+
+LinuxFileMapping LinuxNativeFile::Map(size_t Offset, size_t Size, LinuxFileAccessHint Hint) const
+{
+    const size_t FileSize = GetSize();
+    if (Offset > FileSize)
+    {
+        LOG_ERROR_MESSAGE("Offset (", Offset, ") exceeds the file size (", FileSize, ")");
+        return {};
+    }
+
+    if (Size == 0)
+        Size = FileSize - Offset;
+
+    if (Offset + Size > FileSize)
+    {
+        LOG_ERROR_MESSAGE("The mapped region [", Offset, ", ", Offset + Size, ") exceeds the file size (", FileSize, ")");
+        return {};
+    }
+
+    return LinuxFileMapping{m_Fd, Offset, Size, Hint};
+}
+
+
+#if DILIGENT_HAS_IO_URING
+
+struct LinuxAsyncFileReader::IoUring
+{
+    static constexpr __u64 ExitUserData = ~__u64{0};
+
+    struct Slot
+    {
+        Request Req;
+        iovec   Iov       = {};
+        size_t  BytesRead = 0;
+    };
+
+    int Fd = -1;
+
+    void*  pSQRing    = nullptr;
+    size_t SQRingSize = 0;
+    void*  pCQRing    = nullptr;
+    size_t CQRingSize = 0;
+
+    io_uring_sqe* pSQEs    = nullptr;
+    size_t        SQEsSize = 0;
+
+    unsigned* pSQHead  = nullptr;
+    unsigned* pSQTail  = nullptr;
+    unsigned* pSQMask  = nullptr;
+    unsigned* pSQArray = nullptr;
+
+    unsigned*     pCQHead = nullptr;
+    unsigned*     pCQTail = nullptr;
+    unsigned*     pCQMask = nullptr;
+    io_uring_cqe* pCQEs   = nullptr;
+
+    // Protects the submission queue, the slots and the backlog
+    std::mutex              Mtx;
+    std::condition_variable SlotCV;
+    std::vector<Slot>       Slots;
+    std::vector<Uint32>     FreeSlots;
+    // Requests enqueued by the completion thread while all slots were busy.
+    // The completion thread is the only one that frees slots, so it can't wait for one.
+    std::deque<Request> Backlog;
+
+    bool Init(Uint32 QueueDepth)
+    {
+        io_uring_params Params = {};
+        // Reserve one extra entry for the exit request
+        Fd = static_cast<int>(syscall(__NR_io_uring_setup, QueueDepth + 1, &Params));
+        if (Fd < 0)
+            return false;
+
+        SQRingSize = Params.sq_off.array + Params.sq_entries * sizeof(unsigned);
+        CQRingSize = Params.cq_off.cqes + Params.cq_entries * sizeof(io_uring_cqe);
+
+        const bool SingleMmap = (Params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (SingleMmap)
+            SQRingSize = CQRingSize = std::max(SQRingSize, CQRingSize);
+
+        pSQRing = mmap(nullptr, SQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, Fd, IORING_OFF_SQ_RING);
+        if (pSQRing == MAP_FAILED)
+        {
+            pSQRing = nullptr;
+            return false;
+        }
+
+        if (SingleMmap)
+        {
+            pCQRing = pSQRing;
+        }
+        else
+        {
+            pCQRing = mmap(nullptr, CQRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, Fd, IORING_OFF_CQ_RING);
+            if (pCQRing == MAP_FAILED)
+            {
+                pCQRing = nullptr;
+                return false;
+            }
+        }
+
+        SQEsSize       = Params.sq_entries * sizeof(io_uring_sqe);
+        void* pSQEsMem = mmap(nullptr, SQEsSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, Fd, IORING_OFF_SQES);
+        if (pSQEsMem == MAP_FAILED)
+            return false;
+        pSQEs = static_cast<io_uring_sqe*>(pSQEsMem);
+
+        Uint8* pSQ = static_cast<Uint8*>(pSQRing);
+        pSQHead    = reinterpret_cast<unsigned*>(pSQ + Params.sq_off.head);
+        pSQTail    = reinterpret_cast<unsigned*>(pSQ + Params.sq_off.tail);
+        pSQMask    = reinterpret_cast<unsigned*>(pSQ + Params.sq_off.ring_mask);
+        pSQArray   = reinterpret_cast<unsigned*>(pSQ + Params.sq_off.array);
+
+        Uint8* pCQ = static_cast<Uint8*>(pCQRing);
+        pCQHead    = reinterpret_cast<unsigned*>(pCQ + Params.cq_off.head);
+        pCQTail    = reinterpret_cast<unsigned*>(pCQ + Params.cq_off.tail);
+        pCQMask    = reinterpret_cast<unsigned*>(pCQ + Params.cq_off.ring_mask);
+        pCQEs      = reinterpret_cast<io_uring_cqe*>(pCQ + Params.cq_off.cqes);
+
+        Slots.resize(QueueDepth);
+        FreeSlots.reserve(QueueDepth);
+        for (Uint32 i = QueueDepth; i > 0; --i)
+            FreeSlots.push_back(i - 1);
+
+        return true;
+    }
+
+    ~IoUring()
+    {
+        if (pSQEs != nullptr)
+            munmap(pSQEs, SQEsSize);
+        if (pCQRing != nullptr && pCQRing != pSQRing)
+            munmap(pCQRing, CQRingSize);
+        if (pSQRing != nullptr)
+            munmap(pSQRing, SQRingSize);
+        if (Fd >= 0)
+            close(Fd);
+    }
+
+    // Pushes the submission queue entry and submits it to the kernel. Must be called with Mtx locked.
+    // Returns false if the kernel rejected the entry, in which case no completion will be posted for it.
+    bool Submit(Uint8 Opcode, __u64 UserData, int FileFd, const iovec* pIov, size_t Offset)
+    {
+        const unsigned Tail = *pSQTail;
+        const unsigned Idx  = Tail & *pSQMask;
+
+        io_uring_sqe& SQE = pSQEs[Idx];
+        std::memset(&SQE, 0, sizeof(SQE));
+        SQE.opcode    = Opcode;
+        SQE.fd        = FileFd;
+        SQE.off       = Offset;
+        SQE.addr      = reinterpret_cast<__u64>(pIov);
+        SQE.len       = pIov != nullptr ? 1 : 0;
+        SQE.user_data = UserData;
+
+        pSQArray[Idx] = Idx;
+        // Make the entry visible to the kernel before the tail update
+        __atomic_store_n(pSQTail, Tail + 1, __ATOMIC_RELEASE);
+
+        while (syscall(__NR_io_uring_enter, Fd, 1, 0, 0, nullptr, 0) < 0)
+        {
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+            {
+                LOG_ERROR_MESSAGE("io_uring_enter failed: ", strerror(errno));
+                // Without SQPOLL, the kernel only consumes entries inside io_uring_enter. If it did not
+                // consume this one, take it back so that it is not submitted with an unrelated request later.
+                if (__atomic_load_n(pSQHead, __ATOMIC_ACQUIRE) == Tail)
+                {
+                    __atomic_store_n(pSQTail, Tail, __ATOMIC_RELEASE);
+                    return false;
+                }
+                break;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    bool SubmitSlot(Uint32 SlotIdx)
+    {
+        Slot& S = Slots[SlotIdx];
+
+        S.Iov.iov_base = static_cast<Uint8*>(S.Req.pData) + S.BytesRead;
+        S.Iov.iov_len  = S.Req.Size - S.BytesRead;
+        // Use READV rather than READ as it is supported by all kernels that have io_uring
+        return Submit(IORING_OP_READV, SlotIdx, S.Req.Fd, &S.Iov, S.Req.Offset + S.BytesRead);
+    }
+
+    // Puts the request into a free slot and submits it. Must be called with Mtx locked.
+    // Returns false and releases the slot if the submission failed.
+    bool SubmitRequest(const Request& Req)
+    {
+        VERIFY_EXPR(!FreeSlots.empty());
+        const Uint32 SlotIdx = FreeSlots.back();
+        FreeSlots.pop_back();
+
+        Slots[SlotIdx].Req = Req;
+        if (SubmitSlot(SlotIdx))
+            return true;
+
+        Slots[SlotIdx] = {};
+        FreeSlots.push_back(SlotIdx);
+        return false;
+    }
+};
+
+void LinuxAsyncFileReader::IoUringCompletionThread()
+{
+    IoUring& Ring = *m_pRing;
+
+    bool Exit = false;
+    while (!Exit)
+    {
+        if (syscall(__NR_io_uring_enter, Ring.Fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 && errno != EINTR)
+        {
+            LOG_ERROR_MESSAGE("io_uring_enter failed: ", strerror(errno));
+            std::this_thread::yield();
+        }
+
+        unsigned       Head = *Ring.pCQHead;
+        const unsigned Tail = __atomic_load_n(Ring.pCQTail, __ATOMIC_ACQUIRE);
+        while (Head != Tail)
+        {
+            const io_uring_cqe CQE = Ring.pCQEs[Head & *Ring.pCQMask];
+            ++Head;
+            // Release the entry to the kernel
+            __atomic_store_n(Ring.pCQHead, Head, __ATOMIC_RELEASE);
+
+            if (CQE.user_data == IoUring::ExitUserData)
+            {
+                Exit = true;
+                continue;
+            }
+
+            const Uint32 SlotIdx = static_cast<Uint32>(CQE.user_data);
+
+            Request              Req;
+            size_t               BytesRead = 0;
+            std::vector<Request> FailedRequests;
+            {
+                std::lock_guard<std::mutex> Lock{Ring.Mtx};
+
+                IoUring::Slot& S = Ring.Slots[SlotIdx];
+                if (CQE.res > 0)
+                {
+                    S.BytesRead += static_cast<size_t>(CQE.res);
+                    // Short read - request the remaining data
+                    if (S.BytesRead < S.Req.Size && Ring.SubmitSlot(SlotIdx))
+                        continue;
+                }
+                else if (CQE.res < 0)
+                {
+                    LOG_ERROR_MESSAGE("Asynchronous file read failed: ", strerror(-CQE.res));
+                }
+
+                Req       = S.Req;
+                BytesRead = S.BytesRead;
+                S         = {};
+                Ring.FreeSlots.push_back(SlotIdx);
+
+                // Requests enqueued from completion callbacks take precedence over waiting threads
+                while (!Ring.Backlog.empty() && !Ring.FreeSlots.empty())
+                {
+                    if (!Ring.SubmitRequest(Ring.Backlog.front()))
+                        FailedRequests.push_back(Ring.Backlog.front());
+                    Ring.Backlog.pop_front();
+                }
+            }
+            Ring.SlotCV.notify_one();
+
+            OnRequestComplete(Req, BytesRead == Req.Size, BytesRead);
+            for (const Request& FailedReq : FailedRequests)
+                OnRequestComplete(FailedReq, false, 0);
+        }
+    }
+}
+
+#else
+
+struct LinuxAsyncFileReader::IoUring
+{
+};
+
+void LinuxAsyncFileReader::IoUringCompletionThread()
+{
+}
+
+#endif
+
+
+LinuxAsyncFileReader::LinuxAsyncFileReader(const CreateInfo& CI) noexcept
+{
+#if DILIGENT_HAS_IO_URING
+    if (CI.UseIoUring)
+    {
+        m_pRing = std::make_unique<IoUring>();
+        if (m_pRing->Init(std::max(CI.QueueDepth, 1u)))
+        {
+            m_Threads.emplace_back(&LinuxAsyncFileReader::IoUringCompletionThread, this);
+            return;
+        }
+        m_pRing.reset();
+    }
+#endif
+
+    const Uint32 NumThreads = std::max(CI.NumFallbackThreads, 1u);
+    for (Uint32 i = 0; i < NumThreads; ++i)
+        m_Threads.emplace_back(&LinuxAsyncFileReader::FallbackWorkerThread, this);
+}
+
+LinuxAsyncFileReader::~LinuxAsyncFileReader()
+{
+    WaitForIdle();
+
+#if DILIGENT_HAS_IO_URING
+    if (m_pRing)
+    {
+        std::lock_guard<std::mutex> Lock{m_pRing->Mtx};
+        m_pRing->Submit(IORING_OP_NOP, IoUring::ExitUserData, -1, nullptr, 0);
+    }
+    else
+#endif
+    {
+        std::lock_guard<std::mutex> Lock{m_QueueMtx};
+        m_Stop = true;
+    }
+    m_QueueCV.notify_all();
+
+    for (std::thread& Thread : m_Threads)
+        Thread.join();
+}
+
+void LinuxAsyncFileReader::Enqueue(const Request* pRequests, size_t NumRequests)
+{
+    if (pRequests == nullptr || NumRequests == 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> Lock{m_IdleMtx};
+        m_NumPending += NumRequests;
+    }
+
+#if DILIGENT_HAS_IO_URING
+    if (m_pRing)
+    {
+        IoUring& Ring = *m_pRing;
+        for (size_t i = 0; i < NumRequests; ++i)
+        {
+            const Request& Req = pRequests[i];
+            if (Req.Size == 0)
+            {
+                OnRequestComplete(Req, true, 0);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> Lock{Ring.Mtx};
+            if (Ring.FreeSlots.empty())
+            {
+                if (std::this_thread::get_id() == m_Threads.front().get_id())
+                {
+                    // Called from a completion callback: only this thread frees slots, so
+                    // the request is submitted when the next read completes.
+                    Ring.Backlog.push_back(Req);
+                    continue;
+                }
+                // Block while the queue is full
+                Ring.SlotCV.wait(Lock, [&Ring]() { return !Ring.FreeSlots.empty(); });
+            }
+
+            if (!Ring.SubmitRequest(Req))
+            {
+                Lock.unlock();
+                Ring.SlotCV.notify_one();
+                OnRequestComplete(Req, false, 0);
+            }
+        }
+        return;
+    }
+#endif
+
+    {
+        std::lock_guard<std::mutex> Lock{m_QueueMtx};
+        m_Queue.insert(m_Queue.end(), pRequests, pRequests + NumRequests);
+    }
+    m_QueueCV.notify_all();
+}
+
+void LinuxAsyncFileReader::FallbackWorkerThread()
+{
+    for (;;)
+    {
+        Request Req;
+        {
+            std::unique_lock<std::mutex> Lock{m_QueueMtx};
+            m_QueueCV.wait(Lock, [this]() { return m_Stop || !m_Queue.empty(); });
+            if (m_Queue.empty())
+                return;
+
+            Req = m_Queue.front();
+            m_Queue.pop_front();
+        }
+
+        bool         Error     = false;
+        const size_t BytesRead = PReadAll(Req.Fd, Req.Offset, Req.pData, Req.Size, Error);
+        if (Error)
+            LOG_ERROR_MESSAGE("Asynchronous file read failed: ", strerror(errno));
+
+        OnRequestComplete(Req, BytesRead == Req.Size, BytesRead);
+    }
+}
+
+void LinuxAsyncFileReader::OnRequestComplete(const Request& Req, bool Success, size_t BytesRead)
+{
+    if (!Success)
+        m_Failed.store(true);
+
+    if (Req.Callback != nullptr)
+        Req.Callback(Success, BytesRead, Req.pUserData);
+
+    // Decrement the counter after the callback so that WaitForIdle()
+    // guarantees that all callbacks have returned.
+    std::lock_guard<std::mutex> Lock{m_IdleMtx};
+    VERIFY_EXPR(m_NumPending > 0);
+    if (--m_NumPending == 0)
+        m_IdleCV.notify_all();
+}
+
+bool LinuxAsyncFileReader::WaitForIdle()
+{
+    std::unique_lock<std::mutex> Lock{m_IdleMtx};
+    m_IdleCV.wait(Lock, [this]() { return m_NumPending == 0; });
+    return !m_Failed.exchange(false);
+}
+
+} // namespace Diligent
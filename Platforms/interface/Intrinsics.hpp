@@ -34,3 +34,29 @@
 #if DILIGENT_AVX2_SUPPORTED && defined(__AVX2__)
 #    define DILIGENT_AVX2_ENABLED 1
 #endif
+
+// SSE2 is enabled by default on x64, but not necessarily on x86
+#if DILIGENT_AVX2_SUPPORTED && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define DILIGENT_SSE2_ENABLED 1
+#endif
+
+// Function attributes that allow using SSE2/AVX2 intrinsics in functions that are
+// compiled regardless of the target architecture options and selected at run time
+// based on PlatformMisc::GetCPUFeatures(). MSVC allows using any intrinsics without
+// special attributes.
+#if DILIGENT_AVX2_SUPPORTED
+#    if defined(__clang__) || defined(__GNUC__)
+#        define DILIGENT_TARGET_SSE2      __attribute__((target("sse2")))
+#        define DILIGENT_TARGET_AVX2      __attribute__((target("avx2")))
+#        define DILIGENT_TARGET_AVX2_F16C __attribute__((target("avx2,f16c")))
+#    else
+#        define DILIGENT_TARGET_SSE2
+#        define DILIGENT_TARGET_AVX2
+#        define DILIGENT_TARGET_AVX2_F16C
+#    endif
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || (defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM)))
+#    include <arm_neon.h>
+#    define DILIGENT_NEON_ENABLED 1
+#endif
@@ -0,0 +1,165 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::IRandomAccessFileStream interface
+
+#include "FileStream.h"
+
+DILIGENT_BEGIN_NAMESPACE(Diligent)
+
+/// Memory access pattern hint for the mapped file data.
+DILIGENT_TYPED_ENUM(FILE_ACCESS_HINT, Uint8)
+{
+    /// No special treatment.
+    FILE_ACCESS_HINT_NORMAL = 0,
+
+    /// The data will be accessed sequentially, so it can be aggressively read ahead.
+    FILE_ACCESS_HINT_SEQUENTIAL,
+
+    /// The data will be accessed in random order, so read-ahead is not useful.
+    FILE_ACCESS_HINT_RANDOM,
+
+    /// The data will be accessed soon, so it should be read ahead.
+    FILE_ACCESS_HINT_WILL_NEED
+};
+
+
+/// Callback that is called when an asynchronous read is complete.
+
+/// \param [in] Success   - Whether all requested bytes were read.
+/// \param [in] BytesRead - The number of bytes that were read.
+/// \param [in] pUserData - User data that was given in the read request.
+typedef void(DILIGENT_CALL_TYPE* FileReadCallbackType)(bool Success, size_t BytesRead, void* pUserData);
+
+
+/// Asynchronous file read request.
+struct FileReadRequest
+{
+    /// Offset in the file to read the data from.
+    size_t Offset DEFAULT_INITIALIZER(0);
+
+    /// The number of bytes to read.
+    size_t Size DEFAULT_INITIALIZER(0);
+
+    /// The destination memory. The memory must stay valid until the read is complete.
+    void* pData DEFAULT_INITIALIZER(nullptr);
+
+    /// An optional callback that is called when the read is complete.
+    /// The callback may be called from any thread.
+    FileReadCallbackType Callback DEFAULT_INITIALIZER(nullptr);
+
+    /// User data that is passed to the callback.
+    void* pCallbackUserData DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct FileReadRequest FileReadRequest;
+
+
+// {7AB8A721-F8E3-432B-BB1B-0C12D917452E}
+static DILIGENT_CONSTEXPR struct INTERFACE_ID IID_RandomAccessFileStream =
+    {0x7ab8a721, 0xf8e3, 0x432b, {0xbb, 0x1b, 0xc, 0x12, 0xd9, 0x17, 0x45, 0x2e}};
+
+// clang-format off
+
+#define DILIGENT_INTERFACE_NAME IRandomAccessFileStream
+#include "DefineInterfaceHelperMacros.h"
+
+#define IRandomAccessFileStreamInclusiveMethods \
+    IFileStreamInclusiveMethods;                \
+    IRandomAccessFileStreamMethods RandomAccessFileStream
+
+/// File stream that supports random-access, memory-mapped and asynchronous reads.
+
+/// Random-access and asynchronous reads do not modify the stream position and may be
+/// performed from multiple threads at the same time, which allows applications to overlap
+/// file I/O with data processing.
+DILIGENT_BEGIN_INTERFACE(IRandomAccessFileStream, IFileStream)
+{
+    /// Reads Size bytes at the given offset.
+
+    /// \return true if all bytes were read, and false otherwise.
+    ///
+    /// The method does not modify the stream position and is thread-safe.
+    VIRTUAL bool METHOD(ReadAt)(THIS_
+                                size_t Offset,
+                                void*  pData,
+                                size_t Size) PURE;
+
+    /// Maps the file region into memory and returns it as a read-only data blob.
+
+    /// \param [in]  Offset - Offset of the region in the file.
+    /// \param [in]  Size   - Size of the region. If zero, the region extends to the end of the file.
+    /// \param [in]  Hint   - Access pattern hint, see Diligent::FILE_ACCESS_HINT.
+    /// \param [out] ppData - Address of the memory location where the pointer to the data blob will be written.
+    ///
+    /// \return true if the region was successfully mapped, and false otherwise.
+    ///
+    /// The data blob keeps the mapping alive. GetDataPtr() of the blob returns null
+    /// as the mapped data is read-only; use GetConstDataPtr() instead.
+    /// If memory mapping is not supported by the platform, the data is read into memory.
+    VIRTUAL bool METHOD(MapData)(THIS_
+                                 size_t            Offset,
+                                 size_t            Size,
+                                 FILE_ACCESS_HINT  Hint,
+                                 IDataBlob**       ppData) PURE;
+
+    /// Enqueues asynchronous reads.
+
+    /// \param [in] pRequests   - Array of read requests, see Diligent::FileReadRequest.
+    /// \param [in] NumRequests - The number of requests.
+    ///
+    /// The method may block if too many reads are in flight.
+    VIRTUAL void METHOD(EnqueueReads)(THIS_
+                                      const FileReadRequest* pRequests,
+                                      Uint32                 NumRequests) PURE;
+
+    /// Waits until all enqueued reads are complete.
+
+    /// \return true if all reads that completed since the last call succeeded, and false otherwise.
+    ///
+    /// When the method returns, all read callbacks have returned.
+    VIRTUAL bool METHOD(WaitForReads)(THIS) PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define IRandomAccessFileStream_ReadAt(This, ...)       CALL_IFACE_METHOD(RandomAccessFileStream, ReadAt,       This, __VA_ARGS__)
+#    define IRandomAccessFileStream_MapData(This, ...)      CALL_IFACE_METHOD(RandomAccessFileStream, MapData,      This, __VA_ARGS__)
+#    define IRandomAccessFileStream_EnqueueReads(This, ...) CALL_IFACE_METHOD(RandomAccessFileStream, EnqueueReads, This, __VA_ARGS__)
+#    define IRandomAccessFileStream_WaitForReads(This)      CALL_IFACE_METHOD(RandomAccessFileStream, WaitForReads, This)
+
+// clang-format on
+
+#endif
+
+DILIGENT_END_NAMESPACE // namespace Diligent
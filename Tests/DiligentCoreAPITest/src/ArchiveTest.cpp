@@ -35,6 +35,7 @@
 #include "SerializedPipelineState.h"
 #include "SerializedShader.h"
 #include "ShaderMacroHelper.hpp"
+#include "ThreadPool.hpp"
 
 #include "ResourceLayoutTestCommon.hpp"
 #include "gtest/gtest.h"
@@ -1348,7 +1349,7 @@ void CreateComputeShader(IRenderDevice*        pDevice,
     }
 }
 
-void TestComputePipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = false)
+void TestComputePipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = false, bool BatchUnpack = false)
 {
     GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
     IRenderDevice*         pDevice          = pEnv->GetDevice();
@@ -1488,7 +1489,40 @@ void TestComputePipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = fal
         UnpackInfo.pDevice      = pDevice;
         UnpackInfo.PipelineType = PIPELINE_TYPE_COMPUTE;
 
-        pDearchiver->UnpackPipelineState(UnpackInfo, &pUnpackedPSO);
+        if (!BatchUnpack)
+        {
+            pDearchiver->UnpackPipelineState(UnpackInfo, &pUnpackedPSO);
+        }
+        else
+        {
+            RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+            ASSERT_NE(pThreadPool, nullptr);
+
+            const Char* Names[] = {PSO1Name, "Non-existing PSO name"};
+
+            PipelineStatePrefetchInfo PrefetchInfo;
+            PrefetchInfo.pDevice     = pDevice;
+            PrefetchInfo.ppNames     = Names;
+            PrefetchInfo.NumNames    = _countof(Names);
+            PrefetchInfo.pThreadPool = pThreadPool;
+            EXPECT_EQ(pDearchiver->Prefetch(PrefetchInfo), 1u);
+
+            PipelineStateUnpackInfo UnpackInfos[] = {UnpackInfo, UnpackInfo, UnpackInfo};
+            UnpackInfos[1].Name                   = Names[1];
+
+            PipelineStateBatchUnpackInfo BatchUnpackInfo;
+            BatchUnpackInfo.pUnpackInfos = UnpackInfos;
+            BatchUnpackInfo.NumPipelines = _countof(UnpackInfos);
+            BatchUnpackInfo.pThreadPool  = pThreadPool;
+            BatchUnpackInfo.Asynchronous = CompileAsync;
+
+            IPipelineState* pPSOs[_countof(UnpackInfos)] = {};
+            pDearchiver->UnpackPipelineStates(BatchUnpackInfo, pPSOs);
+            pUnpackedPSO.Attach(pPSOs[0]);
+            EXPECT_EQ(pPSOs[1], nullptr);
+            ASSERT_NE(pPSOs[2], nullptr);
+            pPSOs[2]->Release();
+        }
         ASSERT_NE(pUnpackedPSO, nullptr);
     }
 
@@ -1562,6 +1596,16 @@ TEST(ArchiveTest, ComputePipeline_SplitArchive_Async)
     TestComputePipeline(PSO_ARCHIVE_FLAG_DO_NOT_PACK_SIGNATURES, /*CompileAsync = */ true);
 }
 
+TEST(ArchiveTest, ComputePipeline_BatchUnpack)
+{
+    TestComputePipeline(PSO_ARCHIVE_FLAG_NONE, /*CompileAsync = */ false, /*BatchUnpack = */ true);
+}
+
+TEST(ArchiveTest, ComputePipeline_BatchUnpack_Async)
+{
+    TestComputePipeline(PSO_ARCHIVE_FLAG_NONE, /*CompileAsync = */ true, /*BatchUnpack = */ true);
+}
+
 void TestRayTracingPipeline(bool CompileAsync = false)
 {
     GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
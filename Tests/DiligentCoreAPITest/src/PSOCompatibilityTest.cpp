@@ -265,12 +265,15 @@ RefCntAutoPtr<IPipelineState> CreateGraphicsPSO(GPUTestingEnvironment* pEnv, con
     return pPSO;
 }
 
-RefCntAutoPtr<IPipelineState> CreateComputePSO(GPUTestingEnvironment* pEnv, const char* CSSource)
+RefCntAutoPtr<IPipelineState> CreateComputePSO(GPUTestingEnvironment*        pEnv,
+                                               const char*                   CSSource,
+                                               SHADER_RESOURCE_VARIABLE_TYPE DefaultVarType = SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
 {
     auto*                          pDevice = pEnv->GetDevice();
     ComputePipelineStateCreateInfo PSOCreateInfo;
 
-    PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = DefaultVarType;
     ShaderCreateInfo CreationAttrs;
     CreationAttrs.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
     CreationAttrs.ShaderCompiler = pEnv->GetDefaultCompiler(CreationAttrs.SourceLanguage);
@@ -384,4 +387,36 @@ TEST(PSOCompatibility, IsCompatibleWith)
     }
 }
 
+TEST(PSOCompatibility, SharedImplicitSignature)
+{
+    auto* const pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // Implicit signatures without static resources are shared
+    auto PSO_Mutable  = CreateComputePSO(pEnv, CS_RwBuff, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    auto PSO_Mutable2 = CreateComputePSO(pEnv, CS_RwBuff, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    ASSERT_TRUE(PSO_Mutable);
+    ASSERT_TRUE(PSO_Mutable2);
+    EXPECT_EQ(PSO_Mutable->GetResourceSignature(0), PSO_Mutable2->GetResourceSignature(0));
+    EXPECT_TRUE(PSO_Mutable->IsCompatibleWith(PSO_Mutable2));
+
+    auto PSO_Dynamic = CreateComputePSO(pEnv, CS_RwBuff, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    ASSERT_TRUE(PSO_Dynamic);
+    EXPECT_NE(PSO_Mutable->GetResourceSignature(0), PSO_Dynamic->GetResourceSignature(0));
+
+    // Static resources are stored in the signature, so each pipeline must have its own one
+    auto PSO_Static  = CreateComputePSO(pEnv, CS_RwBuff, SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    auto PSO_Static2 = CreateComputePSO(pEnv, CS_RwBuff, SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    ASSERT_TRUE(PSO_Static);
+    ASSERT_TRUE(PSO_Static2);
+    EXPECT_NE(PSO_Static->GetResourceSignature(0), PSO_Static2->GetResourceSignature(0));
+    EXPECT_TRUE(PSO_Static->IsCompatibleWith(PSO_Static2));
+}
+
 } // namespace
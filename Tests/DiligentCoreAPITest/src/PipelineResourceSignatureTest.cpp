@@ -319,6 +319,172 @@ TEST_F(PipelineResourceSignatureTest, VariableTypes)
 }
 
 
+// Rebinds dynamic resources of many SRBs between draws. The last draw must
+// see the latest bindings even if the backend reuses descriptors written for
+// earlier commits of the same SRB.
+TEST_F(PipelineResourceSignatureTest, DynamicResourceRebinding)
+{
+    auto* const pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* const pDevice  = pEnv->GetDevice();
+    auto*       pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    float ClearColor[] = {0.625, 0.125, 0.5, 0.75};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    static constexpr Uint32 StaticTexArraySize  = 2;
+    static constexpr Uint32 MutableTexArraySize = 4;
+    static constexpr Uint32 DynamicTexArraySize = 3;
+
+    ReferenceTextures RefTextures{
+        3 + StaticTexArraySize + MutableTexArraySize + DynamicTexArraySize,
+        128, 128,
+        USAGE_DEFAULT,
+        BIND_SHADER_RESOURCE,
+        TEXTURE_VIEW_SHADER_RESOURCE //
+    };
+
+    static constexpr size_t Tex2D_StaticIdx = 0;
+    static constexpr size_t Tex2D_MutIdx    = 1;
+    static constexpr size_t Tex2D_DynIdx    = 2;
+
+    static constexpr size_t Tex2DArr_StaticIdx = 3;
+    static constexpr size_t Tex2DArr_MutIdx    = 5;
+    static constexpr size_t Tex2DArr_DynIdx    = 9;
+
+    ShaderMacroHelper Macros;
+
+    Macros.AddShaderMacro("STATIC_TEX_ARRAY_SIZE", static_cast<int>(StaticTexArraySize));
+    Macros.AddShaderMacro("MUTABLE_TEX_ARRAY_SIZE", static_cast<int>(MutableTexArraySize));
+    Macros.AddShaderMacro("DYNAMIC_TEX_ARRAY_SIZE", static_cast<int>(DynamicTexArraySize));
+
+    RefTextures.ClearUsedValues();
+
+    Macros.AddShaderMacro("Tex2D_Static_Ref", RefTextures.GetColor(Tex2D_StaticIdx));
+    Macros.AddShaderMacro("Tex2D_Mut_Ref", RefTextures.GetColor(Tex2D_MutIdx));
+    Macros.AddShaderMacro("Tex2D_Dyn_Ref", RefTextures.GetColor(Tex2D_DynIdx));
+
+    for (Uint32 i = 0; i < StaticTexArraySize; ++i)
+        Macros.AddShaderMacro((std::string{"Tex2DArr_Static_Ref"} + std::to_string(i)).c_str(), RefTextures.GetColor(Tex2DArr_StaticIdx + i));
+
+    for (Uint32 i = 0; i < MutableTexArraySize; ++i)
+        Macros.AddShaderMacro((std::string{"Tex2DArr_Mut_Ref"} + std::to_string(i)).c_str(), RefTextures.GetColor(Tex2DArr_MutIdx + i));
+
+    for (Uint32 i = 0; i < DynamicTexArraySize; ++i)
+        Macros.AddShaderMacro((std::string{"Tex2DArr_Dyn_Ref"} + std::to_string(i)).c_str(), RefTextures.GetColor(Tex2DArr_DynIdx + i));
+
+    auto ModifyShaderCI = [pEnv](ShaderCreateInfo& ShaderCI) {
+        if (pEnv->NeedWARPResourceArrayIndexingBugWorkaround())
+        {
+            // See the VariableTypes test
+            ShaderCI.ShaderCompiler = SHADER_COMPILER_DEFAULT;
+            ShaderCI.HLSLVersion    = ShaderVersion{5, 0};
+        }
+        ShaderCI.WebGPUEmulatedArrayIndexSuffix = "_";
+    };
+
+    const char* ShaderPath = "shaders/ShaderResourceLayout/Textures.hlsl";
+
+    auto pVS = CreateShaderFromFile(SHADER_TYPE_VERTEX, ShaderPath, "VSMain", "PRS dynamic rebinding test: VS", Macros, ModifyShaderCI);
+    auto pPS = CreateShaderFromFile(SHADER_TYPE_PIXEL, ShaderPath, "PSMain", "PRS dynamic rebinding test: PS", Macros, ModifyShaderCI);
+    ASSERT_TRUE(pVS && pPS);
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "Dynamic resource rebinding test";
+
+    // clang-format off
+    PipelineResourceDesc Resources[]
+    {
+        {SHADER_TYPE_VS_PS, "g_Tex2D_Static", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+        {SHADER_TYPE_VS_PS, "g_Tex2D_Mut",    1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VS_PS, "g_Tex2D_Dyn",    1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_VS_PS, "g_Tex2DArr_Static", StaticTexArraySize,  SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+        {SHADER_TYPE_VS_PS, "g_Tex2DArr_Mut",    MutableTexArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_VS_PS, "g_Tex2DArr_Dyn",    DynamicTexArraySize, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_VS_PS, "g_Sampler",         1, SHADER_RESOURCE_TYPE_SAMPLER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    };
+    // clang-format on
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    auto pPSO = CreateGraphicsPSO(pVS, pPS, {pPRS});
+    ASSERT_TRUE(pPSO);
+
+    SET_STATIC_VAR(pPRS, SHADER_TYPE_VERTEX, "g_Tex2D_Static", Set, RefTextures.GetViewObjects(Tex2D_StaticIdx)[0]);
+    SET_STATIC_VAR(pPRS, SHADER_TYPE_VERTEX, "g_Tex2DArr_Static", SetArray, RefTextures.GetViewObjects(Tex2DArr_StaticIdx), 0, StaticTexArraySize);
+
+    if (!pDevice->GetDeviceInfo().IsGLDevice())
+    {
+        RefCntAutoPtr<ISampler> pSampler;
+        pDevice->CreateSampler(SamplerDesc{}, &pSampler);
+        SET_STATIC_VAR(pPRS, SHADER_TYPE_VERTEX, "g_Sampler", Set, pSampler);
+    }
+
+    ITextureView* ppRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(ppRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+
+    // Every draw binds valid textures, but only the bindings of the last draw match the reference
+    auto BindDynamicTextures = [&](IShaderResourceBinding* pSRB, bool Correct) {
+        const size_t Tex2DIdx    = Correct ? Tex2D_DynIdx : Tex2D_MutIdx;
+        const size_t Tex2DArrIdx = Correct ? Tex2DArr_DynIdx : Tex2DArr_MutIdx;
+        SET_SRB_VAR(pSRB, SHADER_TYPE_PIXEL, "g_Tex2D_Dyn", Set, RefTextures.GetViewObjects(Tex2DIdx)[0]);
+        SET_SRB_VAR(pSRB, SHADER_TYPE_VERTEX, "g_Tex2DArr_Dyn", SetArray, RefTextures.GetViewObjects(Tex2DArrIdx), 0, DynamicTexArraySize);
+    };
+
+    auto CommitAndDraw = [&](IShaderResourceBinding* pSRB) {
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->Draw(DrawAttribs{6, DRAW_FLAG_VERIFY_ALL});
+    };
+
+    static constexpr Uint32 NumSRBs = 16;
+
+    std::vector<RefCntAutoPtr<IShaderResourceBinding>> SRBs(NumSRBs);
+    for (RefCntAutoPtr<IShaderResourceBinding>& pSRB : SRBs)
+    {
+        pPRS->CreateShaderResourceBinding(&pSRB, true);
+        ASSERT_NE(pSRB, nullptr);
+
+        SET_SRB_VAR(pSRB, SHADER_TYPE_VERTEX, "g_Tex2D_Mut", Set, RefTextures.GetViewObjects(Tex2D_MutIdx)[0]);
+        SET_SRB_VAR(pSRB, SHADER_TYPE_PIXEL, "g_Tex2DArr_Mut", SetArray, RefTextures.GetViewObjects(Tex2DArr_MutIdx), 0, MutableTexArraySize);
+        BindDynamicTextures(pSRB, true);
+        CommitAndDraw(pSRB);
+    }
+
+    for (Uint32 i = 0; i < NumSRBs; ++i)
+    {
+        IShaderResourceBinding* pSRB = SRBs[i];
+
+        // Commit unchanged resources
+        CommitAndDraw(pSRB);
+
+        // Only a part of the dynamic resources changes
+        SET_SRB_VAR(pSRB, SHADER_TYPE_PIXEL, "g_Tex2D_Dyn", Set, RefTextures.GetViewObjects(Tex2D_StaticIdx)[0]);
+        CommitAndDraw(pSRB);
+
+        BindDynamicTextures(pSRB, false);
+        CommitAndDraw(pSRB);
+    }
+
+    // Restore the original bindings in the reverse order
+    for (Uint32 i = NumSRBs; i-- > 0;)
+    {
+        BindDynamicTextures(SRBs[i], true);
+        CommitAndDraw(SRBs[i]);
+    }
+
+    pSwapChain->Present();
+}
+
 void PipelineResourceSignatureTest::TestMultiSignatures(const std::vector<std::array<Uint8, 3>>& SignatureBindings)
 {
     auto* const pEnv       = GPUTestingEnvironment::GetInstance();
@@ -2031,4 +2197,79 @@ TEST_F(PipelineResourceSignatureTest, UnusedNullResources)
     pSwapChain->Present();
 }
 
+TEST_F(PipelineResourceSignatureTest, SRBRecycling)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    const PipelineResourceDesc Resources[] = {
+        {SHADER_TYPE_PIXEL, "g_MutableBuffer", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL, "g_DynamicBuffer", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name               = "SRB recycling test";
+    PRSDesc.Resources          = Resources;
+    PRSDesc.NumResources       = _countof(Resources);
+    PRSDesc.SRBRecyclePoolSize = 4;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_TRUE(pPRS);
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    {
+        BufferDesc BuffDesc{"SRB recycling test buffer", 256, BIND_UNIFORM_BUFFER};
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    }
+    ASSERT_TRUE(pBuffer);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB);
+    ASSERT_TRUE(pSRB);
+
+    IShaderResourceVariable* pMutableVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_MutableBuffer");
+    IShaderResourceVariable* pDynamicVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynamicBuffer");
+    ASSERT_NE(pMutableVar, nullptr);
+    ASSERT_NE(pDynamicVar, nullptr);
+
+    pMutableVar->Set(pBuffer);
+    pDynamicVar->Set(pBuffer);
+    EXPECT_EQ(pMutableVar->Get(), pBuffer.RawPtr());
+    EXPECT_EQ(pDynamicVar->Get(), pBuffer.RawPtr());
+
+    pSRB->ResetAllVariables();
+    EXPECT_EQ(pMutableVar->Get(), nullptr);
+    EXPECT_EQ(pDynamicVar->Get(), nullptr);
+
+    // A mutable variable may be set again after the reset
+    pMutableVar->Set(pBuffer);
+    pDynamicVar->Set(pBuffer);
+    EXPECT_EQ(pMutableVar->Get(), pBuffer.RawPtr());
+
+    RefCntWeakPtr<IShaderResourceBinding> pWeakSRB{pSRB};
+    pSRB.Release();
+    // The released SRB object is destroyed even though its data is recycled
+    EXPECT_FALSE(pWeakSRB.Lock());
+
+    // Recycled data may only be reused once the GPU is done with it
+    pDevice->IdleGPU();
+
+    pPRS->CreateShaderResourceBinding(&pSRB);
+    ASSERT_TRUE(pSRB);
+    EXPECT_EQ(pSRB->GetPipelineResourceSignature(), pPRS.RawPtr());
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_MutableBuffer")->Get(), nullptr);
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_DynamicBuffer")->Get(), nullptr);
+
+    // Pooled SRB data must not keep the signature alive
+    RefCntWeakPtr<IPipelineResourceSignature> pWeakPRS{pPRS};
+    pPRS.Release();
+    EXPECT_TRUE(pWeakPRS.Lock());
+    pSRB.Release();
+    pDevice->IdleGPU();
+    EXPECT_FALSE(pWeakPRS.Lock());
+}
+
 } // namespace Diligent
@@ -34,6 +34,9 @@
 #include "GraphicsTypesX.hpp"
 #include "CallbackWrapper.hpp"
 #include "ResourceLayoutTestCommon.hpp"
+#include "TempDirectory.hpp"
+#include "FileSystem.hpp"
+#include "ThreadPool.hpp"
 
 #include "InlineShaders/RayTracingTestHLSL.h"
 #include "InlineShaders/DrawCommandTestHLSL.h"
@@ -1158,6 +1161,307 @@ TEST(RenderStateCacheTest, AppendData)
     }
 }
 
+TEST(RenderStateCacheTest, SharedStorage)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    TempDirectory     TmpDir;
+    const std::string StorageFilePath = TmpDir.Get() + FileSystem::SlashSymbol + "RenderStates.cache";
+
+    RenderStateCacheCreateInfo CacheCI{pDevice, pEnv->GetArchiverFactory(), RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE};
+    CacheCI.StorageFilePath = StorageFilePath.c_str();
+
+    // Two caches that share the same storage file emulate two processes
+    RefCntAutoPtr<IRenderStateCache> pCache0;
+    CreateRenderStateCache(CacheCI, &pCache0);
+    ASSERT_NE(pCache0, nullptr);
+
+    RefCntAutoPtr<IRenderStateCache> pCache1;
+    CreateRenderStateCache(CacheCI, &pCache1);
+    ASSERT_NE(pCache1, nullptr);
+
+    EXPECT_EQ(pCache0->RefreshFromStorage(ContentVersion), 0u);
+    EXPECT_EQ(pCache1->RefreshFromStorage(ContentVersion), 0u);
+
+    {
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache0, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ false);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateComputePSO(pCache0, /*PresentInCache = */ false, pCS, /*UseSignature = */ false, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+    }
+    EXPECT_TRUE(pCache0->AppendToStorage(ContentVersion));
+    // Nothing new to append
+    EXPECT_TRUE(pCache0->AppendToStorage(ContentVersion));
+
+    // The records written by the cache are not loaded again
+    EXPECT_EQ(pCache0->RefreshFromStorage(ContentVersion), 0u);
+    // Records with a different content version are skipped
+    EXPECT_EQ(pCache1->RefreshFromStorage(ContentVersion + 1), 0u);
+    pCache1->Reset();
+    EXPECT_EQ(pCache1->RefreshFromStorage(ContentVersion), 1u);
+
+    {
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache1, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ true);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateComputePSO(pCache1, /*PresentInCache = */ true, pCS, /*UseSignature = */ false, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+    }
+
+    {
+        RefCntAutoPtr<IShader> pVS, pPS;
+        CreateGraphicsShaders(pCache1, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, /*PresentInCache = */ false);
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+    }
+    EXPECT_TRUE(pCache1->AppendToStorage(ContentVersion));
+    EXPECT_EQ(pCache0->RefreshFromStorage(ContentVersion), 1u);
+
+    {
+        RefCntAutoPtr<IShader> pVS, pPS;
+        CreateGraphicsShaders(pCache0, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, /*PresentInCache = */ true);
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    // A new cache loads all records
+    {
+        RefCntAutoPtr<IRenderStateCache> pCache2;
+        CreateRenderStateCache(CacheCI, &pCache2);
+        ASSERT_NE(pCache2, nullptr);
+        EXPECT_EQ(pCache2->RefreshFromStorage(), 2u);
+
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache2, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ true);
+        ASSERT_NE(pCS, nullptr);
+    }
+}
+
+TEST(RenderStateCacheTest, WarmUp)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    RenderStateCacheCreateInfo CacheCI{pDevice, pEnv->GetArchiverFactory(), RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE};
+    CacheCI.EnableUsageLog = true;
+
+    RefCntAutoPtr<IDataBlob> pData;
+    RefCntAutoPtr<IDataBlob> pUsageLog;
+    {
+        RefCntAutoPtr<IRenderStateCache> pCache;
+        CreateRenderStateCache(CacheCI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+
+        pCache->SetFrameIndex(0);
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ false);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateComputePSO(pCache, /*PresentInCache = */ false, pCS, /*UseSignature = */ false, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+
+        pCache->SetFrameIndex(1);
+        RefCntAutoPtr<IShader> pVS, pPS;
+        CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, /*PresentInCache = */ false);
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+
+        pCache->WriteToBlob(ContentVersion, &pData);
+        ASSERT_NE(pData, nullptr);
+
+        pCache->WriteUsageLog(&pUsageLog);
+        ASSERT_NE(pUsageLog, nullptr);
+    }
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    for (Uint32 UseThreadPool = 0; UseThreadPool < 2; ++UseThreadPool)
+    {
+        RefCntAutoPtr<IRenderStateCache> pCache = CreateCache(pDevice, /*HotReload = */ false, pData);
+        ASSERT_NE(pCache, nullptr);
+
+        RenderStateCacheWarmUpInfo WarmUpInfo;
+        WarmUpInfo.pUsageLog     = pUsageLog;
+        WarmUpInfo.pThreadPool   = UseThreadPool ? pThreadPool.RawPtr() : nullptr;
+        WarmUpInfo.MaxFrameIndex = 0;
+        // Only the compute shader and the pipeline were first used in frame 0
+        EXPECT_EQ(pCache->WarmUp(WarmUpInfo), 2u);
+        if (UseThreadPool)
+            pThreadPool->WaitForAllTasks();
+
+        RenderStateCacheWarmUpStats Stats;
+        pCache->GetWarmUpStats(Stats);
+        EXPECT_EQ(Stats.NumScheduled, 2u);
+        EXPECT_EQ(Stats.NumCreated, 2u);
+        EXPECT_EQ(Stats.NumFailed, 0u);
+        EXPECT_EQ(Stats.NumHits, 0u);
+
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ true);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateComputePSO(pCache, /*PresentInCache = */ true, pCS, /*UseSignature = */ false, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+
+        pCache->GetWarmUpStats(Stats);
+        EXPECT_EQ(Stats.NumHits, 2u);
+
+        // Warm up the remaining entries. The compute shader and the pipeline are in use and are skipped.
+        WarmUpInfo.MaxFrameIndex = ~0u;
+        EXPECT_EQ(pCache->WarmUp(WarmUpInfo), 2u);
+        if (UseThreadPool)
+            pThreadPool->WaitForAllTasks();
+
+        RefCntAutoPtr<IShader> pVS, pPS;
+        CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, /*PresentInCache = */ true);
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+
+        pCache->GetWarmUpStats(Stats);
+        EXPECT_EQ(Stats.NumScheduled, 4u);
+        EXPECT_EQ(Stats.NumCreated, 4u);
+        EXPECT_EQ(Stats.NumHits, 4u);
+        EXPECT_EQ(Stats.NumLate, 0u);
+    }
+}
+
+TEST(RenderStateCacheTest, WarmUp_LoadWhileRunning)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    RenderStateCacheCreateInfo CacheCI{pDevice, pEnv->GetArchiverFactory(), RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE};
+    CacheCI.EnableUsageLog = true;
+
+    RefCntAutoPtr<IDataBlob> pComputeData;
+    RefCntAutoPtr<IDataBlob> pUsageLog;
+    {
+        RefCntAutoPtr<IRenderStateCache> pCache;
+        CreateRenderStateCache(CacheCI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ false);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateComputePSO(pCache, /*PresentInCache = */ false, pCS, /*UseSignature = */ false, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+
+        pCache->WriteToBlob(ContentVersion, &pComputeData);
+        ASSERT_NE(pComputeData, nullptr);
+
+        pCache->WriteUsageLog(&pUsageLog);
+        ASSERT_NE(pUsageLog, nullptr);
+    }
+
+    RefCntAutoPtr<IDataBlob> pGraphicsData;
+    {
+        RefCntAutoPtr<IRenderStateCache> pCache = CreateCache(pDevice, /*HotReload = */ false);
+        ASSERT_NE(pCache, nullptr);
+
+        RefCntAutoPtr<IShader> pVS, pPS;
+        CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, /*PresentInCache = */ false);
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+
+        pCache->WriteToBlob(ContentVersion, &pGraphicsData);
+        ASSERT_NE(pGraphicsData, nullptr);
+    }
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    TempDirectory TmpDir;
+    for (Uint32 i = 0; i < 8; ++i)
+    {
+        const bool        UseStorage      = (i % 2) != 0;
+        const std::string StorageFilePath = TmpDir.Get() + FileSystem::SlashSymbol + "RenderStates" + std::to_string(i) + ".cache";
+
+        CacheCI.EnableUsageLog  = false;
+        CacheCI.StorageFilePath = UseStorage ? StorageFilePath.c_str() : nullptr;
+
+        RefCntAutoPtr<IRenderStateCache> pCache;
+        CreateRenderStateCache(CacheCI, &pCache);
+        ASSERT_NE(pCache, nullptr);
+        ASSERT_TRUE(pCache->Load(pComputeData, ContentVersion, /*MakeCopy = */ false));
+
+        RenderStateCacheWarmUpInfo WarmUpInfo;
+        WarmUpInfo.pUsageLog   = pUsageLog;
+        WarmUpInfo.pThreadPool = pThreadPool.RawPtr();
+        EXPECT_EQ(pCache->WarmUp(WarmUpInfo), 2u);
+
+        // Add render states to the cache while the warm-up tasks unpack the compute shader and the pipeline
+        RefCntAutoPtr<IShader> pVS, pPS;
+        if (UseStorage)
+        {
+            CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, /*PresentInCache = */ false);
+            EXPECT_TRUE(pCache->AppendToStorage(ContentVersion));
+        }
+        else
+        {
+            EXPECT_TRUE(pCache->Load(pGraphicsData, ContentVersion, /*MakeCopy = */ false));
+            CreateGraphicsShaders(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pVS, pPS, /*PresentInCache = */ true);
+        }
+        ASSERT_NE(pVS, nullptr);
+        ASSERT_NE(pPS, nullptr);
+
+        pThreadPool->WaitForAllTasks();
+
+        RenderStateCacheWarmUpStats Stats;
+        pCache->GetWarmUpStats(Stats);
+        EXPECT_EQ(Stats.NumCreated, 2u);
+        EXPECT_EQ(Stats.NumFailed, 0u);
+
+        RefCntAutoPtr<IShader> pCS;
+        CreateComputeShader(pCache, pShaderSourceFactory, SHADER_COMPILE_FLAG_NONE, pCS, /*PresentInCache = */ true);
+        ASSERT_NE(pCS, nullptr);
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        CreateComputePSO(pCache, /*PresentInCache = */ true, pCS, /*UseSignature = */ false, /*CompileAsync = */ false, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+    }
+}
+
 TEST(RenderStateCacheTest, RenderDeviceWithCache)
 {
     constexpr bool Execute = false;
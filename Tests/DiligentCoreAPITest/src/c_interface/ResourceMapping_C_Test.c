@@ -66,8 +66,14 @@ void TestResourceMappingC_API(struct IResourceMapping* pResourceMapping)
     Uint32 ArrayIndex = 6;
     size_t Size       = 0;
 
+    ResourceMappingEntry Entry;
+    Entry.Name       = "Resource Name";
+    Entry.pObject    = pObject;
+    Entry.ArrayIndex = 0;
+
     IResourceMapping_AddResource(pResourceMapping, "Resource Name", pObject, true);
     IResourceMapping_AddResourceArray(pResourceMapping, "Resource Array Name", 0, &pObject, ArraySize, true);
+    IResourceMapping_AddResources(pResourceMapping, &Entry, 1, true);
     IResourceMapping_RemoveResourceByName(pResourceMapping, "Resource Name", ArrayIndex);
     pObject = IResourceMapping_GetResource(pResourceMapping, "Resource Name", ArrayIndex);
     Size    = IResourceMapping_GetSize(pResourceMapping);
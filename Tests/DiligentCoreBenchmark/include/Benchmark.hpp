@@ -0,0 +1,272 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+namespace Benchmarking
+{
+
+/// Benchmark run options.
+struct BenchmarkOptions
+{
+    /// Colon-separated list of name patterns. Only benchmarks whose names match
+    /// one of the patterns are run. Patterns may contain '*' and '?' wildcards.
+    std::string Filter = "*";
+
+    /// The minimum time spent running the benchmark body before measurements start.
+    double WarmupTimeMs = 50;
+
+    /// The minimum duration of a single repetition. The number of iterations in each
+    /// repetition is calibrated during the warmup so that a repetition takes at least this long.
+    double MinRepetitionTimeMs = 20;
+
+    /// The number of timed repetitions. Statistics are computed over per-repetition averages.
+    Uint32 NumRepetitions = 10;
+};
+
+
+/// Results of a single measurement.
+struct BenchmarkResult
+{
+    /// Full benchmark name, e.g. "Common.LRUCache.Get/Hit".
+    std::string Name;
+
+    /// The number of iterations in each repetition.
+    Uint64 Iterations = 0;
+
+    /// The number of timed repetitions.
+    Uint32 Repetitions = 0;
+
+    // Statistics of the time per iteration, in nanoseconds.
+    double MinNs    = 0;
+    double MeanNs   = 0;
+    double MedianNs = 0;
+    double P90Ns    = 0;
+    double P99Ns    = 0;
+    double MaxNs    = 0;
+    double StdDevNs = 0;
+
+    /// The number of items processed per second, or zero if the benchmark does not report items.
+    double ItemsPerSecond = 0;
+};
+
+
+/// Prevents the compiler from optimizing away the computation of Value.
+template <typename T>
+inline void DoNotOptimize(const T& Value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile(""
+                 :
+                 : "r,m"(Value)
+                 : "memory");
+#else
+    static volatile char Sink;
+    Sink = *reinterpret_cast<const volatile char*>(&Value);
+#endif
+}
+
+
+/// Benchmark state that is passed to every benchmark function.
+
+/// A benchmark function performs the setup and then calls Measure() for every
+/// variant it wants to time:
+///
+///     DILIGENT_BENCHMARK(Common, Example)
+///     {
+///         std::vector<int> Data(1024);
+///         State.SetItemsPerIteration(Data.size());
+///         State.Measure("Sum", [&]() {
+///             DoNotOptimize(std::accumulate(Data.begin(), Data.end(), 0));
+///         });
+///     }
+///
+/// Measure() runs the body until the warmup time elapses, calibrates the number of
+/// iterations per repetition, and then times the requested number of repetitions.
+/// Variants whose full names do not pass the filter are skipped.
+class BenchmarkState
+{
+public:
+    BenchmarkState(std::string Name, const BenchmarkOptions& Options, std::vector<BenchmarkResult>& Results) :
+        m_Name{std::move(Name)},
+        m_Options{Options},
+        m_Results{Results}
+    {}
+
+    /// Sets the number of items processed by one call of the benchmark body.
+    /// This value is used to report throughput and applies to subsequent Measure() calls.
+    void SetItemsPerIteration(double Items) { m_ItemsPerIteration = Items; }
+
+    /// Measures the body. Variant, if not empty, is appended to the benchmark name after a slash.
+    template <typename BodyType>
+    void Measure(const char* Variant, BodyType&& Body)
+    {
+        const std::string FullName = GetFullName(Variant);
+        if (!MatchesFilter(FullName))
+            return;
+
+        using ClockType = std::chrono::steady_clock;
+
+        const auto RunBatch = [&Body](Uint64 NumIterations) {
+            const auto StartTime = ClockType::now();
+            for (Uint64 i = 0; i < NumIterations; ++i)
+                Body();
+            return std::chrono::duration<double, std::nano>(ClockType::now() - StartTime).count();
+        };
+
+        // Warmup and calibration
+        Uint64       NumIterations = 1;
+        double       BatchTimeNs   = RunBatch(NumIterations);
+        double       WarmupTimeNs  = BatchTimeNs;
+        const double MinRepTimeNs  = m_Options.MinRepetitionTimeMs * 1e6;
+        while (BatchTimeNs < MinRepTimeNs || WarmupTimeNs < m_Options.WarmupTimeMs * 1e6)
+        {
+            if (BatchTimeNs < MinRepTimeNs)
+            {
+                // Aim slightly above the target, but never grow more than 10x at once
+                const double Scale = BatchTimeNs > 0 ? MinRepTimeNs * 1.2 / BatchTimeNs : 10.0;
+                NumIterations      = std::max(NumIterations + 1, static_cast<Uint64>(static_cast<double>(NumIterations) * std::min(Scale, 10.0)));
+            }
+            BatchTimeNs = RunBatch(NumIterations);
+            WarmupTimeNs += BatchTimeNs;
+        }
+
+        std::vector<double> Samples(std::max(m_Options.NumRepetitions, 1u));
+        for (double& Sample : Samples)
+            Sample = RunBatch(NumIterations) / static_cast<double>(NumIterations);
+
+        AddResult(FullName, NumIterations, std::move(Samples));
+    }
+
+    /// Measures the body under the benchmark name.
+    template <typename BodyType>
+    void Measure(BodyType&& Body)
+    {
+        Measure("", std::forward<BodyType>(Body));
+    }
+
+    /// Returns true if the variant of this benchmark will be measured.
+    /// Benchmarks may use this to skip expensive setup for filtered-out variants.
+    bool IsEnabled(const char* Variant = "") const
+    {
+        return MatchesFilter(GetFullName(Variant));
+    }
+
+    const std::string& GetName() const { return m_Name; }
+
+private:
+    std::string GetFullName(const char* Variant) const;
+    bool        MatchesFilter(const std::string& FullName) const;
+    void        AddResult(const std::string& FullName, Uint64 NumIterations, std::vector<double> Samples);
+
+private:
+    const std::string             m_Name;
+    const BenchmarkOptions&       m_Options;
+    std::vector<BenchmarkResult>& m_Results;
+
+    double m_ItemsPerIteration = 0;
+};
+
+
+using BenchmarkFunctionType = void (*)(BenchmarkState& State);
+
+/// Registers the benchmark function. Always returns true.
+bool RegisterBenchmark(const char* Name, BenchmarkFunctionType Function);
+
+/// Returns the names of all registered benchmarks.
+std::vector<std::string> GetRegisteredBenchmarks();
+
+/// Runs all registered benchmarks that match the filter and returns the results.
+std::vector<BenchmarkResult> RunBenchmarks(const BenchmarkOptions& Options);
+
+
+/// Returns true if Name matches one of the colon-separated patterns in Filter.
+bool MatchesBenchmarkFilter(const std::string& Name, const std::string& Filter);
+
+/// Computes the percentile (0 to 100) of the values using linear interpolation
+/// between the closest ranks. The values must be sorted.
+double ComputePercentile(const std::vector<double>& SortedValues, double Percentile);
+
+
+/// Writes the results to the file in JSON format. Returns false if the file cannot be written.
+bool WriteBenchmarkResultsJSON(const char* FilePath, const BenchmarkOptions& Options, const std::vector<BenchmarkResult>& Results);
+
+/// Serializes the results to a JSON string.
+std::string BenchmarkResultsToJSON(const BenchmarkOptions& Options, const std::vector<BenchmarkResult>& Results);
+
+/// Parses the results from the JSON string produced by BenchmarkResultsToJSON().
+/// Returns false if the string is not valid JSON.
+bool ParseBenchmarkResultsJSON(const std::string& JSON, std::vector<BenchmarkResult>& Results);
+
+
+/// Result of comparing a benchmark against the baseline.
+struct BenchmarkComparison
+{
+    std::string Name;
+
+    double BaselineNs = 0;
+    double CurrentNs  = 0;
+
+    /// Relative change of the median time, in percent. Positive values mean the benchmark became slower.
+    double ChangePercent = 0;
+
+    /// True if the change exceeds the threshold.
+    bool IsRegression = false;
+};
+
+/// Compares median times of the benchmarks that are present in both result sets.
+
+/// \param [in] Baseline         - Baseline results.
+/// \param [in] Current          - Current results.
+/// \param [in] ThresholdPercent - A benchmark is considered a regression if its median
+///                                time increased by more than this value.
+/// \return     Comparison for every benchmark in Current that has a baseline.
+std::vector<BenchmarkComparison> CompareBenchmarkResults(const std::vector<BenchmarkResult>& Baseline,
+                                                         const std::vector<BenchmarkResult>& Current,
+                                                         double                              ThresholdPercent);
+
+} // namespace Benchmarking
+
+} // namespace Diligent
+
+
+/// Defines and registers a benchmark function named Module.Name.
+#define DILIGENT_BENCHMARK(Module, Name)                                                             \
+    static void       Module##_##Name##_Benchmark(::Diligent::Benchmarking::BenchmarkState& State);  \
+    static const bool Module##_##Name##_Registered =                                                 \
+        ::Diligent::Benchmarking::RegisterBenchmark(#Module "." #Name, Module##_##Name##_Benchmark); \
+    static void Module##_##Name##_Benchmark(::Diligent::Benchmarking::BenchmarkState& State)
@@ -0,0 +1,585 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Benchmark.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace Benchmarking
+{
+
+namespace
+{
+
+struct RegisteredBenchmark
+{
+    std::string           Name;
+    BenchmarkFunctionType Function = nullptr;
+};
+
+std::vector<RegisteredBenchmark>& GetRegistry()
+{
+    // Benchmarks are registered during static initialization, so the registry
+    // must be a function-local static to avoid initialization order issues.
+    static std::vector<RegisteredBenchmark> Registry;
+    return Registry;
+}
+
+// Iterative wildcard matching with single-star backtracking.
+// If IsPrefix is true, returns true if Str is a prefix of some string that matches the pattern.
+bool MatchesPattern(const char* Str, const char* Pattern, bool IsPrefix)
+{
+    const char* StarPattern = nullptr;
+    const char* StarStr     = nullptr;
+    while (*Str != '\0')
+    {
+        if (*Pattern == '*')
+        {
+            StarPattern = Pattern++;
+            StarStr     = Str;
+        }
+        else if (*Pattern == '?' || *Pattern == *Str)
+        {
+            ++Pattern;
+            ++Str;
+        }
+        else if (StarPattern != nullptr)
+        {
+            Pattern = StarPattern + 1;
+            Str     = ++StarStr;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    if (IsPrefix)
+        return true;
+
+    while (*Pattern == '*')
+        ++Pattern;
+    return *Pattern == '\0';
+}
+
+bool MatchesPatternList(const std::string& Name, const std::string& Filter, bool IsPrefix)
+{
+    if (Filter.empty())
+        return true;
+
+    size_t PatternStart = 0;
+    while (PatternStart <= Filter.size())
+    {
+        size_t PatternEnd = Filter.find(':', PatternStart);
+        if (PatternEnd == std::string::npos)
+            PatternEnd = Filter.size();
+        const std::string Pattern = Filter.substr(PatternStart, PatternEnd - PatternStart);
+        if (!Pattern.empty() && MatchesPattern(Name.c_str(), Pattern.c_str(), IsPrefix))
+            return true;
+        PatternStart = PatternEnd + 1;
+    }
+    return false;
+}
+
+const char* GetBuildConfiguration()
+{
+#ifdef DILIGENT_DEBUG
+    return "Debug";
+#elif defined(DILIGENT_DEVELOPMENT)
+    return "Development";
+#else
+    return "Release";
+#endif
+}
+
+void WriteJSONString(std::ostream& Stream, const std::string& Str)
+{
+    Stream << '"';
+    for (char c : Str)
+    {
+        switch (c)
+        {
+            case '"': Stream << "\\\""; break;
+            case '\\': Stream << "\\\\"; break;
+            case '\n': Stream << "\\n"; break;
+            case '\t': Stream << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char Buff[8];
+                    std::snprintf(Buff, sizeof(Buff), "\\u%04x", c);
+                    Stream << Buff;
+                }
+                else
+                {
+                    Stream << c;
+                }
+        }
+    }
+    Stream << '"';
+}
+
+// Minimal JSON reader that is sufficient to load the files written by BenchmarkResultsToJSON().
+class JSONReader
+{
+public:
+    explicit JSONReader(const std::string& JSON) :
+        m_Pos{JSON.c_str()},
+        m_End{JSON.c_str() + JSON.size()}
+    {}
+
+    bool ReadDocument(std::vector<BenchmarkResult>& Results)
+    {
+        if (!ReadValue(0, &Results))
+            return false;
+        SkipWhitespace();
+        return m_Pos == m_End;
+    }
+
+private:
+    void SkipWhitespace()
+    {
+        while (m_Pos < m_End && (*m_Pos == ' ' || *m_Pos == '\t' || *m_Pos == '\n' || *m_Pos == '\r'))
+            ++m_Pos;
+    }
+
+    bool Consume(char c)
+    {
+        SkipWhitespace();
+        if (m_Pos < m_End && *m_Pos == c)
+        {
+            ++m_Pos;
+            return true;
+        }
+        return false;
+    }
+
+    bool ReadString(std::string& Str)
+    {
+        if (!Consume('"'))
+            return false;
+        Str.clear();
+        while (m_Pos < m_End && *m_Pos != '"')
+        {
+            char c = *m_Pos++;
+            if (c == '\\')
+            {
+                if (m_Pos == m_End)
+                    return false;
+                c = *m_Pos++;
+                switch (c)
+                {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case 'r': c = '\r'; break;
+                    case 'b': c = '\b'; break;
+                    case 'f': c = '\f'; break;
+                    case 'u':
+                        if (m_End - m_Pos < 4)
+                            return false;
+                        // Benchmark names are ASCII; other code points are replaced with '?'
+                        c = static_cast<char>(std::strtol(std::string{m_Pos, 4}.c_str(), nullptr, 16));
+                        if (static_cast<unsigned char>(c) >= 0x80)
+                            c = '?';
+                        m_Pos += 4;
+                        break;
+                    default:
+                        // '"', '\\' and '/' are copied as is
+                        break;
+                }
+            }
+            Str.push_back(c);
+        }
+        return Consume('"');
+    }
+
+    bool ReadNumber(double& Number)
+    {
+        SkipWhitespace();
+        char* NumEnd = nullptr;
+        Number       = std::strtod(m_Pos, &NumEnd);
+        if (NumEnd == m_Pos || NumEnd > m_End)
+            return false;
+        m_Pos = NumEnd;
+        return true;
+    }
+
+    bool ReadLiteral(const char* Literal)
+    {
+        SkipWhitespace();
+        const size_t Len = strlen(Literal);
+        if (static_cast<size_t>(m_End - m_Pos) < Len || strncmp(m_Pos, Literal, Len) != 0)
+            return false;
+        m_Pos += Len;
+        return true;
+    }
+
+    // Reads any JSON value. Objects that contain a "name" string are collected as benchmark results
+    // if pResults is not null and the object is an element of the "benchmarks" array.
+    bool ReadValue(int Depth, std::vector<BenchmarkResult>* pResults, BenchmarkResult* pResult = nullptr)
+    {
+        if (Depth > 32)
+            return false;
+
+        SkipWhitespace();
+        if (m_Pos == m_End)
+            return false;
+
+        switch (*m_Pos)
+        {
+            case '{':
+            {
+                ++m_Pos;
+                if (Consume('}'))
+                    return true;
+                do
+                {
+                    std::string Key;
+                    if (!ReadString(Key) || !Consume(':'))
+                        return false;
+
+                    SkipWhitespace();
+                    if (pResult != nullptr && m_Pos < m_End && *m_Pos != '{' && *m_Pos != '[')
+                    {
+                        if (!ReadResultField(Key, *pResult))
+                            return false;
+                    }
+                    else if (pResults != nullptr && pResult == nullptr && Key == "benchmarks")
+                    {
+                        if (!ReadBenchmarksArray(Depth + 1, *pResults))
+                            return false;
+                    }
+                    else if (!ReadValue(Depth + 1, pResults))
+                    {
+                        return false;
+                    }
+                } while (Consume(','));
+                return Consume('}');
+            }
+
+            case '[':
+            {
+                ++m_Pos;
+                if (Consume(']'))
+                    return true;
+                do
+                {
+                    if (!ReadValue(Depth + 1, nullptr))
+                        return false;
+                } while (Consume(','));
+                return Consume(']');
+            }
+
+            case '"':
+            {
+                std::string Str;
+                return ReadString(Str);
+            }
+
+            case 't': return ReadLiteral("true");
+            case 'f': return ReadLiteral("false");
+            case 'n': return ReadLiteral("null");
+
+            default:
+            {
+                double Number = 0;
+                return ReadNumber(Number);
+            }
+        }
+    }
+
+    bool ReadBenchmarksArray(int Depth, std::vector<BenchmarkResult>& Results)
+    {
+        if (!Consume('['))
+            return false;
+        if (Consume(']'))
+            return true;
+        do
+        {
+            SkipWhitespace();
+            if (m_Pos == m_End || *m_Pos != '{')
+                return false;
+
+            BenchmarkResult Result;
+            if (!ReadValue(Depth + 1, nullptr, &Result))
+                return false;
+            if (!Result.Name.empty())
+                Results.emplace_back(std::move(Result));
+        } while (Consume(','));
+        return Consume(']');
+    }
+
+    bool ReadResultField(const std::string& Key, BenchmarkResult& Result)
+    {
+        if (Key == "name")
+            return ReadString(Result.Name);
+
+        if (*m_Pos == '"' || *m_Pos == 't' || *m_Pos == 'f' || *m_Pos == 'n')
+            return ReadValue(0, nullptr); // Unknown non-numeric field
+
+        double Value = 0;
+        if (!ReadNumber(Value))
+            return false;
+
+        // clang-format off
+        if      (Key == "iterations")       Result.Iterations     = static_cast<Uint64>(Value);
+        else if (Key == "repetitions")      Result.Repetitions    = static_cast<Uint32>(Value);
+        else if (Key == "min_ns")           Result.MinNs          = Value;
+        else if (Key == "mean_ns")          Result.MeanNs         = Value;
+        else if (Key == "median_ns")        Result.MedianNs       = Value;
+        else if (Key == "p90_ns")           Result.P90Ns          = Value;
+        else if (Key == "p99_ns")           Result.P99Ns          = Value;
+        else if (Key == "max_ns")           Result.MaxNs          = Value;
+        else if (Key == "stddev_ns")        Result.StdDevNs       = Value;
+        else if (Key == "items_per_second") Result.ItemsPerSecond = Value;
+        // clang-format on
+
+        return true;
+    }
+
+private:
+    const char*       m_Pos;
+    const char* const m_End;
+};
+
+} // namespace
+
+
+std::string BenchmarkState::GetFullName(const char* Variant) const
+{
+    return (Variant != nullptr && *Variant != '\0') ? m_Name + '/' + Variant : m_Name;
+}
+
+bool BenchmarkState::MatchesFilter(const std::string& FullName) const
+{
+    return MatchesBenchmarkFilter(FullName, m_Options.Filter);
+}
+
+void BenchmarkState::AddResult(const std::string& FullName, Uint64 NumIterations, std::vector<double> Samples)
+{
+    VERIFY_EXPR(!Samples.empty());
+    std::sort(Samples.begin(), Samples.end());
+
+    BenchmarkResult Result;
+    Result.Name        = FullName;
+    Result.Iterations  = NumIterations;
+    Result.Repetitions = static_cast<Uint32>(Samples.size());
+    Result.MinNs       = Samples.front();
+    Result.MaxNs       = Samples.back();
+    Result.MedianNs    = ComputePercentile(Samples, 50);
+    Result.P90Ns       = ComputePercentile(Samples, 90);
+    Result.P99Ns       = ComputePercentile(Samples, 99);
+
+    double Sum = 0;
+    for (double Sample : Samples)
+        Sum += Sample;
+    Result.MeanNs = Sum / static_cast<double>(Samples.size());
+
+    double SqDiffSum = 0;
+    for (double Sample : Samples)
+        SqDiffSum += (Sample - Result.MeanNs) * (Sample - Result.MeanNs);
+    Result.StdDevNs = Samples.size() > 1 ? std::sqrt(SqDiffSum / static_cast<double>(Samples.size() - 1)) : 0;
+
+    if (m_ItemsPerIteration > 0 && Result.MedianNs > 0)
+        Result.ItemsPerSecond = m_ItemsPerIteration * 1e9 / Result.MedianNs;
+
+    m_Results.emplace_back(std::move(Result));
+}
+
+
+bool RegisterBenchmark(const char* Name, BenchmarkFunctionType Function)
+{
+    VERIFY_EXPR(Name != nullptr && Function != nullptr);
+    GetRegistry().push_back({Name, Function});
+    return true;
+}
+
+std::vector<std::string> GetRegisteredBenchmarks()
+{
+    std::vector<std::string> Names;
+    for (const RegisteredBenchmark& Benchmark : GetRegistry())
+        Names.push_back(Benchmark.Name);
+    std::sort(Names.begin(), Names.end());
+    return Names;
+}
+
+std::vector<BenchmarkResult> RunBenchmarks(const BenchmarkOptions& Options)
+{
+    std::vector<RegisteredBenchmark> Benchmarks = GetRegistry();
+    std::sort(Benchmarks.begin(), Benchmarks.end(),
+              [](const RegisteredBenchmark& B1, const RegisteredBenchmark& B2) {
+                  return B1.Name < B2.Name;
+              });
+
+    std::vector<BenchmarkResult> Results;
+    for (const RegisteredBenchmark& Benchmark : Benchmarks)
+    {
+        // Skip the setup of benchmarks whose variants can't pass the filter
+        if (!MatchesPatternList(Benchmark.Name, Options.Filter, false) &&
+            !MatchesPatternList(Benchmark.Name + '/', Options.Filter, true))
+            continue;
+
+        BenchmarkState State{Benchmark.Name, Options, Results};
+        const size_t   FirstResult = Results.size();
+        Benchmark.Function(State);
+        for (size_t i = FirstResult; i < Results.size(); ++i)
+        {
+            const BenchmarkResult& Res = Results[i];
+            std::printf("%-56s %14.1f ns %14.1f ns %14.1f ns %12llu",
+                        Res.Name.c_str(), Res.MedianNs, Res.P90Ns, Res.P99Ns,
+                        static_cast<unsigned long long>(Res.Iterations));
+            if (Res.ItemsPerSecond > 0)
+                std::printf(" %12.3f M/s", Res.ItemsPerSecond * 1e-6);
+            std::printf("\n");
+            std::fflush(stdout);
+        }
+    }
+    return Results;
+}
+
+
+bool MatchesBenchmarkFilter(const std::string& Name, const std::string& Filter)
+{
+    return MatchesPatternList(Name, Filter, false);
+}
+
+double ComputePercentile(const std::vector<double>& SortedValues, double Percentile)
+{
+    if (SortedValues.empty())
+        return 0;
+
+    const double Rank   = std::min(std::max(Percentile, 0.0), 100.0) / 100.0 * static_cast<double>(SortedValues.size() - 1);
+    const size_t LoIdx  = static_cast<size_t>(Rank);
+    const size_t HiIdx  = std::min(LoIdx + 1, SortedValues.size() - 1);
+    const double Weight = Rank - static_cast<double>(LoIdx);
+    return SortedValues[LoIdx] + (SortedValues[HiIdx] - SortedValues[LoIdx]) * Weight;
+}
+
+
+std::string BenchmarkResultsToJSON(const BenchmarkOptions& Options, const std::vector<BenchmarkResult>& Results)
+{
+    std::ostringstream Stream;
+    Stream.precision(17);
+
+    char DateStr[64] = {};
+    {
+        const std::time_t Now = std::time(nullptr);
+        if (const std::tm* pTime = std::gmtime(&Now))
+            std::strftime(DateStr, sizeof(DateStr), "%Y-%m-%dT%H:%M:%SZ", pTime);
+    }
+
+    Stream << "{\n"
+           << "  \"context\": {\n"
+           << "    \"date\": \"" << DateStr << "\",\n"
+           << "    \"build_configuration\": \"" << GetBuildConfiguration() << "\",\n"
+           << "    \"warmup_time_ms\": " << Options.WarmupTimeMs << ",\n"
+           << "    \"min_repetition_time_ms\": " << Options.MinRepetitionTimeMs << ",\n"
+           << "    \"repetitions\": " << Options.NumRepetitions << "\n"
+           << "  },\n"
+           << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < Results.size(); ++i)
+    {
+        const BenchmarkResult& Res = Results[i];
+        Stream << (i > 0 ? ",\n" : "\n")
+               << "    {\n"
+               << "      \"name\": ";
+        WriteJSONString(Stream, Res.Name);
+        Stream << ",\n"
+               << "      \"iterations\": " << Res.Iterations << ",\n"
+               << "      \"repetitions\": " << Res.Repetitions << ",\n"
+               << "      \"min_ns\": " << Res.MinNs << ",\n"
+               << "      \"mean_ns\": " << Res.MeanNs << ",\n"
+               << "      \"median_ns\": " << Res.MedianNs << ",\n"
+               << "      \"p90_ns\": " << Res.P90Ns << ",\n"
+               << "      \"p99_ns\": " << Res.P99Ns << ",\n"
+               << "      \"max_ns\": " << Res.MaxNs << ",\n"
+               << "      \"stddev_ns\": " << Res.StdDevNs << ",\n"
+               << "      \"items_per_second\": " << Res.ItemsPerSecond << "\n"
+               << "    }";
+    }
+    Stream << "\n  ]\n}\n";
+
+    return Stream.str();
+}
+
+bool WriteBenchmarkResultsJSON(const char* FilePath, const BenchmarkOptions& Options, const std::vector<BenchmarkResult>& Results)
+{
+    std::ofstream File{FilePath, std::ios::out | std::ios::trunc};
+    if (!File)
+        return false;
+
+    File << BenchmarkResultsToJSON(Options, Results);
+    return static_cast<bool>(File);
+}
+
+bool ParseBenchmarkResultsJSON(const std::string& JSON, std::vector<BenchmarkResult>& Results)
+{
+    Results.clear();
+    return JSONReader{JSON}.ReadDocument(Results);
+}
+
+
+std::vector<BenchmarkComparison> CompareBenchmarkResults(const std::vector<BenchmarkResult>& Baseline,
+                                                         const std::vector<BenchmarkResult>& Current,
+                                                         double                              ThresholdPercent)
+{
+    std::unordered_map<std::string, const BenchmarkResult*> BaselineByName;
+    for (const BenchmarkResult& Res : Baseline)
+        BaselineByName.emplace(Res.Name, &Res);
+
+    std::vector<BenchmarkComparison> Comparisons;
+    for (const BenchmarkResult& Res : Current)
+    {
+        auto it = BaselineByName.find(Res.Name);
+        if (it == BaselineByName.end() || it->second->MedianNs <= 0)
+            continue;
+
+        BenchmarkComparison Cmp;
+        Cmp.Name          = Res.Name;
+        Cmp.BaselineNs    = it->second->MedianNs;
+        Cmp.CurrentNs     = Res.MedianNs;
+        Cmp.ChangePercent = (Cmp.CurrentNs - Cmp.BaselineNs) / Cmp.BaselineNs * 100.0;
+        Cmp.IsRegression  = Cmp.ChangePercent > ThresholdPercent;
+        Comparisons.emplace_back(std::move(Cmp));
+    }
+    return Comparisons;
+}
+
+} // namespace Benchmarking
+
+} // namespace Diligent
@@ -0,0 +1,192 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <vector>
+
+#include "DefaultRawMemoryAllocator.hpp"
+#include "FixedBlockMemoryAllocator.hpp"
+#include "DynamicLinearAllocator.hpp"
+#include "StringPool.hpp"
+#include "DataBlobImpl.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+constexpr size_t NumAllocations = 256;
+
+DILIGENT_BENCHMARK(Common, FixedBlockMemoryAllocator)
+{
+    IMemoryAllocator& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    std::vector<void*> Ptrs(NumAllocations);
+    State.SetItemsPerIteration(NumAllocations);
+
+    for (size_t BlockSize : {32u, 256u})
+    {
+        FixedBlockMemoryAllocator Allocator{RawAllocator, BlockSize, 1024};
+        State.Measure(("AllocFree/" + std::to_string(BlockSize)).c_str(), [&]() {
+            for (void*& Ptr : Ptrs)
+                Ptr = Allocator.Allocate(BlockSize, "Benchmark", __FILE__, __LINE__);
+            for (void* Ptr : Ptrs)
+                Allocator.Free(Ptr);
+        });
+
+        // Reference: the same pattern with the default raw allocator
+        State.Measure(("AllocFree/" + std::to_string(BlockSize) + "/Raw").c_str(), [&]() {
+            for (void*& Ptr : Ptrs)
+                Ptr = RawAllocator.Allocate(BlockSize, "Benchmark", __FILE__, __LINE__);
+            for (void* Ptr : Ptrs)
+                RawAllocator.Free(Ptr);
+        });
+    }
+}
+
+DILIGENT_BENCHMARK(Common, DynamicLinearAllocator)
+{
+    IMemoryAllocator& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    State.SetItemsPerIteration(NumAllocations);
+    for (size_t Size : {16u, 256u})
+    {
+        DynamicLinearAllocator Allocator{RawAllocator, 4 << 10};
+        State.Measure(("AllocateDiscard/" + std::to_string(Size)).c_str(), [&]() {
+            for (size_t i = 0; i < NumAllocations; ++i)
+                DoNotOptimize(Allocator.Allocate(Size, 16));
+            Allocator.Discard();
+        });
+    }
+
+    // Block allocation cost: the allocator releases its blocks after every iteration
+    State.Measure("AllocateFree/256", [&]() {
+        DynamicLinearAllocator Allocator{RawAllocator, 4 << 10};
+        for (size_t i = 0; i < NumAllocations; ++i)
+            DoNotOptimize(Allocator.Allocate(256, 16));
+    });
+
+    {
+        DynamicLinearAllocator Allocator{RawAllocator, 4 << 10};
+        State.Measure("CopyString", [&]() {
+            for (size_t i = 0; i < NumAllocations; ++i)
+                DoNotOptimize(Allocator.CopyString("g_ShaderResourceName"));
+            Allocator.Discard();
+        });
+    }
+
+    // Many small blocks, as in creation of pipelines with many shaders and resources.
+    // Allocation cost must not depend on the number of blocks.
+    for (size_t NumAllocs : {256u, 4096u})
+    {
+        DynamicLinearAllocator Allocator{RawAllocator, 1 << 10};
+        State.SetItemsPerIteration(NumAllocs);
+        State.Measure(("ManyBlocks/" + std::to_string(NumAllocs)).c_str(), [&]() {
+            for (size_t i = 0; i < NumAllocs; ++i)
+                DoNotOptimize(Allocator.Allocate(96, 16));
+            Allocator.Discard();
+        });
+    }
+
+    // Nested scopes that release temporary data, e.g. shader resource reflection during pipeline creation
+    {
+        constexpr size_t NumScopes = 64;
+
+        DynamicLinearAllocator Allocator{RawAllocator, 4 << 10};
+        State.SetItemsPerIteration(NumScopes * 16);
+        State.Measure("ScopedMarker", [&]() {
+            for (size_t s = 0; s < NumScopes; ++s)
+            {
+                DoNotOptimize(Allocator.CopyString("g_PipelineName"));
+                DynamicLinearAllocator::ScopedMarker Scope{Allocator};
+                for (size_t i = 0; i < 15; ++i)
+                    DoNotOptimize(Allocator.Allocate(256, 16));
+            }
+            Allocator.Discard();
+        });
+    }
+}
+
+DILIGENT_BENCHMARK(Common, StringPool)
+{
+    IMemoryAllocator& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    std::vector<std::string> Strings(NumAllocations);
+    size_t                   TotalSize = 0;
+    for (size_t i = 0; i < NumAllocations; ++i)
+    {
+        Strings[i] = "g_Resource" + std::to_string(i * 7919);
+        TotalSize += StringPool::GetRequiredReserveSize(Strings[i]);
+    }
+
+    State.SetItemsPerIteration(NumAllocations);
+    State.Measure("ReserveCopy/String", [&]() {
+        StringPool Pool;
+        Pool.Reserve(TotalSize, RawAllocator);
+        for (const std::string& Str : Strings)
+            DoNotOptimize(Pool.CopyString(Str));
+    });
+
+    State.Measure("ReserveCopy/CStr", [&]() {
+        StringPool Pool;
+        Pool.Reserve(TotalSize, RawAllocator);
+        for (const std::string& Str : Strings)
+            DoNotOptimize(Pool.CopyString(Str.c_str()));
+    });
+}
+
+DILIGENT_BENCHMARK(Common, DataBlobImpl)
+{
+    std::vector<RefCntAutoPtr<DataBlobImpl>> Blobs(NumAllocations);
+    State.SetItemsPerIteration(NumAllocations);
+
+    for (size_t Size : {64u, 1024u, 16384u})
+    {
+        std::vector<Uint8> Data(Size, Uint8{0xAB});
+        State.Measure(("CreateRelease/" + std::to_string(Size)).c_str(), [&]() {
+            for (RefCntAutoPtr<DataBlobImpl>& pBlob : Blobs)
+                pBlob = DataBlobImpl::Create(Data.size(), Data.data());
+            for (RefCntAutoPtr<DataBlobImpl>& pBlob : Blobs)
+                pBlob.Release();
+        });
+    }
+
+    // Blobs that start empty and grow, as serialization and shader compilation do
+    State.Measure("CreateResize/1024", [&]() {
+        for (RefCntAutoPtr<DataBlobImpl>& pBlob : Blobs)
+        {
+            pBlob = DataBlobImpl::Create(size_t{0});
+            pBlob->Resize(1024);
+        }
+        for (RefCntAutoPtr<DataBlobImpl>& pBlob : Blobs)
+            pBlob.Release();
+    });
+}
+
+} // namespace
@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <vector>
+
+#include "Array2DTools.hpp"
+#include "FastRand.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+const char* GetSIMDImplName(ARRAY2D_SIMD_IMPL Impl)
+{
+    switch (Impl)
+    {
+        case ARRAY2D_SIMD_IMPL_SCALAR: return "Scalar";
+        case ARRAY2D_SIMD_IMPL_SSE2: return "SSE2";
+        case ARRAY2D_SIMD_IMPL_AVX2: return "AVX2";
+        case ARRAY2D_SIMD_IMPL_NEON: return "NEON";
+        default: return "Unknown";
+    }
+}
+
+DILIGENT_BENCHMARK(Common, Array2DTools)
+{
+    constexpr Uint32 Width  = 1024;
+    constexpr Uint32 Height = 1024;
+
+    std::vector<float> Src(Width * Height);
+    FastRandFloat      Rnd{0, -1.f, 1.f};
+    for (float& Val : Src)
+        Val = Rnd();
+
+    std::vector<Uint8>  DstUnorm8(Width * Height);
+    std::vector<Uint16> Half(Width * Height, Uint16{0x3C00}); // 1.0
+    std::vector<float>  DstFloat(Width * Height);
+    std::vector<Uint32> Bins(256);
+
+    State.SetItemsPerIteration(Width * Height);
+    for (Uint32 i = ARRAY2D_SIMD_IMPL_SCALAR; i < ARRAY2D_SIMD_IMPL_COUNT; ++i)
+    {
+        const ARRAY2D_SIMD_IMPL Impl = static_cast<ARRAY2D_SIMD_IMPL>(i);
+        if (!IsArray2DSIMDImplSupported(Impl))
+            continue;
+        SetArray2DSIMDImpl(Impl);
+
+        const std::string ImplName = GetSIMDImplName(Impl);
+
+        State.Measure(("MinMax/" + ImplName).c_str(), [&]() {
+            float MinVal = 0, MaxVal = 0;
+            GetArray2DMinMaxValue(Src.data(), Width, Width, Height, MinVal, MaxVal);
+            DoNotOptimize(MinVal);
+            DoNotOptimize(MaxVal);
+        });
+
+        State.Measure(("Sum/" + ImplName).c_str(), [&]() {
+            DoNotOptimize(GetArray2DSum(Src.data(), Width, Width, Height));
+        });
+
+        State.Measure(("Histogram/" + ImplName).c_str(), [&]() {
+            ComputeArray2DHistogram(Src.data(), Width, Width, Height, -1.f, 1.f, static_cast<Uint32>(Bins.size()), Bins.data());
+            DoNotOptimize(Bins.data());
+        });
+
+        State.Measure(("FloatToUnorm8/" + ImplName).c_str(), [&]() {
+            ConvertArray2DFloatToUnorm8(Src.data(), Width, Width, Height, 0.5f, 0.5f, DstUnorm8.data(), Width);
+            DoNotOptimize(DstUnorm8.data());
+        });
+
+        State.Measure(("HalfToFloat/" + ImplName).c_str(), [&]() {
+            ConvertArray2DHalfToFloat(Half.data(), Width, Width, Height, DstFloat.data(), Width);
+            DoNotOptimize(DstFloat.data());
+        });
+
+        State.Measure(("Downsample/" + ImplName).c_str(), [&]() {
+            DownsampleArray2D(Src.data(), Width, Width, Height, DstFloat.data(), Width / 2);
+            DoNotOptimize(DstFloat.data());
+        });
+    }
+    SetArray2DSIMDImpl(ARRAY2D_SIMD_IMPL_AUTO);
+}
+
+} // namespace
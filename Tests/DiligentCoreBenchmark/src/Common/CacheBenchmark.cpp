@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "LRUCache.hpp"
+#include "ObjectsRegistry.hpp"
+#include "FastRand.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+constexpr Uint32 NumKeys = 1024;
+
+std::vector<Uint32> GetRandomKeys(Uint32 Range)
+{
+    FastRandInt         Rnd{0, 0, static_cast<int>(Range - 1)};
+    std::vector<Uint32> Keys(NumKeys);
+    for (Uint32& Key : Keys)
+        Key = static_cast<Uint32>(Rnd());
+    return Keys;
+}
+
+DILIGENT_BENCHMARK(Common, LRUCache)
+{
+    State.SetItemsPerIteration(NumKeys);
+
+    const auto InitData = [](Uint32& Data, size_t& Size) {
+        Data = 1;
+        Size = 1;
+    };
+
+    {
+        // All keys fit into the cache
+        LRUCache<Uint32, Uint32>  Cache{NumKeys};
+        const std::vector<Uint32> Keys = GetRandomKeys(NumKeys);
+        for (Uint32 Key : Keys)
+            Cache.Get(Key, InitData);
+
+        State.Measure("Get/Hit", [&]() {
+            for (Uint32 Key : Keys)
+                DoNotOptimize(Cache.Get(Key, InitData));
+        });
+    }
+
+    {
+        // Only a quarter of the keys fit into the cache, so most requests evict an entry
+        LRUCache<Uint32, Uint32>  Cache{NumKeys / 4};
+        const std::vector<Uint32> Keys = GetRandomKeys(NumKeys);
+
+        State.Measure("Get/Evict", [&]() {
+            for (Uint32 Key : Keys)
+                DoNotOptimize(Cache.Get(Key, InitData));
+        });
+    }
+}
+
+DILIGENT_BENCHMARK(Common, ObjectsRegistry)
+{
+    State.SetItemsPerIteration(NumKeys);
+
+    struct Object
+    {
+        Uint32 Value = 0;
+    };
+
+    ObjectsRegistry<Uint32, std::shared_ptr<Object>> Registry;
+
+    // Keep strong references so that registry entries stay alive
+    std::vector<std::shared_ptr<Object>> Objects;
+    for (Uint32 Key = 0; Key < NumKeys; ++Key)
+    {
+        Objects.emplace_back(Registry.Get(Key, [Key]() {
+            return std::make_shared<Object>(Object{Key});
+        }));
+    }
+
+    const std::vector<Uint32> Keys = GetRandomKeys(NumKeys);
+    State.Measure("Get/Hit", [&]() {
+        for (Uint32 Key : Keys)
+        {
+            DoNotOptimize(Registry.Get(Key, [Key]() {
+                return std::make_shared<Object>(Object{Key});
+            }));
+        }
+    });
+
+    // Objects are released right away, so every request creates a new object
+    // and the registry periodically purges expired entries.
+    Uint32 NextKey = NumKeys;
+    State.Measure("Get/Create", [&]() {
+        for (Uint32 i = 0; i < NumKeys; ++i, ++NextKey)
+        {
+            DoNotOptimize(Registry.Get(NextKey, [NextKey]() {
+                return std::make_shared<Object>(Object{NextKey});
+            }));
+        }
+    });
+}
+
+} // namespace
@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "HashUtils.hpp"
+#include "StringAtomTable.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "FastRand.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+DILIGENT_BENCHMARK(Common, HashUtils)
+{
+    {
+        Uint32 Val = 0;
+        State.SetItemsPerIteration(1);
+        State.Measure("ComputeHash/4xUint32", [&]() {
+            ++Val;
+            DoNotOptimize(ComputeHash(Val, Val + 1, Val + 2, Val + 3));
+        });
+    }
+
+    for (size_t Size : {16u, 256u, 4096u})
+    {
+        std::vector<Uint8> Data(Size);
+        for (size_t i = 0; i < Size; ++i)
+            Data[i] = static_cast<Uint8>(i * 31);
+
+        State.SetItemsPerIteration(static_cast<double>(Size));
+        State.Measure(("ComputeHashRaw/" + std::to_string(Size)).c_str(), [&]() {
+            DoNotOptimize(ComputeHashRaw(Data.data(), Data.size()));
+        });
+    }
+
+    {
+        SamplerDesc SamDesc;
+        SamDesc.Name = "Test sampler";
+        State.SetItemsPerIteration(1);
+        State.Measure("ComputeHash/SamplerDesc", [&]() {
+            SamDesc.MipLODBias += 1.f;
+            DoNotOptimize(ComputeHash(SamDesc));
+        });
+    }
+
+    // Typical resource-name lookup
+    {
+        constexpr size_t NumStrings = 256;
+
+        std::vector<std::string> Strings;
+        FastRandInt              Rnd{0, 0, 25};
+        for (size_t i = 0; i < NumStrings; ++i)
+        {
+            std::string Str = "g_Resource";
+            for (int c = 0; c < 8; ++c)
+                Str.push_back(static_cast<char>('a' + Rnd()));
+            Strings.emplace_back(std::move(Str));
+        }
+
+        State.SetItemsPerIteration(NumStrings);
+        State.Measure("CStringHash", [&]() {
+            for (const std::string& Str : Strings)
+                DoNotOptimize(CStringHash<char>{}(Str.c_str()));
+        });
+
+        std::unordered_map<HashMapStringKey, size_t> Map;
+        for (size_t i = 0; i < NumStrings; ++i)
+            Map.emplace(HashMapStringKey{Strings[i].c_str(), true}, i);
+
+        State.Measure("HashMapStringKey/Find", [&]() {
+            for (const std::string& Str : Strings)
+                DoNotOptimize(Map.find(HashMapStringKey{Str.c_str()}));
+        });
+
+        // Keys and lookups that use interned names: no hashing and pointer comparison only
+        StringAtomTable                              Atoms{DefaultRawMemoryAllocator::GetAllocator()};
+        std::vector<StringAtom>                      NameAtoms;
+        std::unordered_map<HashMapStringKey, size_t> AtomMap;
+        for (size_t i = 0; i < NumStrings; ++i)
+        {
+            NameAtoms.push_back(Atoms.Intern(Strings[i]));
+            AtomMap.emplace(NameAtoms.back().GetKey(), i);
+        }
+
+        State.Measure("StringAtom/Find", [&]() {
+            for (const StringAtom& Atom : NameAtoms)
+                DoNotOptimize(AtomMap.find(Atom.GetKey()));
+        });
+
+        State.Measure("StringAtomTable/Intern", [&]() {
+            for (const std::string& Str : Strings)
+                DoNotOptimize(Atoms.Intern(Str.c_str()));
+        });
+    }
+}
+
+} // namespace
@@ -0,0 +1,101 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "ImageTools.h"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+DILIGENT_BENCHMARK(Common, ComputeImageDifference)
+{
+    constexpr Uint32 Width  = 1024;
+    constexpr Uint32 Height = 1024;
+
+    std::vector<Uint8> Image1(Width * Height * 4);
+    std::vector<Uint8> Image2(Width * Height * 4);
+    std::vector<Uint8> DiffImage(Width * Height * 4);
+
+    FastRandInt Rnd{0, 0, 255};
+    for (size_t i = 0; i < Image1.size(); ++i)
+    {
+        Image1[i] = static_cast<Uint8>(Rnd());
+        // Make roughly half of the pixels differ
+        Image2[i] = (Rnd() & 1) ? Image1[i] : static_cast<Uint8>(Rnd());
+    }
+
+    ComputeImageDifferenceAttribs Attribs;
+    Attribs.Width        = Width;
+    Attribs.Height       = Height;
+    Attribs.pImage1      = Image1.data();
+    Attribs.NumChannels1 = 4;
+    Attribs.Stride1      = Width * 4;
+    Attribs.pImage2      = Image2.data();
+    Attribs.NumChannels2 = 4;
+    Attribs.Stride2      = Width * 4;
+    Attribs.Threshold    = 8;
+
+    State.SetItemsPerIteration(Width * Height);
+    State.Measure("RGBA8", [&]() {
+        ImageDiffInfo Diff;
+        ComputeImageDifference(Attribs, Diff);
+        DoNotOptimize(Diff);
+    });
+
+    Attribs.pDiffImage      = DiffImage.data();
+    Attribs.DiffStride      = Width * 4;
+    Attribs.NumDiffChannels = 4;
+    State.Measure("RGBA8/DiffImage", [&]() {
+        ImageDiffInfo Diff;
+        ComputeImageDifference(Attribs, Diff);
+        DoNotOptimize(Diff);
+    });
+
+    const Uint32 NumThreads = std::min(std::thread::hardware_concurrency(), 8u);
+    if (NumThreads > 1 && State.IsEnabled("RGBA8/DiffImage/ThreadPool"))
+    {
+        RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads - 1});
+        Attribs.pThreadPool                    = pThreadPool;
+        State.Measure("RGBA8/DiffImage/ThreadPool", [&]() {
+            ImageDiffInfo Diff;
+            ComputeImageDifference(Attribs, Diff);
+            DoNotOptimize(Diff);
+        });
+        Attribs.pThreadPool = nullptr;
+    }
+}
+
+} // namespace
@@ -0,0 +1,177 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "BasicMath.hpp"
+#include "BasicMathSIMD.hpp"
+#include "AdvancedMath.hpp"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+float4x4 RandomMatrix(FastRandFloat& Rnd)
+{
+    float4x4 M;
+    for (int r = 0; r < 4; ++r)
+    {
+        for (int c = 0; c < 4; ++c)
+            M[r][c] = Rnd();
+    }
+    return M;
+}
+
+DILIGENT_BENCHMARK(Common, BasicMath)
+{
+    constexpr size_t Count = 1024;
+
+    FastRandFloat Rnd{0, -10, +10};
+
+    std::vector<float4x4> Matrices(Count);
+    for (float4x4& M : Matrices)
+        M = RandomMatrix(Rnd);
+    std::vector<float4x4> DstMatrices(Count);
+
+    const float4x4 Transform = float4x4::Translation(1, 2, 3) * float4x4::RotationY(0.5f) * float4x4::Scale(2.f);
+
+    State.SetItemsPerIteration(Count);
+    State.Measure("MatrixMultiply/Scalar", [&]() {
+        for (size_t i = 0; i < Count; ++i)
+            DstMatrices[i] = Matrices[i] * Transform;
+        DoNotOptimize(DstMatrices.data());
+    });
+    State.Measure("MatrixMultiply/SIMD", [&]() {
+        for (size_t i = 0; i < Count; ++i)
+            DstMatrices[i] = MatrixMultiplySIMD(Matrices[i], Transform);
+        DoNotOptimize(DstMatrices.data());
+    });
+    State.Measure("MatrixMultiply/Batch", [&]() {
+        MultiplyMatrixArray(Matrices.data(), Count, Transform, DstMatrices.data());
+        DoNotOptimize(DstMatrices.data());
+    });
+
+    State.Measure("MatrixInverse/Scalar", [&]() {
+        for (size_t i = 0; i < Count; ++i)
+            DstMatrices[i] = Matrices[i].Inverse();
+        DoNotOptimize(DstMatrices.data());
+    });
+    State.Measure("MatrixInverse/SIMD", [&]() {
+        for (size_t i = 0; i < Count; ++i)
+            DstMatrices[i] = MatrixInverseSIMD(Matrices[i]);
+        DoNotOptimize(DstMatrices.data());
+    });
+
+    std::vector<float3> Points(Count);
+    for (float3& P : Points)
+        P = float3{Rnd(), Rnd(), Rnd()};
+    std::vector<float3> DstPoints(Count);
+
+    State.Measure("TransformPoints/Scalar", [&]() {
+        for (size_t i = 0; i < Count; ++i)
+            DstPoints[i] = Points[i] * Transform;
+        DoNotOptimize(DstPoints.data());
+    });
+    State.Measure("TransformPoints/Batch", [&]() {
+        TransformPoints(Points.data(), Count, Transform, DstPoints.data());
+        DoNotOptimize(DstPoints.data());
+    });
+
+    std::vector<QuaternionF> Quats(Count);
+    for (QuaternionF& Q : Quats)
+        Q = QuaternionF::RotationFromAxisAngle(normalize(float3{Rnd(), Rnd(), Rnd()} + float3{0, 0, 20.f}), Rnd());
+    std::vector<QuaternionF> DstQuats(Count);
+    const QuaternionF        Rotation = QuaternionF::RotationFromAxisAngle(float3{0, 1, 0}, 0.25f);
+
+    State.Measure("QuaternionMultiply/Scalar", [&]() {
+        for (size_t i = 0; i < Count; ++i)
+            DstQuats[i] = Quats[i] * Rotation;
+        DoNotOptimize(DstQuats.data());
+    });
+    State.Measure("QuaternionMultiply/SIMD", [&]() {
+        for (size_t i = 0; i < Count; ++i)
+            DstQuats[i] = QuaternionMultiplySIMD(Quats[i], Rotation);
+        DoNotOptimize(DstQuats.data());
+    });
+}
+
+DILIGENT_BENCHMARK(Common, FrustumCulling)
+{
+    constexpr size_t NumBoxes = 16384;
+
+    FastRandFloat    Rnd{0, -100, +100};
+    BoundBoxArraySoA Boxes;
+    Boxes.Reserve(NumBoxes);
+    std::vector<BoundBox> AoSBoxes(NumBoxes);
+    for (BoundBox& Box : AoSBoxes)
+    {
+        const float3 Center{Rnd(), Rnd(), Rnd()};
+        const float3 Extent = float3{std::abs(Rnd()), std::abs(Rnd()), std::abs(Rnd())} * 0.05f;
+        Box                 = BoundBox{Center - Extent, Center + Extent};
+        Boxes.Add(Box);
+    }
+
+    const float4x4 View = float4x4::Translation(0, 0, 50);
+    const float4x4 Proj = float4x4::Projection(PI_F / 3.f, 1.f, 1.f, 200.f, false);
+    ViewFrustumExt Frustum;
+    ExtractViewFrustumPlanesFromMatrix(View * Proj, Frustum, false);
+
+    std::vector<Uint32> VisibleMask((NumBoxes + 31) / 32);
+
+    State.SetItemsPerIteration(NumBoxes);
+    State.Measure("GetBoxVisibility", [&]() {
+        Uint32 NumVisible = 0;
+        for (const BoundBox& Box : AoSBoxes)
+            NumVisible += GetBoxVisibility(static_cast<const ViewFrustum&>(Frustum), Box) != BoxVisibility::Invisible ? 1 : 0;
+        DoNotOptimize(NumVisible);
+    });
+    State.Measure("GetBoxVisibilityBatch", [&]() {
+        DoNotOptimize(GetBoxVisibilityBatch(static_cast<const ViewFrustum&>(Frustum), Boxes, VisibleMask.data()));
+    });
+    State.Measure("GetBoxVisibilityBatch/Ext", [&]() {
+        DoNotOptimize(GetBoxVisibilityBatch(Frustum, Boxes, VisibleMask.data()));
+    });
+
+    const Uint32 NumThreads = std::min(std::thread::hardware_concurrency(), 8u);
+    if (NumThreads > 1 && State.IsEnabled("GetBoxVisibilityBatch/ThreadPool"))
+    {
+        RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads - 1});
+        State.Measure("GetBoxVisibilityBatch/ThreadPool", [&]() {
+            DoNotOptimize(GetBoxVisibilityBatch(static_cast<const ViewFrustum&>(Frustum), Boxes, VisibleMask.data(),
+                                                nullptr, FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, pThreadPool));
+        });
+    }
+}
+
+} // namespace
@@ -0,0 +1,126 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "Serializer.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+struct TestRecord
+{
+    Uint32      Id         = 0;
+    Uint16      Flags      = 0;
+    Uint8       Type       = 0;
+    Uint64      Hash       = 0;
+    const char* Name       = nullptr;
+    float       Weights[4] = {};
+};
+
+template <SerializerMode Mode>
+bool SerializeRecords(Serializer<Mode>& Ser, typename Serializer<Mode>::template ConstQual<TestRecord>* pRecords, size_t NumRecords)
+{
+    for (size_t i = 0; i < NumRecords; ++i)
+    {
+        auto& Rec = pRecords[i];
+        if (!Ser(Rec.Id, Rec.Flags, Rec.Type, Rec.Hash, Rec.Name))
+            return false;
+        if (!Ser.CopyBytes(Rec.Weights, sizeof(Rec.Weights)))
+            return false;
+    }
+    return true;
+}
+
+DILIGENT_BENCHMARK(Common, Serializer)
+{
+    constexpr size_t NumRecords = 256;
+
+    std::vector<TestRecord> Records(NumRecords);
+    for (size_t i = 0; i < NumRecords; ++i)
+    {
+        TestRecord& Rec = Records[i];
+        Rec.Id          = static_cast<Uint32>(i);
+        Rec.Flags       = static_cast<Uint16>(i * 3);
+        Rec.Type        = static_cast<Uint8>(i & 7);
+        Rec.Hash        = i * 0x9E3779B97F4A7C15ull;
+        Rec.Name        = (i & 1) ? "Odd record name" : "Even";
+    }
+
+    IMemoryAllocator& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    State.SetItemsPerIteration(NumRecords);
+    State.Measure("MeasureWrite", [&]() {
+        Serializer<SerializerMode::Measure> MSer;
+        SerializeRecords(MSer, Records.data(), NumRecords);
+
+        SerializedData Data = MSer.AllocateData(RawAllocator);
+
+        Serializer<SerializerMode::Write> WSer{Data};
+        SerializeRecords(WSer, Records.data(), NumRecords);
+        DoNotOptimize(Data.Ptr());
+    });
+
+    // Single-pass write into pooled chunks; the chunks are reused between iterations
+    SerializedDataChunks Chunks{RawAllocator, 4096};
+    State.Measure("ChunkedWrite", [&]() {
+        Chunks.Clear();
+        {
+            Serializer<SerializerMode::Write> WSer{Chunks};
+            SerializeRecords(WSer, Records.data(), NumRecords);
+        }
+        DoNotOptimize(Chunks.GetSize());
+    });
+
+    Serializer<SerializerMode::Measure> MSer;
+    SerializeRecords(MSer, Records.data(), NumRecords);
+    SerializedData Data = MSer.AllocateData(RawAllocator);
+    {
+        Serializer<SerializerMode::Write> WSer{Data};
+        SerializeRecords(WSer, Records.data(), NumRecords);
+    }
+
+    std::vector<TestRecord> ReadRecords(NumRecords);
+    State.Measure("Read", [&]() {
+        Serializer<SerializerMode::Read> RSer{Data};
+        SerializeRecords(RSer, ReadRecords.data(), NumRecords);
+        DoNotOptimize(ReadRecords.data());
+    });
+
+    State.Measure("ChunkedRead", [&]() {
+        Serializer<SerializerMode::Read> RSer{Chunks};
+        SerializeRecords(RSer, ReadRecords.data(), NumRecords);
+        DoNotOptimize(ReadRecords.data());
+    });
+}
+
+} // namespace
@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <thread>
+
+#include "ThreadPool.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+DILIGENT_BENCHMARK(Common, ThreadPool)
+{
+    constexpr Uint32 NumTasks = 64;
+    State.SetItemsPerIteration(NumTasks);
+
+    const auto EnqueueAndWait = [](IThreadPool* pThreadPool) {
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            EnqueueAsyncWork(pThreadPool,
+                             [](Uint32 ThreadId) {
+                                 return ASYNC_TASK_STATUS_COMPLETE;
+                             });
+        }
+        pThreadPool->WaitForAllTasks();
+    };
+
+    // Queue overhead without thread hand-off: tasks are executed by the calling thread
+    {
+        RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0});
+        State.Measure("EnqueueProcess/Inline", [&]() {
+            for (Uint32 i = 0; i < NumTasks; ++i)
+            {
+                EnqueueAsyncWork(pThreadPool,
+                                 [](Uint32 ThreadId) {
+                                     return ASYNC_TASK_STATUS_COMPLETE;
+                                 });
+            }
+            while (pThreadPool->GetQueueSize() > 0)
+                pThreadPool->ProcessTask(0, false);
+        });
+    }
+
+    const Uint32 MaxThreads = std::max(std::min(std::thread::hardware_concurrency(), 8u), 1u);
+    for (Uint32 NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+    {
+        const std::string Variant = "EnqueueWait/" + std::to_string(NumThreads) + "Threads";
+        if (!State.IsEnabled(Variant.c_str()))
+            continue;
+
+        RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+        State.Measure(Variant.c_str(), [&]() {
+            EnqueueAndWait(pThreadPool);
+        });
+    }
+
+    // Tasks with prerequisites form a chain, so every task waits for the previous one
+    {
+        RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{std::min(MaxThreads, 4u)});
+        State.Measure("Dependencies", [&]() {
+            RefCntAutoPtr<IAsyncTask> pPrevTask;
+            for (Uint32 i = 0; i < NumTasks; ++i)
+            {
+                IAsyncTask* ppPrerequisites[] = {pPrevTask};
+                pPrevTask                     = EnqueueAsyncWork(pThreadPool, ppPrerequisites, pPrevTask ? 1 : 0,
+                                             [](Uint32 ThreadId) {
+                                                 return ASYNC_TASK_STATUS_COMPLETE;
+                                             });
+            }
+            pThreadPool->WaitForAllTasks();
+        });
+    }
+}
+
+} // namespace
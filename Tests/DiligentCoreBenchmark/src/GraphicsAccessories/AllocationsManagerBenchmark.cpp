@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <vector>
+
+#include "VariableSizeAllocationsManager.hpp"
+#include "RingBuffer.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "FastRand.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+DILIGENT_BENCHMARK(GraphicsAccessories, VariableSizeAllocationsManager)
+{
+    constexpr size_t NumAllocations = 1024;
+
+    IMemoryAllocator& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    FastRandInt         Rnd{0, 1, 256};
+    std::vector<size_t> Sizes(NumAllocations);
+    for (size_t& Size : Sizes)
+        Size = static_cast<size_t>(Rnd()) * 16;
+
+    std::vector<VariableSizeAllocationsManager::Allocation> Allocations(NumAllocations);
+
+    // Shuffled free order fragments the free list
+    std::vector<size_t> FreeOrder(NumAllocations);
+    for (size_t i = 0; i < NumAllocations; ++i)
+        FreeOrder[i] = i;
+    for (size_t i = NumAllocations - 1; i > 0; --i)
+        std::swap(FreeOrder[i], FreeOrder[static_cast<size_t>(Rnd()) % (i + 1)]);
+
+    VariableSizeAllocationsManager Mgr{NumAllocations * 256 * 16, Allocator};
+
+    State.SetItemsPerIteration(NumAllocations);
+    State.Measure("AllocFree/Ordered", [&]() {
+        for (size_t i = 0; i < NumAllocations; ++i)
+            Allocations[i] = Mgr.Allocate(Sizes[i], 16);
+        for (size_t i = 0; i < NumAllocations; ++i)
+            Mgr.Free(std::move(Allocations[i]));
+    });
+
+    State.Measure("AllocFree/Shuffled", [&]() {
+        for (size_t i = 0; i < NumAllocations; ++i)
+            Allocations[i] = Mgr.Allocate(Sizes[i], 16);
+        for (size_t i : FreeOrder)
+            Mgr.Free(std::move(Allocations[i]));
+    });
+}
+
+DILIGENT_BENCHMARK(GraphicsAccessories, RingBuffer)
+{
+    constexpr size_t NumAllocationsPerFrame = 256;
+    constexpr Uint64 NumFramesInFlight      = 3;
+
+    IMemoryAllocator& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    RingBuffer RB{NumAllocationsPerFrame * 256 * (NumFramesInFlight + 1), Allocator};
+
+    Uint64 FenceValue = 0;
+    State.SetItemsPerIteration(NumAllocationsPerFrame);
+    State.Measure("Frame", [&]() {
+        for (size_t i = 0; i < NumAllocationsPerFrame; ++i)
+            DoNotOptimize(RB.Allocate(64 + (i & 3) * 64, 16));
+
+        ++FenceValue;
+        RB.FinishCurrentFrame(FenceValue);
+        if (FenceValue > NumFramesInFlight)
+            RB.ReleaseCompletedFrames(FenceValue - NumFramesInFlight);
+    });
+}
+
+} // namespace
@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <vector>
+
+#include "DynamicAtlasManager.hpp"
+#include "FastRand.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+const char* GetStrategyName(DynamicAtlasManager::ALLOCATION_STRATEGY Strategy)
+{
+    switch (Strategy)
+    {
+        case DynamicAtlasManager::ALLOCATION_STRATEGY_TREE: return "Tree";
+        case DynamicAtlasManager::ALLOCATION_STRATEGY_SHELF: return "Shelf";
+        case DynamicAtlasManager::ALLOCATION_STRATEGY_BUDDY: return "Buddy";
+        default: return "Unknown";
+    }
+}
+
+DILIGENT_BENCHMARK(GraphicsAccessories, DynamicAtlasManager)
+{
+    constexpr Uint32 AtlasSize      = 2048;
+    constexpr size_t NumAllocations = 1024;
+
+    struct Workload
+    {
+        const char*                            Name;
+        std::vector<std::pair<Uint32, Uint32>> Sizes;
+    };
+
+    Workload Workloads[2] = {{"Glyphs", {}}, {"Mixed", {}}};
+
+    FastRandInt Rnd{0, 0, 1 << 20};
+    for (size_t i = 0; i < NumAllocations; ++i)
+    {
+        // Glyph-like regions have uniform height
+        Workloads[0].Sizes.emplace_back(8 + Rnd() % 24, 32);
+        Workloads[1].Sizes.emplace_back(4 + Rnd() % 60, 4 + Rnd() % 60);
+    }
+
+    std::vector<DynamicAtlasManager::Region> Regions(NumAllocations);
+
+    State.SetItemsPerIteration(NumAllocations);
+    for (const Workload& WL : Workloads)
+    {
+        for (Uint32 s = 0; s < DynamicAtlasManager::ALLOCATION_STRATEGY_COUNT; ++s)
+        {
+            const DynamicAtlasManager::ALLOCATION_STRATEGY Strategy = static_cast<DynamicAtlasManager::ALLOCATION_STRATEGY>(s);
+
+            const std::string Variant = std::string{"AllocFree/"} + WL.Name + '/' + GetStrategyName(Strategy);
+            if (!State.IsEnabled(Variant.c_str()))
+                continue;
+
+            DynamicAtlasManager Mgr{AtlasSize, AtlasSize, Strategy};
+            State.Measure(Variant.c_str(), [&]() {
+                for (size_t i = 0; i < NumAllocations; ++i)
+                    Regions[i] = Mgr.Allocate(WL.Sizes[i].first, WL.Sizes[i].second);
+                for (DynamicAtlasManager::Region& R : Regions)
+                {
+                    if (!R.IsEmpty())
+                        Mgr.Free(std::move(R));
+                }
+            });
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,153 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DearchiverBase.hpp"
+#include "DataBlobImpl.hpp"
+#include "HashUtils.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+class DearchiverCacheAccessor : public DearchiverBase
+{
+public:
+    template <typename ResType>
+    using NamedResourceCache = DearchiverBase::NamedResourceCache<ResType>;
+
+    using ResourceType = DearchiverBase::ResourceType;
+};
+
+using DataBlobCache = DearchiverCacheAccessor::NamedResourceCache<IDataBlob>;
+using ResourceType  = DearchiverCacheAccessor::ResourceType;
+
+// Every thread unpacks NamesPerThread consecutive names starting at ThreadIdx * ThreadNameOffset,
+// so that the name sets of neighboring threads overlap by 75%.
+constexpr Uint32 NumNames         = 1024;
+constexpr Uint32 NamesPerThread   = 512;
+constexpr Uint32 ThreadNameOffset = NamesPerThread / 4;
+
+// Resources are small blobs filled with data, which roughly models deserialization
+RefCntAutoPtr<IDataBlob> CreateResource(Uint32 NameIdx)
+{
+    constexpr size_t         ResourceSize = 1024;
+    RefCntAutoPtr<IDataBlob> pBlob        = DataBlobImpl::Create(ResourceSize);
+
+    Uint32* pData = pBlob->GetDataPtr<Uint32>();
+    for (size_t i = 0; i < ResourceSize / sizeof(Uint32); ++i)
+        pData[i] = static_cast<Uint32>(ComputeHash(NameIdx, i));
+
+    return pBlob;
+}
+
+template <typename HandlerType>
+void RunOnThreads(Uint32 NumThreads, const HandlerType& Handler)
+{
+    std::vector<std::thread> Threads;
+    Threads.reserve(NumThreads - 1);
+    for (Uint32 t = 1; t < NumThreads; ++t)
+        Threads.emplace_back([&Handler, t]() { Handler(t); });
+
+    Handler(0);
+
+    for (std::thread& Thread : Threads)
+        Thread.join();
+}
+
+DILIGENT_BENCHMARK(GraphicsEngine, DearchiverCache)
+{
+    std::vector<std::string> Names(NumNames);
+    for (Uint32 i = 0; i < NumNames; ++i)
+        Names[i] = "ArchivedPipeline " + std::to_string(i);
+
+    constexpr Uint32 ThreadCounts[] = {1, 2, 4, 8};
+
+    DataBlobCache Cache;
+
+    // Keep strong references so that cache entries stay alive
+    std::vector<RefCntAutoPtr<IDataBlob>> Resources(NumNames);
+    for (Uint32 i = 0; i < NumNames; ++i)
+    {
+        Resources[i] = Cache.GetOrCreate(ResourceType::GraphicsPipeline, Names[i].c_str(),
+                                         [i]() {
+                                             return CreateResource(i);
+                                         });
+    }
+
+    // All resources are in the cache, so every request is a hit
+    for (Uint32 NumThreads : ThreadCounts)
+    {
+        constexpr Uint32 NumPasses = 4;
+        State.SetItemsPerIteration(size_t{NumThreads} * NamesPerThread * NumPasses);
+        State.Measure(("Hit/Threads=" + std::to_string(NumThreads)).c_str(), [&]() {
+            RunOnThreads(NumThreads, [&](Uint32 ThreadIdx) {
+                for (Uint32 Pass = 0; Pass < NumPasses; ++Pass)
+                {
+                    for (Uint32 i = 0; i < NamesPerThread; ++i)
+                    {
+                        const Uint32 NameIdx = (ThreadIdx * ThreadNameOffset + i) % NumNames;
+                        DoNotOptimize(Cache.Get(ResourceType::GraphicsPipeline, Names[NameIdx].c_str()));
+                    }
+                }
+            });
+        });
+    }
+
+    // The cache is empty at the start of every iteration, so threads that request
+    // the same resource at the same time have to wait until it is created.
+    for (Uint32 NumThreads : ThreadCounts)
+    {
+        State.SetItemsPerIteration(size_t{NumThreads} * NamesPerThread);
+        State.Measure(("Create/Threads=" + std::to_string(NumThreads)).c_str(), [&]() {
+            Resources.clear();
+            Cache.Clear();
+
+            std::vector<std::vector<RefCntAutoPtr<IDataBlob>>> ThreadResources(NumThreads);
+            RunOnThreads(NumThreads, [&](Uint32 ThreadIdx) {
+                std::vector<RefCntAutoPtr<IDataBlob>>& ThreadRes = ThreadResources[ThreadIdx];
+                ThreadRes.reserve(NamesPerThread);
+                for (Uint32 i = 0; i < NamesPerThread; ++i)
+                {
+                    const Uint32 NameIdx = (ThreadIdx * ThreadNameOffset + i) % NumNames;
+                    ThreadRes.emplace_back(Cache.GetOrCreate(ResourceType::GraphicsPipeline, Names[NameIdx].c_str(),
+                                                             [NameIdx]() {
+                                                                 return CreateResource(NameIdx);
+                                                             }));
+                }
+            });
+        });
+    }
+}
+
+} // namespace
@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DynamicHeap.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+class MasterBlockManager : public DynamicHeap::MasterBlockListBasedManager
+{
+public:
+    using TBase = DynamicHeap::MasterBlockListBasedManager;
+    using TBase::TBase;
+    using TBase::AllocateMasterBlocks;
+};
+
+// There is no GPU, so stale blocks are returned to the manager immediately
+struct ImmediateReleaseDevice
+{
+    template <typename ObjectType>
+    void SafeReleaseDeviceObject(ObjectType&& Object, Uint64 CmdQueueMask)
+    {
+        ObjectType StaleObject{std::move(Object)};
+    }
+};
+
+// Every thread emulates a device context that allocates dynamic heap pages through its own
+// master block cache and releases them at the end of every frame. Unused cached pages are kept
+// across frames.
+// Batch size 1 takes the manager lock for every page, as the dynamic heap did before the caches
+// were introduced.
+// Throughput is reported per thread.
+DILIGENT_BENCHMARK(GraphicsEngineNextGenBase, DynamicHeap)
+{
+    constexpr Uint32 MasterBlockSize   = 64 << 10;
+    constexpr Uint32 NumBlocksPerFrame = 16;
+    constexpr Uint32 NumFrames         = 64;
+    constexpr Uint32 MaxBatchSize      = 16;
+
+    const Uint32 MaxThreads = std::max(std::min(std::thread::hardware_concurrency(), 16u), 1u);
+
+    MasterBlockManager     Mgr{DefaultRawMemoryAllocator::GetAllocator(), MaxThreads * (NumBlocksPerFrame + MaxBatchSize) * MasterBlockSize};
+    ImmediateReleaseDevice Device;
+
+    State.SetItemsPerIteration(NumFrames * NumBlocksPerFrame);
+    for (const Uint32 BatchSize : {Uint32{1}, Uint32{4}, MaxBatchSize})
+    {
+        const auto RunFrames = [&]() {
+            DynamicHeap::MasterBlockCache<MasterBlockManager> Cache{Mgr, MasterBlockSize, 1024, BatchSize};
+
+            std::vector<MasterBlockManager::MasterBlock> Blocks;
+            for (Uint32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                for (Uint32 i = 0; i < NumBlocksPerFrame; ++i)
+                    Blocks.emplace_back(Cache.Allocate());
+                Mgr.ReleaseMasterBlocks(Blocks, Device, 1);
+                Cache.EndFrame();
+            }
+        };
+
+        for (Uint32 NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+        {
+            const std::string Variant = "AllocateRelease/Batch" + std::to_string(BatchSize) + "/" + std::to_string(NumThreads) + "Threads";
+            State.Measure(Variant.c_str(), [&]() {
+                std::vector<std::thread> Workers;
+                for (Uint32 t = 1; t < NumThreads; ++t)
+                    Workers.emplace_back(RunFrames);
+                RunFrames();
+                for (std::thread& Worker : Workers)
+                    Worker.join();
+            });
+        }
+    }
+}
+
+} // namespace
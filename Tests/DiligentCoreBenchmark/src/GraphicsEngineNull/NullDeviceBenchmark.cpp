@@ -0,0 +1,599 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EngineFactoryNull.h"
+#include "RefCntAutoPtr.hpp"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+class NullDeviceScene
+{
+public:
+    explicit NullDeviceScene(Uint32 NumDeferredContexts = 0)
+    {
+        IEngineFactoryNull* pFactory = LoadAndGetEngineFactoryNull();
+        if (pFactory == nullptr)
+            return;
+
+        EngineCreateInfo EngineCI;
+        EngineCI.NumDeferredContexts = NumDeferredContexts;
+
+        std::vector<IDeviceContext*> ppContexts(size_t{1} + NumDeferredContexts);
+        pFactory->CreateDeviceAndContextsNull(EngineCI, &m_pDevice, ppContexts.data());
+        if (!m_pDevice)
+            return;
+
+        m_pContext.Attach(ppContexts[0]);
+        m_DeferredContexts.resize(NumDeferredContexts);
+        for (Uint32 i = 0; i < NumDeferredContexts; ++i)
+            m_DeferredContexts[i].Attach(ppContexts[size_t{1} + i]);
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.Source         = "void main() {}";
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.Desc           = {"Benchmark VS", SHADER_TYPE_VERTEX, true};
+        m_pDevice->CreateShader(ShaderCI, &m_pVS);
+        ShaderCI.Desc = {"Benchmark PS", SHADER_TYPE_PIXEL, true};
+        m_pDevice->CreateShader(ShaderCI, &m_pPS);
+
+        const PipelineResourceDesc Resources[] = {
+            {SHADER_TYPE_VERTEX, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+            {SHADER_TYPE_PIXEL, "g_Texture", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_PIXEL, "g_Buffer", 1, SHADER_RESOURCE_TYPE_BUFFER_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        };
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "Benchmark PRS";
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+        m_pDevice->CreatePipelineResourceSignature(PRSDesc, &m_pPRS);
+        if (m_pPRS)
+            CreatePipelineState(m_pPRS, &m_pPSO);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Benchmark constants";
+        BuffDesc.Size           = 256;
+        BuffDesc.Usage          = USAGE_DYNAMIC;
+        BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pConstants);
+
+        BuffDesc.Name              = "Benchmark structured buffer";
+        BuffDesc.Usage             = USAGE_DEFAULT;
+        BuffDesc.BindFlags         = BIND_SHADER_RESOURCE;
+        BuffDesc.CPUAccessFlags    = CPU_ACCESS_NONE;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = 16;
+        BuffDesc.Size              = 1024;
+        m_pStructBuffer            = nullptr;
+        m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pStructBuffer);
+
+        BuffDesc           = BufferDesc{};
+        BuffDesc.Name      = "Benchmark vertex buffer";
+        BuffDesc.Size      = 1024;
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+        m_pDevice->CreateBuffer(BuffDesc, nullptr, &m_pVertexBuffer);
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Benchmark texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = 256;
+        TexDesc.Height    = 256;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+        m_pDevice->CreateTexture(TexDesc, nullptr, &m_pTexture);
+
+        TexDesc.Name      = "Benchmark render target";
+        TexDesc.BindFlags = BIND_RENDER_TARGET;
+        m_pDevice->CreateTexture(TexDesc, nullptr, &m_pRenderTarget);
+
+        TexDesc.Name      = "Benchmark depth buffer";
+        TexDesc.Format    = TEX_FORMAT_D32_FLOAT;
+        TexDesc.BindFlags = BIND_DEPTH_STENCIL;
+        m_pDevice->CreateTexture(TexDesc, nullptr, &m_pDepthBuffer);
+
+        if (!m_pPRS || !m_pPSO || !m_pConstants || !m_pStructBuffer || !m_pVertexBuffer || !m_pTexture || !m_pRenderTarget || !m_pDepthBuffer)
+            return;
+
+        m_pPRS->GetStaticVariableByName(SHADER_TYPE_VERTEX, "cbConstants")->Set(m_pConstants);
+        m_pPRS->CreateShaderResourceBinding(&m_pSRB, true);
+        m_pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(m_pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+        m_pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffer")->Set(m_pStructBuffer->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+    }
+
+    bool IsValid() const { return m_pSRB != nullptr; }
+
+    void CreatePipelineState(IPipelineResourceSignature* pPRS, IPipelineState** ppPSO)
+    {
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name                      = "Benchmark PSO";
+        PSOCreateInfo.pVS                               = m_pVS;
+        PSOCreateInfo.pPS                               = m_pPS;
+        PSOCreateInfo.GraphicsPipeline.NumRenderTargets = 1;
+        PSOCreateInfo.GraphicsPipeline.RTVFormats[0]    = TEX_FORMAT_RGBA8_UNORM;
+        PSOCreateInfo.GraphicsPipeline.DSVFormat        = TEX_FORMAT_D32_FLOAT;
+
+        LayoutElement Elements[]                   = {{0, 0, 3, VT_FLOAT32}};
+        PSOCreateInfo.GraphicsPipeline.InputLayout = {Elements, _countof(Elements)};
+
+        IPipelineResourceSignature* ppSignatures[] = {pPRS};
+        PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+        PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+        m_pDevice->CreateGraphicsPipelineState(PSOCreateInfo, ppPSO);
+    }
+
+    void BeginFrame(RESOURCE_STATE_TRANSITION_MODE Mode, IPipelineState* pPSO = nullptr)
+    {
+        ITextureView* pRTV = m_pRenderTarget->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+        m_pContext->SetRenderTargets(1, &pRTV, m_pDepthBuffer->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL), Mode);
+
+        IBuffer* ppVBs[] = {m_pVertexBuffer};
+        m_pContext->SetVertexBuffers(0, 1, ppVBs, nullptr, Mode, SET_VERTEX_BUFFERS_FLAG_RESET);
+        m_pContext->SetPipelineState(pPSO != nullptr ? pPSO : m_pPSO.RawPtr());
+    }
+
+    void EndFrame()
+    {
+        m_pContext->Flush();
+        m_pContext->FinishFrame();
+    }
+
+    IRenderDevice*              GetDevice() const { return m_pDevice; }
+    IDeviceContext*             GetContext() const { return m_pContext; }
+    IDeviceContext*             GetDeferredContext(size_t Idx) const { return m_DeferredContexts[Idx]; }
+    IPipelineState*             GetPSO() const { return m_pPSO; }
+    IPipelineResourceSignature* GetPRS() const { return m_pPRS; }
+    IShaderResourceBinding*     GetSRB() const { return m_pSRB; }
+    IBuffer*                    GetConstants() const { return m_pConstants; }
+    IBuffer*                    GetVertexBuffer() const { return m_pVertexBuffer; }
+    IBuffer*                    GetStructBuffer() const { return m_pStructBuffer; }
+    ITexture*                   GetTexture() const { return m_pTexture; }
+    ITexture*                   GetRenderTarget() const { return m_pRenderTarget; }
+    ITexture*                   GetDepthBuffer() const { return m_pDepthBuffer; }
+
+private:
+    RefCntAutoPtr<IRenderDevice>              m_pDevice;
+    RefCntAutoPtr<IDeviceContext>             m_pContext;
+    RefCntAutoPtr<IShader>                    m_pVS;
+    RefCntAutoPtr<IShader>                    m_pPS;
+    RefCntAutoPtr<IPipelineResourceSignature> m_pPRS;
+    RefCntAutoPtr<IPipelineState>             m_pPSO;
+    RefCntAutoPtr<IShaderResourceBinding>     m_pSRB;
+    RefCntAutoPtr<IBuffer>                    m_pConstants;
+    RefCntAutoPtr<IBuffer>                    m_pStructBuffer;
+    RefCntAutoPtr<IBuffer>                    m_pVertexBuffer;
+    RefCntAutoPtr<ITexture>                   m_pTexture;
+    RefCntAutoPtr<ITexture>                   m_pRenderTarget;
+    RefCntAutoPtr<ITexture>                   m_pDepthBuffer;
+
+    std::vector<RefCntAutoPtr<IDeviceContext>> m_DeferredContexts;
+};
+
+constexpr Uint32 NumDrawsPerFrame = 1000;
+
+DILIGENT_BENCHMARK(GraphicsEngineNull, DeviceContext)
+{
+    NullDeviceScene Scene;
+    if (!Scene.IsValid())
+    {
+        std::printf("Null device is not available, skipping %s\n", State.GetName().c_str());
+        return;
+    }
+
+    IDeviceContext*         pCtx = Scene.GetContext();
+    IShaderResourceBinding* pSRB = Scene.GetSRB();
+
+    State.SetItemsPerIteration(NumDrawsPerFrame);
+
+    // Draw calls with no state changes: measures the draw validation and command recording overhead
+    State.Measure("Draw", [&]() {
+        Scene.BeginFrame(RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        for (Uint32 i = 0; i < NumDrawsPerFrame; ++i)
+            pCtx->Draw(DrawAttribs{3, DRAW_FLAG_NONE});
+        Scene.EndFrame();
+    });
+
+    // Dynamic constant buffer update before every draw
+    State.Measure("MapDraw", [&]() {
+        Scene.BeginFrame(RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        for (Uint32 i = 0; i < NumDrawsPerFrame; ++i)
+        {
+            void* pData = nullptr;
+            pCtx->MapBuffer(Scene.GetConstants(), MAP_WRITE, MAP_FLAG_DISCARD, pData);
+            static_cast<Uint32*>(pData)[0] = i;
+            pCtx->UnmapBuffer(Scene.GetConstants(), MAP_WRITE);
+            pCtx->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+        }
+        Scene.EndFrame();
+    });
+
+    // Resource binding before every draw
+    for (RESOURCE_STATE_TRANSITION_MODE Mode : {RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_TRANSITION_MODE_VERIFY})
+    {
+        const char* Variant = Mode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION ? "CommitDraw/Transition" : "CommitDraw/Verify";
+        State.Measure(Variant, [&]() {
+            Scene.BeginFrame(RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            for (Uint32 i = 0; i < NumDrawsPerFrame; ++i)
+            {
+                pCtx->CommitShaderResources(pSRB, Mode);
+                pCtx->Draw(DrawAttribs{3, DRAW_FLAG_NONE});
+            }
+            Scene.EndFrame();
+        });
+    }
+
+    // Pipeline and vertex buffer changes before every draw
+    State.Measure("SetPSOCommitDraw", [&]() {
+        Scene.BeginFrame(RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        IBuffer* ppVBs[] = {Scene.GetVertexBuffer()};
+        for (Uint32 i = 0; i < NumDrawsPerFrame; ++i)
+        {
+            pCtx->SetPipelineState(Scene.GetPSO());
+            pCtx->SetVertexBuffers(0, 1, ppVBs, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY, SET_VERTEX_BUFFERS_FLAG_RESET);
+            pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+            pCtx->Draw(DrawAttribs{3, DRAW_FLAG_NONE});
+        }
+        Scene.EndFrame();
+    });
+
+    // Binding-heavy draws: every draw commits an SRB with many dynamic resources that
+    // are either unchanged since the previous commit or have one texture replaced.
+    {
+        const PipelineResourceDesc Resources[] = {
+            {SHADER_TYPE_PIXEL, "g_Textures", 32, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+            {SHADER_TYPE_PIXEL, "g_Buffers", 16, SHADER_RESOURCE_TYPE_BUFFER_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        };
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "Binding-heavy PRS";
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+
+        RefCntAutoPtr<IPipelineResourceSignature> pHeavyPRS;
+        Scene.GetDevice()->CreatePipelineResourceSignature(PRSDesc, &pHeavyPRS);
+        RefCntAutoPtr<IPipelineState> pHeavyPSO;
+        if (pHeavyPRS)
+            Scene.CreatePipelineState(pHeavyPRS, &pHeavyPSO);
+        RefCntAutoPtr<IShaderResourceBinding> pHeavySRB;
+        if (pHeavyPSO)
+            pHeavyPRS->CreateShaderResourceBinding(&pHeavySRB, true);
+        if (!pHeavySRB)
+            return;
+
+        IDeviceObject* pTexSRV = Scene.GetTexture()->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+        IDeviceObject* pBufSRV = Scene.GetStructBuffer()->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE);
+
+        IShaderResourceVariable* pTexturesVar = pHeavySRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures");
+        IShaderResourceVariable* pBuffersVar  = pHeavySRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffers");
+        for (Uint32 i = 0; i < Resources[0].ArraySize; ++i)
+            pTexturesVar->SetArray(&pTexSRV, i, 1);
+        for (Uint32 i = 0; i < Resources[1].ArraySize; ++i)
+            pBuffersVar->SetArray(&pBufSRV, i, 1);
+
+        for (bool ChangeResource : {false, true})
+        {
+            State.Measure(ChangeResource ? "CommitDraw/BindingHeavy/OneChanged" : "CommitDraw/BindingHeavy/Unchanged", [&]() {
+                Scene.BeginFrame(RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pHeavyPSO);
+                for (Uint32 i = 0; i < NumDrawsPerFrame; ++i)
+                {
+                    if (ChangeResource)
+                        pTexturesVar->SetArray(&pTexSRV, i % Resources[0].ArraySize, 1, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+                    pCtx->CommitShaderResources(pHeavySRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                    pCtx->Draw(DrawAttribs{3, DRAW_FLAG_NONE});
+                }
+                Scene.EndFrame();
+            });
+        }
+    }
+}
+
+// Parallel command list recording: every thread records NumDrawsPerFrame draws into its own
+// deferred context, and the immediate context executes all command lists. The throughput is
+// reported per thread, so it stays constant as long as recording scales linearly.
+DILIGENT_BENCHMARK(GraphicsEngineNull, DeferredContexts)
+{
+    const Uint32 MaxThreads = std::max(std::min(std::thread::hardware_concurrency(), 16u), 1u);
+    for (Uint32 NumThreads = 1; NumThreads <= MaxThreads; NumThreads *= 2)
+    {
+        const std::string Variant = "Record/" + std::to_string(NumThreads) + "Threads";
+        if (!State.IsEnabled(Variant.c_str()))
+            continue;
+
+        NullDeviceScene Scene{NumThreads};
+        if (!Scene.IsValid())
+        {
+            std::printf("Null device is not available, skipping %s\n", State.GetName().c_str());
+            return;
+        }
+
+        IDeviceContext* pImmediateCtx = Scene.GetContext();
+
+        // Every thread draws its own object with a separate SRB, while the pipeline and
+        // the resources are shared, as is typical for scene rendering
+        std::vector<RefCntAutoPtr<IShaderResourceBinding>> SRBs(NumThreads);
+        for (RefCntAutoPtr<IShaderResourceBinding>& pSRB : SRBs)
+        {
+            Scene.GetPRS()->CreateShaderResourceBinding(&pSRB, true);
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(Scene.GetTexture()->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+            pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffer")->Set(Scene.GetStructBuffer()->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE));
+        }
+
+        // Deferred contexts can't transition resource states, so transition everything up front
+        Scene.BeginFrame(RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        for (IShaderResourceBinding* pSRB : SRBs)
+            pImmediateCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        Scene.EndFrame();
+
+        ITextureView* pRTV = Scene.GetRenderTarget()->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+        ITextureView* pDSV = Scene.GetDepthBuffer()->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL);
+        IBuffer*      pVB  = Scene.GetVertexBuffer();
+
+        std::vector<RefCntAutoPtr<ICommandList>> CmdLists(NumThreads);
+        std::vector<ICommandList*>               ppCmdLists(NumThreads);
+
+        const auto RecordCommandList = [&](Uint32 ThreadId) {
+            IDeviceContext*         pCtx = Scene.GetDeferredContext(ThreadId);
+            IShaderResourceBinding* pSRB = SRBs[ThreadId];
+
+            pCtx->Begin(0);
+            pCtx->SetRenderTargets(1, &pRTV, pDSV, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+            pCtx->SetVertexBuffers(0, 1, &pVB, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY, SET_VERTEX_BUFFERS_FLAG_RESET);
+            for (Uint32 i = 0; i < NumDrawsPerFrame; ++i)
+            {
+                pCtx->SetPipelineState(Scene.GetPSO());
+                pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                pCtx->Draw(DrawAttribs{3, DRAW_FLAG_NONE});
+            }
+            pCtx->FinishCommandList(&CmdLists[ThreadId]);
+        };
+
+        // Worker threads wait for the next frame, record their command lists and report completion
+        std::mutex               Mtx;
+        std::condition_variable  FrameStartedCV;
+        std::condition_variable  FrameRecordedCV;
+        Uint64                   FrameIndex    = 0;
+        Uint32                   NumRecording  = 0;
+        bool                     StopRecording = false;
+        std::vector<std::thread> Workers;
+        for (Uint32 ThreadId = 1; ThreadId < NumThreads; ++ThreadId)
+        {
+            Workers.emplace_back([&, ThreadId]() {
+                Uint64 LastFrame = 0;
+                while (true)
+                {
+                    {
+                        std::unique_lock<std::mutex> Lock{Mtx};
+                        FrameStartedCV.wait(Lock, [&]() { return StopRecording || FrameIndex != LastFrame; });
+                        if (StopRecording)
+                            return;
+                        LastFrame = FrameIndex;
+                    }
+
+                    RecordCommandList(ThreadId);
+
+                    std::lock_guard<std::mutex> Lock{Mtx};
+                    if (--NumRecording == 0)
+                        FrameRecordedCV.notify_one();
+                }
+            });
+        }
+
+        State.SetItemsPerIteration(NumDrawsPerFrame);
+        State.Measure(Variant.c_str(), [&]() {
+            {
+                std::lock_guard<std::mutex> Lock{Mtx};
+                ++FrameIndex;
+                NumRecording = NumThreads - 1;
+            }
+            FrameStartedCV.notify_all();
+
+            // The main thread records the first command list
+            RecordCommandList(0);
+            {
+                std::unique_lock<std::mutex> Lock{Mtx};
+                FrameRecordedCV.wait(Lock, [&]() { return NumRecording == 0; });
+            }
+
+            for (Uint32 i = 0; i < NumThreads; ++i)
+                ppCmdLists[i] = CmdLists[i];
+            pImmediateCtx->ExecuteCommandLists(NumThreads, ppCmdLists.data());
+            for (Uint32 i = 0; i < NumThreads; ++i)
+            {
+                CmdLists[i].Release();
+                Scene.GetDeferredContext(i)->FinishFrame();
+            }
+            pImmediateCtx->FinishFrame();
+        });
+
+        {
+            std::lock_guard<std::mutex> Lock{Mtx};
+            StopRecording = true;
+        }
+        FrameStartedCV.notify_all();
+        for (std::thread& Worker : Workers)
+            Worker.join();
+    }
+}
+
+DILIGENT_BENCHMARK(GraphicsEngineNull, PipelineState)
+{
+    NullDeviceScene Scene;
+    if (!Scene.IsValid())
+    {
+        std::printf("Null device is not available, skipping %s\n", State.GetName().c_str());
+        return;
+    }
+
+    IRenderDevice* pDevice = Scene.GetDevice();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source         = "void main() {}";
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Desc           = {"Benchmark CS", SHADER_TYPE_COMPUTE, true};
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+
+    const ImmutableSamplerDesc ImtblSamplers[] = {
+        {SHADER_TYPE_COMPUTE, "g_Texture", SamplerDesc{}},
+    };
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name                                = "Benchmark compute PSO";
+    PSOCreateInfo.PSODesc.ResourceLayout.ImmutableSamplers    = ImtblSamplers;
+    PSOCreateInfo.PSODesc.ResourceLayout.NumImmutableSamplers = _countof(ImtblSamplers);
+    PSOCreateInfo.pCS                                         = pCS;
+
+    constexpr Uint32 NumPSOs = 100;
+    State.SetItemsPerIteration(NumPSOs);
+
+    // Pipelines with identical implicit signatures, as created by material systems
+    State.Measure("CreateWithImplicitSignature", [&]() {
+        std::vector<RefCntAutoPtr<IPipelineState>> PSOs(NumPSOs);
+        for (Uint32 i = 0; i < NumPSOs; ++i)
+            pDevice->CreateComputePipelineState(PSOCreateInfo, &PSOs[i]);
+        DoNotOptimize(PSOs.data());
+    });
+}
+
+DILIGENT_BENCHMARK(GraphicsEngineNull, ShaderResourceBinding)
+{
+    NullDeviceScene Scene;
+    if (!Scene.IsValid())
+    {
+        std::printf("Null device is not available, skipping %s\n", State.GetName().c_str());
+        return;
+    }
+
+    IShaderResourceBinding*  pSRB    = Scene.GetSRB();
+    IShaderResourceVariable* pTexVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture");
+    IShaderResourceVariable* pBufVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffer");
+    IDeviceObject*           pTexSRV = Scene.GetTexture()->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    IDeviceObject*           pBufSRV = Scene.GetStructBuffer()->GetDefaultView(BUFFER_VIEW_SHADER_RESOURCE);
+
+    constexpr Uint32 NumUpdates = 1000;
+    State.SetItemsPerIteration(NumUpdates);
+
+    State.Measure("SetVariable", [&]() {
+        for (Uint32 i = 0; i < NumUpdates; ++i)
+        {
+            pTexVar->Set(pTexSRV, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+            pBufVar->Set(pBufSRV, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+        }
+    });
+
+    State.Measure("GetVariableByName", [&]() {
+        for (Uint32 i = 0; i < NumUpdates; ++i)
+            DoNotOptimize(pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffer"));
+    });
+
+    State.Measure("CreateSRB", [&]() {
+        for (Uint32 i = 0; i < NumUpdates; ++i)
+        {
+            RefCntAutoPtr<IShaderResourceBinding> pNewSRB;
+            Scene.GetPRS()->CreateShaderResourceBinding(&pNewSRB, true);
+            DoNotOptimize(pNewSRB.RawPtr());
+        }
+    });
+
+    // Transient SRBs created and released every frame, with and without recycling
+    // of the released SRB data by the signature.
+    constexpr Uint32 NumTransientSRBs = 64;
+    for (const Uint32 PoolSize : {Uint32{0}, NumTransientSRBs})
+    {
+        const PipelineResourceDesc Resources[] = {
+            {SHADER_TYPE_PIXEL, "g_Texture", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_PIXEL, "g_Buffer", 1, SHADER_RESOURCE_TYPE_BUFFER_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        };
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name               = "Transient SRB PRS";
+        PRSDesc.Resources          = Resources;
+        PRSDesc.NumResources       = _countof(Resources);
+        PRSDesc.SRBRecyclePoolSize = PoolSize;
+
+        RefCntAutoPtr<IPipelineResourceSignature> pTransientPRS;
+        Scene.GetDevice()->CreatePipelineResourceSignature(PRSDesc, &pTransientPRS);
+
+        std::vector<RefCntAutoPtr<IShaderResourceBinding>> TransientSRBs(NumTransientSRBs);
+        State.SetItemsPerIteration(NumTransientSRBs);
+        State.Measure(PoolSize == 0 ? "TransientSRBs/NoRecycling" : "TransientSRBs/RecyclePoolSize64", [&]() {
+            for (RefCntAutoPtr<IShaderResourceBinding>& pTransientSRB : TransientSRBs)
+            {
+                pTransientPRS->CreateShaderResourceBinding(&pTransientSRB);
+                pTransientSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(pTexSRV);
+                pTransientSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Buffer")->Set(pBufSRV);
+            }
+            for (RefCntAutoPtr<IShaderResourceBinding>& pTransientSRB : TransientSRBs)
+                pTransientSRB.Release();
+        });
+    }
+
+    // Resource mapping with many unrelated resources, as used by streaming systems
+    RefCntAutoPtr<IResourceMapping> pResMapping;
+    Scene.GetDevice()->CreateResourceMapping(ResourceMappingCreateInfo{}, &pResMapping);
+    for (Uint32 i = 0; i < 256; ++i)
+        pResMapping->AddResource(("g_StreamedTexture" + std::to_string(i)).c_str(), pTexSRV, false);
+    pResMapping->AddResource("g_Texture", pTexSRV, false);
+    pResMapping->AddResource("g_Buffer", pBufSRV, false);
+
+    constexpr Uint32 NumBinds = 100;
+    State.SetItemsPerIteration(NumBinds);
+    State.Measure("BindResources", [&]() {
+        for (Uint32 i = 0; i < NumBinds; ++i)
+            pSRB->BindResources(SHADER_TYPE_PIXEL, pResMapping, BIND_SHADER_RESOURCES_UPDATE_ALL | BIND_SHADER_RESOURCES_ALLOW_OVERWRITE);
+    });
+
+    // Binding while another thread keeps updating the mapping
+    {
+        std::atomic<bool> StopUpdates{false};
+        std::thread       Updater{[&]() {
+            for (Uint32 i = 0; !StopUpdates.load(); ++i)
+                pResMapping->AddResource(("g_StreamedTexture" + std::to_string(i % 256)).c_str(), (i & 1) ? pTexSRV : pBufSRV, false);
+        }};
+        State.Measure("BindResources/ConcurrentUpdates", [&]() {
+            for (Uint32 i = 0; i < NumBinds; ++i)
+                pSRB->BindResources(SHADER_TYPE_PIXEL, pResMapping, BIND_SHADER_RESOURCES_UPDATE_ALL | BIND_SHADER_RESOURCES_ALLOW_OVERWRITE);
+        });
+        StopUpdates.store(true);
+        Updater.join();
+    }
+}
+
+} // namespace
@@ -0,0 +1,186 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+void PrintUsage()
+{
+    std::printf(
+        "Usage: DiligentCoreBenchmark [options]\n"
+        "\n"
+        "Options:\n"
+        "  --filter=<patterns>      Colon-separated list of benchmark name patterns ('*' and '?' wildcards)\n"
+        "  --list                   List registered benchmarks and exit\n"
+        "  --warmup_ms=<ms>         Minimum warmup time per measurement (default: 50)\n"
+        "  --min_time_ms=<ms>       Minimum duration of a single repetition (default: 20)\n"
+        "  --repetitions=<n>        Number of timed repetitions (default: 10)\n"
+        "  --json=<path>            Write the results to the JSON file\n"
+        "  --baseline=<path>        Compare the results with the baseline JSON file\n"
+        "  --threshold=<percent>    Fail if a median time grows by more than this value (default: 10)\n"
+        "  --help                   Print this message\n");
+}
+
+const char* GetArgValue(const char* Arg, const char* Name)
+{
+    const size_t NameLen = strlen(Name);
+    return (strncmp(Arg, Name, NameLen) == 0 && Arg[NameLen] == '=') ? Arg + NameLen + 1 : nullptr;
+}
+
+bool ReadFile(const char* Path, std::string& Content)
+{
+    std::ifstream File{Path};
+    if (!File)
+        return false;
+    std::stringstream Stream;
+    Stream << File.rdbuf();
+    Content = Stream.str();
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions Options;
+
+    const char* JSONPath     = nullptr;
+    const char* BaselinePath = nullptr;
+    double      Threshold    = 10;
+    bool        ListOnly     = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* Arg   = argv[i];
+        const char* Value = nullptr;
+        if ((Value = GetArgValue(Arg, "--filter")) != nullptr)
+            Options.Filter = Value;
+        else if ((Value = GetArgValue(Arg, "--warmup_ms")) != nullptr)
+            Options.WarmupTimeMs = std::atof(Value);
+        else if ((Value = GetArgValue(Arg, "--min_time_ms")) != nullptr)
+            Options.MinRepetitionTimeMs = std::atof(Value);
+        else if ((Value = GetArgValue(Arg, "--repetitions")) != nullptr)
+            Options.NumRepetitions = static_cast<Uint32>(std::max(std::atoi(Value), 1));
+        else if ((Value = GetArgValue(Arg, "--json")) != nullptr)
+            JSONPath = Value;
+        else if ((Value = GetArgValue(Arg, "--baseline")) != nullptr)
+            BaselinePath = Value;
+        else if ((Value = GetArgValue(Arg, "--threshold")) != nullptr)
+            Threshold = std::atof(Value);
+        else if (strcmp(Arg, "--list") == 0)
+            ListOnly = true;
+        else if (strcmp(Arg, "--help") == 0)
+        {
+            PrintUsage();
+            return 0;
+        }
+        else
+        {
+            std::fprintf(stderr, "Unknown argument: %s\n\n", Arg);
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    if (ListOnly)
+    {
+        for (const std::string& Name : GetRegisteredBenchmarks())
+        {
+            if (MatchesBenchmarkFilter(Name, Options.Filter))
+                std::printf("%s\n", Name.c_str());
+        }
+        return 0;
+    }
+
+    // Load the baseline first so that a missing file is reported before spending time on the run
+    std::vector<BenchmarkResult> Baseline;
+    if (BaselinePath != nullptr)
+    {
+        std::string BaselineJSON;
+        if (!ReadFile(BaselinePath, BaselineJSON))
+        {
+            std::fprintf(stderr, "Failed to read the baseline file '%s'\n", BaselinePath);
+            return 2;
+        }
+        if (!ParseBenchmarkResultsJSON(BaselineJSON, Baseline))
+        {
+            std::fprintf(stderr, "Failed to parse the baseline file '%s'\n", BaselinePath);
+            return 2;
+        }
+    }
+
+    std::printf("%-56s %17s %17s %17s %12s\n", "Benchmark", "Median", "P90", "P99", "Iterations");
+    const std::vector<BenchmarkResult> Results = RunBenchmarks(Options);
+    if (Results.empty())
+    {
+        std::fprintf(stderr, "No benchmarks match the filter '%s'\n", Options.Filter.c_str());
+        return 2;
+    }
+
+    if (JSONPath != nullptr && !WriteBenchmarkResultsJSON(JSONPath, Options, Results))
+    {
+        std::fprintf(stderr, "Failed to write the results to '%s'\n", JSONPath);
+        return 2;
+    }
+
+    if (BaselinePath == nullptr)
+        return 0;
+
+    const std::vector<BenchmarkComparison> Comparisons = CompareBenchmarkResults(Baseline, Results, Threshold);
+
+    std::printf("\nComparison with baseline '%s' (threshold %.1f%%):\n", BaselinePath, Threshold);
+    size_t NumRegressions = 0;
+    for (const BenchmarkComparison& Cmp : Comparisons)
+    {
+        std::printf("%-56s %14.1f ns -> %14.1f ns %+8.1f%%%s\n",
+                    Cmp.Name.c_str(), Cmp.BaselineNs, Cmp.CurrentNs, Cmp.ChangePercent,
+                    Cmp.IsRegression ? "  REGRESSION" : "");
+        if (Cmp.IsRegression)
+            ++NumRegressions;
+    }
+    if (Comparisons.size() < Results.size())
+        std::printf("%zu benchmark(s) have no baseline\n", Results.size() - Comparisons.size());
+
+    if (NumRegressions > 0)
+    {
+        std::printf("\n%zu benchmark(s) regressed by more than %.1f%%\n", NumRegressions, Threshold);
+        return 1;
+    }
+
+    return 0;
+}
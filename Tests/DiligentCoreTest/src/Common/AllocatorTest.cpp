@@ -26,6 +26,8 @@
  */
 
 #include <array>
+#include <vector>
+#include <thread>
 
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
@@ -33,8 +35,10 @@
 #include "DynamicLinearAllocator.hpp"
 
 #include "gtest/gtest.h"
+#include "TestingEnvironment.hpp"
 
 using namespace Diligent;
+using namespace Diligent::Testing;
 
 namespace
 {
@@ -124,6 +128,34 @@ TEST(Common_FixedBlockMemoryAllocator, UnalignedSize)
     }
 }
 
+TEST(Common_FixedBlockMemoryAllocator, DoubleFree)
+{
+    constexpr Uint32 AllocSize             = 16;
+    constexpr Uint32 NumAllocationsPerPage = 70;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage};
+
+    std::vector<void*> Allocations(NumAllocationsPerPage);
+    for (void*& Ptr : Allocations)
+        Ptr = TestAllocator.Allocate(AllocSize, "Double free test", __FILE__, __LINE__);
+
+    TestAllocator.Free(Allocations[66]);
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"double freeing memory"};
+        TestAllocator.Free(Allocations[66]);
+    }
+
+    // The second free must not have corrupted the free list
+    void* pRawMem0 = TestAllocator.Allocate(AllocSize, "Double free test", __FILE__, __LINE__);
+    void* pRawMem1 = TestAllocator.Allocate(AllocSize, "Double free test", __FILE__, __LINE__);
+    EXPECT_EQ(pRawMem0, Allocations[66]);
+    EXPECT_NE(pRawMem1, Allocations[66]);
+
+    Allocations.push_back(pRawMem1);
+    for (void* Ptr : Allocations)
+        TestAllocator.Free(Ptr);
+}
+
 TEST(Common_FixedLinearAllocator, EmptyAllocator)
 {
     FixedLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
@@ -289,4 +321,82 @@ TEST(Common_DynamicLinearAllocator, ObjectConstruction)
     EXPECT_TRUE(reinterpret_cast<size_t>(Allocator.Allocate(200, 64)) % 64 == 0);
 }
 
+TEST(Common_DynamicLinearAllocator, DiscardReusesBlocks)
+{
+    DynamicLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 256};
+
+    std::vector<void*> Ptrs;
+    for (size_t i = 0; i < 64; ++i)
+        Ptrs.push_back(Allocator.Allocate(64, 16));
+    const size_t NumBlocks = Allocator.GetBlockCount();
+    EXPECT_GE(NumBlocks, size_t{16});
+
+    Allocator.Discard();
+    for (size_t i = 0; i < 64; ++i)
+        EXPECT_EQ(Allocator.Allocate(64, 16), Ptrs[i]);
+    EXPECT_EQ(Allocator.GetBlockCount(), NumBlocks);
+
+    // An oversized allocation gets a dedicated block
+    Allocator.Discard();
+    void* pSmall = Allocator.Allocate(16, 16);
+    void* pLarge = Allocator.Allocate(1024, 16);
+    EXPECT_NE(pLarge, nullptr);
+    EXPECT_EQ(Allocator.GetBlockCount(), NumBlocks + 1);
+
+    // After a discard, the oversized block is reused
+    Allocator.Discard();
+    EXPECT_EQ(Allocator.Allocate(16, 16), pSmall);
+    EXPECT_EQ(Allocator.Allocate(1024, 16), pLarge);
+    EXPECT_EQ(Allocator.GetBlockCount(), NumBlocks + 1);
+}
+
+TEST(Common_DynamicLinearAllocator, Rollback)
+{
+    DynamicLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 256};
+
+    {
+        const DynamicLinearAllocator::Marker Marker = Allocator.GetMarker();
+        void*                                Ptr0   = Allocator.Allocate(64, 16);
+        Allocator.Rollback(Marker);
+        EXPECT_EQ(Allocator.Allocate(64, 16), Ptr0);
+    }
+
+    const DynamicLinearAllocator::Marker Marker = Allocator.GetMarker();
+
+    void* Ptr1 = Allocator.Allocate(32, 16);
+    {
+        DynamicLinearAllocator::ScopedMarker Scope{Allocator};
+        for (size_t i = 0; i < 32; ++i)
+            EXPECT_NE(Allocator.Allocate(64, 16), nullptr);
+    }
+    const size_t NumBlocks = Allocator.GetBlockCount();
+
+    void* Ptr2 = Allocator.Allocate(32, 16);
+    EXPECT_EQ(Ptr2, static_cast<Uint8*>(Ptr1) + 32);
+
+    // Blocks used inside the scope are reused
+    for (size_t i = 0; i < 32; ++i)
+        EXPECT_NE(Allocator.Allocate(64, 16), nullptr);
+    EXPECT_EQ(Allocator.GetBlockCount(), NumBlocks);
+
+    Allocator.Rollback(Marker);
+    EXPECT_EQ(Allocator.Allocate(32, 16), Ptr1);
+}
+
+TEST(Common_DynamicLinearAllocator, ThreadFrameArena)
+{
+    DynamicLinearAllocator& Arena = DynamicLinearAllocator::GetThreadFrameArena();
+    EXPECT_EQ(&Arena, &DynamicLinearAllocator::GetThreadFrameArena());
+
+    DynamicLinearAllocator* pOtherArena = nullptr;
+    std::thread{[&]() {
+        pOtherArena = &DynamicLinearAllocator::GetThreadFrameArena();
+    }}.join();
+    EXPECT_NE(&Arena, pOtherArena);
+
+    const char* Str = Arena.CopyString("Frame string");
+    EXPECT_STREQ(Str, "Frame string");
+    Arena.Discard();
+}
+
 } // namespace
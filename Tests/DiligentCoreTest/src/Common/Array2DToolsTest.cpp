@@ -27,88 +27,363 @@
 #include "Array2DTools.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "FastRand.hpp"
+#include "TestingEnvironment.hpp"
 
 using namespace Diligent;
+using namespace Diligent::Testing;
 
 namespace
 {
 
+// Runs the test for every SIMD implementation supported by the CPU
+template <typename TestFuncType>
+void TestAllSIMDImpls(TestFuncType&& TestFunc)
+{
+    for (Uint32 Impl = ARRAY2D_SIMD_IMPL_SCALAR; Impl < ARRAY2D_SIMD_IMPL_COUNT; ++Impl)
+    {
+        if (!SetArray2DSIMDImpl(static_cast<ARRAY2D_SIMD_IMPL>(Impl)))
+            continue;
+        EXPECT_EQ(GetArray2DSIMDImpl(), static_cast<ARRAY2D_SIMD_IMPL>(Impl));
+        TestFunc();
+    }
+    EXPECT_TRUE(SetArray2DSIMDImpl(ARRAY2D_SIMD_IMPL_AUTO));
+}
+
+// Sizes that cover SIMD main loops as well as remainders
+constexpr Uint32 TestSizes[] = {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100};
+
+TEST(Common_Array2DTools, SIMDImpl)
+{
+    EXPECT_TRUE(IsArray2DSIMDImplSupported(ARRAY2D_SIMD_IMPL_AUTO));
+    EXPECT_TRUE(IsArray2DSIMDImplSupported(ARRAY2D_SIMD_IMPL_SCALAR));
+    EXPECT_FALSE(IsArray2DSIMDImplSupported(ARRAY2D_SIMD_IMPL_COUNT));
+    EXPECT_FALSE(SetArray2DSIMDImpl(ARRAY2D_SIMD_IMPL_COUNT));
+
+    const ARRAY2D_SIMD_IMPL AutoImpl = GetArray2DSIMDImpl();
+    EXPECT_NE(AutoImpl, ARRAY2D_SIMD_IMPL_AUTO);
+    EXPECT_TRUE(IsArray2DSIMDImplSupported(AutoImpl));
+}
+
 TEST(Common_Array2DTools, GetArray2DMinMaxValue)
 {
-    auto Test = [](const float* pData, size_t Stride, Uint32 Width, Uint32 Height) {
-        auto RefMin = pData[0];
-        auto RefMax = pData[0];
-        for (size_t row = 0; row < Height; ++row)
+    TestAllSIMDImpls([]() {
+        auto Test = [](const float* pData, size_t Stride, Uint32 Width, Uint32 Height) {
+            auto RefMin = pData[0];
+            auto RefMax = pData[0];
+            for (size_t row = 0; row < Height; ++row)
+            {
+                for (size_t col = 0; col < Width; ++col)
+                {
+                    auto Val = pData[col + row * Stride];
+                    RefMin   = std::min(Val, RefMin);
+                    RefMax   = std::max(Val, RefMax);
+                }
+            }
+
+            float Min, Max;
+            GetArray2DMinMaxValue(pData, Stride, Width, Height, Min, Max);
+            EXPECT_EQ(Min, RefMin);
+            EXPECT_EQ(Max, RefMax);
+        };
+
+
+        // Test min/max at different positions
+        FastRandFloat Rnd{0, -100, +100};
+        for (Uint32 Width = 1; Width <= 32; ++Width)
         {
-            for (size_t col = 0; col < Width; ++col)
+            constexpr Uint32   Height = 1;
+            std::vector<float> Data(Width);
+            for (Uint32 test_max = 0; test_max < 2; ++test_max)
             {
-                auto Val = pData[col + row * Stride];
-                RefMin   = std::min(Val, RefMin);
-                RefMax   = std::max(Val, RefMax);
+                for (size_t test = 0; test < Data.size(); ++test)
+                {
+                    for (size_t i = 0; i < Data.size(); ++i)
+                    {
+                        if (i == test)
+                            Data[i] = test_max != 0 ? +1000.f : -1000.f;
+                        else
+                            Data[i] = Rnd();
+                    }
+
+                    Test(Data.data(), Width, Width, Height);
+                }
             }
         }
 
-        float Min, Max;
-        GetArray2DMinMaxValue(pData, Stride, Width, Height, Min, Max);
-        EXPECT_EQ(Min, RefMin);
-        EXPECT_EQ(Max, RefMax);
-    };
+        // Test misalignment
+        for (size_t misalign_offset = 0; misalign_offset < 8; ++misalign_offset)
+        {
+            for (Uint32 Width = 1; Width < 32; ++Width)
+            {
+                constexpr Uint32   Height = 1;
+                std::vector<float> Data(size_t{Width} + 8);
+                for (auto& Val : Data)
+                    Val = Rnd();
+                Test(&Data[misalign_offset], Width, Width, Height);
+            }
+        }
 
 
-    // Test min/max at different positions
+        {
+            for (Uint32 test = 0; test < 128; ++test)
+            {
+                const Uint32 Width  = 32 + (test % 8);
+                const Uint32 Height = 24 + (test / 8);
+                const size_t Sride  = Width + test / 10;
+
+                std::vector<float> Data(Sride * size_t{Height});
+                for (auto& Val : Data)
+                    Val = Rnd();
+                Test(Data.data(), Width, Width, Height);
+            }
+        }
+    });
+}
+
+TEST(Common_Array2DTools, GetArray2DSum)
+{
     FastRandFloat Rnd{0, -100, +100};
-    for (Uint32 Width = 1; Width <= 32; ++Width)
-    {
-        constexpr Uint32   Height = 1;
-        std::vector<float> Data(Width);
-        for (Uint32 test_max = 0; test_max < 2; ++test_max)
+    TestAllSIMDImpls([&]() {
+        for (Uint32 Width : TestSizes)
         {
-            for (size_t test = 0; test < Data.size(); ++test)
+            for (Uint32 Height : {1u, 3u, 16u})
             {
-                for (size_t i = 0; i < Data.size(); ++i)
+                const size_t       Stride = Width + 3;
+                std::vector<float> Data(Stride * Height);
+                for (auto& Val : Data)
+                    Val = Rnd();
+
+                double RefSum = 0;
+                for (size_t row = 0; row < Height; ++row)
                 {
-                    if (i == test)
-                        Data[i] = test_max != 0 ? +1000.f : -1000.f;
-                    else
-                        Data[i] = Rnd();
+                    for (size_t col = 0; col < Width; ++col)
+                        RefSum += Data[col + row * Stride];
                 }
 
-                Test(Data.data(), Width, Width, Height);
+                const double Sum = GetArray2DSum(Data.data(), Stride, Width, Height);
+                EXPECT_NEAR(Sum, RefSum, 1e-9 * Width * Height * 100);
+                EXPECT_NEAR(GetArray2DMean(Data.data(), Stride, Width, Height), RefSum / (Width * Height), 1e-9 * 100);
             }
         }
-    }
+        EXPECT_EQ(GetArray2DSum(nullptr, 0, 0, 0), 0.0);
+        EXPECT_EQ(GetArray2DMean(nullptr, 0, 0, 0), 0.0);
+    });
+}
 
-    // Test misalignment
-    for (size_t misalign_offset = 0; misalign_offset < 8; ++misalign_offset)
-    {
-        for (Uint32 Width = 1; Width < 32; ++Width)
+TEST(Common_Array2DTools, ComputeArray2DHistogram)
+{
+    FastRandFloat Rnd{0, -10, +10};
+    TestAllSIMDImpls([&]() {
+        for (Uint32 Width : TestSizes)
         {
-            constexpr Uint32   Height = 1;
-            std::vector<float> Data(size_t{Width} + 8);
-            for (auto& Val : Data)
-                Val = Rnd();
-            Test(&Data[misalign_offset], Width, Width, Height);
+            for (Uint32 NumBins : {1u, 7u, 64u})
+            {
+                constexpr Uint32   Height = 5;
+                const size_t       Stride = Width + 1;
+                std::vector<float> Data(Stride * Height);
+                for (auto& Val : Data)
+                    Val = Rnd();
+                // Out-of-range values and the range boundaries
+                Data[0] = -100.f;
+                if (Width > 1)
+                    Data[1] = +100.f;
+                if (Width > 2)
+                    Data[2] = -8.f;
+                if (Width > 3)
+                    Data[3] = 8.f;
+
+                constexpr float     MinValue = -8;
+                constexpr float     MaxValue = +8;
+                std::vector<Uint32> RefBins(NumBins);
+                for (size_t row = 0; row < Height; ++row)
+                {
+                    for (size_t col = 0; col < Width; ++col)
+                    {
+                        float Bin = (Data[col + row * Stride] - MinValue) * (static_cast<float>(NumBins) / (MaxValue - MinValue));
+                        Bin       = std::min(std::max(Bin, 0.f), static_cast<float>(NumBins - 1));
+                        ++RefBins[static_cast<size_t>(Bin)];
+                    }
+                }
+
+                std::vector<Uint32> Bins(NumBins, 1);
+                ComputeArray2DHistogram(Data.data(), Stride, Width, Height, MinValue, MaxValue, NumBins, Bins.data());
+                for (Uint32 i = 0; i < NumBins; ++i)
+                    EXPECT_EQ(Bins[i], RefBins[i] + 1) << "Width: " << Width << " NumBins: " << NumBins << " Bin: " << i;
+            }
         }
-    }
+    });
+}
 
+TEST(Common_Array2DTools, ComputeArray2DHistogram_TooManyBins)
+{
+    // 2^24 is the largest bin count whose last index is exactly representable as float
+    constexpr Uint32 NumBins = (1u << 24u) + 1u;
 
+    const float Data[] = {0.f, 1.f, 2.f, 3.f};
+    Uint32      Bins[4]{};
     {
-        for (Uint32 test = 0; test < 128; ++test)
+        TestingEnvironment::ErrorScope ExpectedErrors{"must not exceed 2^24"};
+        ComputeArray2DHistogram(Data, 4, 4, 1, 0.f, 4.f, NumBins, Bins);
+    }
+    for (Uint32 Bin : Bins)
+        EXPECT_EQ(Bin, 0u);
+}
+
+template <typename DstType>
+void TestConvertArray2DFloatToUnorm(void (*ConvertFunc)(const float*, size_t, Uint32, Uint32, float, float, DstType*, size_t), float MaxValue)
+{
+    FastRandFloat Rnd{0, -0.5f, +1.5f};
+    TestAllSIMDImpls([&]() {
+        for (Uint32 Width : TestSizes)
         {
-            const Uint32 Width  = 32 + (test % 8);
-            const Uint32 Height = 24 + (test / 8);
-            const size_t Sride  = Width + test / 10;
+            constexpr Uint32 Height    = 3;
+            const size_t     SrcStride = Width + 2;
+            const size_t     DstStride = Width + 5;
 
-            std::vector<float> Data(Sride * size_t{Height});
-            for (auto& Val : Data)
+            std::vector<float> Src(SrcStride * Height);
+            for (auto& Val : Src)
                 Val = Rnd();
-            Test(Data.data(), Width, Width, Height);
+
+            constexpr float      Scale = 2.f;
+            constexpr float      Bias  = -0.5f;
+            std::vector<DstType> Dst(DstStride * Height, 0xAB);
+            ConvertFunc(Src.data(), SrcStride, Width, Height, Scale, Bias, Dst.data(), DstStride);
+            for (size_t row = 0; row < Height; ++row)
+            {
+                for (size_t col = 0; col < DstStride; ++col)
+                {
+                    const DstType Val = Dst[col + row * DstStride];
+                    if (col < Width)
+                    {
+                        const float Norm = std::min(std::max(Src[col + row * SrcStride] * Scale + Bias, 0.f), 1.f);
+                        const float Ref  = std::round(Norm * MaxValue);
+                        // Allow off-by-one difference due to possible FMA contraction
+                        EXPECT_NEAR(static_cast<float>(Val), Ref, 1.f) << "Width: " << Width << " row: " << row << " col: " << col;
+                    }
+                    else
+                    {
+                        EXPECT_EQ(Val, DstType{0xAB}) << "Padding must not be overwritten";
+                    }
+                }
+            }
         }
+    });
+}
+
+TEST(Common_Array2DTools, ConvertArray2DFloatToUnorm8)
+{
+    TestConvertArray2DFloatToUnorm<Uint8>(ConvertArray2DFloatToUnorm8, 255.f);
+}
+
+TEST(Common_Array2DTools, ConvertArray2DFloatToUnorm16)
+{
+    TestConvertArray2DFloatToUnorm<Uint16>(ConvertArray2DFloatToUnorm16, 65535.f);
+}
+
+TEST(Common_Array2DTools, ConvertArray2DHalfToFloat)
+{
+    // Reference conversion using double-precision arithmetic
+    auto HalfToFloatRef = [](Uint16 Half) {
+        const Uint32 Exponent = (Half >> 10u) & 0x1Fu;
+        const Uint32 Mantissa = Half & 0x3FFu;
+
+        double Val = 0;
+        if (Exponent == 0)
+            Val = std::ldexp(static_cast<double>(Mantissa), -24);
+        else if (Exponent == 0x1F)
+            Val = INFINITY;
+        else
+            Val = std::ldexp(static_cast<double>(Mantissa + 1024), static_cast<int>(Exponent) - 25);
+        return static_cast<float>((Half & 0x8000u) != 0 ? -Val : Val);
+    };
+
+    // Test all non-NaN values
+    std::vector<Uint16> AllValues;
+    for (Uint32 i = 0; i < 65536; ++i)
+    {
+        if ((i & 0x7C00u) != 0x7C00u || (i & 0x3FFu) == 0)
+            AllValues.push_back(static_cast<Uint16>(i));
     }
+
+    TestAllSIMDImpls([&]() {
+        const Uint32       Width = static_cast<Uint32>(AllValues.size());
+        std::vector<float> Dst(Width);
+        ConvertArray2DHalfToFloat(AllValues.data(), Width, Width, 1, Dst.data(), Width);
+        for (Uint32 i = 0; i < Width; ++i)
+        {
+            const float Ref = HalfToFloatRef(AllValues[i]);
+            EXPECT_EQ(std::memcmp(&Dst[i], &Ref, sizeof(float)), 0) << "Half: " << AllValues[i] << " Value: " << Dst[i] << " Expected: " << Ref;
+        }
+
+        for (Uint32 Width : TestSizes)
+        {
+            constexpr Uint32    Height    = 3;
+            const size_t        SrcStride = Width + 1;
+            const size_t        DstStride = Width + 2;
+            std::vector<Uint16> Src(SrcStride * Height);
+            for (size_t i = 0; i < Src.size(); ++i)
+                Src[i] = AllValues[(i * 7919) % AllValues.size()];
+
+            std::vector<float> Dst(DstStride * Height, -1.f);
+            ConvertArray2DHalfToFloat(Src.data(), SrcStride, Width, Height, Dst.data(), DstStride);
+            for (size_t row = 0; row < Height; ++row)
+            {
+                for (size_t col = 0; col < DstStride; ++col)
+                {
+                    const float Val = Dst[col + row * DstStride];
+                    EXPECT_EQ(Val, col < Width ? HalfToFloatRef(Src[col + row * SrcStride]) : -1.f);
+                }
+            }
+        }
+    });
+}
+
+TEST(Common_Array2DTools, DownsampleArray2D)
+{
+    FastRandFloat Rnd{0, -100, +100};
+    TestAllSIMDImpls([&]() {
+        for (Uint32 SrcWidth : TestSizes)
+        {
+            for (Uint32 SrcHeight : {1u, 2u, 5u, 16u})
+            {
+                const size_t       SrcStride = SrcWidth + 3;
+                std::vector<float> Src(SrcStride * SrcHeight);
+                for (auto& Val : Src)
+                    Val = Rnd();
+
+                const Uint32       DstWidth  = std::max(SrcWidth / 2, 1u);
+                const Uint32       DstHeight = std::max(SrcHeight / 2, 1u);
+                const size_t       DstStride = DstWidth + 1;
+                std::vector<float> Dst(DstStride * DstHeight, -1000.f);
+                DownsampleArray2D(Src.data(), SrcStride, SrcWidth, SrcHeight, Dst.data(), DstStride);
+
+                for (Uint32 row = 0; row < DstHeight; ++row)
+                {
+                    const float* pRow0 = &Src[std::min(row * 2 + 0, SrcHeight - 1) * SrcStride];
+                    const float* pRow1 = &Src[std::min(row * 2 + 1, SrcHeight - 1) * SrcStride];
+                    for (Uint32 col = 0; col < DstStride; ++col)
+                    {
+                        float Ref = -1000.f;
+                        if (col < DstWidth)
+                        {
+                            const Uint32 Col0 = std::min(col * 2 + 0, SrcWidth - 1);
+                            const Uint32 Col1 = std::min(col * 2 + 1, SrcWidth - 1);
+
+                            Ref = ((pRow0[Col0] + pRow1[Col0]) + (pRow0[Col1] + pRow1[Col1])) * 0.25f;
+                        }
+                        EXPECT_EQ(Dst[col + row * DstStride], Ref) << "Src size: " << SrcWidth << "x" << SrcHeight << " row: " << row << " col: " << col;
+                    }
+                }
+            }
+        }
+    });
 }
 
 } // namespace
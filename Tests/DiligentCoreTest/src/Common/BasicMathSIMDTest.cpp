@@ -0,0 +1,214 @@
+/*
+ *  Copyright 2019-2022 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BasicMathSIMD.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+float4x4 RandomMatrix(FastRandFloat& Rnd)
+{
+    float4x4 m;
+    for (int i = 0; i < 16; ++i)
+        m.Data()[i] = Rnd();
+    return m;
+}
+
+void ExpectNear(const float* pVal, const float* pRef, size_t Count, float Tolerance = 1e-5f)
+{
+    for (size_t i = 0; i < Count; ++i)
+    {
+        // Relative tolerance
+        EXPECT_NEAR(pVal[i], pRef[i], Tolerance * std::max(1.f, std::abs(pRef[i]))) << "Element " << i;
+    }
+}
+
+TEST(Common_BasicMathSIMD, MatrixMultiply)
+{
+    FastRandFloat Rnd{0, -10, +10};
+    for (int test = 0; test < 100; ++test)
+    {
+        const float4x4 m1 = RandomMatrix(Rnd);
+        const float4x4 m2 = RandomMatrix(Rnd);
+
+        const float4x4 Ref = m1 * m2;
+        const float4x4 Res = MatrixMultiplySIMD(m1, m2);
+        ExpectNear(Res.Data(), Ref.Data(), 16);
+    }
+}
+
+TEST(Common_BasicMathSIMD, MatrixTranspose)
+{
+    FastRandFloat Rnd{0, -10, +10};
+    for (int test = 0; test < 10; ++test)
+    {
+        const float4x4 m = RandomMatrix(Rnd);
+        EXPECT_EQ(MatrixTransposeSIMD(m), m.Transpose());
+    }
+}
+
+TEST(Common_BasicMathSIMD, MatrixInverse)
+{
+    FastRandFloat Rnd{0, -1, +1};
+    for (int test = 0; test < 100; ++test)
+    {
+        // Well-conditioned matrix
+        float4x4 m = RandomMatrix(Rnd) + float4x4::Scale(4.f);
+        m._44 += 3.f;
+
+        const float4x4 Ref = m.Inverse();
+        const float4x4 Res = MatrixInverseSIMD(m);
+        ExpectNear(Res.Data(), Ref.Data(), 16, 1e-4f);
+
+        const float4x4 Identity = MatrixMultiplySIMD(m, Res);
+        ExpectNear(Identity.Data(), float4x4::Identity().Data(), 16, 1e-4f);
+    }
+
+    {
+        const float4x4 m   = float4x4::RotationY(0.5f) * float4x4::Translation(1, 2, 3) * float4x4::Scale(2, 3, 4);
+        const float4x4 Inv = MatrixInverseSIMD(m);
+        ExpectNear(Inv.Data(), m.Inverse().Data(), 16, 1e-5f);
+    }
+}
+
+TEST(Common_BasicMathSIMD, TransformVector)
+{
+    FastRandFloat Rnd{0, -10, +10};
+    for (int test = 0; test < 100; ++test)
+    {
+        const float4x4 m = RandomMatrix(Rnd);
+        const float4   v{Rnd(), Rnd(), Rnd(), Rnd()};
+
+        const float4 Ref = v * m;
+        const float4 Res = TransformVectorSIMD(v, m);
+        ExpectNear(Res.Data(), Ref.Data(), 4);
+    }
+}
+
+TEST(Common_BasicMathSIMD, QuaternionMultiply)
+{
+    FastRandFloat Rnd{0, -1, +1};
+    for (int test = 0; test < 100; ++test)
+    {
+        const QuaternionF q1{Rnd(), Rnd(), Rnd(), Rnd()};
+        const QuaternionF q2{Rnd(), Rnd(), Rnd(), Rnd()};
+
+        const QuaternionF Ref = q1 * q2;
+        const QuaternionF Res = QuaternionMultiplySIMD(q1, q2);
+        ExpectNear(Res.q.Data(), Ref.q.Data(), 4);
+    }
+}
+
+TEST(Common_BasicMathSIMD, TransformPoints)
+{
+    FastRandFloat Rnd{0, -10, +10};
+
+    const float4x4 m = RandomMatrix(Rnd);
+    for (size_t Count : {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 100})
+    {
+        std::vector<float3> Src(Count);
+        for (float3& p : Src)
+            p = float3{Rnd(), Rnd(), Rnd()};
+
+        // Extra element to check that the memory past the end is not overwritten
+        std::vector<float3> Dst(Count + 1, float3{-1, -2, -3});
+        TransformPoints(Src.data(), Count, m, Dst.data());
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const float4 Ref = float4{Src[i], 1} * m;
+            ExpectNear(Dst[i].Data(), Ref.Data(), 3);
+        }
+        EXPECT_EQ(Dst[Count], (float3{-1, -2, -3}));
+
+        // In-place
+        TransformPoints(Src.data(), Count, m, Src.data());
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Src[i], Dst[i]);
+    }
+}
+
+TEST(Common_BasicMathSIMD, TransformVectors)
+{
+    FastRandFloat Rnd{0, -10, +10};
+
+    const float4x4 m = RandomMatrix(Rnd);
+    for (size_t Count : {0, 1, 2, 3, 4, 5, 17})
+    {
+        std::vector<float4> Src(Count);
+        for (float4& v : Src)
+            v = float4{Rnd(), Rnd(), Rnd(), Rnd()};
+
+        std::vector<float4> Dst(Count + 1, float4{-1, -2, -3, -4});
+        TransformVectors(Src.data(), Count, m, Dst.data());
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const float4 Ref = Src[i] * m;
+            ExpectNear(Dst[i].Data(), Ref.Data(), 4);
+        }
+        EXPECT_EQ(Dst[Count], (float4{-1, -2, -3, -4}));
+
+        TransformVectors(Src.data(), Count, m, Src.data());
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Src[i], Dst[i]);
+    }
+}
+
+TEST(Common_BasicMathSIMD, MultiplyMatrixArray)
+{
+    FastRandFloat Rnd{0, -10, +10};
+
+    const float4x4 m = RandomMatrix(Rnd);
+    for (size_t Count : {0, 1, 2, 3, 10})
+    {
+        std::vector<float4x4> Src(Count);
+        for (float4x4& Mat : Src)
+            Mat = RandomMatrix(Rnd);
+
+        std::vector<float4x4> Dst(Count + 1, float4x4{-1});
+        MultiplyMatrixArray(Src.data(), Count, m, Dst.data());
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const float4x4 Ref = Src[i] * m;
+            ExpectNear(Dst[i].Data(), Ref.Data(), 16);
+        }
+        EXPECT_EQ(Dst[Count], float4x4{-1});
+
+        MultiplyMatrixArray(Src.data(), Count, m, Src.data());
+        for (size_t i = 0; i < Count; ++i)
+            EXPECT_EQ(Src[i], Dst[i]);
+    }
+}
+
+} // namespace
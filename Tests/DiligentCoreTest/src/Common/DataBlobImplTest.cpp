@@ -0,0 +1,248 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "DataBlobImpl.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<Uint8> MakeTestData(size_t Size)
+{
+    std::vector<Uint8> Data(Size);
+    for (size_t i = 0; i < Size; ++i)
+        Data[i] = static_cast<Uint8>(i * 31 + 7);
+    return Data;
+}
+
+TEST(Common_DataBlobImpl, Create)
+{
+    {
+        RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create(size_t{0});
+        ASSERT_NE(pBlob, nullptr);
+        EXPECT_EQ(pBlob->GetSize(), size_t{0});
+        EXPECT_EQ(pBlob->GetDataPtr(), nullptr);
+        EXPECT_EQ(pBlob->GetConstDataPtr(), nullptr);
+    }
+
+    for (size_t Size : {1u, 16u, 100u, 1000u, 10000u, 100000u})
+    {
+        const std::vector<Uint8>    Data  = MakeTestData(Size);
+        RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create(Size, Data.data());
+        ASSERT_NE(pBlob, nullptr);
+        EXPECT_EQ(pBlob->GetSize(), Size);
+        EXPECT_TRUE(pBlob->IsInline());
+        EXPECT_GE(pBlob->GetInlineCapacity(), Size);
+        EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), Data.data(), Size), 0);
+        EXPECT_EQ(pBlob->GetConstDataPtr<Uint8>(Size / 2), pBlob->GetConstDataPtr<Uint8>() + Size / 2);
+
+        RefCntAutoPtr<DataBlobImpl> pZeroBlob = DataBlobImpl::Create(Size);
+        ASSERT_NE(pZeroBlob, nullptr);
+        EXPECT_EQ(pZeroBlob->GetSize(), Size);
+        EXPECT_EQ(std::vector<Uint8>(Size), std::vector<Uint8>(pZeroBlob->GetConstDataPtr<Uint8>(), pZeroBlob->GetConstDataPtr<Uint8>() + Size));
+
+        RefCntAutoPtr<DataBlobImpl> pCopy = DataBlobImpl::MakeCopy(pBlob);
+        ASSERT_NE(pCopy, nullptr);
+        EXPECT_EQ(pCopy->GetSize(), Size);
+        EXPECT_EQ(std::memcmp(pCopy->GetConstDataPtr(), Data.data(), Size), 0);
+    }
+}
+
+TEST(Common_DataBlobImpl, Resize)
+{
+    const std::vector<Uint8> Data = MakeTestData(50000);
+
+    RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create(16, Data.data());
+    ASSERT_NE(pBlob, nullptr);
+    EXPECT_TRUE(pBlob->IsInline());
+
+    // Grow within the inline capacity
+    const size_t InlineCapacity = pBlob->GetInlineCapacity();
+    pBlob->Resize(InlineCapacity);
+    EXPECT_TRUE(pBlob->IsInline());
+    EXPECT_EQ(pBlob->GetSize(), InlineCapacity);
+    EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), Data.data(), 16), 0);
+    for (size_t i = 16; i < InlineCapacity; ++i)
+        EXPECT_EQ(pBlob->GetConstDataPtr<Uint8>()[i], 0);
+
+    std::memcpy(pBlob->GetDataPtr(), Data.data(), InlineCapacity);
+
+    // Grow past the inline capacity
+    pBlob->Resize(Data.size());
+    EXPECT_FALSE(pBlob->IsInline());
+    EXPECT_EQ(pBlob->GetSize(), Data.size());
+    EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), Data.data(), InlineCapacity), 0);
+    for (size_t i = InlineCapacity; i < Data.size(); ++i)
+        ASSERT_EQ(pBlob->GetConstDataPtr<Uint8>()[i], 0);
+
+    std::memcpy(pBlob->GetDataPtr(), Data.data(), Data.size());
+
+    // Grow past the largest pool size class
+    pBlob->Resize(Data.size() * 4);
+    EXPECT_FALSE(pBlob->IsInline());
+    EXPECT_EQ(pBlob->GetSize(), Data.size() * 4);
+    EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), Data.data(), Data.size()), 0);
+    for (size_t i = Data.size(); i < Data.size() * 4; ++i)
+        ASSERT_EQ(pBlob->GetConstDataPtr<Uint8>()[i], 0);
+
+    // Shrink
+    pBlob->Resize(8);
+    EXPECT_EQ(pBlob->GetSize(), size_t{8});
+    EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), Data.data(), 8), 0);
+
+    pBlob->Resize(0);
+    EXPECT_EQ(pBlob->GetSize(), size_t{0});
+    EXPECT_EQ(pBlob->GetDataPtr(), nullptr);
+}
+
+TEST(Common_DataBlobImpl, DataBuffer)
+{
+    const std::vector<Uint8> Data = MakeTestData(1000);
+
+    DataBlobImpl::DataBufferType DataBuff{Data.begin(), Data.end(), STD_ALLOCATOR_RAW_MEM(Uint8, DefaultRawMemoryAllocator::GetAllocator(), "Test data buffer")};
+    const Uint8* const           pBuffData = DataBuff.data();
+
+    RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create(std::move(DataBuff));
+    ASSERT_NE(pBlob, nullptr);
+    EXPECT_FALSE(pBlob->IsInline());
+    EXPECT_EQ(pBlob->GetSize(), Data.size());
+    // The buffer must be adopted without a copy
+    EXPECT_EQ(pBlob->GetConstDataPtr(), pBuffData);
+    EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), Data.data(), Data.size()), 0);
+
+    pBlob->Resize(2000);
+    EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), Data.data(), Data.size()), 0);
+}
+
+TEST(Common_DataBlobImpl, CustomAllocator)
+{
+    class TestAllocator final : public IMemoryAllocator
+    {
+    public:
+        virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final
+        {
+            ++NumAllocations;
+            return DefaultRawMemoryAllocator::GetAllocator().Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+        }
+        virtual void Free(void* Ptr) override final
+        {
+            ++NumFrees;
+            DefaultRawMemoryAllocator::GetAllocator().Free(Ptr);
+        }
+        virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final
+        {
+            ++NumAllocations;
+            return DefaultRawMemoryAllocator::GetAllocator().AllocateAligned(Size, Alignment, dbgDescription, dbgFileName, dbgLineNumber);
+        }
+        virtual void FreeAligned(void* Ptr) override final
+        {
+            ++NumFrees;
+            DefaultRawMemoryAllocator::GetAllocator().FreeAligned(Ptr);
+        }
+
+        int NumAllocations = 0;
+        int NumFrees       = 0;
+    };
+
+    TestAllocator Allocator;
+    {
+        const std::vector<Uint8> Data = MakeTestData(100);
+
+        RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create(&Allocator, Data.size(), Data.data());
+        ASSERT_NE(pBlob, nullptr);
+        // The blob object and the data are allocated in a single block
+        EXPECT_EQ(Allocator.NumAllocations, 1);
+        EXPECT_TRUE(pBlob->IsInline());
+        EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), Data.data(), Data.size()), 0);
+
+        pBlob->Resize(10000);
+        EXPECT_EQ(Allocator.NumAllocations, 2);
+        EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), Data.data(), Data.size()), 0);
+    }
+    EXPECT_EQ(Allocator.NumFrees, 2);
+}
+
+TEST(Common_DataBlobImpl, Recycle)
+{
+    const void* pObject = nullptr;
+    {
+        RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create(64);
+        pObject                           = pBlob.RawPtr();
+    }
+
+    // The memory block must be reused from the pool
+    RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create(32);
+    EXPECT_EQ(pBlob.RawPtr(), pObject);
+
+    pBlob.Release();
+    DataBlobImpl::ReleasePooledMemory();
+}
+
+TEST(Common_DataBlobImpl, WeakReference)
+{
+    RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create(64);
+    RefCntWeakPtr<IDataBlob>    pWeakBlob{pBlob};
+    EXPECT_TRUE(pWeakBlob.Lock());
+
+    pBlob.Release();
+    EXPECT_FALSE(pWeakBlob.Lock());
+}
+
+TEST(Common_DataBlobImpl, Multithreading)
+{
+    constexpr size_t NumThreads    = 4;
+    constexpr size_t NumIterations = 1000;
+
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([t]() {
+            std::vector<RefCntAutoPtr<DataBlobImpl>> Blobs;
+            for (size_t i = 0; i < NumIterations; ++i)
+            {
+                const size_t Size = (i * 37 + t * 1013) % 5000;
+                Blobs.emplace_back(DataBlobImpl::Create(Size));
+                if (Size > 0)
+                    std::memset(Blobs.back()->GetDataPtr(), static_cast<int>(t), Size);
+                if (Blobs.size() > 16)
+                    Blobs.erase(Blobs.begin(), Blobs.begin() + 8);
+            }
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+}
+
+} // namespace
@@ -27,10 +27,15 @@
 #include "ImageTools.h"
 
 #include <cmath>
+#include <algorithm>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include <array>
 
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
+
 using namespace Diligent;
 
 namespace
@@ -243,4 +248,150 @@ TEST(Common_ImageTools, ComputeImageDifference)
     }
 }
 
+// Straightforward per-pixel reference implementation
+void ComputeImageDifferenceRef(const ComputeImageDifferenceAttribs& Attribs, ImageDiffInfo& Diff, std::vector<Uint8>& DiffImage)
+{
+    Diff = {};
+
+    const Uint32 NumSrcChannels  = std::min(Attribs.NumChannels1, Attribs.NumChannels2);
+    const Uint32 NumDiffChannels = Attribs.NumDiffChannels != 0 ? Attribs.NumDiffChannels : NumSrcChannels;
+    DiffImage.resize(size_t{Attribs.DiffStride} * Attribs.Height);
+
+    Uint64 SumDiff   = 0;
+    Uint64 SumSqDiff = 0;
+    for (Uint32 y = 0; y < Attribs.Height; ++y)
+    {
+        for (Uint32 x = 0; x < Attribs.Width; ++x)
+        {
+            const Uint8* pPixel1 = static_cast<const Uint8*>(Attribs.pImage1) + y * Attribs.Stride1 + x * Attribs.NumChannels1;
+            const Uint8* pPixel2 = static_cast<const Uint8*>(Attribs.pImage2) + y * Attribs.Stride2 + x * Attribs.NumChannels2;
+            Uint8*       pDiff   = &DiffImage[y * Attribs.DiffStride + x * NumDiffChannels];
+
+            Uint32 PixelDiff = 0;
+            for (Uint32 c = 0; c < NumDiffChannels; ++c)
+            {
+                if (c < NumSrcChannels)
+                {
+                    const Uint32 ChannelDiff = static_cast<Uint32>(std::abs(int{pPixel1[c]} - int{pPixel2[c]}));
+                    pDiff[c]                 = static_cast<Uint8>(std::min(ChannelDiff * Attribs.Scale, 255.f));
+                }
+                else
+                {
+                    pDiff[c] = c == 3 ? 255 : 0;
+                }
+            }
+            for (Uint32 c = 0; c < NumSrcChannels; ++c)
+                PixelDiff = std::max(PixelDiff, static_cast<Uint32>(std::abs(int{pPixel1[c]} - int{pPixel2[c]})));
+
+            if (PixelDiff != 0)
+            {
+                ++Diff.NumDiffPixels;
+                if (PixelDiff > Attribs.Threshold)
+                    ++Diff.NumDiffPixelsAboveThreshold;
+                Diff.MaxDiff = std::max(Diff.MaxDiff, PixelDiff);
+                SumDiff += PixelDiff;
+                SumSqDiff += PixelDiff * PixelDiff;
+            }
+        }
+    }
+
+    if (Diff.NumDiffPixels > 0)
+    {
+        Diff.AvgDiff = static_cast<float>(static_cast<double>(SumDiff) / Diff.NumDiffPixels);
+        Diff.RmsDiff = static_cast<float>(std::sqrt(static_cast<double>(SumSqDiff) / Diff.NumDiffPixels));
+    }
+}
+
+TEST(Common_ImageTools, ComputeImageDifferenceLarge)
+{
+    auto pThreadPool  = CreateThreadPool(ThreadPoolCreateInfo{4});
+    auto pNoThreadsTP = CreateThreadPool(ThreadPoolCreateInfo{0});
+
+    FastRandInt Rnd{0, 0, 255};
+    // Make most pixels equal and some channels differ by a small or large amount
+    FastRandInt DiffRnd{1, 0, 15};
+
+    auto TestImage = [&](Uint32 Width, Uint32 Height, Uint32 NumChannels1, Uint32 NumChannels2, Uint32 NumDiffChannels, float Scale) {
+        const Uint32 Stride1 = Width * NumChannels1 + 7;
+        const Uint32 Stride2 = Width * NumChannels2 + 3;
+
+        std::vector<Uint8> Image1(size_t{Stride1} * Height);
+        std::vector<Uint8> Image2(size_t{Stride2} * Height);
+        for (Uint32 y = 0; y < Height; ++y)
+        {
+            for (Uint32 x = 0; x < Width; ++x)
+            {
+                for (Uint32 c = 0; c < std::max(NumChannels1, NumChannels2); ++c)
+                {
+                    const Uint8 Val  = static_cast<Uint8>(Rnd());
+                    const int   Mode = DiffRnd();
+                    Uint8       Val2 = Val;
+                    if (Mode == 0)
+                        Val2 = static_cast<Uint8>(Rnd());
+                    else if (Mode == 1)
+                        Val2 = static_cast<Uint8>(std::min(Val + 3, 255));
+                    if (c < NumChannels1)
+                        Image1[y * Stride1 + x * NumChannels1 + c] = Val;
+                    if (c < NumChannels2)
+                        Image2[y * Stride2 + x * NumChannels2 + c] = Val2;
+                }
+            }
+        }
+
+        ComputeImageDifferenceAttribs Attribs;
+        Attribs.Width           = Width;
+        Attribs.Height          = Height;
+        Attribs.pImage1         = Image1.data();
+        Attribs.NumChannels1    = NumChannels1;
+        Attribs.Stride1         = Stride1;
+        Attribs.pImage2         = Image2.data();
+        Attribs.NumChannels2    = NumChannels2;
+        Attribs.Stride2         = Stride2;
+        Attribs.Threshold       = 8;
+        Attribs.NumDiffChannels = NumDiffChannels;
+        Attribs.DiffStride      = Width * (NumDiffChannels != 0 ? NumDiffChannels : std::min(NumChannels1, NumChannels2));
+        Attribs.Scale           = Scale;
+
+        ImageDiffInfo      RefDiff;
+        std::vector<Uint8> RefDiffImage;
+        ComputeImageDifferenceRef(Attribs, RefDiff, RefDiffImage);
+
+        for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr(), pNoThreadsTP.RawPtr()})
+        {
+            Attribs.pThreadPool = pPool;
+
+            std::vector<Uint8> DiffImage(RefDiffImage.size());
+            for (bool WriteDiffImage : {false, true})
+            {
+                Attribs.pDiffImage = WriteDiffImage ? DiffImage.data() : nullptr;
+
+                ImageDiffInfo Diff;
+                ComputeImageDifference(Attribs, Diff);
+                EXPECT_EQ(Diff.NumDiffPixels, RefDiff.NumDiffPixels);
+                EXPECT_EQ(Diff.NumDiffPixelsAboveThreshold, RefDiff.NumDiffPixelsAboveThreshold);
+                EXPECT_EQ(Diff.MaxDiff, RefDiff.MaxDiff);
+                // Results must be bit-identical regardless of the code path
+                EXPECT_EQ(Diff.AvgDiff, RefDiff.AvgDiff);
+                EXPECT_EQ(Diff.RmsDiff, RefDiff.RmsDiff);
+                if (WriteDiffImage)
+                {
+                    EXPECT_EQ(DiffImage, RefDiffImage);
+                }
+            }
+        }
+    };
+
+    TestImage(256, 256, 4, 4, 0, 1.f);
+    TestImage(253, 131, 4, 4, 0, 1.f);
+    TestImage(253, 131, 4, 4, 4, 3.5f);
+    TestImage(61, 97, 4, 4, 0, 0.75f);
+    TestImage(7, 67, 4, 4, 0, 1.f);
+    TestImage(190, 77, 3, 3, 4, 2.f);
+    TestImage(190, 77, 4, 3, 0, 1.f);
+    TestImage(190, 77, 4, 4, 3, 1.f);
+    TestImage(190, 77, 1, 4, 4, 1.f);
+
+    pNoThreadsTP->StopThreads();
+}
+
 } // namespace
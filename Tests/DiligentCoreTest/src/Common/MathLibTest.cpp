@@ -30,6 +30,8 @@
 
 #include "BasicMath.hpp"
 #include "AdvancedMath.hpp"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
 
 #include "gtest/gtest.h"
 
@@ -2904,6 +2906,95 @@ TEST(Common_AdvancedMath, GetOrientedBoxVisibilityAgainstPlane)
     }
 }
 
+TEST(Common_AdvancedMath, GetBoxVisibilityBatch)
+{
+    const float4x4 View = float4x4::RotationY(0.3f) * float4x4::RotationX(-0.2f) * float4x4::Translation(1, -2, 30);
+    const float4x4 Proj = float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 100.f, false);
+
+    ViewFrustumExt Frustum;
+    ExtractViewFrustumPlanesFromMatrix(View * Proj, Frustum, false);
+
+    FastRandFloat    RndPos{0, -80, +80};
+    FastRandFloat    RndSize{1, 0.1f, 20.f};
+    BoundBoxArraySoA Boxes;
+    for (size_t i = 0; i < 10003; ++i)
+    {
+        const float3 Pos{RndPos(), RndPos(), RndPos() + 40.f};
+        const float3 Size{RndSize(), RndSize(), RndSize()};
+        Boxes.Add(BoundBox{Pos, Pos + Size});
+    }
+    EXPECT_EQ(Boxes.GetSize(), size_t{10003});
+    EXPECT_EQ(Boxes.Get(10), (BoundBox{float3{Boxes.MinX[10], Boxes.MinY[10], Boxes.MinZ[10]}, float3{Boxes.MaxX[10], Boxes.MaxY[10], Boxes.MaxZ[10]}}));
+
+    auto pThreadPool  = CreateThreadPool(ThreadPoolCreateInfo{4});
+    auto pNoThreadsTP = CreateThreadPool(ThreadPoolCreateInfo{0});
+
+    auto Test = [&](size_t NumBoxes, FRUSTUM_PLANE_FLAGS PlaneFlags, bool UseExt, IThreadPool* pPool, bool RequestFullyVisible) {
+        BoundBoxArraySoA TestBoxes = Boxes;
+        TestBoxes.Resize(NumBoxes);
+
+        const size_t        NumMaskElements = (NumBoxes + 31) / 32;
+        std::vector<Uint32> VisibleMask(NumMaskElements, 0xDEADBEEF);
+        std::vector<Uint32> FullyVisibleMask(NumMaskElements, 0xDEADBEEF);
+        Uint32*             pFullyVisibleMask = RequestFullyVisible ? FullyVisibleMask.data() : nullptr;
+
+        const Uint32 NumVisible = UseExt ?
+            GetBoxVisibilityBatch(Frustum, TestBoxes, VisibleMask.data(), pFullyVisibleMask, PlaneFlags, pPool) :
+            GetBoxVisibilityBatch(static_cast<const ViewFrustum&>(Frustum), TestBoxes, VisibleMask.data(), pFullyVisibleMask, PlaneFlags, pPool);
+
+        Uint32 RefNumVisible = 0;
+        for (size_t i = 0; i < NumMaskElements * 32; ++i)
+        {
+            const bool IsVisible      = (VisibleMask[i / 32] & (1u << (i % 32))) != 0;
+            const bool IsFullyVisible = (FullyVisibleMask[i / 32] & (1u << (i % 32))) != 0;
+            if (i >= NumBoxes)
+            {
+                EXPECT_FALSE(IsVisible) << "Bits beyond the number of boxes must be zero";
+                if (RequestFullyVisible)
+                {
+                    EXPECT_FALSE(IsFullyVisible) << "Bits beyond the number of boxes must be zero";
+                }
+                continue;
+            }
+
+            const BoxVisibility RefVisibility = UseExt ?
+                GetBoxVisibility(Frustum, TestBoxes.Get(i), PlaneFlags) :
+                GetBoxVisibility(static_cast<const ViewFrustum&>(Frustum), TestBoxes.Get(i), PlaneFlags);
+            if (RefVisibility != BoxVisibility::Invisible)
+                ++RefNumVisible;
+
+            EXPECT_EQ(IsVisible, RefVisibility != BoxVisibility::Invisible) << "Box " << i;
+            if (RequestFullyVisible)
+            {
+                EXPECT_EQ(IsFullyVisible, RefVisibility == BoxVisibility::FullyVisible) << "Box " << i;
+            }
+        }
+        EXPECT_EQ(NumVisible, RefNumVisible);
+    };
+
+    for (size_t NumBoxes : {0, 1, 3, 4, 7, 8, 9, 31, 32, 33, 100, 10003})
+    {
+        for (FRUSTUM_PLANE_FLAGS PlaneFlags : {FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, FRUSTUM_PLANE_FLAG_OPEN_NEAR, FRUSTUM_PLANE_FLAG_LEFT_PLANE, FRUSTUM_PLANE_FLAG_NONE})
+        {
+            for (bool UseExt : {false, true})
+            {
+                Test(NumBoxes, PlaneFlags, UseExt, nullptr, true);
+                Test(NumBoxes, PlaneFlags, UseExt, nullptr, false);
+            }
+        }
+    }
+
+    for (IThreadPool* pPool : {pThreadPool.RawPtr(), pNoThreadsTP.RawPtr()})
+    {
+        for (size_t NumBoxes : {100, 4097, 10003})
+        {
+            Test(NumBoxes, FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, true, pPool, true);
+            Test(NumBoxes, FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, true, pPool, false);
+            Test(NumBoxes, FRUSTUM_PLANE_FLAG_OPEN_NEAR, false, pPool, true);
+        }
+    }
+}
+
 TEST(Common_AdvancedMath, GetPointToBoxDistance)
 {
     BoundBox Box{float3{1, 2, 3}, float3{4, 5, 6}};
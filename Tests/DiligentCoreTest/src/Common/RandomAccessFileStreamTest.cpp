@@ -0,0 +1,322 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "RandomAccessFileStream.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "DataBlobImpl.hpp"
+#include "TempDirectory.hpp"
+
+#if PLATFORM_LINUX
+#    include "LinuxFileIO.hpp"
+#endif
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+std::vector<Uint8> CreateTestFile(const std::string& Path, size_t Size)
+{
+    std::vector<Uint8> Data(Size);
+    for (size_t i = 0; i < Size; ++i)
+        Data[i] = static_cast<Uint8>((i * 31) ^ (i >> 8));
+
+    FileWrapper File{Path.c_str(), EFileAccessMode::Overwrite};
+    EXPECT_TRUE(File);
+    if (File)
+    {
+        EXPECT_TRUE(File->Write(Data.data(), Data.size()));
+    }
+
+    return Data;
+}
+
+TEST(Common_RandomAccessFileStream, ReadAt)
+{
+    TempDirectory      TmpDir;
+    const std::string  FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "ReadAt.bin";
+    std::vector<Uint8> RefData  = CreateTestFile(FilePath, 100000);
+
+    RefCntAutoPtr<RandomAccessFileStream> pStream = RandomAccessFileStream::Create(FilePath.c_str());
+    ASSERT_TRUE(pStream);
+    ASSERT_TRUE(pStream->IsValid());
+    EXPECT_EQ(pStream->GetSize(), RefData.size());
+
+    RefCntAutoPtr<IRandomAccessFileStream> pRAStream{pStream, IID_RandomAccessFileStream};
+    EXPECT_TRUE(pRAStream);
+    RefCntAutoPtr<IFileStream> pFileStream{pStream, IID_FileStream};
+    EXPECT_TRUE(pFileStream);
+
+    std::vector<Uint8> Data(1000);
+    EXPECT_TRUE(pStream->ReadAt(12345, Data.data(), Data.size()));
+    EXPECT_EQ(std::memcmp(Data.data(), &RefData[12345], Data.size()), 0);
+    EXPECT_EQ(pStream->GetPos(), size_t{0});
+
+    // Reading past the end of the file must fail
+    EXPECT_FALSE(pStream->ReadAt(RefData.size() - 10, Data.data(), 20));
+
+    // Sequential reads
+    EXPECT_TRUE(pStream->SetPos(500, static_cast<int>(FilePosOrigin::Start)));
+    EXPECT_TRUE(pStream->Read(Data.data(), 100));
+    EXPECT_EQ(std::memcmp(Data.data(), &RefData[500], 100), 0);
+    EXPECT_EQ(pStream->GetPos(), size_t{600});
+
+    RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create();
+    pStream->ReadBlob(pBlob);
+    ASSERT_EQ(pBlob->GetSize(), RefData.size() - 600);
+    EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), &RefData[600], pBlob->GetSize()), 0);
+}
+
+TEST(Common_RandomAccessFileStream, MapData)
+{
+    TempDirectory      TmpDir;
+    const std::string  FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "MapData.bin";
+    std::vector<Uint8> RefData  = CreateTestFile(FilePath, 70000);
+
+    RefCntAutoPtr<RandomAccessFileStream> pStream = RandomAccessFileStream::Create(FilePath.c_str());
+    ASSERT_TRUE(pStream);
+
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+        EXPECT_TRUE(pStream->MapData(0, 0, FILE_ACCESS_HINT_SEQUENTIAL, &pData));
+        ASSERT_TRUE(pData);
+        ASSERT_EQ(pData->GetSize(), RefData.size());
+        EXPECT_EQ(std::memcmp(pData->GetConstDataPtr(), RefData.data(), RefData.size()), 0);
+    }
+
+    {
+        // Offset that is not aligned to the page size
+        RefCntAutoPtr<IDataBlob> pData;
+        EXPECT_TRUE(pStream->MapData(4099, 10000, FILE_ACCESS_HINT_RANDOM, &pData));
+        ASSERT_TRUE(pData);
+        ASSERT_EQ(pData->GetSize(), size_t{10000});
+        EXPECT_EQ(std::memcmp(pData->GetConstDataPtr(), &RefData[4099], 10000), 0);
+
+        // The mapping must stay valid after the stream is released
+        pStream.Release();
+        EXPECT_EQ(std::memcmp(pData->GetConstDataPtr(), &RefData[4099], 10000), 0);
+    }
+}
+
+TEST(Common_RandomAccessFileStream, EnqueueReads)
+{
+    TempDirectory      TmpDir;
+    const std::string  FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "EnqueueReads.bin";
+    std::vector<Uint8> RefData  = CreateTestFile(FilePath, 1 << 20);
+
+    RefCntAutoPtr<RandomAccessFileStream> pStream = RandomAccessFileStream::Create(FilePath.c_str());
+    ASSERT_TRUE(pStream);
+
+    constexpr Uint32 NumRequests = 200;
+    constexpr size_t RequestSize = 5000;
+
+    std::vector<Uint8>           Data(NumRequests * RequestSize);
+    std::vector<FileReadRequest> Requests(NumRequests);
+
+    std::atomic<Uint32> NumCompleted{0};
+    for (Uint32 i = 0; i < NumRequests; ++i)
+    {
+        FileReadRequest& Req = Requests[i];
+
+        Req.Offset            = (static_cast<size_t>(i) * 7919 * 13) % (RefData.size() - RequestSize);
+        Req.Size              = RequestSize;
+        Req.pData             = &Data[i * RequestSize];
+        Req.pCallbackUserData = &NumCompleted;
+        Req.Callback          = [](bool Success, size_t BytesRead, void* pUserData) {
+            EXPECT_TRUE(Success);
+            EXPECT_GT(BytesRead, size_t{0});
+            static_cast<std::atomic<Uint32>*>(pUserData)->fetch_add(1);
+        };
+    }
+
+    // Enqueue in two batches
+    pStream->EnqueueReads(Requests.data(), NumRequests / 2);
+    pStream->EnqueueReads(Requests.data() + NumRequests / 2, NumRequests - NumRequests / 2);
+    EXPECT_TRUE(pStream->WaitForReads());
+    EXPECT_EQ(NumCompleted.load(), NumRequests);
+
+    for (Uint32 i = 0; i < NumRequests; ++i)
+    {
+        EXPECT_EQ(std::memcmp(&Data[i * RequestSize], &RefData[Requests[i].Offset], RequestSize), 0) << "Request " << i;
+    }
+
+    // Read past the end of the file
+    FileReadRequest BadReq;
+    BadReq.Offset = RefData.size() - 10;
+    BadReq.Size   = 100;
+    BadReq.pData  = Data.data();
+    pStream->EnqueueReads(&BadReq, 1);
+    EXPECT_FALSE(pStream->WaitForReads());
+    // The error state is reset
+    EXPECT_TRUE(pStream->WaitForReads());
+}
+
+#if PLATFORM_LINUX
+TEST(Common_RandomAccessFileStream, LinuxAsyncFileReader)
+{
+    TempDirectory      TmpDir;
+    const std::string  FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "AsyncReader.bin";
+    std::vector<Uint8> RefData  = CreateTestFile(FilePath, 1 << 18);
+
+    LinuxNativeFile File{FilePath.c_str()};
+    ASSERT_TRUE(File.IsValid());
+
+    for (bool UseIoUring : {true, false})
+    {
+        LinuxAsyncFileReader::CreateInfo CI;
+        CI.QueueDepth = 4; // Small queue depth to test blocking on a full queue
+        CI.UseIoUring = UseIoUring;
+        LinuxAsyncFileReader Reader{CI};
+        if (!UseIoUring)
+        {
+            EXPECT_FALSE(Reader.IsUsingIoUring());
+        }
+
+        constexpr size_t NumRequests = 64;
+        const size_t     RequestSize = RefData.size() / NumRequests;
+
+        std::vector<Uint8>                         Data(RefData.size());
+        std::vector<LinuxAsyncFileReader::Request> Requests(NumRequests);
+        for (size_t i = 0; i < NumRequests; ++i)
+        {
+            Requests[i].Fd     = File.GetDescriptor();
+            Requests[i].Offset = i * RequestSize;
+            Requests[i].Size   = RequestSize;
+            Requests[i].pData  = &Data[i * RequestSize];
+        }
+        Reader.Enqueue(Requests.data(), Requests.size());
+        EXPECT_TRUE(Reader.WaitForIdle());
+        EXPECT_EQ(Data, RefData);
+    }
+}
+
+TEST(Common_RandomAccessFileStream, LinuxAsyncFileReader_EnqueueFromCallback)
+{
+    TempDirectory      TmpDir;
+    const std::string  FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "AsyncReaderCallback.bin";
+    std::vector<Uint8> RefData  = CreateTestFile(FilePath, 1 << 16);
+
+    LinuxNativeFile File{FilePath.c_str()};
+    ASSERT_TRUE(File.IsValid());
+
+    for (bool UseIoUring : {true, false})
+    {
+        LinuxAsyncFileReader::CreateInfo CI;
+        CI.QueueDepth = 2;
+        CI.UseIoUring = UseIoUring;
+        LinuxAsyncFileReader Reader{CI};
+
+        constexpr size_t NumRequests = 16;
+        const size_t     RequestSize = RefData.size() / NumRequests;
+
+        struct CallbackData
+        {
+            LinuxAsyncFileReader*                       pReader    = nullptr;
+            std::vector<LinuxAsyncFileReader::Request>* pFollowUps = nullptr;
+        };
+        std::vector<Uint8>                         Data(RefData.size());
+        std::vector<LinuxAsyncFileReader::Request> Requests(NumRequests);
+        for (size_t i = 0; i < NumRequests; ++i)
+        {
+            Requests[i].Fd     = File.GetDescriptor();
+            Requests[i].Offset = i * RequestSize;
+            Requests[i].Size   = RequestSize;
+            Requests[i].pData  = &Data[i * RequestSize];
+        }
+        // The first requests fill the queue, and their callbacks enqueue the rest while it is still full
+        std::vector<LinuxAsyncFileReader::Request> FollowUps{Requests.begin() + CI.QueueDepth, Requests.end()};
+        CallbackData                               CbData{&Reader, &FollowUps};
+        for (size_t i = 0; i < CI.QueueDepth; ++i)
+        {
+            Requests[i].pUserData = &CbData;
+            Requests[i].Callback  = [](bool Success, size_t BytesRead, void* pUserData) {
+                EXPECT_TRUE(Success);
+                CallbackData& CbData = *static_cast<CallbackData*>(pUserData);
+                // Only the first callback enqueues the requests
+                std::vector<LinuxAsyncFileReader::Request> FollowUps;
+                std::swap(FollowUps, *CbData.pFollowUps);
+                CbData.pReader->Enqueue(FollowUps.data(), FollowUps.size());
+            };
+        }
+        Reader.Enqueue(Requests.data(), CI.QueueDepth);
+        EXPECT_TRUE(Reader.WaitForIdle());
+        EXPECT_EQ(Data, RefData);
+    }
+}
+#endif
+
+TEST(Common_RandomAccessFileStream, EnqueueReads_MultipleStreams)
+{
+    TempDirectory      TmpDir;
+    const std::string  FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "MultipleStreams.bin";
+    std::vector<Uint8> RefData  = CreateTestFile(FilePath, 1 << 16);
+
+    RefCntAutoPtr<RandomAccessFileStream> pStream0 = RandomAccessFileStream::Create(FilePath.c_str());
+    RefCntAutoPtr<RandomAccessFileStream> pStream1 = RandomAccessFileStream::Create(FilePath.c_str());
+    ASSERT_TRUE(pStream0 && pStream1);
+
+    std::vector<Uint8> Data0(RefData.size() / 2);
+    std::vector<Uint8> Data1(RefData.size() / 2);
+
+    FileReadRequest Req0;
+    Req0.Size  = Data0.size();
+    Req0.pData = Data0.data();
+
+    FileReadRequest Req1;
+    Req1.Offset = Data0.size();
+    Req1.Size   = Data1.size();
+    Req1.pData  = Data1.data();
+
+    // Read past the end of the file
+    FileReadRequest BadReq;
+    BadReq.Offset = RefData.size() - 10;
+    BadReq.Size   = 100;
+    BadReq.pData  = Data1.data();
+
+    pStream0->EnqueueReads(&Req0, 1);
+    pStream1->EnqueueReads(&BadReq, 1);
+    // Errors are reported per stream
+    EXPECT_TRUE(pStream0->WaitForReads());
+    EXPECT_FALSE(pStream1->WaitForReads());
+    EXPECT_EQ(std::memcmp(Data0.data(), RefData.data(), Data0.size()), 0);
+
+    pStream1->EnqueueReads(&Req1, 1);
+    // Releasing the stream waits for its reads
+    pStream1.Release();
+    EXPECT_EQ(std::memcmp(Data1.data(), &RefData[Data0.size()], Data1.size()), 0);
+}
+
+} // namespace
@@ -25,9 +25,12 @@
  */
 
 #include <cstring>
+#include <vector>
 
 #include "Serializer.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
+#include "MemoryFileStream.hpp"
+#include "DataBlobImpl.hpp"
 
 #include "gtest/gtest.h"
 
@@ -172,4 +175,116 @@ TEST(SerializerTest, SerializerTest)
     }
 }
 
+TEST(SerializerTest, ChunkedSerializer)
+{
+    auto& RawAllocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    std::vector<Uint8> RefBytes(300);
+    for (size_t i = 0; i < RefBytes.size(); ++i)
+        RefBytes[i] = static_cast<Uint8>(i * 7 + 3);
+
+    constexpr Uint32 NumItems = 64;
+
+    const auto WriteData = [&](auto& Ser) {
+        for (Uint32 i = 0; i < NumItems; ++i)
+        {
+            const Uint8  U8  = static_cast<Uint8>(i);
+            const Uint64 U64 = 0x0102030405060708ull * i;
+            const char*  Str = (i % 3) == 0 ? "chunked serializer test string" : "";
+            // Item sizes vary from 0 to 299 bytes, many are larger than the chunk size
+            const size_t NumBytes = (i * 37) % RefBytes.size();
+            EXPECT_TRUE(Ser(U8, U64, Str, i));
+            EXPECT_TRUE(Ser.SerializeBytes(RefBytes.data(), NumBytes, (i % 2) == 0 ? 8 : 16));
+        }
+    };
+
+    const auto ReadData = [&](auto& Ser) {
+        for (Uint32 i = 0; i < NumItems; ++i)
+        {
+            Uint8       U8  = 0;
+            Uint64      U64 = 0;
+            const char* Str = nullptr;
+            Uint32      Idx = 0;
+            EXPECT_TRUE(Ser(U8, U64, Str, Idx));
+            EXPECT_EQ(U8, static_cast<Uint8>(i));
+            EXPECT_EQ(U64, 0x0102030405060708ull * i);
+            EXPECT_STREQ(Str, (i % 3) == 0 ? "chunked serializer test string" : "");
+            EXPECT_EQ(Idx, i);
+
+            const size_t Alignment = (i % 2) == 0 ? 8 : 16;
+            size_t       NumBytes  = 0;
+            const void*  pBytes    = nullptr;
+            EXPECT_TRUE(Ser.SerializeBytes(pBytes, NumBytes, Alignment));
+            EXPECT_EQ(NumBytes, (i * 37) % RefBytes.size());
+            EXPECT_EQ(reinterpret_cast<size_t>(pBytes) % Alignment, size_t{0});
+            if (NumBytes > 0)
+            {
+                EXPECT_EQ(std::memcmp(pBytes, RefBytes.data(), NumBytes), 0);
+            }
+        }
+    };
+
+    // Reference contiguous data
+    Serializer<SerializerMode::Measure> MSer;
+    WriteData(MSer);
+    SerializedData RefData = MSer.AllocateData(RawAllocator);
+    {
+        Serializer<SerializerMode::Write> WSer{RefData};
+        WriteData(WSer);
+        EXPECT_TRUE(WSer.IsEnded());
+    }
+
+    for (size_t ChunkSize : {16, 50, 256, 4096})
+    {
+        SerializedDataChunks Chunks{RawAllocator, ChunkSize};
+        // Write the data twice to test chunk reuse
+        for (Uint32 pass = 0; pass < 2; ++pass)
+        {
+            Chunks.Clear();
+            {
+                Serializer<SerializerMode::Write> WSer{Chunks};
+                WriteData(WSer);
+            }
+            EXPECT_EQ(Chunks.GetSize(), RefData.Size());
+            if (ChunkSize < RefData.Size())
+            {
+                EXPECT_GT(Chunks.GetNumChunks(), size_t{1});
+            }
+
+            SerializedData Flattened = Chunks.Flatten(RawAllocator);
+            EXPECT_TRUE(Flattened == RefData);
+
+            {
+                Serializer<SerializerMode::Read> RSer{Chunks};
+                ReadData(RSer);
+                EXPECT_TRUE(RSer.IsEnded());
+                EXPECT_EQ(RSer.GetRemainingSize(), size_t{0});
+            }
+
+            {
+                Serializer<SerializerMode::Read> RSer{Flattened};
+                ReadData(RSer);
+                EXPECT_TRUE(RSer.IsEnded());
+            }
+        }
+
+        // Stream the data
+        {
+            RefCntAutoPtr<DataBlobImpl>     pBlob   = DataBlobImpl::Create(size_t{0});
+            RefCntAutoPtr<MemoryFileStream> pStream = MemoryFileStream::Create(pBlob);
+
+            SerializedDataChunks StreamChunks{RawAllocator, ChunkSize, pStream};
+            {
+                Serializer<SerializerMode::Write> WSer{StreamChunks};
+                WriteData(WSer);
+            }
+            EXPECT_TRUE(StreamChunks.IsStreamValid());
+            EXPECT_EQ(StreamChunks.GetNumChunks(), size_t{0});
+            EXPECT_EQ(StreamChunks.GetSize(), RefData.Size());
+            ASSERT_EQ(pBlob->GetSize(), RefData.Size());
+            EXPECT_EQ(std::memcmp(pBlob->GetConstDataPtr(), RefData.Ptr(), RefData.Size()), 0);
+        }
+    }
+}
+
 } // namespace
@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "StageTimings.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class StageTimingsTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        StageTimings::Get().Reset();
+    }
+
+    void TearDown() override
+    {
+        StageTimings::Get().Enable(false);
+        StageTimings::Get().Reset();
+    }
+};
+
+TEST_F(StageTimingsTest, Disabled)
+{
+    {
+        ScopedStageTimer Timer{0u};
+    }
+    EXPECT_EQ(StageTimings::Get().GetStats(0).Count, Uint64{0});
+}
+
+TEST_F(StageTimingsTest, Stats)
+{
+    StageTimings& Timings = StageTimings::Get();
+    Timings.Enable(true);
+
+    Timings.Record(1, 1000, 1500);           // 0.5 us
+    Timings.Record(1, 1000, 11000);          // 10 us
+    Timings.Record(1, 5000, 5000 + 3000000); // 3 ms
+
+    const StageTimings::StageStats Stats = Timings.GetStats(1);
+    EXPECT_EQ(Stats.Count, Uint64{3});
+    EXPECT_EQ(Stats.TotalNs, Uint64{500 + 10000 + 3000000});
+    EXPECT_EQ(Stats.MinNs, Uint64{500});
+    EXPECT_EQ(Stats.MaxNs, Uint64{3000000});
+
+    EXPECT_EQ(Stats.Histogram[0], Uint64{1});  // [0, 2) us
+    EXPECT_EQ(Stats.Histogram[3], Uint64{1});  // [8, 16) us
+    EXPECT_EQ(Stats.Histogram[11], Uint64{1}); // [2048, 4096) us
+
+    EXPECT_EQ(Timings.GetStats(0).Count, Uint64{0});
+
+    {
+        ScopedStageTimer Timer{0u};
+        // The stage may be changed before the timer is destroyed
+        Timer.SetStage(2u);
+    }
+    EXPECT_EQ(Timings.GetStats(0).Count, Uint64{0});
+    EXPECT_EQ(Timings.GetStats(2).Count, Uint64{1});
+
+    Timings.Reset();
+    EXPECT_EQ(Timings.GetStats(1).Count, Uint64{0});
+    EXPECT_EQ(Timings.GetStats(1).MinNs, Uint64{0});
+}
+
+TEST_F(StageTimingsTest, ChromeTrace)
+{
+    StageTimings& Timings = StageTimings::Get();
+
+    Timings.Enable(true, /*RecordTrace = */ false);
+    Timings.Record(0, 0, 1000);
+    EXPECT_EQ(Timings.GetChromeTrace(nullptr, 0).find("\"ph\""), std::string::npos);
+
+    Timings.Enable(true, /*RecordTrace = */ true);
+    Timings.Record(0, 2000, 3500);
+    Timings.Record(5, 4000, 4100);
+
+    const char*       StageNames[] = {"Compile \"main\""};
+    const std::string Trace        = Timings.GetChromeTrace(StageNames, 1);
+
+    EXPECT_EQ(Trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), size_t{0}) << Trace;
+    EXPECT_NE(Trace.find("\"name\":\"Compile \\\"main\\\"\""), std::string::npos) << Trace;
+    EXPECT_NE(Trace.find("\"ts\":2.0,\"dur\":1.5}"), std::string::npos) << Trace;
+    EXPECT_NE(Trace.find("\"name\":\"Stage 5\""), std::string::npos) << Trace;
+    EXPECT_NE(Trace.find("\"ts\":4.0,\"dur\":0.1}"), std::string::npos) << Trace;
+    EXPECT_EQ(Timings.GetNumDroppedTraceEvents(), size_t{0});
+}
+
+TEST_F(StageTimingsTest, Multithreading)
+{
+    StageTimings& Timings = StageTimings::Get();
+    Timings.Enable(true, /*RecordTrace = */ true);
+
+    static constexpr Uint32  NumThreads    = 4;
+    static constexpr Uint32  NumIterations = 1000;
+    static constexpr Uint32  NumUsedStages = 3;
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([]() {
+            for (Uint32 i = 0; i < NumIterations; ++i)
+            {
+                ScopedStageTimer Timer{i % NumUsedStages};
+            }
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    Uint64 TotalCount = 0;
+    for (Uint32 Stage = 0; Stage < NumUsedStages; ++Stage)
+    {
+        const StageTimings::StageStats Stats = Timings.GetStats(Stage);
+
+        Uint64 HistogramCount = 0;
+        for (Uint64 Count : Stats.Histogram)
+            HistogramCount += Count;
+        EXPECT_EQ(HistogramCount, Stats.Count);
+        EXPECT_LE(Stats.MinNs, Stats.MaxNs);
+        TotalCount += Stats.Count;
+    }
+    EXPECT_EQ(TotalCount, Uint64{NumThreads * NumIterations});
+}
+
+} // namespace
@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "StringAtomTable.hpp"
+
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_StringAtomTable, Intern)
+{
+    StringAtomTable Table{DefaultRawMemoryAllocator::GetAllocator()};
+
+    EXPECT_FALSE(Table.Intern(static_cast<const Char*>(nullptr)));
+    EXPECT_FALSE(Table.Find("g_Texture"));
+
+    const std::string Name0{"g_Texture"};
+    const std::string Name1{"g_Texture"};
+
+    const StringAtom Atom0 = Table.Intern(Name0);
+    const StringAtom Atom1 = Table.Intern(Name1.c_str());
+    const StringAtom Atom2 = Table.Intern("g_Buffer");
+    ASSERT_TRUE(Atom0);
+    EXPECT_EQ(Atom0, Atom1);
+    EXPECT_NE(Atom0, Atom2);
+    EXPECT_EQ(Atom0.GetStr(), Atom1.GetStr());
+    EXPECT_NE(Atom0.GetStr(), Name0.c_str());
+    EXPECT_STREQ(Atom0.GetStr(), "g_Texture");
+    EXPECT_EQ(Atom0.GetLength(), Name0.length());
+    EXPECT_EQ(Atom0.GetHash(), HashMapStringKey{"g_Texture"}.GetHash());
+    EXPECT_EQ(Table.Find("g_Texture"), Atom0);
+    EXPECT_EQ(Table.Intern(HashMapStringKey{"g_Buffer"}), Atom2);
+    EXPECT_EQ(Table.GetAtomCount(), size_t{2});
+    EXPECT_GT(Table.GetStorageSize(), size_t{0});
+
+    const StringAtom Empty = Table.Intern("");
+    ASSERT_TRUE(Empty);
+    EXPECT_STREQ(Empty.GetStr(), "");
+}
+
+TEST(Common_StringAtomTable, HashMapKey)
+{
+    StringAtomTable Table{DefaultRawMemoryAllocator::GetAllocator()};
+
+    std::unordered_map<HashMapStringKey, int, HashMapStringKey::Hasher> Map;
+    for (int i = 0; i < 100; ++i)
+        Map.emplace(Table.Intern("Resource" + std::to_string(i)).GetKey(), i);
+
+    // Raw strings and atoms find the same elements
+    for (int i = 0; i < 100; ++i)
+    {
+        const std::string Name = "Resource" + std::to_string(i);
+
+        auto it = Map.find(Name.c_str());
+        ASSERT_NE(it, Map.end());
+        EXPECT_EQ(it->second, i);
+        EXPECT_EQ(Map.find(Table.Find(Name.c_str()).GetKey()), it);
+    }
+
+    std::unordered_map<StringAtom, int, StringAtom::Hasher> AtomMap;
+    AtomMap[Table.Intern("Resource1")] = 1;
+    EXPECT_EQ(AtomMap[Table.Find("Resource1")], 1);
+}
+
+TEST(Common_StringAtomTable, MultithreadedIntern)
+{
+    StringAtomTable Table{DefaultRawMemoryAllocator::GetAllocator()};
+
+    constexpr size_t NumThreads = 8;
+    constexpr size_t NumNames   = 1000;
+
+    std::vector<std::vector<StringAtom>> Atoms(NumThreads);
+    std::vector<std::thread>             Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&Table, &Atoms, t]() {
+            for (size_t i = 0; i < NumNames; ++i)
+                Atoms[t].push_back(Table.Intern("Name" + std::to_string((i + t * 97) % NumNames)));
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(Table.GetAtomCount(), NumNames);
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        for (size_t i = 0; i < NumNames; ++i)
+        {
+            const std::string Name = "Name" + std::to_string((i + t * 97) % NumNames);
+            EXPECT_EQ(Atoms[t][i], Table.Find(Name.c_str()));
+            EXPECT_STREQ(Atoms[t][i].GetStr(), Name.c_str());
+        }
+    }
+}
+
+} // namespace
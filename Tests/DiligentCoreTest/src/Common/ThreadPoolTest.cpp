@@ -30,6 +30,10 @@
 
 #include <array>
 #include <cmath>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "ThreadSignal.hpp"
 
@@ -442,4 +446,112 @@ TEST(Common_ThreadPool, ReRunTasks)
         EXPECT_EQ(ReRunCounters[i], 0) << i;
 }
 
+
+TEST(Common_ThreadPool, ParallelFor)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        for (Uint32 NumItems : {0u, 1u, 7u, 256u})
+        {
+            std::vector<Uint32> Results(NumItems);
+            ParallelFor(pPool, NumItems, [&](Uint32 Index) {
+                Results[Index] = Index * Index;
+            });
+            for (Uint32 i = 0; i < NumItems; ++i)
+                EXPECT_EQ(Results[i], i * i);
+        }
+    }
+
+    // The exception of the first failed item is rethrown
+    std::atomic<Uint32> NumProcessed{0};
+    try
+    {
+        ParallelFor(pThreadPool, 64, [&](Uint32 Index) {
+            NumProcessed.fetch_add(1);
+            if (Index % 10 == 5)
+                throw std::runtime_error{std::to_string(Index)};
+        });
+        ADD_FAILURE() << "Exception was not thrown";
+    }
+    catch (const std::runtime_error& Err)
+    {
+        EXPECT_STREQ(Err.what(), "5");
+    }
+    EXPECT_EQ(NumProcessed.load(), 64u);
+
+    pThreadPool->WaitForAllTasks();
+}
+
+TEST(Common_ThreadPool, ParallelForHelperTasks)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    ASSERT_NE(pThreadPool, nullptr);
+    EXPECT_EQ(pThreadPool->GetThreadCount(), 2u);
+
+    // Keep both workers busy, so that the helper tasks can't start
+    std::atomic<bool> Release{false};
+    for (Uint32 t = 0; t < 2; ++t)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [&](Uint32 ThreadId) {
+                             while (!Release.load())
+                                 std::this_thread::yield();
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+    while (pThreadPool->GetRunningTaskCount() < 2)
+        std::this_thread::yield();
+
+    // The calling thread processes all items, and the helper tasks that never started are removed
+    std::vector<Uint32> Results(256);
+    ParallelFor(pThreadPool, static_cast<Uint32>(Results.size()), [&](Uint32 Index) {
+        Results[Index] = Index + 1;
+    });
+    for (size_t i = 0; i < Results.size(); ++i)
+        EXPECT_EQ(Results[i], i + 1);
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+
+    Release.store(true);
+    pThreadPool->WaitForAllTasks();
+
+    // Without worker threads, the items are processed by the calling thread
+    pThreadPool->StopThreads();
+    EXPECT_EQ(pThreadPool->GetThreadCount(), 0u);
+    Uint32 Sum = 0;
+    ParallelFor(pThreadPool, 16, [&](Uint32 Index) {
+        Sum += Index;
+    });
+    EXPECT_EQ(Sum, 120u);
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+}
+
+TEST(Common_ThreadPool, NestedParallelFor)
+{
+    constexpr Uint32           NumThreads  = 2;
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // All workers wait for nested loops, which must not deadlock
+    constexpr Uint32                               NumOuterTasks = NumThreads * 2;
+    constexpr Uint32                               NumItems      = 32;
+    std::array<std::atomic<Uint32>, NumOuterTasks> Sums{};
+    for (Uint32 t = 0; t < NumOuterTasks; ++t)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [&, t](Uint32 ThreadId) {
+                             ParallelFor(pThreadPool, NumItems, [&](Uint32 Index) {
+                                 Sums[t].fetch_add(Index + 1);
+                             });
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+    pThreadPool->WaitForAllTasks();
+
+    for (const std::atomic<Uint32>& Sum : Sums)
+        EXPECT_EQ(Sum.load(), NumItems * (NumItems + 1) / 2);
+}
+
 } // namespace
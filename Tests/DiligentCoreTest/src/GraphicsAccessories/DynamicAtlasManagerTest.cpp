@@ -33,8 +33,10 @@
 #include "gtest/gtest.h"
 
 #include "FastRand.hpp"
+#include "TestingEnvironment.hpp"
 
 using namespace Diligent;
+using namespace Diligent::Testing;
 
 namespace Diligent
 {
@@ -465,4 +467,249 @@ TEST(GraphicsAccessories_DynamicAtlasManager, AllocateRandom)
     }
 }
 
+// Allocates and releases random regions and checks that allocated regions never overlap
+static void TestRandomAllocations(DynamicAtlasManager::ALLOCATION_STRATEGY Strategy, Uint32 MinSize, Uint32 MaxSize, bool UniformHeight)
+{
+    constexpr Uint32 AtlasSize = 256;
+
+    DynamicAtlasManager Mgr{AtlasSize, AtlasSize, Strategy};
+    EXPECT_EQ(Mgr.GetStrategy(), Strategy);
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetTotalFreeArea(), Uint64{AtlasSize} * AtlasSize);
+
+    std::vector<Uint8> Coverage(AtlasSize * AtlasSize);
+
+    auto UpdateCoverage = [&](const Region& R, Uint8 Value) {
+        ASSERT_LE(R.x + R.width, AtlasSize);
+        ASSERT_LE(R.y + R.height, AtlasSize);
+        for (Uint32 y = R.y; y < R.y + R.height; ++y)
+        {
+            for (Uint32 x = R.x; x < R.x + R.width; ++x)
+            {
+                ASSERT_NE(Coverage[y * AtlasSize + x], Value) << "Region " << R << " overlaps another region";
+                Coverage[y * AtlasSize + x] = Value;
+            }
+        }
+    };
+
+    FastRandInt         rnd{0, static_cast<int>(MinSize), static_cast<int>(MaxSize)};
+    std::vector<Region> Regions;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        // Allocate regions
+        for (Uint32 j = 0; j < 64; ++j)
+        {
+            const Uint32 Width  = static_cast<Uint32>(rnd());
+            const Uint32 Height = UniformHeight ? MaxSize : static_cast<Uint32>(rnd());
+
+            Region R = Mgr.Allocate(Width, Height);
+            if (R.IsEmpty())
+                continue;
+
+            EXPECT_EQ(R.width, Width);
+            EXPECT_EQ(R.height, Height);
+            UpdateCoverage(R, 1);
+            Regions.emplace_back(R);
+        }
+
+        const auto Stats = Mgr.GetFragmentationStats();
+        EXPECT_EQ(Stats.AllocatedRegionCount, Regions.size());
+        EXPECT_EQ(Stats.FreeRegionCount, Mgr.GetFreeRegionCount());
+        EXPECT_EQ(Stats.TotalFreeArea, Mgr.GetTotalFreeArea());
+        EXPECT_LE(Stats.LargestFreeRegionArea, Stats.TotalFreeArea);
+        EXPECT_GE(Stats.ExternalFragmentation, 0.f);
+        EXPECT_LT(Stats.ExternalFragmentation, 1.f);
+
+        Uint64 AllocatedArea = 0;
+        for (const Region& R : Regions)
+            AllocatedArea += Uint64{R.width} * R.height;
+        EXPECT_EQ(Stats.TotalFreeArea + Stats.WastedArea + AllocatedArea, Uint64{AtlasSize} * AtlasSize);
+
+        // Release random half of the regions
+        for (size_t j = 0; j < Regions.size() / 2; ++j)
+        {
+            const size_t Idx = static_cast<size_t>(rnd()) % Regions.size();
+            std::swap(Regions[Idx], Regions.back());
+            UpdateCoverage(Regions.back(), 0);
+            Mgr.Free(std::move(Regions.back()));
+            Regions.pop_back();
+        }
+    }
+
+    for (auto& R : Regions)
+    {
+        UpdateCoverage(R, 0);
+        Mgr.Free(std::move(R));
+    }
+
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetTotalFreeArea(), Uint64{AtlasSize} * AtlasSize);
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 1u);
+
+    const auto Stats = Mgr.GetFragmentationStats();
+    EXPECT_EQ(Stats.AllocatedRegionCount, 0u);
+    EXPECT_EQ(Stats.WastedArea, 0u);
+    EXPECT_EQ(Stats.LargestFreeRegionArea, Uint64{AtlasSize} * AtlasSize);
+    EXPECT_EQ(Stats.ExternalFragmentation, 0.f);
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, AllocateRandom_AllStrategies)
+{
+    for (auto Strategy : {DynamicAtlasManager::ALLOCATION_STRATEGY_TREE,
+                          DynamicAtlasManager::ALLOCATION_STRATEGY_SHELF,
+                          DynamicAtlasManager::ALLOCATION_STRATEGY_BUDDY})
+    {
+        TestRandomAllocations(Strategy, 1, 32, false);
+        TestRandomAllocations(Strategy, 4, 16, true);
+    }
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, Shelf)
+{
+    DynamicAtlasManager Mgr{64, 64, DynamicAtlasManager::ALLOCATION_STRATEGY_SHELF};
+
+    auto R0 = Mgr.Allocate(16, 8);
+    EXPECT_EQ(R0, Region(0, 0, 16, 8));
+    auto R1 = Mgr.Allocate(16, 8);
+    EXPECT_EQ(R1, Region(16, 0, 16, 8));
+    // Shorter region fits into the same shelf
+    auto R2 = Mgr.Allocate(16, 6);
+    EXPECT_EQ(R2, Region(32, 0, 16, 6));
+    // Much shorter region starts a new shelf
+    auto R3 = Mgr.Allocate(8, 2);
+    EXPECT_EQ(R3, Region(0, 8, 8, 2));
+    // Taller region starts a new shelf
+    auto R4 = Mgr.Allocate(8, 16);
+    EXPECT_EQ(R4, Region(0, 10, 8, 16));
+
+    Mgr.Free(std::move(R1));
+    // Free span in the middle of the first shelf is reused
+    auto R5 = Mgr.Allocate(8, 8);
+    EXPECT_EQ(R5, Region(16, 0, 8, 8));
+
+    // Too wide for any shelf
+    EXPECT_TRUE(Mgr.Allocate(128, 8).IsEmpty());
+    // Too tall for the remaining space
+    EXPECT_TRUE(Mgr.Allocate(8, 48).IsEmpty());
+
+    Mgr.Free(std::move(R3));
+    // Released shelf below the top one can be reused for a shorter region
+    auto R6 = Mgr.Allocate(64, 1);
+    EXPECT_EQ(R6, Region(0, 8, 64, 1));
+
+    Mgr.Free(std::move(R0));
+    Mgr.Free(std::move(R2));
+    Mgr.Free(std::move(R4));
+    Mgr.Free(std::move(R5));
+    Mgr.Free(std::move(R6));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 1u);
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, Buddy)
+{
+    {
+        DynamicAtlasManager Mgr{64, 32, DynamicAtlasManager::ALLOCATION_STRATEGY_BUDDY};
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 2u);
+
+        auto R0 = Mgr.Allocate(32, 32);
+        EXPECT_EQ(R0, Region(0, 0, 32, 32));
+        auto R1 = Mgr.Allocate(5, 3);
+        EXPECT_EQ(R1, Region(32, 0, 5, 3));
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 3u + 3u);
+
+        auto Stats = Mgr.GetFragmentationStats();
+        EXPECT_EQ(Stats.WastedArea, 8u * 8u - 5u * 3u);
+        EXPECT_EQ(Stats.LargestFreeRegionArea, 16u * 16u);
+
+        EXPECT_TRUE(Mgr.Allocate(64, 64).IsEmpty());
+        EXPECT_TRUE(Mgr.Allocate(32, 1).IsEmpty());
+
+        auto R2 = Mgr.Allocate(16, 16);
+        EXPECT_EQ(R2, Region(48, 0, 16, 16));
+
+        Mgr.Free(std::move(R1));
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 3u);
+        Mgr.Free(std::move(R0));
+        Mgr.Free(std::move(R2));
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 2u);
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+
+    {
+        DynamicAtlasManager Mgr{64, 64, DynamicAtlasManager::ALLOCATION_STRATEGY_BUDDY, 8};
+
+        auto R0 = Mgr.Allocate(1, 1);
+        EXPECT_EQ(R0, Region(0, 0, 1, 1));
+        auto R1 = Mgr.Allocate(1, 1);
+        EXPECT_EQ(R1, Region(8, 0, 1, 1));
+
+        Mgr.Free(std::move(R0));
+        Mgr.Free(std::move(R1));
+        EXPECT_TRUE(Mgr.IsEmpty());
+        EXPECT_EQ(Mgr.GetFreeRegionCount(), 1u);
+    }
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, FreeInvalidRegion)
+{
+    auto FreeInvalid = [](DynamicAtlasManager& Mgr, const Region& R) {
+        TestingEnvironment::ErrorScope ExpectedErrors{"is not a valid allocated region"};
+        Mgr.Free(Region{R});
+    };
+
+    {
+        DynamicAtlasManager Mgr{64, 64, DynamicAtlasManager::ALLOCATION_STRATEGY_SHELF};
+
+        auto R0 = Mgr.Allocate(16, 8);
+        auto R1 = Mgr.Allocate(16, 8);
+        EXPECT_EQ(R1, Region(16, 0, 16, 8));
+
+        // Region that spans two allocations
+        FreeInvalid(Mgr, Region{0, 0, 32, 8});
+        // Region with wrong width
+        FreeInvalid(Mgr, Region{0, 0, 8, 8});
+        EXPECT_EQ(Mgr.GetFragmentationStats().AllocatedRegionCount, 2u);
+
+        Mgr.Free(std::move(R0));
+        Mgr.Free(std::move(R1));
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+
+    {
+        DynamicAtlasManager Mgr{64, 64, DynamicAtlasManager::ALLOCATION_STRATEGY_BUDDY, 8};
+
+        auto R0 = Mgr.Allocate(8, 8);
+        EXPECT_EQ(R0, Region(0, 0, 8, 8));
+
+        // Split parent of the allocated block
+        FreeInvalid(Mgr, Region{0, 0, 16, 16});
+        // Same block, different size
+        FreeInvalid(Mgr, Region{0, 0, 4, 4});
+        EXPECT_EQ(Mgr.GetFragmentationStats().AllocatedRegionCount, 1u);
+
+        // The allocated block must not be handed out again
+        auto R1 = Mgr.Allocate(16, 16);
+        EXPECT_EQ(R1, Region(16, 0, 16, 16));
+
+        Mgr.Free(std::move(R0));
+        Mgr.Free(std::move(R1));
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, MoveWithStrategy)
+{
+    DynamicAtlasManager Mgr{64, 64, DynamicAtlasManager::ALLOCATION_STRATEGY_SHELF};
+
+    auto R = Mgr.Allocate(8, 8);
+    EXPECT_FALSE(R.IsEmpty());
+
+    DynamicAtlasManager Mgr2{std::move(Mgr)};
+    EXPECT_EQ(Mgr2.GetStrategy(), DynamicAtlasManager::ALLOCATION_STRATEGY_SHELF);
+    EXPECT_FALSE(Mgr2.IsEmpty());
+    Mgr2.Free(std::move(R));
+    EXPECT_TRUE(Mgr2.IsEmpty());
+}
+
 } // namespace
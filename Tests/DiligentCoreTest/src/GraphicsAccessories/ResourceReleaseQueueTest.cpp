@@ -128,4 +128,107 @@ TEST(GraphicsAccessories_ResourceReleaseQueue, GetFilterTypeLiteralName)
     }
 }
 
+// Resources are destroyed outside of the queue lock, so their destructors may release other resources
+TEST(GraphicsAccessories_ResourceReleaseQueue, ReleaseFromDestructor)
+{
+    using QueueType = ResourceReleaseQueue<DynamicStaleResourceWrapper>;
+
+    struct Resource
+    {
+        QueueType* pQueue     = nullptr;
+        Uint64     FenceValue = 0;
+        int*       pCounter   = nullptr;
+
+        Resource(QueueType* _pQueue, Uint64 _FenceValue, int* _pCounter) :
+            pQueue{_pQueue},
+            FenceValue{_FenceValue},
+            pCounter{_pCounter}
+        {}
+
+        Resource(Resource&& rhs) noexcept :
+            pQueue{rhs.pQueue},
+            FenceValue{rhs.FenceValue},
+            pCounter{rhs.pCounter}
+        {
+            rhs.pCounter = nullptr;
+        }
+
+        ~Resource()
+        {
+            if (pCounter == nullptr)
+                return;
+            ++*pCounter;
+            if (FenceValue > 0)
+                pQueue->DiscardResource(Resource{pQueue, FenceValue - 1, pCounter}, FenceValue - 1);
+        }
+    };
+
+    int NumDestroyed = 0;
+
+    QueueType Queue{DefaultRawMemoryAllocator::GetAllocator()};
+    Queue.DiscardResource(Resource{&Queue, 2, &NumDestroyed}, 2);
+
+    Queue.Purge(2);
+    EXPECT_EQ(NumDestroyed, 1);
+    EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), size_t{1});
+
+    Queue.Purge(2);
+    EXPECT_EQ(NumDestroyed, 2);
+    Queue.Purge(2);
+    EXPECT_EQ(NumDestroyed, 3);
+    EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), size_t{0});
+}
+
+TEST(GraphicsAccessories_ResourceReleaseQueue, PurgeReusesStorage)
+{
+    class CountingAllocator final : public IMemoryAllocator
+    {
+    public:
+        virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final
+        {
+            ++NumAllocations;
+            return DefaultRawMemoryAllocator::GetAllocator().Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+        }
+        virtual void Free(void* Ptr) override final
+        {
+            DefaultRawMemoryAllocator::GetAllocator().Free(Ptr);
+        }
+        virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final
+        {
+            ++NumAllocations;
+            return DefaultRawMemoryAllocator::GetAllocator().AllocateAligned(Size, Alignment, dbgDescription, dbgFileName, dbgLineNumber);
+        }
+        virtual void FreeAligned(void* Ptr) override final
+        {
+            DefaultRawMemoryAllocator::GetAllocator().FreeAligned(Ptr);
+        }
+
+        int NumAllocations = 0;
+    };
+
+    CountingAllocator Allocator;
+
+    ResourceReleaseQueue<DynamicStaleResourceWrapper> Queue{Allocator};
+    for (Uint64 FenceValue = 1; FenceValue <= 3; ++FenceValue)
+    {
+        for (int i = 0; i < 8; ++i)
+            Queue.DiscardResource(std::unique_ptr<int>{new int{i}}, FenceValue);
+
+        // Nothing has completed
+        int NumAllocations = Allocator.NumAllocations;
+        Queue.Purge(FenceValue - 1);
+        EXPECT_EQ(Allocator.NumAllocations, NumAllocations);
+        EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), size_t{8});
+
+        NumAllocations = Allocator.NumAllocations;
+        Queue.Purge(FenceValue);
+        EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), size_t{0});
+        if (FenceValue > 1)
+        {
+            // The storage allocated by the first purge is reused
+            EXPECT_EQ(Allocator.NumAllocations, NumAllocations);
+        }
+    }
+}
+
 } // namespace
@@ -0,0 +1,143 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "DearchiverBase.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "DataBlobImpl.hpp"
+#include "ThreadSignal.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+class DearchiverBaseTestHelper : public DearchiverBase
+{
+public:
+    template <typename ResType>
+    using NamedResourceCache = DearchiverBase::NamedResourceCache<ResType>;
+
+    using ResourceType = DearchiverBase::ResourceType;
+};
+
+using DataBlobCache = DearchiverBaseTestHelper::NamedResourceCache<IDataBlob>;
+using ResourceType  = DearchiverBaseTestHelper::ResourceType;
+
+TEST(DearchiverBaseTest, NamedResourceCache)
+{
+    DataBlobCache Cache;
+
+    EXPECT_EQ(Cache.Get(ResourceType::GraphicsPipeline, "Blob"), nullptr);
+
+    RefCntAutoPtr<IDataBlob> pBlob = Cache.GetOrCreate(ResourceType::GraphicsPipeline, "Blob", []() { return DataBlobImpl::Create(16); });
+    ASSERT_NE(pBlob, nullptr);
+    EXPECT_EQ(Cache.Get(ResourceType::GraphicsPipeline, "Blob"), pBlob);
+    // Names are unique for each resource type
+    EXPECT_EQ(Cache.Get(ResourceType::ComputePipeline, "Blob"), nullptr);
+
+    EXPECT_EQ(Cache.GetOrCreate(ResourceType::GraphicsPipeline, "Blob",
+                                []() {
+                                    ADD_FAILURE() << "The blob must be found in the cache";
+                                    return RefCntAutoPtr<IDataBlob>{};
+                                }),
+              pBlob);
+
+    // The cache keeps weak references
+    pBlob.Release();
+    EXPECT_EQ(Cache.Get(ResourceType::GraphicsPipeline, "Blob"), nullptr);
+
+    // Failed creation must not be cached
+    EXPECT_EQ(Cache.GetOrCreate(ResourceType::GraphicsPipeline, "Blob", []() { return RefCntAutoPtr<IDataBlob>{}; }), nullptr);
+    pBlob = Cache.GetOrCreate(ResourceType::GraphicsPipeline, "Blob", []() { return DataBlobImpl::Create(16); });
+    EXPECT_NE(pBlob, nullptr);
+
+    Cache.Clear();
+    EXPECT_EQ(Cache.Get(ResourceType::GraphicsPipeline, "Blob"), nullptr);
+}
+
+TEST(DearchiverBaseTest, NamedResourceCache_ConcurrentCreation)
+{
+    DataBlobCache Cache;
+
+    constexpr size_t NumThreads   = 8;
+    constexpr Uint32 NumResources = 64;
+
+    std::vector<std::string> Names(NumResources);
+    for (Uint32 i = 0; i < NumResources; ++i)
+        Names[i] = "Resource " + std::to_string(i);
+
+    std::atomic<Uint32> NumCreated{0};
+
+    std::vector<std::vector<RefCntAutoPtr<IDataBlob>>> Resources(NumThreads);
+    std::vector<std::thread>                           Threads(NumThreads);
+
+    Threading::Signal StartSignal;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads[t] = std::thread{
+            [&, t]() {
+                StartSignal.Wait();
+                // Every thread requests all resources, starting from a different one
+                for (Uint32 i = 0; i < NumResources; ++i)
+                {
+                    const Uint32 Idx = static_cast<Uint32>((i + t * 7) % NumResources);
+                    Resources[t].emplace_back(Cache.GetOrCreate(ResourceType::GraphicsPipeline, Names[Idx].c_str(),
+                                                                [&]() {
+                                                                    NumCreated.fetch_add(1);
+                                                                    std::this_thread::yield();
+                                                                    return DataBlobImpl::Create(Idx);
+                                                                }));
+                }
+            }};
+    }
+    StartSignal.Trigger(true);
+
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    // Every resource must only be created once
+    EXPECT_EQ(NumCreated.load(), NumResources);
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        ASSERT_EQ(Resources[t].size(), size_t{NumResources});
+        for (Uint32 i = 0; i < NumResources; ++i)
+        {
+            const Uint32 Idx = static_cast<Uint32>((i + t * 7) % NumResources);
+            ASSERT_NE(Resources[t][i], nullptr);
+            EXPECT_EQ(Resources[t][i]->GetSize(), size_t{Idx});
+            EXPECT_EQ(Resources[t][i], Cache.Get(ResourceType::GraphicsPipeline, Names[Idx].c_str()));
+        }
+    }
+}
+
+} // namespace
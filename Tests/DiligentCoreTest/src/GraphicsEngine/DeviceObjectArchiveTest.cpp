@@ -0,0 +1,101 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "DeviceObjectArchive.hpp"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(DeviceObjectArchiveTest, SerializeToStream)
+{
+    using DeviceType   = DeviceObjectArchive::DeviceType;
+    using ResourceType = DeviceObjectArchive::ResourceType;
+
+    auto& RawAllocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    constexpr Uint32 ContentVersion = 123;
+
+    DeviceObjectArchive Archive{ContentVersion};
+
+    std::vector<Uint8> Bytes(256 << 10);
+    for (size_t i = 0; i < Bytes.size(); ++i)
+        Bytes[i] = static_cast<Uint8>(i * 13 + 1);
+
+    // Make the archive larger than a single serialization chunk
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const std::string Name = "Resource " + std::to_string(i);
+
+        DeviceObjectArchive::ResourceData& ResData = Archive.GetResourceData(ResourceType::ComputePipeline, Name.c_str());
+
+        ResData.Common = SerializedData{Bytes.data(), 100 + i * 17};
+
+        ResData.DeviceSpecific[static_cast<size_t>(DeviceType::Vulkan)] = SerializedData{Bytes.data() + i, 7 + i};
+
+        Archive.GetDeviceShaders(DeviceType::Vulkan).emplace_back(SerializedData{Bytes.data(), (i + 1) * 5000}.MakeCopy(RawAllocator));
+    }
+
+    RefCntAutoPtr<IDataBlob> pRefBlob;
+    Archive.Serialize(&pRefBlob);
+    ASSERT_NE(pRefBlob, nullptr);
+    EXPECT_GT(pRefBlob->GetSize(), SerializedDataChunks::DefaultChunkSize);
+
+    RefCntAutoPtr<DataBlobImpl>     pStreamBlob = DataBlobImpl::Create(size_t{0});
+    RefCntAutoPtr<MemoryFileStream> pStream     = MemoryFileStream::Create(pStreamBlob);
+    EXPECT_TRUE(Archive.Serialize(pStream));
+
+    ASSERT_EQ(pStreamBlob->GetSize(), pRefBlob->GetSize());
+    EXPECT_EQ(std::memcmp(pStreamBlob->GetConstDataPtr(), pRefBlob->GetConstDataPtr(), pRefBlob->GetSize()), 0);
+
+    DeviceObjectArchive::CreateInfo CI;
+    CI.pData = pStreamBlob;
+    DeviceObjectArchive Archive2{CI};
+    EXPECT_EQ(Archive2.GetContentVersion(), ContentVersion);
+    EXPECT_EQ(Archive2.GetNamedResources().size(), Archive.GetNamedResources().size());
+    for (const auto& it : Archive.GetNamedResources())
+    {
+        auto it2 = Archive2.GetNamedResources().find(it.first);
+        ASSERT_NE(it2, Archive2.GetNamedResources().end());
+        EXPECT_EQ(it2->second, it.second);
+    }
+    for (size_t i = 0; i < Archive.GetDeviceShaders(DeviceType::Vulkan).size(); ++i)
+    {
+        EXPECT_EQ(Archive2.GetSerializedShader(DeviceType::Vulkan, i), Archive.GetSerializedShader(DeviceType::Vulkan, i));
+    }
+}
+
+} // namespace
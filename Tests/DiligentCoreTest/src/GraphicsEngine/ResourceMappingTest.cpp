@@ -0,0 +1,299 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ResourceMappingImpl.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class TestDeviceObject final : public ObjectBase<IDeviceObject>
+{
+public:
+    using TBase = ObjectBase<IDeviceObject>;
+
+    TestDeviceObject(IReferenceCounters* pRefCounters) :
+        TBase{pRefCounters}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DeviceObject, TBase)
+
+    virtual const DeviceObjectAttribs& DILIGENT_CALL_TYPE GetDesc() const override final { return m_Desc; }
+    virtual Int32 DILIGENT_CALL_TYPE                      GetUniqueID() const override final { return 0; }
+    virtual void DILIGENT_CALL_TYPE                       SetUserData(IObject* pUserData) override final {}
+    virtual IObject* DILIGENT_CALL_TYPE                   GetUserData() const override final { return nullptr; }
+
+private:
+    DeviceObjectAttribs m_Desc;
+};
+
+RefCntAutoPtr<ResourceMappingImpl> CreateResourceMapping()
+{
+    return RefCntAutoPtr<ResourceMappingImpl>{MakeNewRCObj<ResourceMappingImpl>()(DefaultRawMemoryAllocator::GetAllocator())};
+}
+
+RefCntAutoPtr<IDeviceObject> CreateObject()
+{
+    return RefCntAutoPtr<IDeviceObject>{MakeNewRCObj<TestDeviceObject>()()};
+}
+
+TEST(GraphicsEngine_ResourceMapping, AddGetRemove)
+{
+    RefCntAutoPtr<ResourceMappingImpl> pMapping = CreateResourceMapping();
+
+    RefCntAutoPtr<IDeviceObject> pObj0 = CreateObject();
+    RefCntAutoPtr<IDeviceObject> pObj1 = CreateObject();
+    RefCntAutoPtr<IDeviceObject> pObj2 = CreateObject();
+
+    pMapping->AddResource("g_Texture", pObj0, false);
+    IDeviceObject* ppArray[] = {pObj1, pObj2};
+    pMapping->AddResourceArray("g_Textures", 1, ppArray, 2, false);
+    EXPECT_EQ(pMapping->GetSize(), size_t{3});
+
+    EXPECT_EQ(pMapping->GetResource("g_Texture", 0), pObj0);
+    EXPECT_EQ(pMapping->GetResource("g_Texture", 1), nullptr);
+    EXPECT_EQ(pMapping->GetResource("g_Textures", 0), nullptr);
+    EXPECT_EQ(pMapping->GetResource("g_Textures", 1), pObj1);
+    EXPECT_EQ(pMapping->GetResource("g_Textures", 2), pObj2);
+    EXPECT_EQ(pMapping->GetResource("g_Buffer", 0), nullptr);
+
+    // Replace the resource
+    pMapping->AddResource("g_Texture", pObj2, false);
+    EXPECT_EQ(pMapping->GetResource("g_Texture", 0), pObj2);
+    EXPECT_EQ(pMapping->GetSize(), size_t{3});
+
+    pMapping->RemoveResourceByName("g_Textures", 1);
+    EXPECT_EQ(pMapping->GetResource("g_Textures", 1), nullptr);
+    EXPECT_EQ(pMapping->GetResource("g_Textures", 2), pObj2);
+    EXPECT_EQ(pMapping->GetSize(), size_t{2});
+
+    pMapping->RemoveResourceByName("g_Buffer", 0);
+    EXPECT_EQ(pMapping->GetSize(), size_t{2});
+}
+
+TEST(GraphicsEngine_ResourceMapping, AddResourceArrayOverlap)
+{
+    RefCntAutoPtr<ResourceMappingImpl> pMapping = CreateResourceMapping();
+
+    RefCntAutoPtr<IDeviceObject> pObj0 = CreateObject();
+    RefCntAutoPtr<IDeviceObject> pObj1 = CreateObject();
+
+    IDeviceObject* ppArray0[] = {pObj0, pObj0, pObj0};
+    pMapping->AddResourceArray("g_Textures", 2, ppArray0, 3, false);
+    pMapping->AddResource("g_Texture", pObj0, false);
+
+    // Elements 0 and 1 are added, elements 2 and 3 are replaced
+    IDeviceObject* ppArray1[] = {pObj1, pObj1, pObj1, pObj1};
+    pMapping->AddResourceArray("g_Textures", 0, ppArray1, 4, false);
+    EXPECT_EQ(pMapping->GetSize(), size_t{6});
+    for (Uint32 i = 0; i < 4; ++i)
+        EXPECT_EQ(pMapping->GetResource("g_Textures", i), pObj1) << i;
+    EXPECT_EQ(pMapping->GetResource("g_Textures", 4), pObj0);
+    EXPECT_EQ(pMapping->GetResource("g_Texture", 0), pObj0);
+}
+
+TEST(GraphicsEngine_ResourceMapping, AddResources)
+{
+    RefCntAutoPtr<ResourceMappingImpl> pMapping = CreateResourceMapping();
+
+    RefCntAutoPtr<IDeviceObject> pObj0 = CreateObject();
+    RefCntAutoPtr<IDeviceObject> pObj1 = CreateObject();
+    RefCntAutoPtr<IDeviceObject> pObj2 = CreateObject();
+
+    pMapping->AddResource("g_Texture", pObj0, false);
+    pMapping->AddResource("g_Buffer", pObj0, false);
+
+    const ResourceMappingEntry Entries[] = {
+        {"g_Textures", pObj1, 1},
+        {"g_Texture", pObj1},
+        {"g_Textures", pObj0, 0},
+        {nullptr, pObj2},
+        {"g_Textures", pObj2, 1}, // Replaces the first entry
+        {"", pObj2},
+    };
+    pMapping->AddResources(Entries, _countof(Entries), false);
+    EXPECT_EQ(pMapping->GetSize(), size_t{4});
+
+    EXPECT_EQ(pMapping->GetResource("g_Texture", 0), pObj1);
+    EXPECT_EQ(pMapping->GetResource("g_Buffer", 0), pObj0);
+    EXPECT_EQ(pMapping->GetResource("g_Textures", 0), pObj0);
+    EXPECT_EQ(pMapping->GetResource("g_Textures", 1), pObj2);
+
+    // A batch without changes keeps the current snapshot
+    ResourceMappingImpl::SnapshotReader Reader{*pMapping};
+    pMapping->AddResources(&Entries[1], 3, false);
+    pMapping->AddResources(&Entries[4], 2, false);
+    EXPECT_EQ(pMapping->GetSize(), size_t{4});
+    EXPECT_EQ(pObj2->GetReferenceCounters()->GetNumStrongRefs(), 2);
+}
+
+TEST(GraphicsEngine_ResourceMapping, ReleaseRemovedNames)
+{
+    class CountingAllocator final : public IMemoryAllocator
+    {
+    public:
+        virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final
+        {
+            ++NumAllocations;
+            return DefaultRawMemoryAllocator::GetAllocator().Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+        }
+        virtual void Free(void* Ptr) override final
+        {
+            --NumAllocations;
+            DefaultRawMemoryAllocator::GetAllocator().Free(Ptr);
+        }
+        virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final
+        {
+            ++NumAllocations;
+            return DefaultRawMemoryAllocator::GetAllocator().AllocateAligned(Size, Alignment, dbgDescription, dbgFileName, dbgLineNumber);
+        }
+        virtual void FreeAligned(void* Ptr) override final
+        {
+            --NumAllocations;
+            DefaultRawMemoryAllocator::GetAllocator().FreeAligned(Ptr);
+        }
+
+        int NumAllocations = 0;
+    };
+
+    CountingAllocator Allocator;
+    {
+        RefCntAutoPtr<ResourceMappingImpl> pMapping{MakeNewRCObj<ResourceMappingImpl>()(Allocator)};
+
+        RefCntAutoPtr<IDeviceObject> pObj = CreateObject();
+        pMapping->AddResource("g_Stable", pObj, false);
+
+        const int NumAllocations = Allocator.NumAllocations;
+        for (size_t i = 0; i < 256; ++i)
+        {
+            const std::string Name = "Streamed" + std::to_string(i);
+            pMapping->AddResource(Name.c_str(), pObj, false);
+            pMapping->RemoveResourceByName(Name.c_str(), 0);
+        }
+        // Names of the removed resources must not accumulate
+        EXPECT_EQ(Allocator.NumAllocations, NumAllocations);
+        EXPECT_EQ(pMapping->GetResource("g_Stable", 0), pObj);
+    }
+    EXPECT_EQ(Allocator.NumAllocations, 0);
+}
+
+TEST(GraphicsEngine_ResourceMapping, SnapshotReader)
+{
+    RefCntAutoPtr<ResourceMappingImpl> pMapping = CreateResourceMapping();
+
+    std::vector<RefCntAutoPtr<IDeviceObject>> Objects;
+    std::vector<std::string>                  Names;
+    for (size_t i = 0; i < 64; ++i)
+    {
+        Objects.emplace_back(CreateObject());
+        Names.emplace_back("Resource" + std::to_string(i));
+        pMapping->AddResource(Names.back().c_str(), Objects.back(), true);
+    }
+
+    ResourceMappingImpl::SnapshotReader Reader{*pMapping};
+
+    // Modifications are not visible to the existing reader
+    pMapping->RemoveResourceByName("Resource0", 0);
+    EXPECT_EQ(Reader.GetResource("Resource0", 0), Objects[0]);
+    EXPECT_EQ(pMapping->GetResource("Resource0", 0), nullptr);
+
+    std::vector<HashMapStringKey> Keys;
+    for (const std::string& Name : Names)
+        Keys.emplace_back(Name.c_str());
+    std::sort(Keys.begin(), Keys.end(), [](const HashMapStringKey& lhs, const HashMapStringKey& rhs) { return lhs.GetHash() < rhs.GetHash(); });
+
+    ResourceMappingImpl::SnapshotReader::SortedLookup Lookup{Reader};
+    for (const HashMapStringKey& Key : Keys)
+    {
+        const size_t Idx = std::stoi(Key.GetStr() + strlen("Resource"));
+        EXPECT_EQ(Lookup.GetResource(Key.GetHash(), Key.GetStr(), 0), Objects[Idx]) << Key.GetStr();
+        EXPECT_EQ(Lookup.GetResource(Key.GetHash(), Key.GetStr(), 1), nullptr) << Key.GetStr();
+    }
+}
+
+TEST(GraphicsEngine_ResourceMapping, ReleaseReplacedSnapshots)
+{
+    RefCntAutoPtr<ResourceMappingImpl> pMapping = CreateResourceMapping();
+
+    RefCntAutoPtr<IDeviceObject> pObj = CreateObject();
+
+    // An active reader must only keep its own snapshot alive, not the ones that replaced it
+    ResourceMappingImpl::SnapshotReader Reader{*pMapping};
+    pMapping->AddResource("g_Texture", pObj, false);
+    pMapping->RemoveResourceByName("g_Texture", 0);
+    EXPECT_EQ(pObj->GetReferenceCounters()->GetNumStrongRefs(), 1);
+    EXPECT_EQ(Reader.GetSize(), size_t{0});
+}
+
+TEST(GraphicsEngine_ResourceMapping, ConcurrentReadWrite)
+{
+    RefCntAutoPtr<ResourceMappingImpl> pMapping = CreateResourceMapping();
+
+    RefCntAutoPtr<IDeviceObject> pStable = CreateObject();
+    pMapping->AddResource("g_Stable", pStable, true);
+
+    std::atomic<bool>        Stop{false};
+    std::vector<std::thread> Writers;
+    for (size_t t = 0; t < 2; ++t)
+    {
+        Writers.emplace_back([&, t]() {
+            RefCntAutoPtr<IDeviceObject> pObj = CreateObject();
+            for (size_t i = 0; !Stop.load(); ++i)
+            {
+                const std::string Name = "Streamed" + std::to_string(t) + "_" + std::to_string(i % 32);
+                pMapping->AddResource(Name.c_str(), pObj, false);
+                if (i % 3 == 0)
+                    pMapping->RemoveResourceByName(Name.c_str(), 0);
+            }
+        });
+    }
+
+    for (size_t i = 0; i < 20000; ++i)
+    {
+        ASSERT_EQ(pMapping->GetResource("g_Stable", 0), pStable);
+    }
+
+    Stop.store(true);
+    for (std::thread& Writer : Writers)
+        Writer.join();
+
+    EXPECT_EQ(pMapping->GetResource("g_Stable", 0), pStable);
+}
+
+} // namespace
@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "../../../../Graphics/GraphicsEngine/include/ResourceNameTable.hpp"
+#include "PipelineResourceSignature.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(ResourceNameTableTest, Find)
+{
+    const PipelineResourceDesc Resources[] = //
+        {
+            {SHADER_TYPE_VERTEX, "Buff", 1u, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER},
+            {SHADER_TYPE_PIXEL, "Tex", 1u, SHADER_RESOURCE_TYPE_TEXTURE_SRV},
+            {SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "Tex", 1u, SHADER_RESOURCE_TYPE_TEXTURE_SRV},
+            {SHADER_TYPE_COMPUTE, "Buff", 1u, SHADER_RESOURCE_TYPE_BUFFER_UAV},
+        };
+
+    const ResourceNameTable Table{Resources, _countof(Resources)};
+
+    EXPECT_EQ(Table.Find("Buff", SHADER_TYPE_VERTEX), 0u);
+    EXPECT_EQ(Table.Find("Buff", SHADER_TYPE_COMPUTE), 3u);
+    EXPECT_EQ(Table.Find("Buff", SHADER_TYPE_VERTEX | SHADER_TYPE_COMPUTE), 0u);
+    EXPECT_EQ(Table.Find("Buff", SHADER_TYPE_PIXEL), ResourceNameTable::InvalidIndex);
+
+    // The first matching resource must be returned, as with the linear search
+    EXPECT_EQ(Table.Find("Tex", SHADER_TYPE_PIXEL), 1u);
+    EXPECT_EQ(Table.Find("Tex", SHADER_TYPE_VERTEX), 2u);
+
+    // The name must be compared as a string, not a pointer
+    const std::string TexName{"Tex"};
+    EXPECT_EQ(Table.Find(TexName.c_str(), SHADER_TYPE_PIXEL), 1u);
+
+    EXPECT_EQ(Table.Find("Te", SHADER_TYPE_PIXEL), ResourceNameTable::InvalidIndex);
+    EXPECT_EQ(Table.Find("Texx", SHADER_TYPE_PIXEL), ResourceNameTable::InvalidIndex);
+
+    EXPECT_EQ(Table.FindIf("Buff", [](Uint32 Idx) { return Idx > 0; }), 3u);
+    EXPECT_EQ(Table.FindIf("Buff", [](Uint32 Idx) { return false; }), ResourceNameTable::InvalidIndex);
+
+    const ResourceNameTable EmptyTable;
+    EXPECT_TRUE(EmptyTable.IsEmpty());
+    EXPECT_EQ(EmptyTable.Find("Buff", SHADER_TYPE_VERTEX), ResourceNameTable::InvalidIndex);
+}
+
+TEST(ResourceNameTableTest, LayoutVariables)
+{
+    std::vector<std::string> Names;
+    for (Uint32 i = 0; i < 512; ++i)
+        Names.emplace_back("g_Resource" + std::to_string(i));
+
+    std::vector<ShaderResourceVariableDesc> Vars;
+    for (Uint32 i = 0; i < Names.size(); ++i)
+    {
+        const SHADER_TYPE Stages = (i % 2) == 0 ? SHADER_TYPE_VERTEX : SHADER_TYPE_PIXEL;
+        Vars.emplace_back(Stages, Names[i].c_str(), SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    }
+
+    const ResourceNameTable Table{Vars.data(), static_cast<Uint32>(Vars.size())};
+    for (Uint32 i = 0; i < Names.size(); ++i)
+    {
+        const SHADER_TYPE Stages      = (i % 2) == 0 ? SHADER_TYPE_VERTEX : SHADER_TYPE_PIXEL;
+        const SHADER_TYPE OtherStages = (i % 2) == 0 ? SHADER_TYPE_PIXEL : SHADER_TYPE_VERTEX;
+        EXPECT_EQ(Table.Find(Names[i].c_str(), Stages), i);
+        EXPECT_EQ(Table.Find(Names[i].c_str(), OtherStages), ResourceNameTable::InvalidIndex);
+    }
+}
+
+} // namespace
@@ -0,0 +1,434 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "EngineFactoryNull.h"
+
+#include <cstring>
+#include <vector>
+
+#include "RefCntAutoPtr.hpp"
+#include "StateCreationStageTimer.hpp"
+
+#include "gtest/gtest.h"
+
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class NullDeviceTest : public ::testing::Test
+{
+protected:
+    static constexpr Uint32 NumDeferredContexts = 2;
+
+    void SetUp() override
+    {
+        IEngineFactoryNull* pFactory = LoadAndGetEngineFactoryNull();
+        ASSERT_NE(pFactory, nullptr);
+
+        EngineCreateInfo EngineCI;
+        EngineCI.NumDeferredContexts = NumDeferredContexts;
+
+        IDeviceContext* ppContexts[1 + NumDeferredContexts] = {};
+        pFactory->CreateDeviceAndContextsNull(EngineCI, &m_pDevice, ppContexts);
+        ASSERT_NE(m_pDevice, nullptr);
+
+        m_pContext.Attach(ppContexts[0]);
+        for (Uint32 i = 0; i < NumDeferredContexts; ++i)
+            m_pDeferredContexts[i].Attach(ppContexts[1 + i]);
+        ASSERT_NE(m_pContext, nullptr);
+    }
+
+    void TearDown() override
+    {
+        if (m_pContext)
+        {
+            m_pContext->Flush();
+            m_pContext->FinishFrame();
+        }
+    }
+
+    RefCntAutoPtr<IShader> CreateShader(const char* Name, SHADER_TYPE Type)
+    {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.Source         = "void main() {}";
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.Desc           = {Name, Type, true};
+
+        RefCntAutoPtr<IShader> pShader;
+        m_pDevice->CreateShader(ShaderCI, &pShader);
+        return pShader;
+    }
+
+    RefCntAutoPtr<IPipelineState> CreateGraphicsPSO(const char*                       Name,
+                                                    IPipelineResourceSignature*       pPRS,
+                                                    const PipelineResourceLayoutDesc& ResourceLayout = {})
+    {
+        RefCntAutoPtr<IShader> pVS = CreateShader("Null device test VS", SHADER_TYPE_VERTEX);
+        RefCntAutoPtr<IShader> pPS = CreateShader("Null device test PS", SHADER_TYPE_PIXEL);
+        if (!pVS || !pPS)
+            return {};
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name                      = Name;
+        PSOCreateInfo.PSODesc.ResourceLayout            = ResourceLayout;
+        PSOCreateInfo.pVS                               = pVS;
+        PSOCreateInfo.pPS                               = pPS;
+        PSOCreateInfo.GraphicsPipeline.NumRenderTargets = 1;
+        PSOCreateInfo.GraphicsPipeline.RTVFormats[0]    = TEX_FORMAT_RGBA8_UNORM;
+
+        IPipelineResourceSignature* ppSignatures[] = {pPRS};
+        if (pPRS != nullptr)
+        {
+            PSOCreateInfo.ppResourceSignatures    = ppSignatures;
+            PSOCreateInfo.ResourceSignaturesCount = 1;
+        }
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        m_pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+        return pPSO;
+    }
+
+    RefCntAutoPtr<ITexture> CreateTexture(const char* Name, BIND_FLAGS BindFlags)
+    {
+        TextureDesc TexDesc;
+        TexDesc.Name      = Name;
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = 64;
+        TexDesc.Height    = 64;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.BindFlags = BindFlags;
+
+        RefCntAutoPtr<ITexture> pTexture;
+        m_pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+        return pTexture;
+    }
+
+    RefCntAutoPtr<IRenderDevice>  m_pDevice;
+    RefCntAutoPtr<IDeviceContext> m_pContext;
+    RefCntAutoPtr<IDeviceContext> m_pDeferredContexts[NumDeferredContexts];
+};
+
+TEST_F(NullDeviceTest, CreateDeviceAndContexts)
+{
+    EXPECT_EQ(m_pDevice->GetDeviceInfo().Type, RENDER_DEVICE_TYPE_NULL);
+
+    EXPECT_FALSE(m_pContext->GetDesc().IsDeferred);
+    for (Uint32 i = 0; i < NumDeferredContexts; ++i)
+    {
+        ASSERT_NE(m_pDeferredContexts[i], nullptr);
+        EXPECT_TRUE(m_pDeferredContexts[i]->GetDesc().IsDeferred);
+    }
+
+    FenceDesc FenceCI;
+    FenceCI.Name = "Null device test fence";
+    RefCntAutoPtr<IFence> pFence;
+    m_pDevice->CreateFence(FenceCI, &pFence);
+    ASSERT_NE(pFence, nullptr);
+
+    m_pContext->EnqueueSignal(pFence, 1);
+    m_pContext->Flush();
+    EXPECT_EQ(pFence->GetCompletedValue(), 1u);
+}
+
+TEST_F(NullDeviceTest, BufferData)
+{
+    const Uint32 InitData[] = {1, 2, 3, 4};
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Null device test buffer";
+    BuffDesc.Size      = sizeof(InitData);
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+    BufferData BuffData{InitData, sizeof(InitData)};
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    m_pDevice->CreateBuffer(BuffDesc, &BuffData, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    BuffDesc.Name           = "Null device test staging buffer";
+    BuffDesc.Usage          = USAGE_STAGING;
+    BuffDesc.BindFlags      = BIND_NONE;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+    RefCntAutoPtr<IBuffer> pStaging;
+    m_pDevice->CreateBuffer(BuffDesc, nullptr, &pStaging);
+    ASSERT_NE(pStaging, nullptr);
+
+    m_pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStaging, 0, sizeof(InitData), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    m_pContext->WaitForIdle();
+
+    void* pData = nullptr;
+    m_pContext->MapBuffer(pStaging, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    EXPECT_EQ(std::memcmp(pData, InitData, sizeof(InitData)), 0);
+    m_pContext->UnmapBuffer(pStaging, MAP_READ);
+}
+
+TEST_F(NullDeviceTest, CreatePipelineStateCache)
+{
+    PipelineStateCacheCreateInfo CacheCI;
+    CacheCI.Desc.Name = "Null device test PSO cache";
+
+    RefCntAutoPtr<IPipelineStateCache> pCache;
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Pipeline state caches are not supported in Null backend"};
+        m_pDevice->CreatePipelineStateCache(CacheCI, &pCache);
+    }
+    EXPECT_EQ(pCache, nullptr);
+}
+
+TEST_F(NullDeviceTest, ExplicitSignature)
+{
+    const PipelineResourceDesc Resources[] = {
+        {SHADER_TYPE_VERTEX, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+        {SHADER_TYPE_PIXEL, "g_Texture", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL, "g_Textures", 4, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Null device test PRS";
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    m_pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_NE(pPRS, nullptr);
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreateGraphicsPSO("Null device test PSO - explicit signature", pPRS);
+    ASSERT_NE(pPSO, nullptr);
+    ASSERT_EQ(pPSO->GetResourceSignatureCount(), 1u);
+    EXPECT_EQ(pPSO->GetResourceSignature(0), pPRS);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Null device test constants";
+    BuffDesc.Size           = 256;
+    BuffDesc.Usage          = USAGE_DYNAMIC;
+    BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+    RefCntAutoPtr<IBuffer> pConstants;
+    m_pDevice->CreateBuffer(BuffDesc, nullptr, &pConstants);
+    ASSERT_NE(pConstants, nullptr);
+
+    RefCntAutoPtr<ITexture> pTexture = CreateTexture("Null device test texture", BIND_SHADER_RESOURCE);
+    RefCntAutoPtr<ITexture> pRT      = CreateTexture("Null device test render target", BIND_RENDER_TARGET);
+    ASSERT_TRUE(pTexture && pRT);
+
+    IShaderResourceVariable* pStaticVar = pPRS->GetStaticVariableByName(SHADER_TYPE_VERTEX, "cbConstants");
+    ASSERT_NE(pStaticVar, nullptr);
+    pStaticVar->Set(pConstants);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+    EXPECT_EQ(pSRB->GetVariableCount(SHADER_TYPE_PIXEL), 2u);
+    EXPECT_EQ(pSRB->GetVariableByName(SHADER_TYPE_VERTEX, "cbConstants"), nullptr);
+
+    IDeviceObject* pSRV = pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture")->Set(pSRV);
+    IDeviceObject* ppSRVs[] = {pSRV, pSRV, pSRV, pSRV};
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures")->SetArray(ppSRVs, 0, _countof(ppSRVs));
+    EXPECT_EQ(pSRB->CheckResources(SHADER_TYPE_PIXEL, nullptr, BIND_SHADER_RESOURCES_VERIFY_ALL_RESOLVED | BIND_SHADER_RESOURCES_UPDATE_ALL), SHADER_RESOURCE_VARIABLE_TYPE_FLAG_NONE);
+
+    for (IDeviceContext* pCtx : {m_pDeferredContexts[0].RawPtr(), m_pContext.RawPtr()})
+    {
+        if (pCtx->GetDesc().IsDeferred)
+            pCtx->Begin(0);
+
+        ITextureView* pRTV = pRT->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+        pCtx->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pCtx->SetPipelineState(pPSO);
+        pCtx->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pCtx->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+
+        if (pCtx->GetDesc().IsDeferred)
+        {
+            RefCntAutoPtr<ICommandList> pCmdList;
+            pCtx->FinishCommandList(&pCmdList);
+            ASSERT_NE(pCmdList, nullptr);
+            ICommandList* ppCmdLists[] = {pCmdList};
+            m_pContext->ExecuteCommandLists(1, ppCmdLists);
+            pCtx->FinishFrame();
+        }
+    }
+}
+
+TEST_F(NullDeviceTest, SRBRecycling)
+{
+    const PipelineResourceDesc Resources[] = {
+        {SHADER_TYPE_PIXEL, "g_Texture", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL, "g_Textures", 4, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Null device test PRS - SRB recycling";
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+    EXPECT_EQ(PRSDesc.SRBRecyclePoolSize, 0u);
+    PRSDesc.SRBRecyclePoolSize = 2;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    m_pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_NE(pPRS, nullptr);
+
+    RefCntAutoPtr<ITexture> pTexture = CreateTexture("Null device test texture", BIND_SHADER_RESOURCE);
+    ASSERT_NE(pTexture, nullptr);
+    IDeviceObject* pSRV = pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+
+    for (Uint32 i = 0; i < 3; ++i)
+    {
+        RefCntAutoPtr<IShaderResourceBinding> pSRB;
+        pPRS->CreateShaderResourceBinding(&pSRB);
+        ASSERT_NE(pSRB, nullptr);
+        EXPECT_EQ(pSRB->GetPipelineResourceSignature(), pPRS);
+
+        // Variables of a reused SRB must not retain resources from the previous owner
+        IShaderResourceVariable* pTexVar  = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Texture");
+        IShaderResourceVariable* pTexsVar = pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Textures");
+        ASSERT_TRUE(pTexVar != nullptr && pTexsVar != nullptr);
+        EXPECT_EQ(pTexVar->Get(), nullptr);
+        for (Uint32 elem = 0; elem < 4; ++elem)
+            EXPECT_EQ(pTexsVar->Get(elem), nullptr);
+
+        pTexVar->Set(pSRV);
+        IDeviceObject* ppSRVs[] = {pSRV, pSRV, pSRV, pSRV};
+        pTexsVar->SetArray(ppSRVs, 0, _countof(ppSRVs));
+
+        // Variables keep their SRB alive, so the owner must be rebound when the data is reused
+        RefCntAutoPtr<IShaderResourceVariable> pVarRef{pTexVar};
+        RefCntWeakPtr<IShaderResourceBinding>  pWeakSRB{pSRB};
+        pSRB.Release();
+        EXPECT_TRUE(pWeakSRB.Lock());
+        pVarRef.Release();
+        EXPECT_FALSE(pWeakSRB.Lock());
+
+        m_pContext->Flush();
+        m_pContext->FinishFrame();
+    }
+}
+
+TEST_F(NullDeviceTest, ImplicitSignature)
+{
+    // Shaders are not reflected by the Null backend, so the implicit signature only
+    // contains immutable samplers; variables from the layout do not create resources.
+    const ShaderResourceVariableDesc Variables[] = {
+        {SHADER_TYPE_PIXEL, "g_Texture", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+    };
+    const ImmutableSamplerDesc ImtblSamplers[] = {
+        {SHADER_TYPE_PIXEL, "g_Sampler", SamplerDesc{}},
+    };
+    PipelineResourceLayoutDesc ResourceLayout;
+    ResourceLayout.DefaultVariableType  = SHADER_RESOURCE_VARIABLE_TYPE_STATIC;
+    ResourceLayout.Variables            = Variables;
+    ResourceLayout.NumVariables         = _countof(Variables);
+    ResourceLayout.ImmutableSamplers    = ImtblSamplers;
+    ResourceLayout.NumImmutableSamplers = _countof(ImtblSamplers);
+
+    RefCntAutoPtr<IPipelineState> pPSO = CreateGraphicsPSO("Null device test PSO - implicit signature", nullptr, ResourceLayout);
+    ASSERT_NE(pPSO, nullptr);
+    ASSERT_EQ(pPSO->GetResourceSignatureCount(), 1u);
+
+    IPipelineResourceSignature* pPRS = pPSO->GetResourceSignature(0);
+    ASSERT_NE(pPRS, nullptr);
+    const PipelineResourceSignatureDesc& PRSDesc = pPRS->GetDesc();
+    EXPECT_EQ(PRSDesc.NumResources, 0u);
+    ASSERT_EQ(PRSDesc.NumImmutableSamplers, 1u);
+    EXPECT_STREQ(PRSDesc.ImmutableSamplers[0].SamplerOrTextureName, "g_Sampler");
+
+    EXPECT_EQ(pPSO->GetStaticVariableCount(SHADER_TYPE_PIXEL), 0u);
+    EXPECT_EQ(pPSO->GetStaticVariableByName(SHADER_TYPE_PIXEL, "g_Texture"), nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+    EXPECT_EQ(pSRB->GetVariableCount(SHADER_TYPE_PIXEL), 0u);
+
+    // Two pipelines with identical layouts must be compatible
+    RefCntAutoPtr<IPipelineState> pPSO2 = CreateGraphicsPSO("Null device test PSO - implicit signature 2", nullptr, ResourceLayout);
+    ASSERT_NE(pPSO2, nullptr);
+    EXPECT_TRUE(pPSO->IsCompatibleWith(pPSO2));
+
+    RefCntAutoPtr<ITexture> pRT = CreateTexture("Null device test render target", BIND_RENDER_TARGET);
+    ASSERT_NE(pRT, nullptr);
+
+    ITextureView* pRTV = pRT->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+    m_pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    m_pContext->SetPipelineState(pPSO);
+    m_pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    m_pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    m_pContext->SetPipelineState(pPSO2);
+    m_pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+}
+
+TEST_F(NullDeviceTest, ComputePipeline)
+{
+    RefCntAutoPtr<IShader> pCS = CreateShader("Null device test CS", SHADER_TYPE_COMPUTE);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name = "Null device test compute PSO";
+    PSOCreateInfo.pCS          = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    m_pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+    EXPECT_EQ(pPSO->GetDesc().PipelineType, PIPELINE_TYPE_COMPUTE);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    m_pContext->SetPipelineState(pPSO);
+    m_pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    m_pContext->DispatchCompute(DispatchComputeAttribs{4, 4, 1});
+}
+
+TEST_F(NullDeviceTest, StateCreationTimings)
+{
+    m_pDevice->ResetStateCreationTimings();
+    EXPECT_EQ(m_pDevice->GetStateCreationTimestamp(), Uint64{0});
+    {
+        // Stages are not recorded while the timings are disabled
+        ScopedStateCreationStageTimer Timer{m_pDevice, STATE_CREATION_STAGE_RENDER_STATE_CACHE_MISS};
+    }
+
+    m_pDevice->EnableStateCreationTimings(true);
+    EXPECT_NE(m_pDevice->GetStateCreationTimestamp(), Uint64{0});
+    {
+        ScopedStateCreationStageTimer Timer{m_pDevice, STATE_CREATION_STAGE_RENDER_STATE_CACHE_MISS};
+        Timer.SetStage(STATE_CREATION_STAGE_RENDER_STATE_CACHE_HIT);
+    }
+    m_pDevice->EnableStateCreationTimings(false);
+
+    StateCreationStageStats Stats;
+    m_pDevice->GetStateCreationStageStats(STATE_CREATION_STAGE_RENDER_STATE_CACHE_HIT, Stats);
+    EXPECT_EQ(Stats.Count, Uint64{1});
+    m_pDevice->GetStateCreationStageStats(STATE_CREATION_STAGE_RENDER_STATE_CACHE_MISS, Stats);
+    EXPECT_EQ(Stats.Count, Uint64{0});
+
+    m_pDevice->ResetStateCreationTimings();
+}
+
+} // namespace
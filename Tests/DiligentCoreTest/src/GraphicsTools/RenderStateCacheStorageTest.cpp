@@ -0,0 +1,268 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "RenderStateCacheStorage.hpp"
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "DataBlobImpl.hpp"
+#include "TempDirectory.hpp"
+
+#if PLATFORM_LINUX
+#    include <sys/wait.h>
+#    include <unistd.h>
+#endif
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+RefCntAutoPtr<IDataBlob> MakeRecordData(Uint32 Id, size_t Size)
+{
+    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create(Size);
+    Uint8*                      pDst  = pData->GetDataPtr<Uint8>();
+    for (size_t i = 0; i < Size; ++i)
+        pDst[i] = static_cast<Uint8>(Id * 131 + i);
+    return RefCntAutoPtr<IDataBlob>{pData};
+}
+
+bool CompareRecordData(const RenderStateCacheStorage::Record& Record, Uint32 Id, size_t Size)
+{
+    if (!Record.pData || Record.pData->GetSize() != Size)
+        return false;
+
+    RefCntAutoPtr<IDataBlob> pRefData = MakeRecordData(Id, Size);
+    return std::memcmp(Record.pData->GetConstDataPtr(), pRefData->GetConstDataPtr(), Size) == 0;
+}
+
+TEST(RenderStateCacheStorageTest, AppendRead)
+{
+    TempDirectory     TmpDir;
+    const std::string FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "AppendRead.cache";
+
+    RenderStateCacheStorage Storage0{FilePath.c_str()};
+    RenderStateCacheStorage Storage1{FilePath.c_str()};
+    EXPECT_EQ(Storage0.GetCommittedSize(), Uint64{0});
+    EXPECT_TRUE(Storage1.ReadNewRecords().empty());
+
+    EXPECT_TRUE(Storage0.Append(MakeRecordData(0, 1000), 7));
+    EXPECT_TRUE(Storage0.Append(MakeRecordData(1, 33), 7));
+    EXPECT_GT(Storage0.GetCommittedSize(), Uint64{1033});
+    EXPECT_EQ(Storage0.GetCommittedSize(), Storage1.GetCommittedSize());
+
+    // Records appended by the storage object are not returned by it
+    EXPECT_TRUE(Storage0.ReadNewRecords().empty());
+
+    {
+        std::vector<RenderStateCacheStorage::Record> Records = Storage1.ReadNewRecords();
+        ASSERT_EQ(Records.size(), size_t{2});
+        EXPECT_TRUE(CompareRecordData(Records[0], 0, 1000));
+        EXPECT_TRUE(CompareRecordData(Records[1], 1, 33));
+        EXPECT_EQ(Records[0].ContentVersion, Uint32{7});
+        EXPECT_LT(Records[0].Offset, Records[1].Offset);
+        // Record data must be 16-byte aligned
+        EXPECT_EQ(reinterpret_cast<size_t>(Records[1].pData->GetConstDataPtr()) % 16, size_t{0});
+    }
+    EXPECT_TRUE(Storage1.ReadNewRecords().empty());
+
+    EXPECT_TRUE(Storage1.Append(MakeRecordData(2, 5000), 8));
+    {
+        std::vector<RenderStateCacheStorage::Record> Records = Storage0.ReadNewRecords();
+        ASSERT_EQ(Records.size(), size_t{1});
+        EXPECT_TRUE(CompareRecordData(Records[0], 2, 5000));
+        EXPECT_EQ(Records[0].ContentVersion, Uint32{8});
+    }
+    EXPECT_TRUE(Storage1.ReadNewRecords().empty());
+
+    // A new storage object reads all records
+    {
+        RenderStateCacheStorage Storage2{FilePath.c_str()};
+
+        std::vector<RenderStateCacheStorage::Record> Records = Storage2.ReadNewRecords();
+        ASSERT_EQ(Records.size(), size_t{3});
+        EXPECT_TRUE(CompareRecordData(Records[0], 0, 1000));
+        EXPECT_TRUE(CompareRecordData(Records[1], 1, 33));
+        EXPECT_TRUE(CompareRecordData(Records[2], 2, 5000));
+    }
+
+    Storage0.Rewind();
+    EXPECT_EQ(Storage0.ReadNewRecords().size(), size_t{3});
+}
+
+TEST(RenderStateCacheStorageTest, IncompleteAppend)
+{
+    TempDirectory     TmpDir;
+    const std::string FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "IncompleteAppend.cache";
+
+    RenderStateCacheStorage Storage0{FilePath.c_str()};
+    EXPECT_TRUE(Storage0.Append(MakeRecordData(0, 100), 0));
+    const Uint64 CommittedSize = Storage0.GetCommittedSize();
+
+    // Simulate a writer that failed before committing the record
+    {
+        FileWrapper File{FilePath.c_str(), EFileAccessMode::Append};
+        ASSERT_TRUE(File);
+        const std::vector<Uint8> Garbage(300, Uint8{0xCD});
+        EXPECT_TRUE(File->Write(Garbage.data(), Garbage.size()));
+    }
+
+    RenderStateCacheStorage Storage1{FilePath.c_str()};
+    EXPECT_EQ(Storage1.ReadNewRecords().size(), size_t{1});
+    EXPECT_EQ(Storage1.GetCommittedSize(), CommittedSize);
+
+    // The next record overwrites the uncommitted data
+    EXPECT_TRUE(Storage1.Append(MakeRecordData(1, 200), 0));
+    std::vector<RenderStateCacheStorage::Record> Records = Storage0.ReadNewRecords();
+    ASSERT_EQ(Records.size(), size_t{1});
+    EXPECT_TRUE(CompareRecordData(Records[0], 1, 200));
+}
+
+TEST(RenderStateCacheStorageTest, ChecksumMismatch)
+{
+    TempDirectory     TmpDir;
+    const std::string FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "ChecksumMismatch.cache";
+
+    Uint64 CorruptOffset = 0;
+    {
+        RenderStateCacheStorage Storage{FilePath.c_str()};
+        EXPECT_TRUE(Storage.Append(MakeRecordData(0, 100), 0));
+        CorruptOffset = Storage.GetCommittedSize() - 64;
+        EXPECT_TRUE(Storage.Append(MakeRecordData(1, 100), 0));
+    }
+
+    // Corrupt the data of the first record
+    {
+        std::vector<Uint8> FileData;
+        ASSERT_TRUE(FileWrapper::ReadWholeFile(FilePath.c_str(), FileData));
+        ASSERT_LT(CorruptOffset, FileData.size());
+        FileData[static_cast<size_t>(CorruptOffset)] ^= 0xFF;
+        ASSERT_TRUE(FileWrapper::WriteFile(FilePath.c_str(), FileData.data(), FileData.size()));
+    }
+
+    RenderStateCacheStorage Storage{FilePath.c_str()};
+
+    std::vector<RenderStateCacheStorage::Record> Records = Storage.ReadNewRecords();
+    ASSERT_EQ(Records.size(), size_t{1});
+    EXPECT_TRUE(CompareRecordData(Records[0], 1, 100));
+}
+
+TEST(RenderStateCacheStorageTest, ConcurrentWriters)
+{
+    TempDirectory     TmpDir;
+    const std::string FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "ConcurrentWriters.cache";
+
+    constexpr Uint32 NumThreads       = 4;
+    constexpr Uint32 NumRecordsPerThr = 16;
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&FilePath, t]() {
+            // Every thread uses its own storage object to emulate separate processes
+            RenderStateCacheStorage Storage{FilePath.c_str()};
+            for (Uint32 i = 0; i < NumRecordsPerThr; ++i)
+            {
+                const Uint32 Id = t * NumRecordsPerThr + i;
+                EXPECT_TRUE(Storage.Append(MakeRecordData(Id, 64 + Id * 3), Id));
+            }
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    RenderStateCacheStorage Storage{FilePath.c_str()};
+
+    std::vector<RenderStateCacheStorage::Record> Records = Storage.ReadNewRecords();
+    ASSERT_EQ(Records.size(), size_t{NumThreads * NumRecordsPerThr});
+
+    std::vector<bool> Found(NumThreads * NumRecordsPerThr);
+    for (const RenderStateCacheStorage::Record& Record : Records)
+    {
+        const Uint32 Id = Record.ContentVersion;
+        ASSERT_LT(Id, Found.size());
+        EXPECT_FALSE(Found[Id]);
+        Found[Id] = true;
+        EXPECT_TRUE(CompareRecordData(Record, Id, 64 + Id * 3));
+    }
+}
+
+#if PLATFORM_LINUX
+TEST(RenderStateCacheStorageTest, MultipleProcesses)
+{
+    TempDirectory     TmpDir;
+    const std::string FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "MultipleProcesses.cache";
+
+    constexpr Uint32 NumProcesses     = 4;
+    constexpr Uint32 NumRecordsPerPrc = 8;
+
+    RenderStateCacheStorage Storage{FilePath.c_str()};
+
+    std::vector<pid_t> Children;
+    for (Uint32 p = 0; p < NumProcesses; ++p)
+    {
+        const pid_t Pid = fork();
+        ASSERT_GE(Pid, 0);
+        if (Pid == 0)
+        {
+            bool Success = true;
+            {
+                RenderStateCacheStorage ChildStorage{FilePath.c_str()};
+                for (Uint32 i = 0; i < NumRecordsPerPrc; ++i)
+                {
+                    const Uint32 Id = p * NumRecordsPerPrc + i;
+                    Success         = ChildStorage.Append(MakeRecordData(Id, 1000 + Id), Id) && Success;
+                }
+            }
+            _exit(Success ? 0 : 1);
+        }
+        Children.push_back(Pid);
+    }
+
+    for (pid_t Pid : Children)
+    {
+        int Status = 0;
+        ASSERT_EQ(waitpid(Pid, &Status, 0), Pid);
+        EXPECT_TRUE(WIFEXITED(Status) && WEXITSTATUS(Status) == 0);
+    }
+
+    std::vector<RenderStateCacheStorage::Record> Records = Storage.ReadNewRecords();
+    ASSERT_EQ(Records.size(), size_t{NumProcesses * NumRecordsPerPrc});
+    for (const RenderStateCacheStorage::Record& Record : Records)
+        EXPECT_TRUE(CompareRecordData(Record, Record.ContentVersion, 1000 + Record.ContentVersion));
+}
+#endif
+
+} // namespace
@@ -0,0 +1,147 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FlagEnum.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Character types may alias anything, so the underlying type must be wider than a byte
+// for the strict aliasing check below to be meaningful.
+enum TEST_FLAGS : Uint32
+{
+    TEST_FLAG_NONE = 0u,
+    TEST_FLAG_A    = 1u << 0u,
+    TEST_FLAG_B    = 1u << 1u,
+    TEST_FLAG_C    = 1u << 2u,
+    TEST_FLAG_ALL  = TEST_FLAG_A | TEST_FLAG_B | TEST_FLAG_C
+};
+DEFINE_FLAG_ENUM_OPERATORS(TEST_FLAGS)
+
+enum class TEST_FLAGS_64 : Uint64
+{
+    None = 0ull,
+    Low  = 1ull << 0ull,
+    High = 1ull << 63ull
+};
+DEFINE_FLAG_ENUM_OPERATORS(TEST_FLAGS_64)
+
+struct FlagsItem
+{
+    const char* Name;
+    TEST_FLAGS  Flags;
+};
+
+// Accumulates flags into a member and derives a value from the result in the constructor.
+// Compound assignment through a reference to the underlying integer type violates strict
+// aliasing, and GCC at -O2 read the member before the stores in this pattern.
+class FlagAccumulator
+{
+public:
+    FlagAccumulator(const FlagsItem* pItems, size_t NumItems)
+    {
+        for (size_t i = 0; i < NumItems; ++i)
+        {
+            m_Flags |= pItems[i].Flags;
+            ++m_NumItems;
+        }
+
+        if (m_Flags & TEST_FLAG_C)
+            m_Category = 2;
+        else if (m_Flags != TEST_FLAG_NONE)
+            m_Category = 1;
+    }
+
+    TEST_FLAGS GetFlags() const { return m_Flags; }
+    int        GetCategory() const { return m_Category; }
+
+private:
+    TEST_FLAGS m_Flags    = TEST_FLAG_NONE;
+    size_t     m_NumItems = 0;
+    int        m_Category = 0;
+};
+
+TEST(Primitives_FlagEnum, BinaryOperators)
+{
+    static_assert((TEST_FLAG_A | TEST_FLAG_B) == 3u, "Unexpected value");
+    static_assert((TEST_FLAG_ALL & TEST_FLAG_B) == TEST_FLAG_B, "Unexpected value");
+    static_assert((TEST_FLAG_ALL ^ TEST_FLAG_B) == (TEST_FLAG_A | TEST_FLAG_C), "Unexpected value");
+    static_assert(static_cast<Uint32>(~TEST_FLAG_A) == 0xFFFFFFFEu, "Unexpected value");
+
+    static_assert((TEST_FLAGS_64::Low | TEST_FLAGS_64::High) != TEST_FLAGS_64::None, "Unexpected value");
+    EXPECT_EQ(static_cast<Uint64>(TEST_FLAGS_64::Low | TEST_FLAGS_64::High), 0x8000000000000001ull);
+    EXPECT_EQ(static_cast<Uint64>(~TEST_FLAGS_64::High), 0x7FFFFFFFFFFFFFFFull);
+}
+
+TEST(Primitives_FlagEnum, CompoundAssignment)
+{
+    TEST_FLAGS Flags = TEST_FLAG_NONE;
+
+    TEST_FLAGS& Ref = (Flags |= TEST_FLAG_A);
+    EXPECT_EQ(&Ref, &Flags);
+    EXPECT_EQ(Flags, TEST_FLAG_A);
+
+    (Flags |= TEST_FLAG_B) |= TEST_FLAG_C;
+    EXPECT_EQ(Flags, TEST_FLAG_ALL);
+
+    Flags &= ~TEST_FLAG_B;
+    EXPECT_EQ(Flags, TEST_FLAG_A | TEST_FLAG_C);
+
+    Flags ^= TEST_FLAG_ALL;
+    EXPECT_EQ(Flags, TEST_FLAG_B);
+
+    TEST_FLAGS_64 Flags64 = TEST_FLAGS_64::None;
+    Flags64 |= TEST_FLAGS_64::High;
+    Flags64 |= TEST_FLAGS_64::Low;
+    Flags64 &= TEST_FLAGS_64::High;
+    EXPECT_EQ(Flags64, TEST_FLAGS_64::High);
+}
+
+TEST(Primitives_FlagEnum, AccumulateIntoMember)
+{
+    const std::vector<FlagsItem> Items = {{"A", TEST_FLAG_A}, {"None", TEST_FLAG_NONE}, {"B", TEST_FLAG_B}, {"C", TEST_FLAG_C}};
+    for (size_t NumItems = 0; NumItems <= Items.size(); ++NumItems)
+    {
+        TEST_FLAGS RefFlags = TEST_FLAG_NONE;
+        for (size_t i = 0; i < NumItems; ++i)
+            RefFlags = RefFlags | Items[i].Flags;
+        const int RefCategory = (RefFlags & TEST_FLAG_C) != 0 ? 2 : (RefFlags != TEST_FLAG_NONE ? 1 : 0);
+
+        // Heap allocation makes the constructor store the flags to memory
+        std::unique_ptr<FlagAccumulator> pAcc{new FlagAccumulator{Items.data(), NumItems}};
+        EXPECT_EQ(pAcc->GetFlags(), RefFlags) << "NumItems: " << NumItems;
+        EXPECT_EQ(pAcc->GetCategory(), RefCategory) << "NumItems: " << NumItems;
+    }
+}
+
+} // namespace
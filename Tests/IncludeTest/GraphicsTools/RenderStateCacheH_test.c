@@ -50,6 +50,12 @@ void TestRenderStateCacheCInterface()
     IRenderStateCache_CreateTilePipelineState(pCache, (TilePipelineStateCreateInfo*)NULL, &pPSO);
     IRenderStateCache_WriteToBlob(pCache, 1234, (IDataBlob**)NULL);
     IRenderStateCache_WriteToStream(pCache, 1234, (IFileStream*)NULL);
+    IRenderStateCache_AppendToStorage(pCache, 1234);
+    IRenderStateCache_RefreshFromStorage(pCache, 1234);
+    IRenderStateCache_SetFrameIndex(pCache, 1234);
+    IRenderStateCache_WriteUsageLog(pCache, (IDataBlob**)NULL);
+    IRenderStateCache_WarmUp(pCache, (RenderStateCacheWarmUpInfo*)NULL);
+    IRenderStateCache_GetWarmUpStats(pCache, (RenderStateCacheWarmUpStats*)NULL);
     IRenderStateCache_Reset(pCache);
     IRenderStateCache_Reload(pCache, NULL, NULL);
     Uint32 Ver = IRenderStateCache_GetContentVersion(pCache);